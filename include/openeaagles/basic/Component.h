@@ -102,6 +102,13 @@ class String;
 //    using the 'components' slot, and the list can be modified with the
 //    addComponent() and processComponents() functions.
 //
+//    processComponents() also caches our child components in a contiguous array,
+//    which is used by updateTC() and updateData() to update the children without
+//    walking (or ref()'ing) the list.  The traversals are counted, and the
+//    array that's replaced by the next call to processComponents(), along with
+//    its list, is retired until there are no traversals in progress, so a
+//    traversal on this or another thread can finish with the old children.
+//
 //       Component* container()
 //          Pointer to our container (i.e., we are a component of our container).
 //
@@ -407,6 +414,12 @@ protected:
    virtual bool shutdownNotification();     // We're shutting down
    virtual bool onEventReset();             // Reset event handler
 
+   // Called by updateTC() and updateData() to update each of our child
+   // components (or only the selected one) and our slot event logger;
+   // derived classes can override these to instrument the updates
+   virtual void updateChildTC(Component* const child, const LCreal dt);
+   virtual void updateChildData(Component* const child, const LCreal dt);
+
    virtual bool setSelectionName(const Object* const s); // Name (or number) of component to select
    virtual bool select(const String* const name);        // Select component by name
    virtual bool select(const Number* const num);         // Select component by number
@@ -426,7 +439,23 @@ protected:
       );
 
 private:
+   // Retired child component array (see processComponents())
+   struct RetiredChildren {
+      Component** children;      // Zero terminated child array
+      PairStream* list;          // Its component list (ref()'d)
+      RetiredChildren* next;
+   };
+
+   void swapComponents(PairStream* const newList);
+   Component** beginTraversal();
+   void endTraversal();
+   void freeRetiredChildren(const bool all);
+
    SPtr<PairStream> components; // Child components 
+   Component** children;        // Cached child components (zero terminated; in 'components' order)
+   RetiredChildren* retired;    // Retired child arrays (newest first)
+   long traversals;             // Number of traversals of 'children' in progress
+   long childLock;              // Semaphore for 'children' and 'retired'
    Component* containerPtr;     // We are a component of this container
 
    Component* selected;         // Selected child (process only this one)
@@ -2,20 +2,31 @@
 // Class: Factory
 //
 // Description: Class factory
+//
+//    The factory names of the basic classes are kept in a hash table.  User
+//    libraries can register their own classes, so that they're constructed by
+//    createObj() without adding them to an application's factory, using
+//    registerObj() (e.g., "Basic::Factory::registerObj<MyClass>();").  The
+//    factory names of the basic classes can not be replaced, and the first
+//    registration of a name is used.
 //------------------------------------------------------------------------------
 #ifndef __Eaagles_Basic_Factory_H__
 #define __Eaagles_Basic_Factory_H__
 
+#include "openeaagles/basic/FactoryTable.h"
+
 namespace Eaagles {
 namespace Basic {
 
-class Object;
-
 class Factory
 {
 public:
    static Object* createObj(const char* name);
 
+   // Registers a user factory name; returns true if registered
+   static bool registerObj(const char* const name, FactoryTable::CreateFunc func);
+   template <class T> static bool registerObj()  { return registerObj(T::getFactoryName(), &FactoryTable::newObject<T>); }
+
 protected:
    Factory();   // prevent object creation
 };
@@ -0,0 +1,107 @@
+//------------------------------------------------------------------------------
+// Class: FactoryTable
+//------------------------------------------------------------------------------
+#ifndef __Eaagles_Basic_FactoryTable_H__
+#define __Eaagles_Basic_FactoryTable_H__
+
+namespace Eaagles {
+namespace Basic {
+
+class Object;
+
+//------------------------------------------------------------------------------
+// Class: FactoryTable
+// Description: Hash table of factory names and the functions that construct
+//              the objects, which is used by the libraries' Factory classes to
+//              construct objects by factory name without a chain of string
+//              compares.
+//
+//    A table is filled by its 'init' function, which adds each class using
+//    add<T>(), when the table is first used.  (Tables are usually static
+//    objects, which are constructed before the classes' factory names are
+//    guaranteed to be initialized.)  The init function fills a private
+//    table, which is then moved into this table while it's locked, so
+//    other threads never see a partially filled table.
+//
+// Example:
+//
+//    static void addClasses(Basic::FactoryTable& table)
+//    {
+//       table.add<Foo>();
+//       table.add<Bar>();
+//    }
+//
+//    static Basic::FactoryTable factoryTable(addClasses);
+//
+//    Basic::Object* Factory::createObj(const char* name)
+//    {
+//       return factoryTable.createObj(name);
+//    }
+//
+// Public member functions:
+//
+//    Object* createObj(const char* const name)
+//       Returns a new object of factory name 'name', or zero if the name
+//       isn't in the table.
+//
+//    CreateFunc find(const char* const name)
+//       Returns the create function of factory name 'name', or zero.
+//
+//    bool add(const char* const name, CreateFunc func)
+//    bool add<T>()
+//       Adds the factory name 'name', or class T's factory name, to the table.
+//       Returns false if the name is already in the table (i.e., the first
+//       function added for a name is used).
+//
+//    unsigned int entries()
+//       Number of factory names in the table.
+//
+//    static Object* newObject<T>()
+//       Create function that constructs a default object of class T.
+//
+//------------------------------------------------------------------------------
+class FactoryTable
+{
+public:
+   typedef Object* (*CreateFunc)();                   // Constructs a new object
+   typedef void (*InitFunc)(FactoryTable& table);     // Adds the classes to a table
+
+public:
+   FactoryTable(InitFunc init = 0);
+   ~FactoryTable();
+
+   Object* createObj(const char* const name);
+   CreateFunc find(const char* const name);
+   bool add(const char* const name, CreateFunc func);
+   unsigned int entries();
+
+   template <class T> bool add()             { return add(T::getFactoryName(), &FactoryTable::newObject<T>); }
+   template <class T> static Object* newObject()  { return new T(); }
+
+private:
+   FactoryTable(const FactoryTable&);              // can not be copied
+   FactoryTable& operator=(const FactoryTable&);
+
+   struct Entry {
+      char* name;             // Factory name
+      unsigned int hash;      // Hash of the factory name
+      CreateFunc func;        // Create function
+   };
+
+   void initialize();                                 // Fills the table (first use)
+   void take(FactoryTable& src);                      // Moves 'src' entries to our empty table
+   bool insert(const char* const name, CreateFunc func);
+   const Entry* lookup(const char* const name) const;
+
+   Entry* table;              // Hash table
+   unsigned int size;         // Size of the hash table (power of two)
+   unsigned int n;            // Number of factory names
+   InitFunc initFunc;         // Fills the table
+   long initialized;          // Table has been filled (atomic flag)
+   long lock;                 // Table semaphore
+};
+
+} // End Basic namespace
+} // End Eaagles namespace
+
+#endif
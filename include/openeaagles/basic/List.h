@@ -5,6 +5,7 @@
 #define __Eaagles_Basic_List_H__
 
 #include "openeaagles/basic/Object.h"
+#include <cstddef>
 
 namespace Eaagles {
 namespace Basic {
@@ -114,6 +115,19 @@ namespace Basic {
 //          Returns the item's value: a pointer to the Object.
 //
 //
+// Item storage and indexing:
+//
+//     List::Items are allocated from a shared pool of item slabs (see
+//     Item::operator new()), so 'new List::Item' and 'delete item' reuse
+//     the items that were freed by other lists instead of the heap.
+//
+//     Large lists (see MIN_INDEX_ENTRIES) keep an index of their items, which
+//     is built by the second getPosition() after the list was changed, so that
+//     the following getPosition() calls are O(1) until the list is changed again.
+//     Derived classes (e.g., PairStream) can use getChangeCount() to keep their
+//     own indexes.
+//
+//
 //  Example of looping through the list:
 //
 //      List* list = <some list>
@@ -133,6 +147,10 @@ public:
    struct Item {
       Item() { next = 0; previous = 0; value = 0; }
 
+      // Pooled storage
+      static void* operator new(size_t size);
+      static void operator delete(void* p, size_t size);
+
       Item* getNext()                  { return next; }
       const Item* getNext() const      { return next; }
 
@@ -192,14 +210,30 @@ public:
    // Object interface
    virtual bool isValid() const;
 
+protected:
+   static const unsigned int MIN_INDEX_ENTRIES = 32;  // Min number of entries for an index
+
+   // Change counter; incremented (never zero) each time the list is changed
+   unsigned int getChangeCount() const     { return changeCnt; }
+
 private:
+   void initData();
+   void changed()                          { if (++changeCnt == 0) changeCnt = 1; }
    const Object* getPosition1(const unsigned int n) const;
+   void buildPosIndex() const;
 
    Item* headP;            // Pointer to head object
    Item* tailP;            // Pointer to last object
 
    unsigned int num;       // Number of list objects
-
+   unsigned int changeCnt; // Change counter
+
+   // Position index (see getPosition1())
+   mutable Item** posIndex;            // Items in list order
+   mutable unsigned int maxPosIndex;   // Size of the 'posIndex' array
+   mutable unsigned int posIndexCnt;   // Change count when the index was built (zero if never)
+   mutable unsigned int posLookupCnt;  // Change count at the last getPosition()
+   mutable long indexLock;             // Index semaphore
 };
 
 } // End Basic namespace
@@ -270,10 +270,20 @@ namespace Basic {
 //       Use put() to add items and get() to remove items.  Use the constructor's
 //       'qsize' parameter to set the size of the queue.  
 //
+//    QSpscQueue, QMpscQueue -- Lock-free Quick Queues (see QSpscQueue.h and QMpscQueue.h)
+//       Same as QQueue, but without the semaphore, for a single producer thread
+//       (QSpscQueue) or any number of producer threads (QMpscQueue), and a single
+//       consumer thread.
+//
 //    QStack -- Quick Stack (see QStack.h)
 //       Use push() to add items and pop() to remove items.  Use the constructor's
 //       'ssize' parameter to set the size of the stack.
 //
+//    QPool -- Quick (recycling) object Pool (see QPool.h)
+//       Use get() to get a free object and release() to return an object to the
+//       pool; use recycle() to free the objects that are no longer referenced.
+//       Use the constructor's 'psize' parameter to set the size of the pool.
+//
 //
 // Exception:
 //    Exception
@@ -339,6 +349,7 @@ class Object
    protected: virtual bool setSlotByIndex(const int slotindex, Object* const obj);
    protected: virtual Object* getSlotByIndex(const int slotindex);
    public: bool setSlotByName(const char* const slotname, Object* const obj);
+   public: bool setSlotAtIndex(const int slotindex, Object* const obj);    // SlotTable index: 1 .. n
    public: Object* getSlotByName(const char* const slotname);
    public: const char* slotIndex2Name(const int slotindex) const;
    public: int slotName2Index(const char* const slotname) const;
@@ -348,6 +359,7 @@ class Object
       const unsigned int classIndex;   // Registered class index
       const char* const cname;         // class name from 'type_info'
       const char* const fname;         // class form name
+      const unsigned int fhash;        // hash of the class form name
       const SlotTable* const st;       // Pointer to the SlotTable
       const _Static* const bstatic;    // Pointer to the base class _Static object
       int count;                       // NCurrent of instances
@@ -359,6 +371,9 @@ class Object
    private: static struct _Static _static;
    protected: static const _Static* getStatic(); //Get the _Static member
 
+   // True if 'name' is the factory name of class 'p' or one of its base classes
+   protected: static bool findFactoryName(const _Static* const p, const char name[]);
+
 public:
    // Standard message types
    static const unsigned short MSG_ERROR   = 0x0001;  // Error messages; ALWAYS ENABLED (use std::cerr)
@@ -390,9 +405,16 @@ public:
    // QQueue -- Quick queue
    #include "openeaagles/basic/QQueue.h"
 
+   // QSpscQueue, QMpscQueue -- Lock-free quick queues
+   #include "openeaagles/basic/QSpscQueue.h"
+   #include "openeaagles/basic/QMpscQueue.h"
+
    // QStack -- Quick stack
    #include "openeaagles/basic/QStack.h"
 
+   // QPool -- Quick (recycling) object pool
+   #include "openeaagles/basic/QPool.h"
+
    // Output the list of known Eaagles classes
    static void writeClassList(std::ostream& sout);
 
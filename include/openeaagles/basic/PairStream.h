@@ -34,6 +34,11 @@ class Identifier;
 //   Finds a pair by name (const version)
 //     const Pair* findByName(const char* const slotname) const;   
 //
+//   (Large streams keep an index of their pairs sorted by name, which is
+//   built by the second findByName() since the stream was last changed (see
+//   List), so the following findByName() calls are O(log n).  The pairs' slot
+//   names must not be changed while they're on the stream.)
+//
 //   Finds the name associated with an object
 //     const Identifier* findName(const Object* const obj) const;
 //
@@ -110,6 +115,26 @@ public:
       return List::remove(static_cast<Object*>(pair1));
    }
 
+private:
+   // Name index entry
+   struct NameEntry {
+      const char* name;       // Slot name
+      unsigned int pos;       // Position in the stream
+      const Pair* pair;       // The pair
+   };
+
+   static bool nameEntryLess(const NameEntry& a, const NameEntry& b);
+
+   void initData();
+   const Pair* findByName1(const char* const slotname) const;
+   void buildNameIndex() const;
+
+   mutable NameEntry* nameIndex;       // Pairs sorted by name (and position)
+   mutable unsigned int nNameIndex;    // Number of entries in the index
+   mutable unsigned int maxNameIndex;  // Size of the 'nameIndex' array
+   mutable unsigned int nameIndexCnt;  // Change count when the index was built (zero if never)
+   mutable unsigned int nameLookupCnt; // Change count at the last findByName()
+   mutable long nameLock;              // Index semaphore
 };
 
 } // End Basic namespace
@@ -13,6 +13,12 @@ namespace Eaagles {
       class Object;
       typedef Object* (*ParserFormFunc)(const char* formname);
       extern Object* lcParser(const char* filename, ParserFormFunc func, int* numErrors = 0);
+
+      // Compiled (binary) description files -- see ParserCache.cpp
+      extern bool lcCompile(const char* filename, const char* compiledFilename, ParserFormFunc func, int* numErrors = 0);
+      extern Object* lcLoadCompiled(const char* compiledFilename, ParserFormFunc func, int* numErrors = 0);
+      extern bool lcIsCompiledCurrent(const char* compiledFilename);
+      extern Object* lcParserCached(const char* filename, const char* compiledFilename, ParserFormFunc func, int* numErrors = 0, const char* sourceFilename = 0);
    }
 }
 
@@ -0,0 +1,124 @@
+//------------------------------------------------------------------------------
+// Template QMpscQueue<T>
+//      and Eaagles::Basic::Object::QMpscQueue<T>
+//
+// Description: Lock-free, multi-producer/single-consumer queue of items of type T
+//
+// Notes:
+//    1) Use the constructor's 'qsize' parameter to set the max size of the queue.
+//    2) Use put() or putN() to add items and get() or getN() to remove items.
+//       Any number of threads may put items at the same time; the items of
+//       one putN() call are kept together and in order.
+//    3) Only one thread at a time may get items (the consumer).  Use QQueue
+//       when there are several consumers (e.g., a producer that removes the
+//       oldest items when the queue is full).
+//    4) Each producer claims its slots with a compare-and-swap of the in
+//       count, then copies its items into the slots and marks them as ready.
+//       The consumer stops at the first slot that isn't ready yet, so the
+//       items are always removed in the order that their slots were claimed.
+//    5) clear() and get() must be called by the consumer; clear() removes the
+//       ready items.  entries() includes the items that are still being put.
+//
+// Examples:
+//    QMpscQueue<int>* q1 = new QMpscQueue<int>(100); // queue size 100 items
+//    q1->put(1);           // puts 1 on the queue (any thread)
+//    q1->put(2);           // puts 2 on the queue (any thread)
+//    int i = q1->get();    // i is equal to 1 (consumer)
+//    int j = q1->get();    // j is equal to 2 (consumer)
+//------------------------------------------------------------------------------
+template <class T> class QMpscQueue {
+public:
+   QMpscQueue(const unsigned int qsize) : SIZE(qsize), in(0), out(0)     { allocate(); }
+   QMpscQueue(const QMpscQueue<T> &q1) : SIZE(q1.SIZE), in(0), out(0)    { allocate(); }
+   ~QMpscQueue()                                                         { delete[] queue; delete[] ready; }
+
+   bool isEmpty() const           { return (entries() == 0); }
+   bool isNotEmpty() const        { return (entries() != 0); }
+   unsigned int entries() const {
+      const unsigned long o = static_cast<unsigned long>(lcAtomicLoad(out));
+      return static_cast<unsigned int>(static_cast<unsigned long>(lcAtomicLoad(in)) - o);
+   }
+   bool isFull() const            { return (entries() >= SIZE); }
+   bool isNotFull() const         { return (entries() < SIZE); }
+
+   // Puts an item at the back of the queue
+   bool put(T item) {
+      return (putN(&item, 1) == 1);
+   }
+
+   // Puts up to 'num' items at the back of the queue; returns the number of items put
+   unsigned int putN(const T items[], const unsigned int num) {
+      // Claim our slots
+      unsigned long i0 = 0;
+      unsigned int k = 0;
+      bool claimed = false;
+      while (!claimed) {
+         // (load 'out' first, so it's never ahead of 'in')
+         const unsigned long o = static_cast<unsigned long>(lcAtomicLoad(out));
+         const long i = lcAtomicLoad(in);
+         const unsigned long used = static_cast<unsigned long>(i) - o;
+         if (num == 0 || used >= SIZE) return 0;
+         k = (num < (SIZE - used) ? num : static_cast<unsigned int>(SIZE - used));
+         i0 = static_cast<unsigned long>(i);
+         claimed = lcAtomicCompareAndSwap(in, i, static_cast<long>(i0 + k));
+      }
+
+      // Fill them and mark them as ready (the ready value is the slot's count plus one)
+      for (unsigned int j = 0; j < k; j++) {
+         const unsigned long cnt = i0 + j;
+         queue[cnt & mask] = items[j];
+         lcAtomicStore(ready[cnt & mask], static_cast<long>(cnt + 1));
+      }
+      return k;
+   }
+
+   // Gets an item from the front of the queue (consumer)
+   T get() {
+      T p = 0;
+      getN(&p, 1);
+      return p;
+   }
+
+   // Gets up to 'max' ready items from the front of the queue; returns the number of items (consumer)
+   unsigned int getN(T items[], const unsigned int max) {
+      unsigned long cnt = static_cast<unsigned long>(out);
+      unsigned int k = 0;
+      while (k < max && lcAtomicLoad(ready[cnt & mask]) == static_cast<long>(cnt + 1)) {
+         items[k++] = queue[cnt & mask];
+         cnt++;
+      }
+      // Release the emptied slots to the producers
+      if (k > 0) lcAtomicStore(out, static_cast<long>(cnt));
+      return k;
+   }
+
+   // Clears the (ready) items from the queue (consumer)
+   void clear() {
+      T p = 0;
+      while (getN(&p, 1) > 0) {}
+   }
+
+private:
+   QMpscQueue<T>& operator=(QMpscQueue<T>&) { return *this; }
+
+   // Allocates the slots: the number of slots is a power of two, so the
+   // slot index of a count is still correct when the count wraps around.
+   void allocate() {
+      unsigned long n = 1;
+      while (n < SIZE) n *= 2;
+      mask = n - 1;
+      queue = new T[n];
+      ready = new long[n];
+      for (unsigned long j = 0; j < n; j++) {
+         ready[j] = 0;
+      }
+   }
+
+   T* queue;                // The Queue [ mask+1 ]
+   long* ready;             // Count (plus one) of each slot's item, once it's ready
+   const unsigned int SIZE; // Max size of the queue
+   unsigned long mask;      // Slot index mask (number of slots minus one)
+   long in;                 // In (put) count; claimed by the producers
+   char pad[64];            // Keeps 'in' and 'out' on separate cache lines
+   long out;                // Out (get) count; written by the consumer only
+};
@@ -0,0 +1,160 @@
+//------------------------------------------------------------------------------
+// Template QPool<T>
+//      and Eaagles::Basic::Object::QPool<T>
+//
+// Description: Pool of recycled objects of type T, where T is an Object class
+//              with a clear() function.
+//
+// Notes:
+//    1) Use the constructor's 'psize' parameter to set the max number of objects
+//       that are held (free and in-use) by the pool.  setSize() changes the max
+//       size; the free objects that no longer fit are freed (unref()'d).
+//    2) get() returns a free object, or zero if there are no free objects (a
+//       miss), in which case the caller creates a new object.
+//    3) release() returns an object to the pool, which takes over the caller's
+//       reference.  If no one else is referencing the object then it's cleared
+//       and freed, otherwise it's held 'in-use' until recycle() finds that the
+//       other references have been released.  If the pool is full then the
+//       object is simply unref()'d (dropped).
+//    4) recycle() clears and frees the in-use objects that are no longer being
+//       referenced by others; call it once per frame.
+//    5) T::clear() must return the object to its newly constructed state; it's
+//       called while the pool is locked, so it must not use the pool.
+//    6) get(), release(), recycle(), clear() and setSize() are internally protected
+//       by a semaphore.  The hit, miss, recycled and dropped counts can be used to
+//       size the pool.
+//
+// Examples:
+//    QPool<Emission>* p1 = new QPool<Emission>(100); // pool size 100 objects
+//    Emission* em = p1->get();       // get a free emission
+//    if (em == 0) em = new Emission(); // or create a new one
+//    ...                             // use (send) the emission
+//    p1->release(em);                // return it; the pool has our reference
+//    ...
+//    p1->recycle();                  // once per frame
+//------------------------------------------------------------------------------
+template <class T> class QPool {
+public:
+   QPool(const unsigned int psize) : SIZE(psize), nFree(0), nInUse(0), semaphore(0)   { pool = new T*[SIZE]; resetStats(); }
+   QPool(const QPool<T> &p1) : SIZE(p1.getSize()), nFree(0), nInUse(0), semaphore(0)  { pool = new T*[SIZE]; resetStats(); }
+   ~QPool()                                                                            { clear(); delete[] pool; }
+
+   unsigned int getSize() const       { return SIZE; }        // Max number of objects
+   unsigned int getNumFree() const    { return nFree; }       // Number of free objects
+   unsigned int getNumInUse() const   { return nInUse; }      // Number of in-use objects
+
+   // Statistics
+   unsigned int getHits() const       { return hits; }        // get() returned a free object
+   unsigned int getMisses() const     { return misses; }      // get() returned zero
+   unsigned int getRecycled() const   { return recycled; }    // Objects cleared and freed
+   unsigned int getDropped() const    { return dropped; }     // Objects unref()'d because the pool was full
+   void resetStats()                  { hits = 0; misses = 0; recycled = 0; dropped = 0; }
+
+   // Gets a free object, or zero if there are none
+   T* get() {
+      lcLock( semaphore );
+      T* p = 0;
+      if (nFree > 0) {
+         p = pool[--nFree];
+         hits++;
+      }
+      else misses++;
+      lcUnlock( semaphore );
+      return p;
+   }
+
+   // Returns an object (and the caller's reference) to the pool
+   void release(T* const p) {
+      if (p == 0) return;
+      const bool unused = (p->getRefCount() <= 1);
+      if (unused) p->clear();
+      bool held = false;
+      lcLock( semaphore );
+      if ((nFree + nInUse) < SIZE) {
+         if (unused) {
+            pool[nFree++] = p;
+            recycled++;
+         }
+         else {
+            // In-use objects are stored from the top of the array
+            pool[SIZE - (++nInUse)] = p;
+         }
+         held = true;
+      }
+      else dropped++;
+      lcUnlock( semaphore );
+      if (!held) p->unref();
+   }
+
+   // Clears and frees the in-use objects that are no longer referenced by others
+   void recycle() {
+      lcLock( semaphore );
+      unsigned int i = SIZE - nInUse;
+      while (i < SIZE) {
+         T* p = pool[i];
+         if (p->getRefCount() <= 1) {
+            p->clear();
+            // Replace it with the first (already checked) in-use object
+            pool[i] = pool[SIZE - nInUse];
+            nInUse--;
+            pool[nFree++] = p;
+            recycled++;
+         }
+         i++;
+      }
+      lcUnlock( semaphore );
+   }
+
+   // Unref()'s all objects
+   void clear() {
+      lcLock( semaphore );
+      while (nFree > 0) pool[--nFree]->unref();
+      while (nInUse > 0) pool[SIZE - (nInUse--)]->unref();
+      lcUnlock( semaphore );
+   }
+
+   // Sets the max number of objects; the in-use objects are kept first, then
+   // as many free objects as still fit, and the others are unref()'d.
+   void setSize(const unsigned int psize) {
+      T** newPool = new T*[psize];
+      lcLock( semaphore );
+      T** oldPool = pool;
+      const unsigned int oldSize = SIZE;
+      const unsigned int oldFree = nFree;
+      const unsigned int oldInUse = nInUse;
+      pool = newPool;
+      SIZE = psize;
+      const unsigned int keepInUse = (oldInUse < SIZE ? oldInUse : SIZE);
+      const unsigned int keepFree = (oldFree < (SIZE - keepInUse) ? oldFree : (SIZE - keepInUse));
+      nFree = 0;
+      nInUse = 0;
+      unsigned int nDrop = 0;
+      for (unsigned int i = 0; i < oldFree; i++) {
+         if (nFree < keepFree) pool[nFree++] = oldPool[i];
+         else oldPool[nDrop++] = oldPool[i];
+      }
+      for (unsigned int i = oldSize - oldInUse; i < oldSize; i++) {
+         if (nInUse < keepInUse) pool[SIZE - (++nInUse)] = oldPool[i];
+         else oldPool[nDrop++] = oldPool[i];
+      }
+      dropped += nDrop;
+      lcUnlock( semaphore );
+
+      // (the dropped objects were moved to the front of the old array)
+      for (unsigned int i = 0; i < nDrop; i++) oldPool[i]->unref();
+      delete[] oldPool;
+   }
+
+private:
+   QPool<T>& operator=(QPool<T>&) { return *this; }
+   T** pool;                 // The pool: free objects [ 0 .. nFree-1 ] and
+                             //    in-use objects [ SIZE-nInUse .. SIZE-1 ]
+   unsigned int SIZE;        // Max number of objects
+   unsigned int nFree;       // Number of free objects
+   unsigned int nInUse;      // Number of in-use objects
+   unsigned int hits;        // Number of get() calls that returned an object
+   unsigned int misses;      // Number of get() calls that returned zero
+   unsigned int recycled;    // Number of objects cleared and freed
+   unsigned int dropped;     // Number of objects dropped (pool full)
+   mutable long semaphore;   // get(), release(), recycle(), clear() semaphore
+};
@@ -6,8 +6,10 @@
 //
 // Notes:
 //    1) Use the constructor's 'qsize' parameter to set the max size of the queue.
-//    2) Use put() to add items and get() to remove items.
-//    3) put(), get(), peek() and clear() are internally protected by a semaphore
+//    2) Use put() to add items and get() to remove items, or use putN() and
+//       getN() to add or remove several items with one semaphore lock.
+//    3) put(), putN(), get(), getN(), peek() and clear() are internally protected
+//       by a semaphore (see QSpscQueue and QMpscQueue for lock-free queues)
 //
 // Examples:
 //    QQueue<int>* q1 = new QQueue<int>(100); // queue size 100 items
@@ -43,6 +45,36 @@ public:
       return ok;
    }
 
+   // Puts up to 'num' items at the back of the queue; returns the number of items put
+   unsigned int putN(const T items[], const unsigned int num) {
+      lcLock( semaphore );
+      unsigned int i = 0;
+      while (i < num && n < SIZE) {
+         queue[in++] = items[i++];
+         n++;
+         if (in >= SIZE) in = 0;
+      }
+      lcUnlock( semaphore );
+      return i;
+   }
+
+   // Gets up to 'max' items from the front of the queue; returns the number of items
+   unsigned int getN(T items[], const unsigned int max) {
+      lcLock( semaphore );
+      unsigned int i = 0;
+      while (i < max && n > 0) {
+         if (in >= n) {
+            items[i++] = queue[in - n];
+         }
+         else {
+            items[i++] = queue[SIZE + in - n];
+         }
+         n--;
+      }
+      lcUnlock( semaphore );
+      return i;
+   }
+
    // Gets an item from the front of the queue
    T get() {
       lcLock( semaphore );
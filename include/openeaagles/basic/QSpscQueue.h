@@ -0,0 +1,97 @@
+//------------------------------------------------------------------------------
+// Template QSpscQueue<T>
+//      and Eaagles::Basic::Object::QSpscQueue<T>
+//
+// Description: Lock-free, single-producer/single-consumer queue of items of type T
+//
+// Notes:
+//    1) Use the constructor's 'qsize' parameter to set the max size of the queue.
+//    2) Use put() or putN() to add items and get() or getN() to remove items;
+//       putN() and getN() add or remove several items with one index update.
+//    3) Only one thread at a time may put items (the producer), and only one
+//       thread at a time may get items (the consumer); the producer and the
+//       consumer can be different threads.  For example, a sensor that puts
+//       items during its player's time-critical phase, and gets them in a later
+//       phase, even when the player is moved to another T/C thread between the
+//       frames.  Use QMpscQueue when there are several producers, or QQueue
+//       otherwise.
+//    4) clear() and get() must be called by the consumer.  entries(), isEmpty()
+//       and isFull() are exact only for the producer and the consumer.
+//
+// Examples:
+//    QSpscQueue<int>* q1 = new QSpscQueue<int>(100); // queue size 100 items
+//    q1->put(1);           // puts 1 on the queue (producer)
+//    q1->put(2);           // puts 2 on the queue (producer)
+//    int i = q1->get();    // i is equal to 1 (consumer)
+//    int j = q1->get();    // j is equal to 2 (consumer)
+//------------------------------------------------------------------------------
+template <class T> class QSpscQueue {
+public:
+   QSpscQueue(const unsigned int qsize) : SIZE(qsize), in(0), out(0)     { queue = new T[SIZE+1]; }
+   QSpscQueue(const QSpscQueue<T> &q1) : SIZE(q1.SIZE), in(0), out(0)    { queue = new T[SIZE+1]; }
+   ~QSpscQueue()                                                         { delete[] queue; }
+
+   bool isEmpty() const           { return (entries() == 0); }
+   bool isNotEmpty() const        { return (entries() != 0); }
+   unsigned int entries() const {
+      const long i = lcAtomicLoad(in);
+      const long o = lcAtomicLoad(out);
+      return static_cast<unsigned int>(i >= o ? (i - o) : (i + SIZE + 1 - o));
+   }
+   bool isFull() const            { return (entries() >= SIZE); }
+   bool isNotFull() const         { return (entries() < SIZE); }
+
+   // Puts an item at the back of the queue (producer)
+   bool put(T item) {
+      return (putN(&item, 1) == 1);
+   }
+
+   // Puts up to 'num' items at the back of the queue; returns the number of items put (producer)
+   unsigned int putN(const T items[], const unsigned int num) {
+      long i = in;
+      const long o = lcAtomicLoad(out);
+      unsigned int space = static_cast<unsigned int>(o > i ? (o - i - 1) : (SIZE - i + o));
+      unsigned int k = 0;
+      while (k < num && k < space) {
+         queue[i++] = items[k++];
+         if (i > static_cast<long>(SIZE)) i = 0;
+      }
+      // Release the new items to the consumer
+      if (k > 0) lcAtomicStore(in, i);
+      return k;
+   }
+
+   // Gets an item from the front of the queue (consumer)
+   T get() {
+      T p = 0;
+      getN(&p, 1);
+      return p;
+   }
+
+   // Gets up to 'max' items from the front of the queue; returns the number of items (consumer)
+   unsigned int getN(T items[], const unsigned int max) {
+      long o = out;
+      const long i = lcAtomicLoad(in);
+      unsigned int k = 0;
+      while (k < max && o != i) {
+         items[k++] = queue[o++];
+         if (o > static_cast<long>(SIZE)) o = 0;
+      }
+      // Release the emptied slots to the producer
+      if (k > 0) lcAtomicStore(out, o);
+      return k;
+   }
+
+   // Clears the queue (consumer)
+   void clear() {
+      lcAtomicStore(out, lcAtomicLoad(in));
+   }
+
+private:
+   QSpscQueue<T>& operator=(QSpscQueue<T>&) { return *this; }
+   T* queue;                // The Queue [ SIZE+1 ]; one slot is always empty
+   const unsigned int SIZE; // Max size of the queue
+   long in;                 // In (put) index; written by the producer only
+   char pad[64];            // Keeps 'in' and 'out' on separate cache lines
+   long out;                // Out (get) index; written by the consumer only
+};
@@ -66,9 +66,37 @@ class Number;
 // Class:  Rng
 // Description:  Random Number Generator
 //
+// Notes:
+//    1) By default, all Rng objects draw from one Mersenne Twister state, which
+//    is shared by all instances and is not thread safe.
+//
+//    2) Counter-based streams: setStream() (or the 'stream' and 'streamSeed'
+//    slots) switches this object to its own Philox4x32-10 stream, which is
+//    derived from the (seed, stream ID) pair only.  Each player or component
+//    can use its own stream ID (e.g., its player ID), so its numbers are the
+//    same no matter which thread draws them or how many threads are used.
+//    Different stream IDs are independent streams of 2^66 numbers each, and
+//    setStreamPosition() jumps to any position in the stream.
+//
+//    3) A copy (clone) of an Rng that's using a counter-based stream doesn't
+//    continue its stream; the copy draws from a new substream, which is derived
+//    from the original's stream and the number of copies already made of the
+//    original.  The copies of an Rng are the same streams if they're made in the
+//    same order, no matter which threads later draw from them, but copies of
+//    the same Rng must not be made by more than one thread at a time.  Use
+//    setStream() to give a copy a specific stream instead.
+//
+//    4) The fillInt32() and fillHalfOpen() functions fill arrays with the same
+//    numbers as repeated calls to drawInt32() and drawHalfOpen(), and drawN()
+//    fills an array using the distribution's draw().
+//
 // Factory name: Rng
 // Slots:
-//    seed      <Number>  ! seed (default: 5489UL first instance only)
+//    seed       <Number>  ! seed (default: 5489UL first instance only)
+//    stream     <Number>  ! counter-based stream ID; enables the counter-based stream
+//                         ! (default: shared Mersenne Twister state)
+//    streamSeed <Number>  ! counter-based stream seed; enables the counter-based
+//                         ! stream (default: 5489)
 //------------------------------------------------------------------------------
 class Rng : public Object
 {
@@ -106,15 +134,41 @@ public:
    void seed(unsigned int);                  // seed with 32 bit integer
    void seed(const unsigned int*, int size); // seed with array
 
+   //-----------------------------------------------------------------
+   // Counter-based stream functions
+   //-----------------------------------------------------------------
+   void setStream(const unsigned int seed, const unsigned int id); // use stream 'id' of 'seed'
+   void setStreamPosition(const LCuint64 pos);  // jump to number 'pos' of the stream
+   bool isStreamEnabled() const;                // using a counter-based stream?
+   unsigned int getStreamSeed() const;          // counter-based stream seed
+   unsigned int getStreamId() const;            // counter-based stream ID
+   LCuint64 getSubstream() const;               // substream of a copy (zero if not a copy)
+
+   //-----------------------------------------------------------------
+   // philox() -- Philox4x32-10 counter-based generator; computes the
+   // four random numbers, 'out', of counter 'ctr' and key 'key'
+   //-----------------------------------------------------------------
+   static void philox(const unsigned int ctr[4], const unsigned int key[2], unsigned int out[4]);
+
    //-----------------------------------------------------------------
    // drawInt32() -- generate 32 bit random integer
    //-----------------------------------------------------------------
    unsigned int drawInt32();
+
+   //-----------------------------------------------------------------
+   // fillInt32() -- fills 'v' with 'num' 32 bit random integers
+   //-----------------------------------------------------------------
+   void fillInt32(unsigned int* const v, const unsigned int num);
   
    //-----------------------------------------------------------------
    // draw() -- this will be defined in the distribution classes
    //-----------------------------------------------------------------
    virtual double draw();
+
+   //-----------------------------------------------------------------
+   // drawN() -- fills 'v' with 'num' draw()s
+   //-----------------------------------------------------------------
+   virtual void drawN(double* const v, const unsigned int num);
   
    //-----------------------------------------------------------------
    // drawClosed() -- generates double floating point numbers in the 
@@ -139,6 +193,11 @@ public:
    // 4294967296 = 2^32
    //-----------------------------------------------------------------
    double drawHalfOpen();
+
+   //-----------------------------------------------------------------
+   // fillHalfOpen() -- fills 'v' with 'num' drawHalfOpen() numbers
+   //-----------------------------------------------------------------
+   void fillHalfOpen(double* const v, const unsigned int num);
   
    //-----------------------------------------------------------------
    // drawHalfOpen53() -- generates 53 bit resolution doubles in the 
@@ -243,8 +302,11 @@ public:
    // Slot functions
    //----
    bool setSlotSeed(const Number* const);
+   bool setSlotStream(const Number* const);
+   bool setSlotStreamSeed(const Number* const);
 
 private:
+   void initData();
 
    //----
    // compile time constants
@@ -263,6 +325,20 @@ private:
    //----
    unsigned int twiddle(unsigned int, unsigned int);     // used by gen_state()
    void gen_state();                                     // generate new state
+   void nextBlock();                                     // next counter-based block
+   static LCuint64 mixSubstream(const LCuint64 sub, const unsigned int copy); // substream of a copy
+
+   //----
+   // counter-based stream (this object only)
+   //----
+   unsigned int streamKey[2];    // Key: { seed, stream ID }
+   unsigned int streamCtr[4];    // Counter: { block number (low, high), substream (low, high) }
+   unsigned int streamBuf[4];    // Current block of random numbers
+   unsigned int streamIdx;       // Next number in 'streamBuf' (4 when empty)
+   bool streamFlg;               // Using the counter-based stream
+   mutable unsigned int nCopies; // Number of copies made of this object's stream
+
+   double gaussSpare;            // Second normal deviate from drawGauss() (or zero)
 
 };
 
@@ -141,7 +141,7 @@ inline double Rng::drawRayleigh(const double alpha)
 //-----------------------------------------------------------------
 inline double Rng::drawGauss(const double mu, const double sigma)
 {
-   static double z = 0.0;
+   double& z = gaussSpare;
 
    double x = 0.0;
    double y = 0.0;
@@ -260,6 +260,12 @@ inline double Rng::drawErlang(const unsigned int m, const double a)
 //----
 inline unsigned int Rng::drawInt32()
 { 
+   // counter-based stream
+   if (streamFlg) {
+      if (streamIdx >= 4) nextBlock();
+      return streamBuf[streamIdx++];
+   }
+
    if (p == n) gen_state(); // new state vector needed
    // gen_state() is split off to be non-inline, because it is only called once
    // in every 624 calls and otherwise irand() would become too big to get inlined
@@ -272,6 +278,29 @@ inline unsigned int Rng::drawInt32()
    return ( x ^ (x >> 18) );
 }
 
+//----
+// counter-based stream
+//----
+inline bool Rng::isStreamEnabled() const
+{
+   return streamFlg;
+}
+
+inline unsigned int Rng::getStreamSeed() const
+{
+   return streamKey[0];
+}
+
+inline unsigned int Rng::getStreamId() const
+{
+   return streamKey[1];
+}
+
+inline LCuint64 Rng::getSubstream() const
+{
+   return (static_cast<LCuint64>(streamCtr[3]) << 32) | streamCtr[2];
+}
+
 //----
 // inline for speed, must therefore reside in header file
 //----
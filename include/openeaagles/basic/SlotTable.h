@@ -25,6 +25,10 @@ namespace Basic {
 // Slot tables are usually defined using the macros BEGIN_SLOTTABLE and
 // END_SLOTTABLE (see macros.h).
 //
+// On first use, each table builds a hash table index of its slot names, which
+// includes all of the base class slot names, so slot names are found by index()
+// without searching each of the base class tables.
+//
 //------------------------------------------------------------------------------
 class SlotTable
 {
@@ -49,9 +53,26 @@ public:
    virtual void deleteData();
 
 private:
+   struct Slot {
+      const char* name;       // Slot name
+      unsigned int hash;      // Hash of the slot name
+      unsigned int index;     // Slot index [ 1 .. n() ]
+   };
+
+   void buildIndex() const;   // Builds the slot name index
+   void clearIndex();         // Clears the slot name index
+
    SlotTable* baseTable;   // Pointer to base class's slot table
    char** slots1;          // Array of slot names
    unsigned int nslots1;   // Number of slots in table
+
+   // Slot name index, which includes the base class slots (built on first use)
+   mutable Slot* htable;            // Hash table of the slot names
+   mutable unsigned int hsize;      // Size of the hash table (power of two)
+   mutable const char** names;      // Slot names by slot index [ 1 .. n() ]
+   mutable unsigned int ntotal;     // Total number of slots (i.e., n())
+   mutable long indexBuilt;         // Index has been built (atomic flag)
+   mutable long indexLock;          // Index semaphore
 };
 
 } // End Basic namespace
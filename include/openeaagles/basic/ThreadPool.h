@@ -12,6 +12,49 @@ namespace Basic {
    class Component;
    class ThreadPoolThread;
 
+//------------------------------------------------------------------------------
+// Class: ThreadPoolTask
+//
+// Description:
+//    Completion handle of a callback object that was passed to the ThreadPool's
+//    submit() function.  The handle is completed after the ThreadPoolManager's
+//    execute() methods have been called with the callback object, or when the
+//    pool is destroyed before the callback was executed (or while it was being
+//    executed).  waitForCompleted() blocks on the handle's completed signal, so
+//    it doesn't use any processor time while it's waiting.
+//------------------------------------------------------------------------------
+class ThreadPoolTask : public Object {
+   DECLARE_SUBCLASS(ThreadPoolTask,Object)
+   friend class ThreadPool;
+   friend class ThreadPoolThread;
+
+public:
+   ThreadPoolTask();
+
+   // Priority of the callback (higher priorities are executed first)
+   int getPriority() const;
+
+   // True if the callback has been executed (or the pool was destroyed)
+   bool isCompleted() const;
+
+   // Blocks until the callback has been executed (or the pool was destroyed)
+   void waitForCompleted() const;
+
+protected:
+   void setPriority(const int pri);
+   void setCompleted();
+
+private:
+   bool createSignal();
+   void closeSignal();
+
+   int priority;              // Priority
+   long completed;            // Completed flag (atomic)
+
+   // Implementation dependent
+   void* completedSig;        // Completed signal
+};
+
 //------------------------------------------------------------------------------
 // Class: ThreadPoolManager
 //
@@ -73,6 +116,30 @@ protected:
 //    still operate as if threads were being used except all calls (such
 //    as execute()) will block the caller until completed.
 //
+//    A negative number of threads scales the pool with the number of
+//    processors: -1 is one thread per processor, -2 is one thread per
+//    processor less one (e.g., to leave a processor for the main thread),
+//    and so on, with a minimum of one thread.
+//
+//    Backlog: when all threads are busy, callbacks are queued on a backlog
+//    of up to 'maxQueued' callbacks (default: 0 -- no backlog), which the
+//    threads execute, highest priority first (in order within a priority),
+//    as they finish their current callbacks.  The ThreadPoolManager's
+//    prepare() method is called by the pool thread for queued callbacks.
+//    The current callback objects of queued and submit()'d callbacks are
+//    ref()'d until they've been executed.
+//
+//    execute() blocks while all threads are busy and the backlog is full,
+//    which (with no backlog) is the same as waiting for a free thread.
+//    submit() never blocks; it returns a ThreadPoolTask completion handle,
+//    or zero if the backlog is full.
+//
+// Slots:
+//    numThreads  <Number>   ! Number of threads; 0 for single-threaded mode, or
+//                           ! negative to scale with the number of processors (default: 0)
+//    priority    <Number>   ! Thread priority (zero(0) is lowest, one(1) is highest) (default: 0.5)
+//    maxQueued   <Number>   ! Max number of queued callbacks (backlog) (default: 0)
+//
 // Possible improvements:
 // - Provide another slot/variable to specify a wait timeout while waiting for
 //   a thread to free from the pool. If the wait is exceeded, could continue
@@ -88,6 +155,7 @@ public:
    ThreadPool(ThreadPoolManager* mgr);
    ThreadPool(ThreadPoolManager* mgr, const unsigned int num);
    ThreadPool(ThreadPoolManager* mgr, const unsigned int num, const LCreal pri);
+   ThreadPool(ThreadPoolManager* mgr, const int num, const LCreal pri, const unsigned int maxq);
 
    // Sets a manager for the thread pool. Will often need to call this if
    // the thread pool is created as a slot (as opposed to creating it
@@ -100,11 +168,12 @@ public:
    // subsequent phases.
    void initialize(Component* const parent);
 
-   // Blocks until a thread from the thread pool is available and then uses
-   // it to call the execute() method in the provided ThreadPoolManager in a
-   // separate thread. If the ThreadPool is in single-threaded mode, this will
-   // not use a new thread and will instead call the execute() method from the
-   // ThreadPoolManager in the calling thread and block until completed.
+   // Blocks until a thread from the thread pool is available (or there's room
+   // on the backlog) and then uses it to call the execute() method in the
+   // provided ThreadPoolManager in a separate thread. If the ThreadPool is in
+   // single-threaded mode, this will not use a new thread and will instead call
+   // the execute() method from the ThreadPoolManager in the calling thread and
+   // block until completed.
    void execute();
 
    // Same as execute() except allows the caller to provide an additional current
@@ -113,32 +182,69 @@ public:
    // different threads.
    void execute(Object* cur);
 
-   // Destroys all threads in the thread pool.
+   // Same as execute(Object*) except it doesn't block: the callback is given
+   // to an available thread or queued on the backlog with priority 'pri'.
+   // Returns a completion handle, which is ref()'d for the caller, or zero
+   // if all threads are busy and the backlog is full.  In single-threaded
+   // mode, the callback is executed before returning.
+   ThreadPoolTask* submit(Object* cur, const int pri = 0);
+
+   // Destroys all threads in the thread pool.  The threads of a parent that
+   // has been shutdown are ended normally; the others are terminated.  The
+   // callbacks that are still queued, or that were being executed by the
+   // terminated threads, are completed.
    void destroy();
 
+   unsigned int getNumThreads() const;    // Number of threads (zero if single-threaded)
+   unsigned int getNumQueued() const;     // Number of queued callbacks
+   unsigned int getMaxQueued() const;     // Max number of queued callbacks
+
    // Slot functions
    virtual bool setSlotNumThreads(const Number* const);
    virtual bool setSlotPriority(const Number* const);
+   virtual bool setSlotMaxQueued(const Number* const);
 
 protected:
-   void threadAvailable(ThreadPoolThread* availableThread);
+   // Called by a pool thread when it has finished its callback: gives the
+   // thread the next queued callback and returns true, or returns the thread
+   // to the available threads and returns false if there are none.
+   bool nextTask(ThreadPoolThread* const thread);
 
 private:
-   static const unsigned int MAX_THREADS = 32;
+   static const unsigned int MAX_THREADS = 256;
    void initData();
-   ThreadPoolThread* getAvailableThread();
+
+   // Queued callback
+   struct QueuedTask {
+      Object* cur;            // Current callback object (ref()'d)
+      ThreadPoolTask* task;   // Completion handle (ref()'d), or zero
+      int pri;                // Priority
+      unsigned int seq;       // Sequence number (in order within a priority)
+   };
+
+   static bool isBefore(const QueuedTask& a, const QueuedTask& b);
+   bool startTask(Object* const cur, ThreadPoolTask* const task, const int pri, const bool wait);
+   void pushQueued(Object* const cur, ThreadPoolTask* const task, const int pri);
+   void popQueued(QueuedTask* const qt);
 
    ThreadPoolManager* manager;
-   unsigned int numThreads;
+   int numThreads;
    LCreal priority;
+   unsigned int maxQueued;
 
    unsigned int actualThreads;
-   ThreadPoolThread* allThreads[MAX_THREADS];
+   ThreadPoolThread** allThreads;
 
    // Keeps track of which threads are available to avoid performance penalty of checking signal state
-   ThreadPoolThread* availableThreads[MAX_THREADS];
+   ThreadPoolThread** availableThreads;
+   unsigned int numAvailable;
+
+   // Backlog of queued callbacks (heap, highest priority first)
+   QueuedTask* queue;
+   unsigned int numQueued;
+   unsigned int queueSeq;
 
-   // Semaphore to protect the available thread pool
+   // Semaphore to protect the available thread pool and the backlog
    mutable long availableThreadsLock;
 
    // Callback object for when we're not using threading
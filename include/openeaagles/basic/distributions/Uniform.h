@@ -18,6 +18,7 @@ public:
   Uniform();
 
   virtual double draw();
+  virtual void drawN(double* const v, const unsigned int num);
 
   bool setMin(const double x)                           { min = x; return true; }
   double getMin() const                                 { return min; }
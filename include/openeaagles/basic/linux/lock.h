@@ -65,3 +65,44 @@ inline void lcUnlock(long int& semaphore)
 }
 
 
+
+// ---
+// Atomic functions (used by the lock-free queues):
+//    lcAtomicLoad(const long int& v)            -- returns 'v' (acquire)
+//    lcAtomicStore(long int& v, long int x)     -- sets 'v' to 'x' (release)
+//    lcAtomicCompareAndSwap(long int& v, long int c, long int x)
+//                                               -- sets 'v' to 'x' only if 'v' is
+//                                                  equal to 'c'; returns true if set
+//
+// Linux version
+// ---
+
+// Note: x86 stores are not reordered with other stores, nor loads with other
+// loads, so only the compiler needs a barrier; other processors get a full
+// memory barrier.
+inline long int lcAtomicLoad(const long int& v)
+{
+   const long int x = *static_cast<const volatile long int*>(&v);
+#if defined(__i386__) || defined(__x86_64__)
+   __asm__ __volatile__ ( "" ::: "memory" );
+#else
+   __sync_synchronize();
+#endif
+   return x;
+}
+
+inline void lcAtomicStore(long int& v, const long int x)
+{
+#if defined(__i386__) || defined(__x86_64__)
+   __asm__ __volatile__ ( "" ::: "memory" );
+#else
+   __sync_synchronize();
+#endif
+   *static_cast<volatile long int*>(&v) = x;
+}
+
+inline bool lcAtomicCompareAndSwap(long int& v, const long int c, const long int x)
+{
+   return __sync_bool_compare_and_swap(&v, c, x);
+}
+
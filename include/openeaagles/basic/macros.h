@@ -161,15 +161,11 @@
     const char* ThisType::getFactoryName() { return _static.fname; }                   \
     bool ThisType::isFormName(const char name[]) const                                 \
     {                                                                                  \
-        if (name == 0) return false;                                                   \
-        if ( std::strcmp(_static.fname,name) == 0 )  return true;                      \
-        else return ThisType::BaseClass::isFormName(name);                             \
+        return findFactoryName(&_static, name);                                        \
     }                                                                                  \
     bool ThisType::isFactoryName(const char name[]) const                              \
     {                                                                                  \
-        if (name == 0) return false;                                                   \
-        if ( std::strcmp(_static.fname,name) == 0 )  return true;                      \
-        else return ThisType::BaseClass::isFactoryName(name);                          \
+        return findFactoryName(&_static, name);                                        \
     }                                                                                  \
     const Eaagles::Basic::SlotTable& ThisType::getSlotTable()  { return slottable; }   \
     bool ThisType::isClassType(const std::type_info& type) const                       \
@@ -207,15 +203,11 @@
     const char* ThisType::getFactoryName() { return _static.fname; }                   \
     bool ThisType::isFormName(const char name[]) const                                 \
     {                                                                                  \
-        if (name == 0) return false;                                                   \
-        if ( std::strcmp(_static.fname,name) == 0 )  return true;                      \
-        else return ThisType::BaseClass::isFormName(name);                             \
+        return findFactoryName(&_static, name);                                        \
     }                                                                                  \
     bool ThisType::isFactoryName(const char name[]) const                              \
     {                                                                                  \
-        if (name == 0) return false;                                                   \
-        if ( std::strcmp(_static.fname,name) == 0 )  return true;                      \
-        else return ThisType::BaseClass::isFactoryName(name);                          \
+        return findFactoryName(&_static, name);                                        \
     }                                                                                  \
     const Eaagles::Basic::SlotTable& ThisType::getSlotTable() { return slottable; }    \
     bool ThisType::isClassType(const std::type_info& type) const                       \
@@ -236,15 +228,11 @@
     const char* ThisType::getFactoryName() { return _static.fname; }                   \
     bool ThisType::isFormName(const char name[]) const                                 \
     {                                                                                  \
-        if (name == 0) return false;                                                   \
-        if ( std::strcmp(_static.fname,name) == 0 )  return true;                      \
-        else return ThisType::BaseClass::isFormName(name);                             \
+        return findFactoryName(&_static, name);                                        \
     }                                                                                  \
     bool ThisType::isFactoryName(const char name[]) const                              \
     {                                                                                  \
-        if (name == 0) return false;                                                   \
-        if ( std::strcmp(_static.fname,name) == 0 )  return true;                      \
-        else return ThisType::BaseClass::isFactoryName(name);                          \
+        return findFactoryName(&_static, name);                                        \
     }                                                                                  \
     const Eaagles::Basic::SlotTable& ThisType::getSlotTable() { return slottable; }    \
     bool ThisType::isClassType(const std::type_info& type) const                       \
@@ -77,6 +77,12 @@ namespace Eaagles {
 //    lcLock(long& s)   -- locks the semaphore w/spinlock wait
 //    lcUnlock(long& s) -- frees the semaphore
 // where 's' is the semaphore that must be initialized to zero.
+//
+// Atomic load, store and compare-and-swap functions (see the lock-free
+// queues, QSpscQueue and QMpscQueue):
+//    lcAtomicLoad(const long& v)                    -- returns 'v' (acquire)
+//    lcAtomicStore(long& v, long x)                 -- sets 'v' to 'x' (release)
+//    lcAtomicCompareAndSwap(long& v, long c, long x) -- sets 'v' to 'x' if it's 'c'
 // ---
 #if defined(WIN32)
   #if defined(__MINGW32__)
@@ -525,6 +531,10 @@ int lcStrcasecmp(const char* const s1, const char* const s2);
 // (using lower case characters)
 int lcStrncasecmp(const char* const s1, const char* const s2, const size_t n);
 
+// String hash function: returns a hash (FNV-1a) of the null terminated string 's'
+// (e.g., for hash tables of factory and slot names)
+unsigned int lcStrhash(const char* const s);
+
 // returns number of digits in the whole number part (i.e. left of decimal)
 // of a floating point number 
 unsigned int getDigits(const double x);
@@ -63,3 +63,34 @@ inline void lcUnlock(long int& semaphore)
 #endif
 
 }
+
+
+// ---
+// Atomic functions (used by the lock-free queues):
+//    lcAtomicLoad(const long int& v)            -- returns 'v' (acquire)
+//    lcAtomicStore(long int& v, long int x)     -- sets 'v' to 'x' (release)
+//    lcAtomicCompareAndSwap(long int& v, long int c, long int x)
+//                                               -- sets 'v' to 'x' only if 'v' is
+//                                                  equal to 'c'; returns true if set
+//
+// MinGW version (x86; stores are not reordered with other stores, nor loads
+// with other loads, so only the compiler needs a barrier)
+// ---
+
+inline long int lcAtomicLoad(const long int& v)
+{
+   const long int x = *static_cast<const volatile long int*>(&v);
+   __asm__ __volatile__ ( "" ::: "memory" );
+   return x;
+}
+
+inline void lcAtomicStore(long int& v, const long int x)
+{
+   __asm__ __volatile__ ( "" ::: "memory" );
+   *static_cast<volatile long int*>(&v) = x;
+}
+
+inline bool lcAtomicCompareAndSwap(long int& v, const long int c, const long int x)
+{
+   return __sync_bool_compare_and_swap(&v, c, x);
+}
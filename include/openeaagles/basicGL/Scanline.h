@@ -7,6 +7,7 @@
 #include "openeaagles/basic/Object.h"
 
 namespace Eaagles {
+   namespace Basic { class Component; class ThreadPool; }
 namespace BasicGL {
 
 class Clip3D;
@@ -16,6 +17,28 @@ class Polygon;
 // Class: Scanline
 // Base class: Object -> Scanline
 // Description:  (Abstract) 2D scan line engine.  
+//
+// Notes:
+//    1) The edge table is built by addPolygon() and sorted once per scan().
+//
+//    2) With a thread pool (see setThreadPool()), scan() splits the image into
+//    horizontal bands of scanlines, one more than the number of pool threads,
+//    and scans them in parallel; the calling thread scans the first band.  Each
+//    band has its own active edge and polygon tables, and the output is the same
+//    as the single-threaded scan.  The derived class's callback() is then called
+//    from several threads at once, but never twice for the same pixel.
+//
+//    3) callback() is passed the polygon table's PolyData in both modes.  The
+//    bands keep their own scan state of each polygon (see PolyData::BandState),
+//    so with a thread pool the PolyData's x0, n0, nslope and aptEdge2 members
+//    aren't updated; use getNorm(norm, x, y), which works in both modes.
+//
+//    4) The bands use their own versions of the scanline(), step(),
+//    toggleActivePolygon() and purgePolygons() functions, and sort their own
+//    active edge tables, so overrides of these functions (and of sortEdges() for
+//    the active edge table) are only used by the single-threaded scan().  A derived
+//    class that overrides them must not be given a thread pool.
+//
 // Factory name: Scanline
 //------------------------------------------------------------------------------
 class Scanline : public Basic::Object
@@ -37,25 +60,52 @@ public:
 
    void setSize(const unsigned int width, const unsigned int height);   // Sets the viewport size
 
-   // adds a polygon to the 'world'
+   // adds a polygon to the 'world'; returns false if the polygon wasn't added
+   // (e.g., back facing, clipped away, or the polygon or edge table is full)
    bool addPolygon(const Polygon* const poly);
 
    void clear();
 
+   // Sets the thread pool used by scan(), or zero for a single-threaded scan.
+   // The pool is initialized with 'parent' as its threads' parent component,
+   // and must not be shared with other users.
+   bool setThreadPool(Basic::ThreadPool* const pool, Basic::Component* const parent);
+   Basic::ThreadPool* getThreadPool()     { return threadPool; }
+
 protected:
    // PolyData Description
    class PolyData : public Basic::Object {
       DECLARE_SUBCLASS(PolyData,Basic::Object)
    public:
       PolyData();
+
+      // Norm at 'x' on the current scanline (single-threaded scan only)
       void getNorm(osg::Vec3& lnorm, const LCreal x) const;
 
+      // Norm at 'x' on scanline 'y' (the callback()'s pixel); either mode
+      void getNorm(osg::Vec3& lnorm, const LCreal x, const unsigned int y) const;
+
+      void clearBandState();        // Frees the band scan states
+
+      // Scan state of the polygon in one band of a multi-threaded scan
+      struct BandState {
+         LCreal      x0;            // X value at start
+         osg::Vec3   n0;            // Initial Norm
+         osg::Vec3   nslope;        // Norm slope
+         bool        aptEdge2;      // reached second edge
+      };
+
       LCreal      x0;               // X value at start
+      unsigned int index;           // Index in the polygon table (PT)
       osg::Vec3   n0;               // Initial Norm
       osg::Vec3   nslope;           // Norm slope
       bool        aptEdge2;         // reached second edge
       SPtr<Polygon> polygon;      // Clipped (working) polygon
       SPtr<const Polygon> orig;   // Original polygon
+
+      BandState*  bandState;        // Scan state in each band [ nBands ], or zero
+      unsigned int nBands;          // Number of bands (zero if single-threaded)
+      unsigned int bandLines;       // Number of scanlines split into the bands
    };
 
 protected:
@@ -85,6 +135,8 @@ protected:
    virtual void callback(const PolyData* const p, const unsigned int x, const unsigned int y) =0;
 
    virtual void reset();
+
+   // Single-threaded scan only (see note 4)
    virtual void scanline(const int y);
    virtual const PolyData* step(const int x);
    virtual void toggleActivePolygon();
@@ -102,6 +154,50 @@ private:
    static const unsigned int MAX_POLYS = 500;
    static const unsigned int MAX_ACTIVE_POLYS = 100;
 
+   // Band of scanlines [ y0 .. y1-1 ] that's scanned by a pool thread, with its
+   // own active edge and polygon tables, and its own scan state of each polygon.
+   class Band : public Basic::Object {
+      DECLARE_SUBCLASS(Band,Basic::Object)
+   public:
+      Band();
+      Band(Scanline* const s, const unsigned int idx, const unsigned int y0, const unsigned int y1);
+      void scan();
+
+   private:
+      // Active edge: the edge's current X value and norm are kept here, since
+      // the edges are shared by all bands
+      struct ActiveEdge {
+         const Edge* edge;    // The edge (from the ET)
+         LCreal      x;       // Current X value
+         osg::Vec3   cn;      // Current Norm
+      };
+
+      void scanline(const int y);
+      const PolyData* step(const int x);
+      void toggleActivePolygon();
+      void purgePolygons();
+      void sortEdges();
+
+      Scanline*      scanner;                // Our scanner (not ref()'d)
+      unsigned int   index;                  // Band index (PolyData::bandState[index])
+      unsigned int   y0, y1;                 // Scanlines [ y0 .. y1-1 ]
+      LCreal         curX;                   // current X value (pixel number)
+      LCreal         curY;                   // current Y value (scanline number)
+
+      PolyData*      apt[MAX_ACTIVE_POLYS];  // Active Polygon Table (APT)
+      unsigned int   nAPT;                   // Number of polygons in APT
+
+      ActiveEdge     aet[MAX_ACTIVE_EDGES];  // Active Edge Table (AET)
+      unsigned int   nAET;                   // Number of edges in AET
+      unsigned int   refAET;                 // Ref index for AET
+      unsigned int   refET;                  // Ref index for ET
+   };
+
+   // Thread pool manager that scans the bands
+   class BandManager;
+
+   void scanBands(const unsigned int num);
+
    Clip3D*        clipper;                // clipping object
 
    LCreal         angle;                  // area rotation angle     (radians)
@@ -128,6 +224,8 @@ private:
    Edge*          aet[MAX_ACTIVE_EDGES];  // Active Edge Table (AET)
    unsigned int   nAET;                   // Number of edges in AET
    unsigned int   refAET;                 // Ref index for AET
+
+   Basic::ThreadPool* threadPool;         // Thread pool (or zero if single-threaded)
 };
 
 
@@ -32,6 +32,9 @@ class SlSymbol;
 //
 // Notes:
 //    1) All symbol index values are one-based; range: [ 1 ... getMaxSymbols() ]
+//    The symbol storage grows as symbols are added, up to getMaxSymbols()
+//    symbols (see the 'maxSymbols' slot), and the lowest free index is always
+//    used for a new symbol.
 //
 //    2) The real-time thread, updateTC(), is not passed to our base class
 //    or our component symbols.
@@ -68,17 +71,27 @@ class SlSymbol;
 //    (if so desired), and the symbol loader will draw lines between the symbols (this
 //    is an easy way to draw routes).
 //
+//    8) The symbols are indexed by type and by ID, so getSymbolIndexById() and
+//    getSymbolIndexesByType() don't search all of the symbols.  Use updateSymbolId()
+//    to change a symbol's ID.
+//
+//    9) A symbol's screen position is only recomputed by draw() when the symbol's
+//    position has been updated, or when the map's reference point, heading,
+//    north-up mode or scale have changed (including while the symbol was hidden).
+//
 // Factory name: SymbolLoader
 // Slots:
 //     templates         <PairStream>   ! List of templates to use for symbols
 //     showOnlyInRange   <Number>       ! only show symbols within range (default: true)
+//     interconnect      <Number>       ! Interconnect the symbols (default: false)
+//     maxSymbols        <Number>       ! Max number of symbols (default: MAX_SYMBOLS)
 //
 //------------------------------------------------------------------------------
 class SymbolLoader : public MapPage {
    DECLARE_SUBCLASS(SymbolLoader,MapPage)
 
 public:
-   static const int MAX_SYMBOLS = 300;
+   static const int MAX_SYMBOLS = 300;    // Default max number of symbols
 
 public:
    SymbolLoader();
@@ -89,6 +102,10 @@ public:
    // Returns the maximum number of active symbols
    int getMaxSymbols() const;
 
+   // Sets the maximum number of active symbols; can't be less than the
+   // highest symbol index that's been used since the loader was cleared
+   virtual bool setMaxSymbols(const int max);
+
    // Returns the symbol type code for the symbol at index, 'idx',
    // or zero for no symbol at 'idx'.
    int getSymbolType(const int idx) const;
@@ -96,6 +113,13 @@ public:
    // Returns the symbol index for 'mySymbol', or zero if not found.
    int getSymbolIndex(const BasicGL::Graphic* const mySymbol) const;
 
+   // Returns the lowest index of the symbols with ID 'id', or zero if not found.
+   int getSymbolIndexById(const char* const id) const;
+
+   // Gets the indexes of up to 'max' symbols of type 'nType' (in no
+   // particular order); returns the number of indexes
+   int getSymbolIndexesByType(const int nType, int* const indexes, const int max) const;
+
    // Returns the symbol at index 'idx', or zero if not found
    SlSymbol* getSymbol(const int idx);
 
@@ -112,6 +136,9 @@ public:
    // Change a symbol's type
    virtual bool setSymbolType(const int idx, const int nType);
 
+   // Change a symbol's ID
+   virtual bool updateSymbolId(const int idx, const char* const id);
+
    // Remove a symbol
    virtual bool removeSymbol(const int idx);
 
@@ -180,18 +207,54 @@ protected:
    bool setSlotTemplates(Basic::PairStream* myTemps);
    bool setSlotShowInRangeOnly(const Basic::Number* const x);
    bool setSlotInterconnect(const Basic::Number* const x);
+   bool setSlotMaxSymbols(const Basic::Number* const x);
 
    virtual SlSymbol* symbolFactory();  // Creates symbols objects
 
    int getSymbols(SPtr<SlSymbol>* const newSyms, const int max);
 
 private:
+   // Type and ID links of each symbol slot (slot indexes; -1 for none)
+   struct SymbolLinks {
+      int typeNext;              // Next symbol of the same type
+      int typePrev;              // Previous symbol of the same type
+      int idNext;                // Next symbol in the same ID bucket
+      int idPrev;                // Previous symbol in the same ID bucket
+      unsigned int idBucket;     // ID bucket
+   };
+
    void initData();
+   bool growSymbols();
+   int allocSlot();
+   void freeSlot(const int i);
+   void linkSymbol(const int i);
+   void unlinkSymbol(const int i);
+   void rehashIds();
+   bool isMapChanged();
 
    Basic::PairStream* templates;    // holds our pairstream of templates
-   SlSymbol* symbols[MAX_SYMBOLS];  // holds our array of symbols
+   SlSymbol** symbols;              // holds our array of symbols [ symbolsSize ]
+   SymbolLinks* links;              // Type and ID links [ symbolsSize ]
+   int symbolsSize;                 // Size of the symbol arrays
+   int symbolsHigh;                 // One past the highest symbol slot used (since cleared)
+   int numSymbols;                  // Number of active symbols
+   int maxSymbols;                  // Max number of symbols
+   int* freeSlots;                  // Free slots below 'symbolsHigh' (min-heap) [ symbolsSize ]
+   int numFree;                     // Number of free slots
+   int* typeHeads;                  // First symbol slot of each type [ typeHeadsSize ]
+   int typeHeadsSize;               // Size of the type heads array
+   int* idBuckets;                  // First symbol slot of each ID bucket [ idBucketsSize ]
+   unsigned int idBucketsSize;      // Number of ID buckets (power of two)
    bool showInRangeOnly;            // only show the symbols within our range, else draw all the symbols if false
    bool interconnect;               // Connect our symbols with a line?
+
+   // Map state used by the last draw()
+   double mapRefLat;                // Reference latitude (degs)
+   double mapRefLon;                // Reference longitude (degs)
+   LCreal mapHdg;                   // Heading (degs)
+   LCreal mapScale;                 // Scale (screen units per NM)
+   bool mapNorthUp;                 // North up mode
+   bool mapValid;                   // Map state is valid
 };
 
 
@@ -247,6 +310,8 @@ public:
 
    void setSymbolPair(Basic::Pair* const p);     // Sets the graphical component
    void setHeadingDeg(const LCreal h);           // Sets the (optional) heading (degrees)
+   bool isPositionDirty() const;                 // Position has changed since the screen position was computed
+   void setPositionDirty(const bool flg);        // Sets the position dirty flag
    void setHdgAngleObj(Basic::Degrees* const p); // Sets the Basic::Angle object that holds the heading value
    void setHdgGraphics(Graphic* const p);        // Sets the graphic object named 'hdg' to handle heading rotation
 
@@ -257,6 +322,7 @@ private:
    bool llFlg;             // Position is Lat/lon (not X/Y)
    bool acFlg;             // aircraft nose/wing coordinate flag
    bool scrnFlg;           // using screen coordinates only
+   bool dirty;             // position has changed since the screen position was computed
 
    int type;               // numeric type (for looking up in slottable)
    char id[MAX_ID_SIZE+1]; // ID (or name) sent to the '
@@ -279,13 +345,14 @@ private:
 // Inline functions for SymbolLoader and SlSymbol
 // -------------------------------------------------------------------------------
 
-inline int SymbolLoader::getMaxSymbols() const { return MAX_SYMBOLS; }
+inline int SymbolLoader::getMaxSymbols() const { return maxSymbols; }
+inline int SymbolLoader::getNumberOfActiveSymbols() const { return numSymbols; }
 inline bool SymbolLoader::setInterconnect(const bool flg) { interconnect = flg; return true; }
 
 inline SlSymbol* SymbolLoader::getSymbol(const int idx)
 {
    SlSymbol* p = 0;
-   if (idx >= 1 && idx <= MAX_SYMBOLS) {
+   if (idx >= 1 && idx <= symbolsHigh) {
       const int i = (idx - 1);
       if (symbols[i] != 0) p = symbols[i];
    }
@@ -295,7 +362,7 @@ inline SlSymbol* SymbolLoader::getSymbol(const int idx)
 inline const SlSymbol* SymbolLoader::getSymbol(const int idx) const
 {
    const SlSymbol* p = 0;
-   if (idx >= 1 && idx <= MAX_SYMBOLS) {
+   if (idx >= 1 && idx <= symbolsHigh) {
       const int i = (idx - 1);
       if (symbols[i] != 0) p = symbols[i];
    }
@@ -308,6 +375,7 @@ inline bool SlSymbol::isPositionLL() const               { return llFlg; }
 inline bool SlSymbol::isPositionAC() const               { return acFlg; }
 inline bool SlSymbol::isPositionXY() const               { return !llFlg || !scrnFlg; }
 inline bool SlSymbol::isPositionScreen() const           { return scrnFlg; }
+inline bool SlSymbol::isPositionDirty() const            { return dirty; }
 
 inline int SlSymbol::getType() const                     { return type; }
 inline const char* SlSymbol::getId() const               { return id; }
@@ -325,15 +393,16 @@ inline LCreal SlSymbol::getHeadingRad() const            { return static_cast<LC
 inline Basic::Degrees* SlSymbol::getHdgAngleObj() const  { return hdgAng; }
 inline Graphic* SlSymbol::getHdgGraphics() const         { return phdg; }
 
-inline void SlSymbol::setXPosition(const double v)       { xPos = v; }
-inline void SlSymbol::setYPosition(const double v)       { yPos = v; }
+inline void SlSymbol::setXPosition(const double v)       { xPos = v; dirty = true; }
+inline void SlSymbol::setYPosition(const double v)       { yPos = v; dirty = true; }
 inline void SlSymbol::setXScreenPos(const double v)      { xScreenPos = v; }
 inline void SlSymbol::setYScreenPos(const double v)      { yScreenPos = v; }
 inline void SlSymbol::setVisible(const bool x)           { visibility = x; }
 inline void SlSymbol::setType(const int t)               { type = t; }
-inline void SlSymbol::setLatLonFlag(const bool flg)      { llFlg = flg; }
-inline void SlSymbol::setACCoordFlag(const bool flg)     { acFlg = flg; }
-inline void SlSymbol::setScreenFlag(const bool flg)      { scrnFlg = flg; }
+inline void SlSymbol::setLatLonFlag(const bool flg)      { llFlg = flg; dirty = true; }
+inline void SlSymbol::setACCoordFlag(const bool flg)     { acFlg = flg; dirty = true; }
+inline void SlSymbol::setScreenFlag(const bool flg)      { scrnFlg = flg; dirty = true; }
+inline void SlSymbol::setPositionDirty(const bool flg)   { dirty = flg; }
 
 }  // end of BasicGL namespace
 }  // end of Eaagles namespace
@@ -117,6 +117,14 @@ namespace Dis {
 //       type id.  For incoming emission PDUs, the "emitter name" from the PDU
 //       is matched with the EmissionPduHandler's "emitterName" value.
 //
+//    7) As the incoming NTMs are added, they're also put into a hash table that
+//       is keyed by their entity type codes and by the level of their last non-
+//       wild card code (category, subcategory, specific or extra; see the
+//       NtmInputNode class).  findNtmByTypeCodes() then finds the same NTM as
+//       the incoming quick lookup tree with at most four table lookups: the
+//       entity's full type, then with its extra, specific and subcategory
+//       codes in turn replaced by wild cards.
+//
 //==============================================================================
 class NetIO : public Simulation::NetIO
 {
@@ -286,6 +294,8 @@ public:
    virtual LCreal getMaxOrientationErr(const Simulation::Nib* const nib) const;
    virtual LCreal getMaxAge(const Simulation::Nib* const nib) const;
    virtual Simulation::Nib* createNewOutputNib(Simulation::Player* const player);
+   virtual const Simulation::Ntm* findNetworkTypeMapper(const Simulation::Nib* const nib) const;
+   virtual const Simulation::Ntm* findNetworkTypeMapper(const Simulation::Player* const p) const;
 
    // DIS v7 additions
    virtual LCreal getHbtPduEe() const;
@@ -369,8 +379,10 @@ protected:
    virtual void processInputList();        // Update players/systems from the Input-list
    virtual Simulation::Nib* nibFactory(const Simulation::NetIO::IoType ioType);  // Create a new Nib
    virtual Simulation::NetIO::NtmInputNode* rootNtmInputNodeFactory() const;
-   virtual void testOutputEntityTypes(const unsigned int);   // Test quick lookup of outgoing entity types
-   virtual void testInputEntityTypes(const unsigned int);    // Test quick lookup of incoming entity types
+   virtual bool addInputEntityType(Simulation::Ntm* const item);
+   virtual bool clearInputEntityTypes();
+   virtual unsigned int testOutputEntityTypes(const unsigned int);   // Test quick lookup of outgoing entity types
+   virtual unsigned int testInputEntityTypes(const unsigned int);    // Test quick lookup of incoming entity types
 
 private:
     void initData();
@@ -404,6 +416,23 @@ private:
 
    // Number of emission PDU handlers in the table, 'emissionHandlers'
    unsigned int   nEmissionHandlers;
+
+   // Incoming NTM quick lookup table entry (see note #7)
+   struct NtmTypeEntry {
+      unsigned int level;     // Level of the last non-wild card code (zero if unused)
+      unsigned int kdc;       // Kind, domain and country codes
+      unsigned int csse;      // Category, subcategory, specific and extra codes
+      const Ntm* ntm;         // The NTM
+   };
+
+   static unsigned int hashNtmCodes(const unsigned int level, const unsigned int kdc, const unsigned int csse);
+   const Ntm* lookupInputNtmTable(const unsigned int level, const unsigned int kdc, const unsigned int csse) const;
+   void insertInputNtmTable(const Ntm* const ntm);
+   void clearInputNtmTable();
+
+   NtmTypeEntry* inputNtmTable;        // Incoming NTM quick lookup table (hashed)
+   unsigned int inputNtmTableSize;     // Size of the table (power of two)
+   unsigned int nInputNtmTable;        // Number of NTMs in the table
 };
 
 
@@ -1,6 +1,41 @@
 //------------------------------------------------------------------------------
 // Class: JSBSimModel
 // Description: JSBSim Model
+//
+// Factory name: JSBSimModel
+// Slots:
+//    rootDir     <String>   ! root directory for JSBSim models (default: 0)
+//    model       <String>   ! JSBSim model (default: 0)
+//    preload     <Number>   ! Number of spare (ready) instances of this model that are
+//                           ! kept in the model cache; they're loaded using a worker
+//                           ! thread after each reset (default: 0)
+//    asyncLoad   <Boolean>  ! If no cached instance is ready at reset, load the model
+//                           ! using a worker thread and attach it to the player once
+//                           ! it's ready (default: false -- load during reset)
+//
+// Model cache:
+//    Loading a JSBSim model parses the aircraft, engine and system files, so newly
+//    loaded JSBSim executives (each with its own property manager) are kept in a
+//    process wide cache that is keyed by the root directory and model name; the
+//    'preload' and 'asyncLoad' loader threads fill the cache.  reset() takes a ready
+//    executive from the cache, if any, before loading a new one.  Models are loaded
+//    one at a time (JSBSim's loader isn't thread safe).
+//
+//    With the default 'preload' of zero, nothing is loaded ahead of time, and
+//    each reset() loads the model itself (or, with 'asyncLoad', waits for it).
+//    Players that are spawned quickly (e.g., in a burst) need a non-zero
+//    'preload', sized to the number of players of this model that are spawned
+//    at once, so that their resets take ready executives from the cache (the
+//    loader tops the cache up again after each reset).
+//
+//    The cache only holds executives that have never been used; JSBSim can't reset
+//    an executive to its loaded state, so the executive of a deleted JSBSimModel is
+//    deleted, not returned to the cache.
+//
+//    While an asynchronous load is pending, dynamics() doesn't update the player.
+//
+//    At shutdown, the loader thread is stopped (after its current load, if any)
+//    and the cache is freed; clearModelCache() also frees the cache.
 //------------------------------------------------------------------------------
 #ifndef __Eaagles_Dynamics_JSBSimModel_H__
 #define __Eaagles_Dynamics_JSBSimModel_H__
@@ -16,10 +51,14 @@ namespace JSBSim {
 namespace Eaagles {
 
 namespace Basic {
+    class Number;
     class String;
 };
 
+namespace Simulation { class Player; }
+
 namespace Dynamics {
+class ModelLoader;
 
 class JSBSimModel : public Simulation::AerodynamicsModel
 {
@@ -64,6 +103,20 @@ public:
     const Basic::String* getModel() const { return model; }       // JSBSim model
     virtual bool setModel(const Basic::String* const msl);
 
+    unsigned int getPreload() const { return preload; }          // Number of spare instances kept in the cache
+    virtual bool setPreload(const unsigned int n);
+
+    bool isAsyncLoad() const { return asyncLoad; }               // Asynchronous model loading enabled?
+    virtual bool setAsyncLoad(const bool flg);
+
+    bool isLoadPending() const { return loadPending; }           // Waiting for an asynchronous load?
+
+    // Number of ready instances of a model in the model cache
+    static unsigned int getNumCachedModels(const char* const rootDir, const char* const model);
+
+    // Deletes all of the ready instances in the model cache
+    static void clearModelCache();
+
     // DynamicsModel interface
     virtual void dynamics(const LCreal  dt = 0.0);
 
@@ -87,15 +140,29 @@ public:
     virtual bool setCommandedAltitude(const double a, const double aMps = 0, const double maxPitch = 0);
 
 protected:
+    // Component interface
+    virtual bool shutdownNotification();
+
+    bool setSlotPreload(const Basic::Number* const msg);
+    bool setSlotAsyncLoad(const Basic::Number* const msg);
 
     JSBSim::FGFDMExec* fdmex;
     JSBSim::FGPropertyManager* propMgr;
 
 private:
     void initData();
+    bool attachModel();                                  // Gets a loaded executive from the model cache
+    void startLoader(const unsigned int n);              // Loads 'n' instances using a worker thread
+    void stopLoader();                                   // Stops the loader thread (waits for its current load)
+    void setHoldFlags();                                 // Checks the model for autopilot holds
+    void initModel(Simulation::Player* const p);         // Sets the initial conditions
 
     const Basic::String* rootDir;   // root directory for JSBSim models
     const Basic::String* model;     // JSBSim model
+    ModelLoader* loader;            // Model loader thread
+    unsigned int preload;           // Number of spare instances kept in the model cache
+    bool asyncLoad;                 // Asynchronous model loading
+    bool loadPending;               // Waiting for an asynchronous load
 
     LCreal pitchTrimPos;    // +/- 1.0
     LCreal pitchTrimRate;   // maxVal(1.0) per sec
@@ -10,6 +10,9 @@
 // decompressSubframe() - Take our frame and decompress the subframe image
 //        virtual int decompressSubframe(const int x, const int y, Subframe& subFrame);
 //
+// getFrameEntry() - Return the frame entry that we've loaded.
+//        CadrgFrameEntry* getFrameEntry();
+//
 //------------------------------------------------------------------------------
 #ifndef __Eaagles_Maps_Rpf_CadrgFrame_H__
 #define __Eaagles_Maps_Rpf_CadrgFrame_H__
@@ -34,6 +37,8 @@ public:
     virtual void load(CadrgFrameEntry* entry);
     // Decompress our subframe
     virtual int decompressSubframe(const int x, const int y, Subframe& subFrame);
+    // The frame entry that we've loaded
+    CadrgFrameEntry* getFrameEntry()    { return frameEntry; }
 
 private:
     static const int frameSize = 6144;              // Total frame size
@@ -32,6 +32,25 @@
 //            )   // end of CadrgMap
 // ) // end of display
 //
+// Background decoding:
+// By default, the tiles are loaded and decoded by the drawing thread, on demand.
+// When the 'decodeThreads' slot is greater than zero, the tiles are loaded and
+// decoded by a pool of worker threads into a least recently used cache of decoded
+// tiles (see TileCache), and the drawing thread only loads finished tiles into
+// the textures.  The tiles around the position that's predicted 'prefetchTime'
+// seconds ahead, using the ground track and speed of our reference position
+// (i.e., our ownship), are also decoded in advance.
+//
+// Slots:
+//    pathNames       <PairStream>  ! Path names to the A.toc files
+//    maxTableSize    <Number>      ! Max table size (default: 3)
+//    mapLevel        <String>      ! Initial map level (e.g., "1:500K")
+//    decodeThreads   <Number>      ! Number of tile decoding threads, or zero to decode
+//                                  ! using the drawing thread (default: 0)
+//    tileCacheSize   <Number>      ! Number of decoded tiles that are cached (default: 64)
+//    prefetchTime    <Number>      ! Prefetch look ahead time (seconds), or zero for no
+//                                  ! prefetching (default: 20)
+//
 // Subroutines:
 // getNumberOfCadrgFiles() - Return total number of all files
 //       int CadrgMap::getNumberOfCadrgFiles()
@@ -95,9 +114,16 @@
 //      void CadrgMap::latLonToPixelRowColumn(const double lat, const double lon, float &originRow,
 //                                            float &originCol, TexturePager* tp)
 //
-// getTile() - Gets our pixels.
+// getTile() - Gets our pixels; returns zero if we're using the decoding threads
+// and the tile isn't ready yet (it's been queued).
 //      void* CadrgMap::getPixels(const int row, const int column, TexturePager* tp)
 //
+// prefetchTiles() - Queues the tiles around our predicted position for decoding.
+//      void CadrgMap::prefetchTiles(TexturePager* tp)
+//
+// subframeToTile() - Sets a tile's colors from a decompressed subframe.
+//      static void CadrgMap::subframeToTile(const Subframe& subframe, const CadrgClut& clut, ColorArray& tile)
+//
 // releaseFrame() - Release the current frame within the frame entry at the specific row and column,
 // if it exists.  This frees us space and is more efficient if the frame is not being used.
 //      void CadrgMap::releaseFrame(const int row, const int column, TexturePager* tp)
@@ -123,9 +149,12 @@ namespace BasicGL { class Texture; }
 namespace Maps {
 namespace Rpf {
 
+class CadrgClut;
 class CadrgFile;
 class TexturePager;
 class MapDrawer;
+class TileCache;
+struct Subframe;
 
 class CadrgMap : public BasicGL::MapPage
 {
@@ -170,6 +199,8 @@ public:
 
     // Get pixels
     virtual void* getPixels(const int row, const int column, TexturePager* tp);
+    virtual void prefetchTiles(TexturePager* tp);
+    static void subframeToTile(const Subframe& subframe, const CadrgClut& clut, ColorArray& tile);
     int getNumberOfCadrgFiles();
     const char* getLevel();
 
@@ -181,6 +212,15 @@ public:
 
     int getMaxTableSize()   { return maxTableSize; }
 
+    // Background decoding
+    virtual bool setDecodeThreads(const int n);
+    virtual bool setTileCacheSize(const int n);
+    virtual bool setPrefetchTime(const LCreal t);
+    int getDecodeThreads() const            { return decodeThreads; }
+    int getTileCacheSize() const            { return tileCacheSize; }
+    LCreal getPrefetchTime() const          { return prefetchTime; }
+    TileCache* getTileCache()               { return tileCache; }   // Zero if not using the decoding threads
+
     // Component interface
     virtual void updateData(const LCreal dt = 0.00000);
     virtual void sortMaps(const int count);             // simple function to sort our maps.
@@ -190,6 +230,12 @@ protected:
     bool setSlotPathnames(const Basic::PairStream* const x);
     bool setSlotMaxTableSize(const Basic::Number* const x);
     bool setSlotMapLevel(Basic::String* x);
+    bool setSlotDecodeThreads(const Basic::Number* const x);
+    bool setSlotTileCacheSize(const Basic::Number* const x);
+    bool setSlotPrefetchTime(const Basic::Number* const x);
+
+    // Component interface
+    virtual bool shutdownNotification();
 
 private:
     static const int MAX_FILES = 10;            // Holds the maximum number of cadrg files we can hold
@@ -203,6 +249,16 @@ private:
     ColorArray outTile;                         // Holds the tile color information
     Basic::String* mapLevel;                    // Our map "level" we are ("1:500K", etc..)
     bool initLevelLoaded;                       // Has our initial map level been loaded?
+
+    TileCache* tileCache;                       // Decoded tile cache (if using the decoding threads)
+    int decodeThreads;                          // Number of tile decoding threads
+    int tileCacheSize;                          // Number of decoded tiles that are cached
+    LCreal prefetchTime;                        // Prefetch look ahead time (seconds)
+    double prevLat;                             // Previous reference latitude (degs)
+    double prevLon;                             // Previous reference longitude (degs)
+    double latRate;                             // Reference latitude rate (degs/sec)
+    double lonRate;                             // Reference longitude rate (degs/sec)
+    bool trackValid;                            // Previous reference position is valid
 };
 
 }  // End Rpf namespace
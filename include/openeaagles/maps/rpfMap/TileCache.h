@@ -0,0 +1,143 @@
+// ------------------------------------------------------------------------------
+// Class: TileCache
+//
+// Description: Least recently used (LRU) cache of decoded CADRG tiles (the RGB
+// images of the frames' subframes), which are loaded and decoded by a pool of
+// worker threads.  The drawing (GL) thread only copies finished tiles into its
+// texture buffer.  This is created and driven by the CadrgMap when its
+// 'decodeThreads' slot is greater than zero.
+//
+// Subroutines:
+// setCacheSize() - Sets the number of decoded tiles that are cached.
+//      bool TileCache::setCacheSize(const int n)
+//
+// setNumThreads() - Sets the number of worker threads.
+//      bool TileCache::setNumThreads(const int n)
+//
+// start() - Creates the worker threads; 'parent' is the component that owns us.
+//      bool TileCache::start(Basic::Component* const parent)
+//
+// stop() - Stops the worker threads and waits for them to finish.
+//      void TileCache::stop()
+//
+// getTile() - If the tile at the row and column of the TOC entry is in the
+// cache then it's copied to 'tile' and we return true; otherwise the tile is
+// queued (high priority) for the worker threads and we return false.
+//      bool TileCache::getTile(CadrgTocEntry* const toc, const int row, const int column, CadrgMap::ColorArray& tile)
+//
+// prefetchTile() - Queues the tile (low priority), if it's not already cached.
+//      void TileCache::prefetchTile(CadrgTocEntry* const toc, const int row, const int column)
+//
+// decodeNext() - Decodes the next queued tile into the cache; returns false if
+// the queue was empty.  Called by the worker threads.
+//      bool TileCache::decodeNext(CadrgFrame* const frame, CadrgMap::ColorArray*& buffer)
+//
+// decodeTile() - Loads (if needed) and decodes a tile using the caller's frame,
+// and converts it to RGB.  Thread safe, and usable without a graphics context
+// (e.g., to measure the decode throughput).
+//      static bool TileCache::decodeTile(CadrgTocEntry* const toc, const int row, const int column,
+//                                        CadrgFrame* const frame, CadrgMap::ColorArray& tile)
+//
+// Statistics: getNumDecoded(), getDecodeTime() (total of all worker threads),
+// getNumHits() and getNumMisses().
+//
+// ------------------------------------------------------------------------------
+#ifndef __Eaagles_Maps_Rpf_TileCache_H__
+#define __Eaagles_Maps_Rpf_TileCache_H__
+
+#include "openeaagles/maps/rpfMap/CadrgMap.h"
+
+namespace Eaagles {
+namespace Basic { class Component; class Thread; }
+namespace Maps {
+namespace Rpf {
+
+class CadrgFrame;
+class CadrgTocEntry;
+
+class TileCache : public Basic::Object
+{
+    DECLARE_SUBCLASS(TileCache, Basic::Object)
+
+public:
+    TileCache();
+
+    // Get functions
+    int getCacheSize() const                { return cacheSize; }
+    int getNumThreads() const               { return numThreads; }
+    bool isStarted() const                  { return started; }
+    bool isStopping() const                 { return stopping; }
+    unsigned int getNumDecoded() const      { return numDecoded; }
+    double getDecodeTime() const            { return decodeTime; }
+    unsigned int getNumHits() const         { return numHits; }
+    unsigned int getNumMisses() const       { return numMisses; }
+
+    // Set functions
+    virtual bool setCacheSize(const int n);
+    virtual bool setNumThreads(const int n);
+
+    // Worker threads
+    virtual bool start(Basic::Component* const parent);
+    virtual void stop();
+
+    // Tile requests
+    bool getTile(CadrgTocEntry* const toc, const int row, const int column, CadrgMap::ColorArray& tile);
+    void prefetchTile(CadrgTocEntry* const toc, const int row, const int column);
+
+    // Worker thread support
+    bool decodeNext(CadrgFrame* const frame, CadrgMap::ColorArray*& buffer);
+    static bool decodeTile(CadrgTocEntry* const toc, const int row, const int column, CadrgFrame* const frame, CadrgMap::ColorArray& tile);
+
+private:
+    static const int MAX_THREADS = 8;       // Max number of worker threads
+    static const int MAX_REQUESTS = 64;     // Max number of queued tiles
+
+    // Cached tile
+    struct Tile {
+        CadrgTocEntry* toc;                 // TOC entry (ref()'d), or zero if not used
+        int row;                            // Tile row
+        int column;                         // Tile column
+        CadrgMap::ColorArray* pixels;       // Decoded tile
+        unsigned int lastUsed;              // Use count when last used
+    };
+
+    // Queued tile
+    struct Request {
+        CadrgTocEntry* toc;                 // TOC entry (ref()'d)
+        int row;                            // Tile row
+        int column;                         // Tile column
+        bool prefetch;                      // Prefetch (low priority) request
+        bool busy;                          // A worker thread is decoding this tile
+    };
+
+    Tile* findTile(const CadrgTocEntry* const toc, const int row, const int column);
+    int findRequest(const CadrgTocEntry* const toc, const int row, const int column) const;
+    void queueRequest(CadrgTocEntry* const toc, const int row, const int column, const bool prefetch);
+    void removeRequest(const int idx);
+    void clearCache();
+
+    Tile* tiles;                            // Cached tiles
+    int cacheSize;                          // Number of cached tiles
+    unsigned int useCount;                  // Tile use counter
+
+    Request requests[MAX_REQUESTS];         // Queued tiles (oldest first)
+    int numRequests;                        // Number of queued tiles
+
+    Basic::Thread* threads[MAX_THREADS];    // Worker threads
+    int numThreads;                         // Number of worker threads
+    bool started;                           // Worker threads have been started
+    bool stopping;                          // Worker threads are stopping
+
+    unsigned int numDecoded;                // Number of tiles decoded
+    double decodeTime;                      // Total decode time (seconds)
+    unsigned int numHits;                   // getTile() hits
+    unsigned int numMisses;                 // getTile() misses
+
+    mutable long lock;                      // Semaphore to protect the cache and the queue
+};
+
+} // End Rpf namespace
+} // End Maps namespace
+} // End Eaagles namespace
+
+#endif
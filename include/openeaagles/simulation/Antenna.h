@@ -49,7 +49,10 @@ class RfSystem;
 //
 //    2) When the Emission 'recycle' flag is enabled (default behavior), the
 //       system will try to reuse Emission objects, which removes the overhead
-//       of creating and deleting them.
+//       of creating and deleting them.  The emissions are kept in a pool (see
+//       QPool) and the emissions that are no longer referenced by the targets
+//       are recycled each process() frame; use getEmissionPool() to check the
+//       pool's hit and miss statistics.
 //
 //------------------------------------------------------------------------------
 class Antenna : public ScanGimbal  
@@ -93,6 +96,9 @@ public:
    // Recycle emissions flag (reuse old emission structure instead of creating new ones)
    bool isEmissionRecycleEnabled() const       { return recycle; }
 
+   // Pool of recycled emissions
+   const QPool<Emission>& getEmissionPool() const { return emPool; }
+
    // Beam width (radians)
    double getBeamWidth() const                 { return beamWidth; }
 
@@ -136,16 +142,12 @@ protected:
    // Basic::Component protected interface
    virtual bool shutdownNotification();
 
-   QStack<Emission*> freeEmStack;  // Free emission stack
-   mutable long      freeEmLock;   // Semaphore to protect 'freeEmStack'
-
-   QQueue<Emission*> inUseEmQueue; // In use emission queue
-   mutable long      inUseEmLock;  // Semaphore to protect 'inUseEmQueue'
+   QPool<Emission>   emPool;       // Pool of recycled emissions
 
 private:
    void initData();
 
-   static const int MAX_EMISSIONS = 10000;   // Max size of emission queues and arrays
+   static const int MAX_EMISSIONS = 10000;   // Max size of emission pool and arrays
 
    RfSystem*    sys;               // Assigned R/F system (e.g., sensor, radio)
 
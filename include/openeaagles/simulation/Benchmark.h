@@ -0,0 +1,177 @@
+//------------------------------------------------------------------------------
+// Class: Benchmark
+//------------------------------------------------------------------------------
+#ifndef __Eaagles_Simulation_Benchmark_H__
+#define __Eaagles_Simulation_Benchmark_H__
+
+#include "openeaagles/basic/Component.h"
+
+namespace Eaagles {
+   namespace Basic { class Distance; class Number; class PairStream; class String; }
+
+namespace Simulation {
+   class Station;
+
+//------------------------------------------------------------------------------
+// Class: Benchmark
+//
+// Description: Headless benchmark of the simulation core.  A Station, its
+//              Simulation and an optional set of template players (e.g., air
+//              vehicles with radars and RWRs, SAMs, missiles) are defined by
+//              the input file or programmatically.  The benchmark populates the
+//              scenario with 'numPlayers' clones of the templates, then runs
+//              the station's time-critical and background tasks, unpaced (i.e.,
+//              as fast as possible), for 'numFrames' frames.  No display,
+//              network or OTW system is required.
+//
+//              The results -- frame time percentiles for the T/C frame, each of
+//              the simulation's four phases (dynamics, transmit, receive and
+//              process) and the background frame, and the per-frame time spent
+//              in each type of player subsystem (see Simulation::Subsystem) during
+//              the T/C and background frames -- are written as JSON to
+//              'outputFile' or to the standard output.
+//
+// Factory name: Benchmark
+// Slots --
+//    station        <Station>            ! Station under test (default: 0)
+//
+//    templates      <Basic::PairStream>  ! Template players that are cloned (in turn)
+//                                        ! to populate the scenario (default: 0)
+//
+//    numPlayers     <Basic::Number>      ! Number of template clones added to the scenario (default: 0)
+//
+//    numFrames      <Basic::Number>      ! Number of measured T/C frames (default: 1000)
+//
+//    warmupFrames   <Basic::Number>      ! Number of unmeasured frames run before measuring (default: 10)
+//
+//    bgRatio        <Basic::Number>      ! Number of T/C frames per background frame (default: 1)
+//
+//    seed           <Basic::Number>      ! Seed for the random placement of the clones (default: 12345)
+//
+//    areaRadius     <Basic::Distance>    ! Clones are placed uniformly within a circle of this
+//                   <Basic::Number>      ! radius (meters) about the gaming area's center (default: 100000.0)
+//
+//    firstPlayerId  <Basic::Number>      ! Player ID of the first clone (default: 1001)
+//
+//    outputFile     <Basic::String>      ! JSON results file name (default: standard output)
+//
+//
+// Notes:
+//    1) The T/C frame time step is one over the station's 'tcRate'; the number of
+//       T/C and background threads are set by the simulation's 'numTcThreads'
+//       and 'numBgThreads' slots.
+//
+//    2) The scenario is reproducible: the clones' IDs, names and initial positions
+//       depend only on the slot values (and the 'seed'), and each frame uses the
+//       same fixed time step.  Set the simulation's 'simulationTime', 'day',
+//       'month' and 'year' slots to also fix the simulated date and time.
+//
+//    3) run() sends a RESET_EVENT to the station, so the clones are added after
+//       the player list is restored to its initial players, and the clones are
+//       reset at their new initial positions.
+//
+//    4) The subsystem times are the wall-clock times spent in each type of
+//       subsystem summed over all of the players, and, with multiple T/C or
+//       background threads, over all of the threads; so their sum can be more
+//       than the frame time.  The "player" subsystem is the player's own update
+//       (e.g., Player::dynamics(), which includes the update of its dynamics model).
+//
+//------------------------------------------------------------------------------
+class Benchmark : public Basic::Component
+{
+    DECLARE_SUBCLASS(Benchmark, Basic::Component)
+
+public:
+   // Measured frame time series
+   enum Series {
+      TC_FRAME,                  // Station's T/C frame
+      PHASE_DYNAMICS,            // Simulation phase 0
+      PHASE_TRANSMIT,            // Simulation phase 1
+      PHASE_RECEIVE,             // Simulation phase 2
+      PHASE_PROCESS,             // Simulation phase 3
+      BG_FRAME,                  // Station's background frame
+      NUM_SERIES
+   };
+
+public:
+   Benchmark();
+
+   Station* getStation();                                // Station under test
+   const Station* getStation() const;                    // Station under test (const version)
+
+   unsigned int getNumPlayers() const;                   // Number of template clones
+   unsigned int getNumFrames() const;                    // Number of measured frames
+   unsigned int getWarmupFrames() const;                 // Number of warm-up frames
+   unsigned int getBgRatio() const;                      // T/C frames per background frame
+   unsigned int getSeed() const;                         // Placement seed
+
+   // Runs the benchmark and writes the results; returns true if the
+   // benchmark was run.
+   virtual bool run();
+
+   // Results of the last run()
+   unsigned int getNumSamples(const Series s) const;     // Number of samples
+   double getPercentile(const Series s, const double pct) const;  // Percentile [ 0 .. 100 ] (sec)
+   double getMean(const Series s) const;                 // Mean (sec)
+   double getTotalTime() const;                          // Wall-clock time of the measured frames (sec)
+
+   // Subsystem results of the last run(); T/C frames ('tc' is true) or background
+   // frames of subsystem type 's' (see Simulation::Subsystem)
+   unsigned int getNumSubsystemSamples(const bool tc) const;                              // Number of samples
+   double getSubsystemPercentile(const bool tc, const unsigned int s, const double pct) const;  // Percentile [ 0 .. 100 ] (sec)
+   double getSubsystemMean(const bool tc, const unsigned int s) const;                    // Mean (sec)
+
+   virtual bool setStation(Station* const p);
+   virtual bool setNumPlayers(const unsigned int n);
+   virtual bool setNumFrames(const unsigned int n);
+   virtual bool setWarmupFrames(const unsigned int n);
+   virtual bool setBgRatio(const unsigned int n);
+   virtual bool setSeed(const unsigned int s);
+   virtual bool setAreaRadius(const double r);
+
+protected:
+   virtual bool populate();                              // Adds the template clones to the simulation
+   virtual bool writeResults(std::ostream& sout) const;  // Writes the JSON results
+
+   bool setSlotStation(Station* const msg);
+   bool setSlotTemplates(Basic::PairStream* const msg);
+   bool setSlotNumPlayers(const Basic::Number* const msg);
+   bool setSlotNumFrames(const Basic::Number* const msg);
+   bool setSlotWarmupFrames(const Basic::Number* const msg);
+   bool setSlotBgRatio(const Basic::Number* const msg);
+   bool setSlotSeed(const Basic::Number* const msg);
+   bool setSlotAreaRadius(const Basic::Distance* const msg);
+   bool setSlotAreaRadius(const Basic::Number* const msg);
+   bool setSlotFirstPlayerId(const Basic::Number* const msg);
+   bool setSlotOutputFile(const Basic::String* const msg);
+
+private:
+   void initData();
+   void freeSamples();
+   bool allocateSamples();
+
+   Station* station;                   // Station under test
+   SPtr<Basic::PairStream> templates;  // Template players
+   const Basic::String* outputFile;    // JSON results file name
+
+   unsigned int numPlayers;            // Number of template clones
+   unsigned int numFrames;             // Number of measured frames
+   unsigned int warmupFrames;          // Number of warm-up frames
+   unsigned int bgRatio;               // T/C frames per background frame
+   unsigned int seed;                  // Placement seed
+   double areaRadius;                  // Placement radius (meters)
+   unsigned short firstPlayerId;       // First clone's player ID
+
+   double* samples[NUM_SERIES];        // Frame time samples (sec); sorted after each run()
+   unsigned int nSamples[NUM_SERIES];  // Number of samples
+   double* subsysSamples[2];           // Subsystem time samples (sec) of the T/C [0] and background [1]
+                                       // frames; 'maxSamples' per subsystem type; sorted after each run()
+   unsigned int nSubsysSamples[2];     // Number of samples (per subsystem type)
+   unsigned int maxSamples;            // Size of each series (i.e., 'numFrames' of the last run())
+   double totalTime;                   // Wall-clock time of the measured frames (sec)
+};
+
+}  // End Simulation namespace
+}  // End Eaagles namespace
+
+#endif
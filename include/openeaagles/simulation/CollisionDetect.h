@@ -28,6 +28,9 @@ namespace Simulation {
 //    Using the 'maxPlayers', 'playerTypes', 'maxRange2Players', 'maxAngle2Players'
 //    and 'localOnly' slot parameters, this function filters the players list
 //    to create a sublist of players that are checked by the process() function.
+//    When 'maxRange2Players' is greater than zero, only the candidate players
+//    from the simulation's broad phase (see Simulation::findNearbyPlayers())
+//    are filtered, rather than the whole player list.
 //
 // 2) process() -- time critical thread --
 //    Checks the distance from own ownship to the players in the sublist, which
@@ -136,6 +139,9 @@ private:
 
    PlayerOfInterest* players; // Player of interest (POI) list
    unsigned int maxPlayers;   // Max number of players of interest
+
+   Player** candidates;       // Broad phase candidate players
+   unsigned int maxCandidates; // Size of the 'candidates' array
 };
 
 //------------------------------------------------------------------------------
@@ -25,6 +25,11 @@ namespace Simulation {
 //    radioName         <Identifier> ! Name of the (optional) communication radio model (see notes #1 and #2)
 //                                   ! (default: 0)
 //    trackManagerName  <Identifier> ! Track Manager Name (default: 0)
+//    network           <Number>     ! Datalink network ID; messages are only exchanged by datalinks
+//                                   ! on the same network, and zero is on all networks (see note #4)
+//                                   ! (default: 0)
+//    sideMask          <Number>     ! Sides (see Player::Side) of the players whose messages
+//                                   ! are received (see note #4) (default: 0xff, all sides)
 //
 // Events:
 //    DATALINK_MESSAGE  (Basic::Object)  Default handler: Pass messages to subcomponents.
@@ -35,6 +40,10 @@ namespace Simulation {
 //    2) 'maxRange' is used when a named radio, 'radioName', is not provided.
 //    3) This class is one of the "top level" systems attached to a Player
 //       class (see Player.h).
+//    4) Without a radio, sendMessage() queues the message with the simulation,
+//       which delivers it, at the end of the phase, to the local players within
+//       'maxRange' that have a datalink on our 'network' and whose 'sideMask'
+//       includes our ownship's side (see Simulation::queueDatalinkMessage()).
 //------------------------------------------------------------------------------
 class Datalink : public System  
 {
@@ -63,6 +72,14 @@ public:
    bool isLocalSendEnabled() const              { return sendLocal; }
    virtual bool setLocalSendEnabled(const bool flg);
 
+   // Datalink network ID; zero is on all networks (default: 0)
+   unsigned int getNetworkId() const            { return networkId; }
+   virtual bool setNetworkId(const unsigned int id);
+
+   // Sides (Player::Side bits) of the players whose messages we receive (default: all)
+   unsigned int getSideMask() const             { return sideMask; }
+   virtual bool setSideMask(const unsigned int mask);
+
    // Send messages to the network output queue (default: true)
    bool isNetworkQueueEnabled() const           { return queueForNetwork; }
    virtual bool setNetworkQueueEnabled(const bool flg);
@@ -92,6 +109,8 @@ protected:
    // Slot functions
    virtual bool setSlotRadioId(const Basic::Number* const num);
    virtual bool setSlotMaxRange(const Basic::Distance* const num);
+   virtual bool setSlotNetwork(const Basic::Number* const num);
+   virtual bool setSlotSideMask(const Basic::Number* const num);
 
    // System class protected functions
    virtual void dynamics(const LCreal dt);    // Phase 0 -> ages queues
@@ -107,6 +126,8 @@ private:
    QQueue<Basic::Object*>* inQueue;   // Received message queue  
    QQueue<Basic::Object*>* outQueue;  // Queue for messages going out over the network/DIS
    double noRadioMaxRange;            // Max range of our datalink (NM)
+   unsigned int networkId;            // Datalink network ID (zero: all networks)
+   unsigned int sideMask;             // Sides of the players whose messages we receive
 
    const Basic::String* radioName;    // Name of our radio
    CommRadio* radio;                  // Our radio
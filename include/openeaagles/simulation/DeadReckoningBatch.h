@@ -0,0 +1,97 @@
+//------------------------------------------------------------------------------
+// Class: DeadReckoningBatch
+//------------------------------------------------------------------------------
+#ifndef __Eaagles_Simulation_DeadReckoningBatch_H__
+#define __Eaagles_Simulation_DeadReckoningBatch_H__
+
+#include "openeaagles/basic/osg/Vec3d"
+
+namespace Eaagles {
+namespace Simulation {
+   class Nib;
+
+//------------------------------------------------------------------------------
+// Class: DeadReckoningBatch
+// Description: Batch of NIBs that are dead reckoned together, in one pass,
+//              instead of one NIB at a time.
+//
+//    add() adds a NIB, and the DR time (seconds since its T0 state) that it's
+//    to be dead reckoned to, to the batch.  sort() then groups the NIBs by their
+//    DR algorithm, so that compute() can dead reckon each group with one loop
+//    over structure-of-arrays (SoA) copies of the NIBs' T0 position, velocity
+//    and acceleration vectors.  The rotational and body-axis algorithms use the
+//    NIB's own DR functions, so the results are the same as the NIB's.
+//
+//    compute() stores the results with the NIBs (see Nib::getBatchDeadReckoning()),
+//    which use them only if they're for the same DR time and if the NIB's DR
+//    hasn't been reset since (e.g., by a network thread), otherwise the NIB
+//    computes its own DR.  Use compute()'s 'idx' and 'n' parameters to split the
+//    batch across several threads; each thread computes a contiguous part of
+//    the batch, so the parts are independent.
+//
+//    The NIBs are not ref()'d, so the batch is only valid while its NIBs are
+//    held by others (e.g., by the players on the current player list).
+//
+//    The batch is not a Basic::Object; it's a helper for the Simulation and
+//    NetIO classes.
+//
+//------------------------------------------------------------------------------
+class DeadReckoningBatch
+{
+public:
+   DeadReckoningBatch();
+   ~DeadReckoningBatch();
+
+   unsigned int getNumNibs() const     { return np; }          // Number of NIBs in the batch
+
+   // Adds NIB 'nib' to the batch, which is to be dead reckoned to
+   // DR time 'dT' (seconds).
+   void add(Nib* const nib, const double dT);
+
+   // Groups the NIBs by their DR algorithm
+   void sort();
+
+   // Dead reckons the idx'th part [ 1 .. n ] of 'n' parts of the batch
+   void compute(const unsigned int idx = 1, const unsigned int n = 1);
+
+   // Clears the batch
+   void clear();
+
+private:
+   DeadReckoningBatch(const DeadReckoningBatch&);               // can not be copied
+   DeadReckoningBatch& operator=(const DeadReckoningBatch&);
+
+   static const unsigned int NUM_ALGORITHMS = 10;   // See Nib::DeadReckoning
+
+   bool resize(const unsigned int n);
+
+   // Added NIBs and their DR times
+   Nib** nibs;                // NIBs (not ref()'d)
+   double* times;             // DR times (sec)
+   unsigned char* algs;       // DR algorithms
+
+   // Sorted NIBs, their DR times and SoA copies of their T0 vectors
+   Nib** sNibs;               // NIBs (not ref()'d)
+   double* t;                 // DR times (sec)
+   unsigned char* alg;        // DR algorithms
+   double* data;              // Block of the DR times and the SoA vectors
+   unsigned int* resets;      // DR reset counts
+   double* px;                // T0 position vectors, replaced by the DR positions (meters) (ECEF)
+   double* py;
+   double* pz;
+   double* vx;                // T0 velocity vectors (m/sec) (ECEF)
+   double* vy;
+   double* vz;
+   double* ax;                // T0 acceleration vectors ((m/sec)/sec) (ECEF)
+   double* ay;
+   double* az;
+   osg::Vec3d* rpy;           // DR Euler angles (rad) [ phi theta psi ] (Body/ECEF)
+
+   unsigned int np;           // Number of NIBs
+   unsigned int maxNp;        // Size of the arrays
+};
+
+} // End Simulation namespace
+} // End Eaagles namespace
+
+#endif
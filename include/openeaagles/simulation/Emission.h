@@ -144,9 +144,11 @@ public:
 
    // SensorMsg class interface
    virtual void setRange(const LCreal r);   // Sets the range to the target (meters) (which we use to set the range loss)
-   virtual void clear();                    // Clear this emission's data
+   virtual void clear();                    // Clear this emission's data (returns it to its constructed state)
 
 private:
+   void initData();
+
    LCreal          freq;           // Frequency                        (Hz)
    LCreal          lambda;         // Wavelength                       (meters)
    LCreal          pw;             // Pulse Width                      (Sec)
@@ -138,6 +138,29 @@ private:
 //    weapon player.  During flyout, the bullets are grouped into bursts.
 //
 // Factory name: Bullet
+// Slots:
+//    maxBursts   <Number>   ! Burst budget; max number of active burst trajectories (default: 100)
+//    hitRadius   <Distance> ! Radius of the hit sphere around the players (default: 10 meters)
+//                <Number>   ! (meters)
+//    drag        <Number>   ! Drag coefficient, k, where the drag deceleration is k * V^2 (1/meters)
+//                           ! (default: 0 -- no drag)
+//
+//    The bursts' positions and velocities are kept as a structure of arrays, so
+//    the integration of gravity and drag is a set of simple loops over all of the
+//    bursts that the compiler can vectorize.
+//
+//    Each frame, the path of each burst (i.e., the segment from its previous to
+//    its current position) is tested against the hit sphere of each player that's
+//    near the bursts, so fast bursts can't pass through a player between frames.
+//    Each burst that passes through a player's hit sphere is a hit on that player.
+//    The nearby players are found by the simulation's detonation effects processing
+//    (see Simulation::queueDetonation()), which calls detonationEffect() for each
+//    of them.  The bursts are checked in groups of consecutive bursts, with a
+//    separate detonation check for each group, whose range is limited to about
+//    MAX_CHECK_RADIUS.  Life forms have a one meter (horizontal) hit radius.
+//
+//    Bursts are removed once they've hit a player or exceeded the max time of
+//    flight, and new bursts are dropped while the burst budget is used up.
 //==============================================================================
 class Bullet : public Weapon  
 {
@@ -146,11 +169,23 @@ class Bullet : public Weapon
 public:
    static const LCreal DEFAULT_MUZZLE_VEL;         // Meters / second
    static const LCreal DEFAULT_MAX_TOF;            // Seconds
+   static const int    DEFAULT_MAX_BURSTS;         // Burst budget
+   static const LCreal DEFAULT_HIT_RADIUS;         // Meters
+   static const LCreal MAX_CHECK_RADIUS;           // Max range of a burst group's hit check (meters)
+   static const LCreal LIFE_FORM_HIT_RADIUS;       // Meters
 
 public:
    Bullet();
 
    LCreal getMuzzleVelocity() const                { return muzzleVel; }
+   int getMaxBursts() const                        { return maxBursts; }
+   int getNumBursts() const                        { return nbt; }
+   LCreal getHitRadius() const                     { return hitRadius; }
+   LCreal getDrag() const                          { return drag; }
+
+   virtual bool setMaxBursts(const int n);
+   virtual bool setHitRadius(const LCreal r);
+   virtual bool setDrag(const LCreal k);
 
    // Fire (add) a burst of bullets 
    virtual bool burstOfBullets(
@@ -165,14 +200,23 @@ public:
    virtual const char* getDescription() const;
    virtual const char* getNickname() const;
    virtual int getCategory() const;
+   virtual bool detonationEffect(Player* const p, const osg::Vec3& detPos, const LCreal maxRng, const Player* const tgt);
 
    // Component Interface
    virtual void reset();
 
 protected:
+   // Burst status
+   enum BurstStatus { BURST_ACTIVE, BURST_HIT, BURST_MISS };
+
    virtual void resetBurstTrajectories();
    virtual void updateBurstTrajectories(const LCreal dt);
    virtual bool checkForTargetHit();
+   virtual void removeBursts();                    // Removes the bursts that are no longer active
+
+   // Swept hit test: returns true if burst 'i' passed within 'radius' of 'pos'
+   // during the last frame, and its closest range, 'rng'.
+   bool sweptHit(const int i, const osg::Vec3& pos, const LCreal radius, const bool horizontal, LCreal* const rng) const;
 
    Player* getHitPlayer()                 { return hitPlayer; }
    const Player* getHitPlayer() const     { return hitPlayer; }
@@ -185,27 +229,44 @@ protected:
    // Basic::Component protected interface
    virtual bool shutdownNotification();
 
-   struct Burst {
-      enum Status { ACTIVE, HIT, MISS };
-      Burst() : bPos(0,0,0), bVel(0,0,0), bTof(0), bNum(0), bRate(0), bEvent(0) {}
-      osg::Vec3 bPos;       // Burst positions -- world  (m)
-      osg::Vec3 bVel;       // Burst velocities -- world (m)
-      LCreal    bTof;       // Burst time of flight      (sec)
-      int       bNum;       // Number of rounds in burst
-      int       bRate;      // Round rate for this burst (rds per min)
-      int       bEvent;     // Release event number for burst
-      Status    bStatus;    // Burst status
-   };
+   bool setSlotMaxBursts(const Basic::Number* const msg);
+   bool setSlotHitRadius(const Basic::Distance* const msg);
+   bool setSlotHitRadius(const Basic::Number* const msg);
+   bool setSlotDrag(const Basic::Number* const msg);
 
 private:
-   enum { MBT = 100 };        // Max number of burst trajectories
+   void initData();
+   bool allocateBursts(const int n);
+   void freeBursts();
 
    LCreal   muzzleVel;        // Muzzle velocity                           (m/s)
+   LCreal   hitRadius;        // Hit sphere radius                         (m)
+   LCreal   drag;             // Drag coefficient                          (1/m)
    SPtr<Player> hitPlayer;    // Player we hit (if any)
 
-   // Bullet trajectories
+   // Burst trajectories (arrays of 'maxBursts' bursts)
    int       nbt;             // Number of burst trajectories
-   Burst bursts[MBT];         // Bursts
+   int       maxBursts;       // Burst budget; max number of burst trajectories
+   int       nhits;           // Number of bursts that have hit a player
+   LCreal*   bPosN;           // Burst positions -- world, north (m)
+   LCreal*   bPosE;           // Burst positions -- world, east  (m)
+   LCreal*   bPosD;           // Burst positions -- world, down  (m)
+   LCreal*   bVelN;           // Burst velocities -- world, north (m/s)
+   LCreal*   bVelE;           // Burst velocities -- world, east  (m/s)
+   LCreal*   bVelD;           // Burst velocities -- world, down  (m/s)
+   LCreal*   bPrevN;          // Burst positions at the start of the frame -- world, north (m)
+   LCreal*   bPrevE;          // Burst positions at the start of the frame -- world, east  (m)
+   LCreal*   bPrevD;          // Burst positions at the start of the frame -- world, down  (m)
+   LCreal*   bTof;            // Burst time of flight      (sec)
+   int*      bNum;            // Number of rounds in burst
+   int*      bRate;           // Round rate for this burst (rds per min)
+   int*      bEvent;          // Release event number for burst
+   BurstStatus* bStatus;      // Burst status
+
+   // Hit check groups of consecutive bursts (see checkForTargetHit())
+   int       ngc;             // Number of groups
+   int*      gcFirst;         // Index of each group's first burst (plus one past the last group)
+   osg::Vec3* gcCenter;       // Center of each group's check (the detonation position)
 };
 
 } // End Simulation namespace
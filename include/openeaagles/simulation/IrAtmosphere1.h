@@ -18,6 +18,7 @@ namespace Eaagles {
       class Table4;
       class List;
       class Number;
+      class Distance;
    }
 
 namespace Simulation {
@@ -35,6 +36,10 @@ class IrQueryMsg;
 //    solarRadiationTable        <Table2>       The table containing solar radiation tables
 //    backgroundRadiationTable   <Table3>       The background radiation table
 //    transmissivityTable        <Table4>       The table containing transmissivity data
+//    altitudeResolution         <Distance>     Seeker and target altitude quantization for the
+//                               <Number>       lookup cache (meters) (default: 0 -- no cache)
+//    rangeResolution            <Distance>     Ground range quantization for the lookup cache
+//                               <Number>       (meters) (default: 0 -- no cache)
 //
 // Public Member Functions:
 //
@@ -100,14 +105,36 @@ class IrQueryMsg;
 //
 // Notes:
 //    1) The first index of each table represents the center frequency of the bins
+//
+//    2) The band bounds, band centers and fractions of the total waveband are
+//       computed once, and the band-to-sensor overlap ratios are computed once
+//       for each seeker waveband (up to MAX_SEEKER_BANDS of them).
+//
+//    3) When both 'altitudeResolution' and 'rangeResolution' are greater than
+//       zero, the seeker altitude, target altitude and ground range are rounded
+//       to these resolutions, and the per-band background radiation, solar
+//       radiation and transmissivity lookups are cached (LOOKUP_CACHE_SIZE
+//       entries) using the rounded values as the key.  The results are then
+//       within the tables' variation over one resolution step of the uncached
+//       results.
 //------------------------------------------------------------------------------
 
 class IrAtmosphere1 : public IrAtmosphere
 {
    DECLARE_SUBCLASS(IrAtmosphere1, IrAtmosphere)
 
+public:
+   static const unsigned int MAX_SEEKER_BANDS = 32;     // Max number of seeker wavebands with precomputed overlaps
+   static const unsigned int LOOKUP_CACHE_SIZE = 256;   // Number of lookup cache entries (power of two)
+
 public:
    IrAtmosphere1();
+
+   LCreal getAltitudeResolution() const     { return altRes; }   // Lookup cache altitude resolution (meters)
+   LCreal getRangeResolution() const        { return rngRes; }   // Lookup cache range resolution (meters)
+   virtual bool setAltitudeResolution(const LCreal meters);
+   virtual bool setRangeResolution(const LCreal meters);
+
    virtual bool calculateAtmosphereContribution(IrQueryMsg* const msg, LCreal* totalSignal, LCreal* totalBackground);
 
 protected:
@@ -160,11 +187,52 @@ protected:
    virtual bool setSlotSolarRadiationTable(const Basic::Table2* const tbl);
    virtual bool setSlotBackgroundRadiationTable(const Basic::Table3* const tbl);
    virtual bool setSlotTransmissivityTable(const Basic::Table4* const tbl);
+   virtual bool setSlotAltitudeResolution(const Basic::Distance* const msg);
+   virtual bool setSlotAltitudeResolution(const Basic::Number* const msg);
+   virtual bool setSlotRangeResolution(const Basic::Distance* const msg);
+   virtual bool setSlotRangeResolution(const Basic::Number* const msg);
 
 private:
+   void initData();
+   bool prepareBands();
+   void clearBands();
+   void clearLookupCache();
+   const LCreal* getSeekerOverlaps(const LCreal lowerSensorBound, const LCreal upperSensorBound, LCreal* const scratch);
+   void lookupBands(
+      const LCreal seekerAltitude,       // The altitude of the seeker (meters)
+      const LCreal targetAltitude,       // Altitude of the target (meters)
+      const LCreal range,                // Ground range to the target (meters)
+      const LCreal viewAngle,            // View Angle (Radians)
+      LCreal* const bg,                  // (out) Background radiation by band
+      LCreal* const solar,               // (out) Solar radiation by band
+      LCreal* const trans                // (out) Transmissivity by band
+   ) const;
+
    const Basic::Table2* solarRadiationTable;
    const Basic::Table3* backgroundRadiationTable;
    const Basic::Table4* transmissivityTable;
+
+   // Precomputed band data; 'nBands' is set only once they're ready
+   unsigned int nBands;                 // Number of bands in the precomputed data
+   LCreal* bandCenter;                  // Band centers (microns)
+   LCreal* bandLower;                   // Band lower bounds (microns)
+   LCreal* bandUpper;                   // Band upper bounds (microns)
+   LCreal* bandFraction;                // Fraction of the band to the total waveband
+
+   // Per-seeker band-to-sensor overlap ratios; entries are never replaced
+   LCreal seekerLower[MAX_SEEKER_BANDS];   // Seeker lower wavelength (microns)
+   LCreal seekerUpper[MAX_SEEKER_BANDS];   // Seeker upper wavelength (microns)
+   LCreal* seekerOverlap;                  // 'nBands' overlap ratios per seeker
+   unsigned int nSeekers;                  // Number of seeker entries
+
+   // Lookup cache; direct mapped by the quantized altitudes and range
+   LCreal altRes;                            // Altitude resolution (meters)
+   LCreal rngRes;                            // Range resolution (meters)
+   int cacheKey[LOOKUP_CACHE_SIZE][3];       // Quantized seeker alt, target alt and range
+   bool cacheValid[LOOKUP_CACHE_SIZE];       // Valid entries
+   LCreal* cacheData;                        // Background, solar and transmissivity; 3 * 'nBands' per entry
+
+   long cacheLock;                           // Semaphore to protect the precomputed data and cache
 };
 
 } // End Simulation namespace
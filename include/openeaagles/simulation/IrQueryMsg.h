@@ -134,7 +134,7 @@ public:
 
    // SensorMsg class interface
    virtual void setRange(const LCreal r);   // Sets the range to the target (meters) (which we use to set the range loss)
-   virtual void clear();                    // Clear this message's data
+   virtual void clear();                    // Clear this message's data (returns it to its constructed state)
 
    // FAB - valuable to keep info about merging
    enum MergedQueryStatus {
@@ -147,6 +147,7 @@ public:
    void setQueryMergeStatus(MergedQueryStatus status) { mergedQueryStatus = status; }
 
 private:
+   void initData();
 
    LCreal         lowerWavelength;           //Lower wavelength          (microns)
    LCreal         upperWavelength;           //Upper wavelength          (microns)
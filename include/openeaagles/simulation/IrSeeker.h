@@ -41,6 +41,9 @@ public:
    // System limits
    int getMaxQueries() const                 { return MAX_QUERIES; }
 
+   // Pool of recycled IR query messages
+   const QPool<IrQueryMsg>& getQueryPool() const { return queryPool; }
+
 #ifdef USE_TDBIR
    // FAB - was missing, but needed, since IrSeeker uses TdbIr; copied in from v2009_0204
    // Gimbal Interface
@@ -60,14 +63,10 @@ protected:
    // Basic::Component protected interface
    virtual bool shutdownNotification();
 
-   QStack<IrQueryMsg*> freeQueryStack;  // stack of free queries of target IR signatures
-   mutable long        freeQueryLock;   // Semaphore to protect 'freeQueryStack'
-
-   QQueue<IrQueryMsg*> inUseQueryQueue; // Queue of in use queries of target IR signatures 
-   mutable long        inUseQueryLock;  // Semaphore to protect 'inUseQueryQueue'
+   QPool<IrQueryMsg>   queryPool;       // Pool of recycled queries of target IR signatures
 
 private:
-   static const int MAX_QUERIES = 10000;   // Max size of queues and arrays
+   static const int MAX_QUERIES = 10000;   // Max size of the query pool
 };
 
 #ifdef USE_TDBIR
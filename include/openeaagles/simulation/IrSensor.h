@@ -155,6 +155,9 @@ public:
    // Store sensor reports until we are ready to pass on to track manager. 
    void addStoredMessage(IrQueryMsg* msg);
 
+   // Pool of recycled IR query messages (queries and sensor reports)
+   const QPool<IrQueryMsg>& getQueryPool() const { return queryPool; }
+
    virtual bool calculateIrQueryReturn(IrQueryMsg* const irQuery);
 
    // Component Interface
@@ -175,6 +178,8 @@ protected:
    QQueue<IrQueryMsg*>  storedMessagesQueue;
    mutable long storedMessagesLock;          // Semaphore to protect 'storedMessagesQueue'
 
+   QPool<IrQueryMsg>    queryPool;           // Pool of recycled IR query messages
+
 
 private:
    static const int MAX_EMISSIONS = 10000;   // Max size of emission queues and arrays
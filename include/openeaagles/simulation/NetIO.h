@@ -6,6 +6,7 @@
 
 #include "openeaagles/basic/Component.h"
 #include "openeaagles/simulation/Player.h"
+#include "openeaagles/simulation/DeadReckoningBatch.h"
 
 namespace Eaagles {
    namespace Basic { class Angle; class Distance; class Identifier; class List;
@@ -107,6 +108,11 @@ namespace Simulation {
 //    (Note: without the outgoing Ntm list, no local players will be written
 //    to the network)
 //
+//    The outgoing Ntm quick lookup tree's results are kept in a hash table,
+//    keyed by the player's class and type string, so that each player type
+//    is matched by the tree only once (see findNetworkTypeMapper()).  The
+//    table is cleared whenever the outgoing Ntm list is changed.
+//
 //    A network specific Nib is created, using the nibFactory() function, to
 //    manage the flow of data from the Eaagles player to the network entity.
 //    The outgoing Nib objects are managed using the "output Nib" list.
@@ -117,6 +123,11 @@ namespace Simulation {
 //    and the 'enableRelay' slot can be used to enable the relaying of Eaagles
 //    players that were discovered from other interoperability networks.
 //
+//    Before the outgoing entities are processed, processOutputList() dead
+//    reckons the output NIBs of the local players, as one batch (see
+//    DeadReckoningBatch), for the NIBs' DR error checks (see Nib's
+//    isPlayerStateUpdateRequired()).
+//
 //
 // Input/Output frames:
 //
@@ -404,8 +415,10 @@ protected:
    unsigned int getNumOutputEntityTypes() const;               // Number of input types
    unsigned int getNumInputEntityTypes() const;                // Number of output types
 
-   virtual void testOutputEntityTypes(const unsigned int n);   // Test rig for outgoing quick lookup
-   virtual void testInputEntityTypes(const unsigned int n);    // Test rig for incoming quick lookup
+   // Test rigs for the quick lookups: returns the number of lookups where the
+   // quick lookup table and the quick lookup tree differ
+   virtual unsigned int testOutputEntityTypes(const unsigned int n);   // Test rig for outgoing quick lookup
+   virtual unsigned int testInputEntityTypes(const unsigned int n);    // Test rig for incoming quick lookup
 
 
 
@@ -453,6 +466,8 @@ private: // Nib related private
    Nib*  outputList[MAX_OBJECTS];   // Table of output objects in name order
    unsigned int   nOutNibs;         // Number of output objects in both tables
 
+   DeadReckoningBatch outDrBatch;   // Output NIBs' DR batch (see processOutputList())
+
    // NIB quick lookup key
    struct NibKey {
       NibKey(const unsigned short playerId, const Basic::String* const federateName) {
@@ -481,6 +496,26 @@ private:  // Ntm related private
    // Output entity type table
    const Ntm*     outputEntityTypes[MAX_ENTITY_TYPES]; // Table of pointers to output entity type mappers; Ntm objects
    unsigned int   nOutputEntityTypes;                  // Number of output entity mappers (Ntm objects) in the table, 'outputEntityTypes'
+
+   // Output NTM quick lookup table entry: the output NTM tree's
+   // result for players of class 'cls' with type string 'type'
+   struct NtmOutputEntry {
+      const std::type_info* cls;    // Player's class (zero if unused)
+      char* type;                   // Player's type string
+      unsigned int hash;            // Hash of the class and type string
+      const Ntm* ntm;               // Tree's NTM (zero if no match)
+   };
+   static const unsigned int MAX_NTM_TABLE_ENTRIES = 4096;  // Max entries in the output NTM table
+
+   static unsigned int hashNtmKey(const std::type_info* const cls, const char* const type);
+   const NtmOutputEntry* lookupOutputNtmTable(const std::type_info* const cls, const char* const type, const unsigned int h) const;
+   void insertOutputNtmTable(const std::type_info* const cls, const char* const type, const unsigned int h, const Ntm* const ntm) const;
+   void clearOutputNtmTable();
+
+   mutable NtmOutputEntry* outputNtmTable;   // Output NTM quick lookup table (hashed)
+   mutable unsigned int outputNtmTableSize;  // Size of the table (power of two)
+   mutable unsigned int nOutputNtmTable;     // Number of entries in the table
+   mutable long outputNtmLock;               // Output NTM quick lookup table semaphore
 };
 
 
@@ -91,7 +91,7 @@ public:
    // Dead Reckoning (DR) algorithm (see enum DeadReckoning)
    bool isDeadReckoning(const unsigned char dr) const { return (drNum == dr); }
    unsigned char getDeadReckoning() const             { return drNum; }
-   bool setDeadReckoning(const unsigned char dr)      { drNum = dr; return true; }
+   bool setDeadReckoning(const unsigned char dr)      { drNum = dr; drResetCnt++; return true; }
 
    // DR's position vector @ T0 (meters) (ECEF)
    const osg::Vec3d& getDrPosition() const            { return drP0; }
@@ -108,6 +108,9 @@ public:
    // DR's angular rates @ T0 (rad/sec)  [ phi theta psi ] (Body/ECEF)
    const osg::Vec3d& getDrAngularVelocities() const   { return drAV0; }
 
+   // Current DR time (seconds since T0)
+   double getDrTime() const                           { return drTime; }
+
    // update incoming entity dead reckoning
    bool updateDeadReckoning(
       const LCreal dt,              // delta time (sec)
@@ -225,10 +228,27 @@ protected:
    // Update our DR time and return the new time
    double updateDrTime(const double dt)               { return (drTime += dt); }
 
+   // Gets (and uses up) the DR position and angles that were computed by a
+   // DeadReckoningBatch, if they're for DR time 'dT' and the DR hasn't been
+   // reset since.  Returns false if there are no valid batched results.
+   bool getBatchDeadReckoning(
+         const double dT,           // DR time (seconds)
+         osg::Vec3d* const pNewP0,  // DR Position vector @ time = 'dT' (meters) (ECEF)
+         osg::Vec3d* const pNewRPY  // DR Euler angles @ time = 'dT' (rad) [ phi theta psi ] (Body/ECEF)
+      );
+
    // Basic::Component protected interface
    virtual bool shutdownNotification();
 
 private:
+   friend class DeadReckoningBatch;
+
+   // compute the DR Euler angles of the world, 1st order rotation, algorithms
+   void drComputeWorldAngles(
+         const double dT,           // DR time (seconds)
+         osg::Vec3d* const pNewRPY  // DR Euler angles @ time = 'dT' (rad) [ phi theta psi ] (Body/ECEF)
+      ) const;
+
    // compute the rotational matrix R0
    static bool drComputeMatrixR0(
          const osg::Vec3d& RPY,      // [radians]
@@ -322,6 +342,14 @@ private:
    osg::Vec3d  smoothVel;              // Smoothing Velocity (meters/second) (ECEF)
    double      smoothTime;             // Smoothing Time
 
+   // Batched DR results (see DeadReckoningBatch)
+   unsigned int drResetCnt;            // Number of DR resets
+   osg::Vec3d  drBatchPos;             // Batched DR position vector (meters) (ECEF)
+   osg::Vec3d  drBatchAngles;          // Batched DR angles (rad) [ roll pitch yaw ] (Body/ECEF)
+   double      drBatchTime;            // DR time of the batched results (sec)
+   unsigned int drBatchResetCnt;       // DR reset count when the batched results were computed
+   bool        drBatchValid;           // Batched results are valid
+
    // Articulated parts (Air Vehicles)
    unsigned int apartWingSweepCnt;     // Articulated Part: wing sweep angle change count
    unsigned int apartGearPosCnt;       // Articulated Part: gear position change count
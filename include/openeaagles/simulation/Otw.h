@@ -13,6 +13,7 @@ namespace Eaagles {
    namespace Basic {
       class Distance;
       class Identifier;
+      class List;
       class Number;
       class PairStream;
       class String;
@@ -40,6 +41,16 @@ class Otm;
 //       Player's (see Player.h) position vectors [ x y z ] are north(x),
 //       east(y) and down(z) from the reference point.
 //
+//    4) When there are more active, in-range players than 'maxModels', the
+//       closest players are given the model slots.  Players that already have
+//       a model compete using a range that is reduced by 'modelHysteresis',
+//       and they're not dropped until they're beyond 'maxRange' increased by
+//       the same ratio, which keeps models from thrashing near the limits.
+//
+//    5) Each model is assigned a level-of-detail (LOD) tier, which is the index
+//       of the first 'lodRanges' entry that is greater than or equal to the
+//       range to the player (zero if no LOD ranges have been set).  Derived
+//       classes can use the tier to select models or reduce update rates.
 //
 // Factory name: Otw
 // Slots:
@@ -56,6 +67,10 @@ class Otm;
 //
 //    otwModelTypes  <PairStream>   ! OTW system's model type IDs (list of Otm objects) (default: 0)
 //
+//    modelHysteresis <Number>      ! Model add/drop hysteresis ratio [ 0 .. 1 ] (default: 0.1)
+//
+//    lodRanges      <List>         ! List of increasing LOD tier ranges (meters) (default: 0)
+//
 //------------------------------------------------------------------------------
 class Otw : public Basic::Component
 {
@@ -75,6 +90,10 @@ public:
     unsigned int getMaxModels() const     { return maxModels; }      // Max number of active, in-range player/models
     unsigned int getMaxElevations() const { return maxElevations; }  // Max number of terrain elevation requests
     LCreal getMaxRange() const            { return maxRange; }       // Max range of active player/models
+    LCreal getModelHysteresis() const     { return modelHyst; }      // Model add/drop hysteresis ratio
+    unsigned int getNumLodRanges() const  { return nLodRanges; }     // Number of LOD tier ranges
+    unsigned int getModelsAdded() const   { return nModelsAdded; }   // Number of models added during the last frame
+    unsigned int getModelsEvicted() const { return nModelsEvicted; } // Number of models evicted (lost their slot) during the last frame
     double getRefLatitude() const         { return refLat; }         // Visual database reference latitude  (degs)
     double getRefLongitude() const        { return refLon; }         // Visual database reference longitude (degs)
     virtual bool isResetInProgress() const;                          // True if visual system is resetting
@@ -86,6 +105,8 @@ public:
     bool setMaxRange(const LCreal r);                                // Sets the max range (meters)
     bool setMaxModels(const unsigned int n);                         // Sets the max number of active, in-range player/models
     bool setMaxElevations(const unsigned int n);                     // Sets the max number of player terrain elevation requests
+    bool setModelHysteresis(const LCreal h);                         // Sets the model add/drop hysteresis ratio [ 0 .. 1 ]
+    bool setLodRanges(const LCreal* const rngs, const unsigned int n); // Sets the LOD tier ranges (meters)
 
     // Sets our ownship pointer; public version, which is usually called by the Station class.  Derived classes
     // can override this function and control the switching of the ownship using setOwnship0()
@@ -99,6 +120,8 @@ public:
     virtual bool setSlotRefLatitude(const Basic::Number* const msg);      // Sets the visual database reference latitude  (degs) slot
     virtual bool setSlotRefLongitude(const Basic::Number* const msg);     // Sets the visual database reference longitude (degs) slot
     virtual bool setSlotOtwModelTypes(const Basic::PairStream* const msg); // Sets the list of OTW model type IDs (Otm objects)
+    virtual bool setSlotModelHysteresis(const Basic::Number* const msg);  // Sets the model add/drop hysteresis ratio slot
+    virtual bool setSlotLodRanges(const Basic::List* const msg);          // Sets the LOD tier ranges (meters) slot
 
     // Basic::Component interface
     virtual void updateTC(const LCreal dt = 0.0f);
@@ -113,6 +136,9 @@ protected:
     // Find a player's model object in table 'type' by the player IDs
     virtual OtwModel* findModel(const unsigned short playerID, const Basic::String* const federateName, const TableType type);
 
+    // Returns the LOD tier for a player at range 'rng' (meters)
+    virtual unsigned int computeLodTier(const LCreal rng) const;
+
     // Find a player's model object in table 'type' using a pointer to the player
     virtual OtwModel* findModel(const Player* const player, const TableType type);
 
@@ -159,6 +185,7 @@ protected:
 private:
    static const unsigned int MAX_MODELS = 400;          // Max model table size
    static const unsigned int MAX_MODELS_TYPES = 400;    // Max OTW model type table size
+   static const unsigned int MAX_LOD_RANGES = 8;        // Max number of LOD tier ranges
 
    void processesModels();                        // Process ownship & player models
    void processesElevations();                    // Process terrain elevation requests
@@ -168,11 +195,16 @@ private:
    void mapPlayers2ElevTable();                   // Map player list to terrain elevation table
    OtwModel* newModelEntry(Player* const ip);     // Create a new model entry for this player & return the table index
    OtwModel* newElevEntry(Player* const ip);      // Create a new elevation entry for this player & return the table index
+   void selectModels(const unsigned int n);       // Selects the closest 'n' model candidates
+   bool reserveCandidates(const unsigned int n);  // Makes sure the candidate table can hold 'n' entries
 
    // Parameters
    LCreal         maxRange;                        // Max range of visual system  (meters)
    unsigned int   maxModels;                       // Max number of models (must be <= MAX_MODELS)
    unsigned int   maxElevations;                   // Max number of terrain elevation requests
+   LCreal         modelHyst;                       // Model add/drop hysteresis ratio
+   LCreal         lodRanges[MAX_LOD_RANGES];       // LOD tier ranges (meters)
+   unsigned int   nLodRanges;                      // Number of LOD tier ranges
 
    // Ref position
    double         refLat;                          // Visual database reference latitude (deg)
@@ -187,23 +219,39 @@ private:
    // Model table
    OtwModel*      modelTbl[MAX_MODELS];            // The table of models
    unsigned int   nModels;                         // Number of models
+   unsigned int   nModelsAdded;                    // Number of models added last frame
+   unsigned int   nModelsEvicted;                  // Number of models evicted last frame
+
+   // Model slot candidates (active, in-range players)
+   struct ModelCandidate {
+      Player*   player;          // The player
+      OtwModel* model;           // The player's current model (if any)
+      LCreal    range;           // Range to the player (meters)
+      LCreal    priority;        // Selection priority (lower is better)
+   };
+   ModelCandidate* candidates;                     // Candidate table
+   unsigned int   maxCandidates;                   // Size of the candidate table
 
    // Height-Of-Terrain request table
    OtwModel*      hotTbl[MAX_MODELS];              // Height-Of-Terrain request table
    unsigned int   nHots;                           // Number of HOTs requests
 
    // OtwModel quick lookup key
-    struct OtwModelKey {
+   struct OtwModelKey {
       OtwModelKey(const unsigned short pid, const Basic::String* const federateName);
       // OtwModel IDs  -- Comparisons in this order --
       unsigned short  playerID;   // Player ID
-      SPtr<const Basic::String> fName;  // Federate name
+      unsigned int    fKey;       // Federate name key (hashed federate name)
+      SPtr<const Basic::String> fName;  // Federate name (used only when the keys match)
    };
 
    // OTW model type table
    const Otm*     otwModelTypes[MAX_MODELS_TYPES]; // Table of pointers to OTW type mappers; Otm objects
    unsigned int   nOtwModelTypes;                  // Number of type mappers (Otm objects) in the table, 'otwModelTable'
 
+   // nth_element callback: model candidate priority compare function
+   static bool compareCandidates(const ModelCandidate& a, const ModelCandidate& b);
+
    // bsearch callbacks: object name compare function --
    //   True types are (const OtwModelKey* key, const OtwModel** model)
    static int compareKey2Model(const void* key, const void* nib);
@@ -251,6 +299,13 @@ public:
 
     unsigned short getPlayerID() const       { return playerID; }       // Player ID for the player associated with this model
     const Basic::String* getFederateName() const { return federateName; } // Player's federate name (if networked)
+    unsigned int getFederateKey() const      { return federateKey; }    // Player's federate name key (zero if not networked)
+
+    LCreal getRange() const                  { return range; }          // Range to the player (meters) when last selected
+    void setRange(const LCreal r)            { range = r; }             // Sets the range to the player (meters)
+
+    unsigned int getLodTier() const          { return lodTier; }        // Level-of-detail tier (zero is the closest)
+    void setLodTier(const unsigned int t)    { lodTier = t; }           // Sets the level-of-detail tier
 
     int getAgeCount() const                  { return ageCount; }       // Age counter value (number of OTW frames since last OTW update)
     int incAgeCount()                        { return ++ageCount; }     // Increments the age counter
@@ -275,6 +330,9 @@ public:
     // Clear out this model (we're INACTIVE)
     virtual void clear();
 
+    // Returns the integer key for a federate name (zero for no name)
+    static unsigned int federateNameKey(const Basic::String* const federateName);
+
 protected:
     // Sets the player object, p, associated with this model
     virtual void setPlayer(Player* const p);
@@ -289,9 +347,13 @@ private:
     int           rcount;        // HOT request counter (how many times have we asked)
     bool          hotActive;     // HOT entry is active
 
+    LCreal        range;         // Range to the player (meters)
+    unsigned int  lodTier;       // Level-of-detail tier
+
     // Model IDs  -- Comparisons in this order --
     unsigned short playerID;     // Player ID
     SPtr<const Basic::String> federateName; // Federate name
+    unsigned int  federateKey;   // Federate name key
 };
 
 //------------------------------------------------------------------------------
@@ -1033,6 +1033,8 @@ protected:
    // Basic::Component Interface
    virtual bool shutdownNotification();
    virtual void printTimingStats();
+   virtual void updateChildTC(Basic::Component* const child, const LCreal dt);   // (timed by subsystem type
+   virtual void updateChildData(Basic::Component* const child, const LCreal dt); //  while phase timing is enabled)
 
    // These systems, from our subcomponent list, can only be set by reset()
    virtual bool setDynamicsModel(Basic::Pair* const sys); // Sets our dynamics model
@@ -0,0 +1,96 @@
+//------------------------------------------------------------------------------
+// Class: PlayerGrid
+//------------------------------------------------------------------------------
+#ifndef __Eaagles_Simulation_PlayerGrid_H__
+#define __Eaagles_Simulation_PlayerGrid_H__
+
+#include "openeaagles/basic/Object.h"
+#include "openeaagles/basic/osg/Vec3"
+
+namespace Eaagles {
+   namespace Basic { class PairStream; }
+
+namespace Simulation {
+   class Player;
+
+//------------------------------------------------------------------------------
+// Class: PlayerGrid
+// Description: Spatial index (broad phase) of a player list.  The players are
+//              sorted into a uniform grid of horizontal (north/east) cells,
+//              which are hashed into buckets, so the players that are near a
+//              position can be found without scanning the whole player list.
+//
+//    build() sorts the players of a player list into the grid; the player list
+//    is ref()'d until the grid is cleared or rebuilt, so the players remain
+//    valid while the grid is in use.  The grid is a snapshot of the players'
+//    positions at the time it was built.
+//
+//    query() returns the players in the grid cells that are within range of a
+//    position (i.e., a superset of the players within range), in player list
+//    order, so the callers can still apply their own exact (e.g., range, FOV and
+//    player type) checks.  Players whose gaming area position is not valid are
+//    not sorted into the grid, and they're always returned.  Queries are
+//    'const' and can be made by several threads at once.
+//
+//    The grid is not a Basic::Object; it's a helper for the Simulation class.
+//
+//------------------------------------------------------------------------------
+class PlayerGrid
+{
+public:
+   PlayerGrid();
+   ~PlayerGrid();
+
+   bool isValid() const                { return valid; }       // True if the grid has been built
+   unsigned int getNumPlayers() const  { return np; }          // Number of players in the grid
+   double getCellSize() const          { return cellSize; }    // Grid cell size (meters)
+   double getMaxSpeed() const          { return maxSpeed; }    // Max player ground speed when the grid was built (m/s)
+
+   // Sorts the players of 'plist' into a grid with 'cellSize' meter cells
+   void build(Basic::PairStream* const plist, const double cellSize);
+
+   // Clears the grid and releases the player list
+   void clear();
+
+   // Finds the players in the grid cells within 'rng' meters (horizontal) of
+   // 'pos' (NED), in player list order.  Returns the number of players found;
+   // only the first 'max' players are stored in 'list', so if the number is
+   // greater than 'max' then 'list' is too small.
+   unsigned int query(const osg::Vec3& pos, const double rng, Player* list[], const unsigned int max) const;
+
+   // True if player 'p' is in the grid (i.e., on the player list)
+   bool contains(const Player* const p) const;
+
+private:
+   PlayerGrid(const PlayerGrid&);               // can not be copied
+   PlayerGrid& operator=(const PlayerGrid&);
+
+   static const unsigned int MAX_CELLS = 16;    // Max cells per query
+
+   unsigned int bucket(const int cn, const int ce) const;
+   bool resize(const unsigned int n);
+
+   Basic::PairStream* players;        // Player list (ref()'d while the grid is valid)
+
+   // Grid entries, sorted by bucket and then by player list order
+   Player** entries;          // Players
+   int* cells;                // Grid cell [ north, east ] of each entry
+   unsigned int* order;       // Player list order of each entry
+   unsigned int* start;       // Index of each bucket's first entry [ 0 .. nBuckets ];
+                              //    the unplaced players follow the last bucket.
+
+   Player** listed;           // Players in player list order
+
+   unsigned int np;           // Number of players
+   unsigned int nPlaced;      // Number of players sorted into the grid
+   unsigned int maxNp;        // Size of the arrays
+   unsigned int nBuckets;     // Number of buckets (power of two)
+   double cellSize;           // Cell size (meters)
+   double maxSpeed;           // Max player ground speed (m/s)
+   bool valid;                // Grid has been built
+};
+
+} // End Simulation namespace
+} // End Eaagles namespace
+
+#endif
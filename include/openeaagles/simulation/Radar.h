@@ -17,8 +17,23 @@ namespace Simulation {
 //
 // Factory name: Radar
 // Slots:
-//    igain    <Basic::Number>     ! Integrator gain (no units; default: 1.0f)
-//             <Basic::Decibel>    ! Integrator gain (dB)
+//    igain         <Basic::Number>     ! Integrator gain (no units; default: 1.0f)
+//                  <Basic::Decibel>    ! Integrator gain (dB)
+//
+//    numSweeps     <Basic::Number>     ! Number of sweeps in the real-beam display (default: NUM_SWEEPS)
+//
+//    ptrsPerSweep  <Basic::Number>     ! Number of points per sweep in the real-beam display (default: PTRS_PER_SWEEP)
+//
+// Notes:
+//    1) The real-beam sweep and closure buffers are single, contiguous blocks with
+//       each sweep aligned to SWEEP_ALIGN values.
+//
+//    2) The sweep power is aged lazily: updateData() only counts the aging
+//       frames, and a sweep's pending aging is applied, in a single pass,
+//       when the sweep is written by receive() or read using getSweep().
+//       The sweeps, and the aging frame count, are protected by 'myLock'.
+//       Applying the pending aging doesn't change the sweep's value, so
+//       getSweep() is a const function that ages the sweep buffers.
 //
 //------------------------------------------------------------------------------
 class Radar : public RfSensor
@@ -29,16 +44,26 @@ public:
    // Max number of reports (per scan)
    static const unsigned int MAX_REPORTS = EAAGLES_CONFIG_MAX_REPORTS;
 
-   static const unsigned int NUM_SWEEPS = 121;          // Number of sweeps in Real-Beam display
-   static const unsigned int PTRS_PER_SWEEP = 128;      // Number of points per sweep in RB display
+   static const unsigned int NUM_SWEEPS = 121;          // Default number of sweeps in Real-Beam display
+   static const unsigned int PTRS_PER_SWEEP = 128;      // Default number of points per sweep in RB display
+   static const unsigned int SWEEP_ALIGN = 8;           // Sweep alignment (number of values)
 
 public:
    Radar();
 
-   const LCreal* getSweep(const unsigned int n) const     { return (n < NUM_SWEEPS ?  sweeps[n] : 0); }
-   const LCreal* getClosure(const unsigned int n) const   { return (n < NUM_SWEEPS ?  vclos[n]  : 0); }
-   unsigned int getNumSweeps() const                      { return NUM_SWEEPS; }
-   unsigned int getPtrsPerSweep() const                   { return PTRS_PER_SWEEP; }
+   // Returns the n'th sweep's power (the sweep's pending aging is applied first)
+   const LCreal* getSweep(const unsigned int n) const;
+
+   // Copies up to 'max' points of the n'th sweep's power, with the pending aging
+   // applied to the copy, to 'power'; returns the number of points copied.
+   unsigned int getSweep(const unsigned int n, LCreal* const power, const unsigned int max) const;
+
+   const LCreal* getClosure(const unsigned int n) const   { return (n < nSweeps ?  &vclos[n*sweepStride] : 0); }
+   unsigned int getNumSweeps() const                      { return nSweeps; }
+   unsigned int getPtrsPerSweep() const                   { return nPtrs; }
+
+   // Sets the real-beam display's resolution; all sweeps are cleared
+   virtual bool setSweepResolution(const unsigned int numSweeps, const unsigned int ptrsPerSweep);
 
    unsigned int getMaxReports() const                     { return MAX_REPORTS; }
    unsigned int getNumReports() const                     { return numReports; }
@@ -63,6 +88,8 @@ public:
 
    // Slot functions
    virtual bool setSlotIGain(Basic::Number* const msg);
+   virtual bool setSlotNumSweeps(const Basic::Number* const msg);
+   virtual bool setSlotPtrsPerSweep(const Basic::Number* const msg);
 
    // System Interface -- Event handler(s)
    virtual bool killedNotification(Player* const killedBy = 0);
@@ -87,28 +114,40 @@ protected: // (#temporary#) allow subclasses to access and use report queue
    // Semaphore to protect 'rptQueue', 'rptSnQueue', 'reports' and 'rptMaxSn'
    mutable long myLock;
 
-   // Queues
-   QQueue<Emission*>   rptQueue;       // Reporting emission queue
-   QQueue<LCreal>      rptSnQueue;     // Reporting Signal/Nose queue  (dB)
+   // Queues (used with the 'myLock' semaphore, so they don't need their own locks)
+   QSpscQueue<Emission*> rptQueue;     // Reporting emission queue
+   QSpscQueue<LCreal>  rptSnQueue;     // Reporting Signal/Nose queue  (dB)
 
    // Reports
    Emission*   reports[MAX_REPORTS];   // Best emission for this report
    LCreal      rptMaxSn[MAX_REPORTS];  // Signal/Nose value            (dB)
    unsigned int numReports;            // Number of reports this sweep
 
+   // Real-beam sweeps (these lock 'myLock')
+   void clearSweep(const unsigned int n);                      // Clears the n'th sweep
+   void ageSweeps();                                           // Ages all sweeps by one frame
+   void addToSweep(const unsigned int n, const unsigned int irng, const LCreal power, const LCreal closure);
+
 private:
    void initData();
    void clearTracksAndQueues();
-   void clearSweep(const unsigned int i);
-   void ageSweeps();
+   void ageSweep(const unsigned int n) const;
+   bool allocateSweeps(const unsigned int numSweeps, const unsigned int ptrsPerSweep);
+   void freeSweeps();
    unsigned int computeSweepIndex(const LCreal az);
    unsigned int computeRangeIndex(const LCreal rng);
 
    bool        endOfScanFlg;           // End of scan flag
 
-   LCreal      sweeps[NUM_SWEEPS][PTRS_PER_SWEEP];
-   LCreal      vclos[NUM_SWEEPS][PTRS_PER_SWEEP];
-   int         csweep;                     // Current sweep
+   LCreal*     sweepMem;               // Sweep buffer memory (unaligned)
+   LCreal*     sweeps;                 // Sweep power  [nSweeps][sweepStride]
+   LCreal*     vclos;                  // Sweep closure [nSweeps][sweepStride]
+   unsigned int* sweepAgedFrame;       // Aging frame when each sweep was last aged
+   unsigned int agingFrame;            // Aging frame counter
+   unsigned int nSweeps;               // Number of sweeps
+   unsigned int nPtrs;                 // Number of points per sweep
+   unsigned int sweepStride;           // Sweep stride (nPtrs rounded up to SWEEP_ALIGN)
+   int         csweep;                 // Current sweep
 
    LCreal      currentJamSignal;
    int         numberOfJammedEmissions;
@@ -162,7 +162,7 @@ public:
    void setDataMessage(Basic::Object* const msg);
 
 
-   // Clear data
+   // Clear data (returns the message to its constructed state)
    virtual void clear();
 
 private:
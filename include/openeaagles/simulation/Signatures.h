@@ -32,13 +32,33 @@ class Emission;
 // Public member functions:
 //      LCreal getRCS(Emission* em)
 //          Computes the Radar Cross Section for the emission.
+//
+//      getRCSN(const Emission* const ems[], LCreal rcs[], const unsigned int n)
+//          Computes the Radar Cross Sections of 'n' emissions; the default
+//          calls getRCS() for each emission, and derived classes can override
+//          it to do their per-call setup once for the whole batch.
+//
+//      CostClass getCostClass()
+//          Relative cost of computing the RCS (cheapest first), which can be
+//          used to estimate the load of scenarios with many emitters.
 //------------------------------------------------------------------------------
 class RfSignature : public Basic::Component  
 {
     DECLARE_SUBCLASS(RfSignature,Basic::Component)
+public:
+    enum CostClass {
+       CONSTANT_COST,       // Fixed RCS; independent of the emission
+       CLOSED_FORM_COST,    // Closed form equation of the emission's wavelength
+       GRID_COST,           // Fixed resolution grid lookup by the angles of incidence
+       TABLE_COST,          // Table lookup (breakpoint search) by the angles of incidence
+       COMPOSITE_COST       // Depends on the player's state and/or other signatures
+    };
+
 public:
     RfSignature();
     virtual LCreal getRCS(const Emission* const em)=0;
+    virtual void getRCSN(const Emission* const ems[], LCreal rcs[], const unsigned int n);
+    virtual CostClass getCostClass() const;
 };
 
 //------------------------------------------------------------------------------
@@ -61,6 +81,7 @@ public:
 
     // RfSignature interface
     virtual LCreal getRCS(const Emission* const em);
+    virtual CostClass getCostClass() const;
 private:
     LCreal rcs;         // Constant RCS value
 };
@@ -85,6 +106,7 @@ public:
 
     // RfSignature interface
     virtual LCreal getRCS(const Emission* const em);
+    virtual CostClass getCostClass() const;
 private:
     LCreal radius;      // Sphere radius
     LCreal rcs;         // RCS of sphere
@@ -115,6 +137,7 @@ public:
 
     // RfSignature interface
     virtual LCreal getRCS(const Emission* const em);
+    virtual CostClass getCostClass() const;
 private:
     LCreal a;       // Length dimension
     LCreal b;       // Width dimension
@@ -164,6 +187,7 @@ public:
 // Factory name: SigSwitch
 // Note:
 //  1) First pair (1:) is camouflage type 0, the second (2:) is camouflage type 1, etc.
+//  2) getRCSN() finds the ownship's signature once for the whole batch.
 //------------------------------------------------------------------------------
 class SigSwitch : public RfSignature  
 {
@@ -173,6 +197,11 @@ public:
 
    // RfSignature interface
    virtual LCreal getRCS(const Emission* const em);
+   virtual void getRCSN(const Emission* const ems[], LCreal rcs[], const unsigned int n);
+   virtual CostClass getCostClass() const;
+
+protected:
+   RfSignature* getCurrentSignature();
 };
 
 
@@ -194,6 +223,9 @@ public:
 //    inDecibel  <Basic::Number>   ! True if the dependent data is in decibel meters
 //                                 ! squared instead of the default meters squared (default: false)
 //
+//    gridTolerance <Basic::Number> ! Max relative RCS error of the lookup grid, or zero
+//                                  ! to always use the table (default: 0)
+//
 // Notes:
 //  1) Must provide a Basic::Table2 (2 dimensional) table, where ...
 //       -- Azimuth is the first independent variable (radians),
@@ -208,6 +240,17 @@ public:
 //
 //  4) If 'inDecibel' is set true then the dependent data is in decibel meters
 //     squared instead of the default meters squared
+//
+//  5) If 'gridTolerance' is greater than zero then the table is resampled, when
+//     it's loaded, into a fixed resolution grid of the table's values by az/el
+//     (radians), so getRCS() doesn't have to search the breakpoints or convert
+//     the angles.  The grid starts at the table's smallest breakpoint spacing
+//     (a uniform table's breakpoints are then on the grid) and is refined until
+//     the grid's RCS is within the tolerance of the table's RCS, which is checked
+//     at the cell centers and at the table's breakpoints and their midpoints.
+//     The error is relative to the table's RCS, or to 0.1% of the max RCS for
+//     small values.  If the tolerance can't be met with MAX_GRID_POINTS points,
+//     or if the table extrapolates, then the table is used.
 //------------------------------------------------------------------------------
 class SigAzEl : public RfSignature  
 {
@@ -227,19 +270,48 @@ public:
    bool isDecibel() const           { return dbFlg; }
    virtual bool setDecibel(const bool flg);
 
+   LCreal getGridTolerance() const  { return gridTol; }
+   bool isGridValid() const         { return (grid != 0); }
+   virtual bool setGridTolerance(const LCreal tol);
+
    // Slot functions
    virtual bool setSlotTable(const Basic::Table2* const tbl);
    virtual bool setSlotSwapOrder(const Basic::Number* const msg);
    virtual bool setSlotInDegrees(const Basic::Number* const msg);
    virtual bool setSlotDecibel(const Basic::Number* const msg);
+   virtual bool setSlotGridTolerance(const Basic::Number* const msg);
 
    // RfSignature interface
    virtual LCreal getRCS(const Emission* const em);
+   virtual void getRCSN(const Emission* const ems[], LCreal rcs[], const unsigned int n);
+   virtual CostClass getCostClass() const;
+
+   static const unsigned int MAX_GRID_POINTS = 262144;   // Max number of grid points
+
+protected:
+   LCreal computeTableRCS(const LCreal az, const LCreal el) const;
+   LCreal computeTableValue(const LCreal az, const LCreal el) const;
+   LCreal computeGridRCS(const LCreal az, const LCreal el) const;
+   virtual void buildGrid();
+   void clearGrid();
+
 protected:
    const Basic::Table2* tbl;      // The table
    bool swapOrderFlg;               // Swap independent data order from az/el to el/az
    bool degFlg;                     // independent data in degrees 
    bool dbFlg;                      // dependent data in decibels 
+
+private:
+   bool checkGrid() const;
+
+   LCreal  gridTol;                 // Grid tolerance (relative RCS error; zero for no grid)
+   LCreal* grid;                    // Grid of table values [ gridNumAz * gridNumEl ] (az major)
+   unsigned int gridNumAz;          // Number of grid azimuths
+   unsigned int gridNumEl;          // Number of grid elevations
+   LCreal gridAz0;                  // First grid azimuth (radians)
+   LCreal gridEl0;                  // First grid elevation (radians)
+   LCreal gridAzScale;              // Grid azimuth points per radian
+   LCreal gridElScale;              // Grid elevation points per radian
 };
 
 
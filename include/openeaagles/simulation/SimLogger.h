@@ -83,7 +83,7 @@ protected:
 
 private:
     static const int MAX_QUEUE_SIZE = 1000;     // Max size of the logger event queue
-    QQueue<SimLogEvent*> seQueue;               // Sim Event Queue
+    QMpscQueue<SimLogEvent*> seQueue;           // Sim Event Queue (lock-free; events are logged by any thread)
 
     double          time;                       // Sim time (seconds)
     double          execTime;                   // Executive time (seconds)
@@ -109,6 +109,7 @@ public:
     public:
         SimLogEvent();
         virtual void captureData() =0;
+        virtual void clear();                      // Clears the event (i.e., returns it to its constructed state)
         void setTime(const double t)               { time = t;          }
         void setExecTime(const double t)           { execTime = t;      }
         void setUtcTime(const double t)            { utcTime = t;       }
@@ -136,6 +137,8 @@ public:
         bool   printSimTime;                        // whether to record SIM time
         bool   printExecTime;                       // whether to record EXEC time
         char* msg;
+    private:
+        void initData();
     };
 
     //------------------------------------------------------------------------------
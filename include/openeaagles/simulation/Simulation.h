@@ -5,6 +5,9 @@
 #define __Eaagles_Simulation_Simulation_H__
 
 #include "openeaagles/basic/Component.h"
+#include "openeaagles/basic/osg/Vec3"
+#include "openeaagles/simulation/DeadReckoningBatch.h"
+#include "openeaagles/simulation/PlayerGrid.h"
 
 namespace Eaagles {
    namespace Basic { class Distance; class EarthModel; class LatLon; class Pair; class Time; class Terrain; }
@@ -12,11 +15,13 @@ namespace Eaagles {
 
 namespace Simulation {
    class DataRecorder;
+   class Datalink;
    class IrAtmosphere;
    class Player;
    class SimBgThread;
    class SimTcThread;
    class Station;
+   class Weapon;
 
 //------------------------------------------------------------------------------
 // Class: Simulation
@@ -147,6 +152,14 @@ namespace Simulation {
 //    Use cycle(), frame() and phase() to get the current values, and use getExecCounter()
 //    to get the total number of phases since the start of the exec.
 //
+//    For profiling (e.g., see Benchmark), setPhaseTimingEnabled() enables the
+//    measuring of the wall-clock time spent in each phase, which is available
+//    from getPhaseTime() until the next frame.  While enabled, the players also
+//    measure the time spent in their subsystems (see Player::updateTC() and
+//    Player::updateData()), which are summed, by subsystem type, over all of the
+//    players and threads.  Use getTcSubsystemTime() and getBgSubsystemTime() for
+//    the totals of the last T/C and background frames.
+//
 //
 // Multiple time critical and background threads:
 //
@@ -196,6 +209,58 @@ namespace Simulation {
 //       conversion functions.
 //
 //
+// Detonation effects:
+//
+//    Weapons queue their detonations using queueDetonation() (e.g., see
+//    Weapon::checkDetonationEffect()), and the effects of all of the detonations
+//    that were queued during a phase are processed, as one batch, at the end of
+//    the phase by processDetonations().  The players are sorted into a grid of
+//    horizontal (north/east) cells (see PlayerGrid) once per batch, and each
+//    detonation is only checked against the players in the cells that are
+//    within its range.  Each
+//    of these players, and the detonation's target player, are passed to the
+//    weapon's detonationEffect() function, which calls the player's
+//    processDetonation() if the player is affected.
+//
+//
+// Broad phase (nearby players):
+//
+//    Once per background frame, after the player list is updated and before
+//    the players' background processing, the players are sorted into a grid
+//    of horizontal (north/east) cells.  During the players' background processing,
+//    components that need the players near a position (e.g., CollisionDetect)
+//    can use findNearbyPlayers() instead of scanning the whole player list.  The
+//    candidates are a superset of the players within range: the range is padded
+//    for the players' motion during the frame, and players without a valid
+//    gaming area position are always candidates.  The grid's cell size is the
+//    largest range that was requested during the previous frame.
+//
+//
+// Dead reckoning:
+//
+//    At the start of phase 0, before the players' dynamics, the networked
+//    players' NIBs are dead reckoned, as one batch, by deadReckonNetworkPlayers()
+//    (see DeadReckoningBatch).  The batch is split across the T/C threads when
+//    there are multiple T/C threads and enough NIBs.  Each networked player's
+//    deadReckonPosition() then uses its NIB's batched results, unless the NIB
+//    was reset by the network since, in which case the NIB computes its own DR.
+//
+//
+// Datalink messages:
+//
+//    Datalinks without a radio model queue their messages using
+//    queueDatalinkMessage() (see Datalink::sendMessage()), and the messages that
+//    were queued during a phase are delivered, as one batch, at the end of the
+//    phase by processDatalinkMessages().  Messages queued by the background
+//    processing are delivered at the end of the next T/C phase.  The players are
+//    sorted into a grid (see PlayerGrid) once per batch, so each message is only
+//    checked against the players within its range.  A message is delivered, as
+//    a DATALINK_MESSAGE event, to the active, local players (other than the
+//    sender) that have a datalink that's on the sender's network and that's
+//    subscribed to the sender's side (see Datalink's 'network' and 'sideMask'
+//    slots).  Each datalink queues its own received messages.
+//
+//
 // Environments:
 //
 //    Current simulation environments include terrain elevation posts, getTerrain(),
@@ -231,6 +296,29 @@ public:
    // of new players accepted per background frame
    static const int MAX_NEW_PLAYERS = 1000;
 
+   // Min number of NIBs per T/C thread to split the networked players' dead
+   // reckoning batch across the T/C threads (see deadReckonNetworkPlayers())
+   static const unsigned int MIN_DR_NIBS_PER_THREAD = 256;
+
+   // Player subsystem types (profiling; see setPhaseTimingEnabled())
+   enum Subsystem {
+      SUBSYS_PLAYER,             // The player itself (e.g., dynamics(), signatures, terrain)
+      SUBSYS_DYNAMICS_MODEL,     // DynamicsModel component
+      SUBSYS_DATALINK,           // Datalink
+      SUBSYS_GIMBAL,             // Gimbal (e.g., antennas, seekers)
+      SUBSYS_IR_SYSTEM,          // IrSystem
+      SUBSYS_NAVIGATION,         // Navigation
+      SUBSYS_OBC,                // OnboardComputer
+      SUBSYS_PILOT,              // Pilot
+      SUBSYS_RADIO,              // Radio
+      SUBSYS_SENSOR,             // RfSensor (e.g., radars, RWRs, sensor managers)
+      SUBSYS_STORES_MGR,         // StoresMgr
+      SUBSYS_OTHER,              // All other components
+      NUM_SUBSYSTEMS
+   };
+
+   static const char* getSubsystemName(const unsigned int s);  // Name of subsystem type 's'
+
 public:
     Simulation();
 
@@ -270,6 +358,19 @@ public:
        unsigned long* const simSec,                //    The whole seconds since midnight (00:00:00), January 1, 1970
        unsigned long* const simUSec) const;        //    The number of microseconds in the current second.
 
+    // Phase timing (profiling) -- wall-clock time spent in each of the
+    // last frame's four phases; only measured while enabled.
+    bool isPhaseTimingEnabled() const;             // Is phase timing enabled?
+    double getPhaseTime(const unsigned int p) const; // Wall-clock time (sec) of phase 'p' [ 0 .. 3 ] during the last frame
+    virtual bool setPhaseTimingEnabled(const bool enb); // Enables/disables phase (and subsystem) timing
+
+    // Subsystem timing (profiling) -- wall-clock time spent in each type of
+    // subsystem during the last T/C or background frame, summed over all of
+    // the players and threads; only measured while phase timing is enabled.
+    double getTcSubsystemTime(const unsigned int s) const;   // T/C frame time (sec) of subsystem type 's'
+    double getBgSubsystemTime(const unsigned int s) const;   // Background frame time (sec) of subsystem type 's'
+    void addSubsystemTime(const bool tc, const unsigned int s, const double t); // Adds time 't' (sec) to subsystem type 's'
+
     // Unique event and weapon IDs
     unsigned short getNewEventID();                // Generates an unique major simulation event ID [1 .. 65535]
     unsigned short getNewWeaponEventID();          // Generates a unique weapon event ID [1 .. 65535]
@@ -298,6 +399,27 @@ public:
     virtual bool addNewPlayer(const char* const playerName, Player* const player); // Add a new player
     virtual bool addNewPlayer(Basic::Pair* const player);      // Add a new player (pair: name, player)
 
+    virtual bool queueDetonation(                  // Queues a detonation for the detonation effects processing
+       Weapon* const wpn,                          //    Detonating weapon
+       const osg::Vec3& pos,                       //    Location of the detonation (NED; meters)
+       const LCreal maxRng,                        //    Max range of the detonation's effects (meters)
+       Player* const tgt = 0,                      //    Target player, which is always checked (default: none)
+       const bool all = false                      //    Check all players, otherwise only local players (default: false)
+    );
+
+    virtual bool queueDatalinkMessage(             // Queues a datalink message for delivery at the end of the phase
+       Datalink* const src,                        //    Sending datalink
+       Basic::Object* const msg,                   //    Message
+       const LCreal maxRng                         //    Max range of the message (meters)
+    );
+
+    // Broad phase: finds the players that could be within 'rng' meters
+    // (horizontal) of 'pos' (NED), in player list order.  Returns the number of
+    // candidates, of which only the first 'max' are stored in 'list' (pointers are
+    // not ref()'d), or -1 if the broad phase is not available (i.e., outside of
+    // the players' background processing), in which case use the player list.
+    virtual int findNearbyPlayers(const osg::Vec3& pos, const LCreal rng, Player* list[], const unsigned int max);
+
     virtual bool setInitialSimulationTime(const long time);    // Sets the initial simulated time (sec; or less than zero to slave to UTC)
 
     virtual bool setAirports(Dafif::AirportLoader* const p);   // Sets the airport loader
@@ -324,8 +446,17 @@ public:
        const unsigned int n
     );
 
+    // Dead reckons the idx'th part of 'n' parts of the networked players' DR batch
+    void computeDeadReckoningBatch(
+       const unsigned int idx,
+       const unsigned int n
+    );
+
 protected:
     virtual void updatePlayerList();                  // Update the current player list
+    virtual void processDetonations();                // Process the effects of the queued detonations
+    virtual void processDatalinkMessages();           // Deliver the queued datalink messages
+    virtual void deadReckonNetworkPlayers(Basic::PairStream* const playerList, const LCreal dt); // Batch DR of the networked players
     bool setSlotPlayers(Basic::PairStream* const msg); 
 
     Basic::Terrain* getTerrain();                     // Returns the terrain elevation database
@@ -350,7 +481,28 @@ protected:
     virtual bool shutdownNotification();
 
 private:
+   // Queued detonation
+   struct QueuedDetonation {
+      Weapon* wpn;               // Detonating weapon (ref()'d)
+      osg::Vec3 pos;             // Location of the detonation (NED; meters)
+      LCreal maxRng;             // Max range of the effects (meters)
+      Player* tgt;               // Target player (ref()'d) or zero
+      bool all;                  // Check all players, otherwise local players only
+   };
+
+   // Queued datalink message
+   struct QueuedDatalinkMsg {
+      Datalink* src;             // Sending datalink (ref()'d)
+      Player* ownship;           // Sender's ownship (ref()'d)
+      Basic::Object* msg;        // Message (ref()'d)
+      osg::Vec3 pos;             // Sender's position when the message was sent (NED; meters)
+      LCreal maxRng;             // Max range of the message (meters)
+      bool posValid;             // Sender's position is valid
+   };
+
    void initData();
+   void clearDetonations();
+   void clearDatalinkMessages();
 
    bool insertPlayerSort(Basic::Pair* const newPlayer, Basic::PairStream* const newList);
    Player* findPlayerPrivate(const short id, const int netID) const;
@@ -409,6 +561,12 @@ private:
    unsigned long simTvUSec;      // Simulated UTC time value: Microseconds
    bool simTimeSlaved;           // Simulated time is slaved to the computer time
 
+   double phaseTimes[4];         // Wall-clock time of each phase of the last frame (sec)
+   bool phaseTimingFlg;          // Phase timing enabled
+   double tcSubsysTimes[NUM_SUBSYSTEMS];  // Wall-clock time of each subsystem type during the last T/C frame (sec)
+   double bgSubsysTimes[NUM_SUBSYSTEMS];  // Wall-clock time of each subsystem type during the last background frame (sec)
+   mutable long subsysTimesLock;          // Subsystem times semaphore
+
    long simTime0;                // Initial time of day since midnight (default: -1.0, which slaves to UTC time)
    unsigned short simDay0;       // Initial day of the month [ 1 .. 31 ] (default: 0, which slaves to UTC time)
    unsigned short simMonth0;     // Initial month [ 1 .. 12 ] (default: 0, which slaves to UTC time)
@@ -418,7 +576,37 @@ private:
    unsigned short eventWpnID;    // Weapon event ID
    unsigned short relWpnId;      // Current released weapon ID
 
-   QQueue<Basic::Pair*> newPlayerQueue;   // Queue of new players
+   QMpscQueue<Basic::Pair*> newPlayerQueue; // Queue of new players (lock-free; players are added by any thread)
+
+   // Detonation effects
+   QueuedDetonation* detQueue;   // Detonations queued during the current phase
+   unsigned int nDetQueue;       // Number of queued detonations
+   unsigned int maxDetQueue;     // Size of the 'detQueue' array
+   QueuedDetonation* detBatch;   // Batch of detonations being processed
+   unsigned int maxDetBatch;     // Size of the 'detBatch' array
+   long detLock;                 // Detonation queue semaphore
+
+   PlayerGrid detGrid;           // Player grid (rebuilt for each batch of detonations)
+   Player** detPlayers;          // Players near the detonation
+   unsigned int maxDetPlayers;   // Size of the 'detPlayers' array
+
+   // Datalink messages
+   QueuedDatalinkMsg* dlQueue;   // Messages queued during the current phase
+   unsigned int nDlQueue;        // Number of queued messages
+   unsigned int maxDlQueue;      // Size of the 'dlQueue' array
+   QueuedDatalinkMsg* dlBatch;   // Batch of messages being delivered
+   unsigned int maxDlBatch;      // Size of the 'dlBatch' array
+   long dlLock;                  // Datalink message queue semaphore
+
+   // Networked players' dead reckoning
+   DeadReckoningBatch drBatch;   // NIBs of the networked players (rebuilt each frame)
+
+   // Broad phase
+   PlayerGrid bpGrid;            // Player grid (valid during the players' background processing)
+   LCreal bpMargin;              // Range margin for the players' motion during the frame (meters)
+   LCreal bpCellSize;            // Grid cell size of the next frame (meters)
+   LCreal bpMaxRng;              // Largest range requested during this frame (meters)
+   long bpLock;                  // Broad phase semaphore
 
    IrAtmosphere*          irAtmosphere; // Atmosphere data for IR algorithms
    Basic::Terrain*        terrain;    // Terrain data
@@ -65,6 +65,13 @@ namespace Simulation {
 //
 //    dataRecorder      <DataRecorder>    ! Our Data Recorder
 //
+//    fastTime          <Basic::Boolean>  ! Fast-time mode; see runFastTime() (default: false)
+//
+//    fastTimeBgRatio   <Basic::Number>   ! Fast-time: number of T/C frames per background frame (default: 1)
+//
+//    fastTimeNetworks  <Basic::Boolean>  ! Fast-time: process the interoperability networks with each
+//                                        ! background frame, otherwise they're not processed (default: false)
+//
 //
 // Ownship player:
 //
@@ -140,6 +147,23 @@ namespace Simulation {
 //       display manager's thread.
 //
 //
+// Fast-time mode:
+//
+//    For batch (e.g., Monte Carlo) runs, the 'fastTime' slot replaces the paced
+//    threads with a tight loop, runFastTime(), which is called by the main
+//    application.  Each T/C frame uses a fixed time step of one over 'tcRate',
+//    and every 'fastTimeBgRatio' T/C frames, the background tasks and the
+//    data recorder are processed in the same thread.  The simulated time
+//    (see Simulation) advances by the fixed time step, independent of the
+//    wall-clock time, so runs are repeatable.
+//
+//    While in fast-time mode, createTimeCriticalProcess() and updateData()
+//    do not create any threads and updateData() does not process the
+//    background or network tasks.  The interoperability networks are not
+//    processed unless 'fastTimeNetworks' is true, in which case their input
+//    and output tasks are processed, unpaced, with each background frame.
+//
+//
 // Shutdown:
 //
 //    At shutdown, the user application must send a SHUTDOWN_EVENT event
@@ -216,6 +240,20 @@ public:
    unsigned int getFastForwardRate() const { return fastForwardRate; } // Hz
    virtual bool setFastForwardRate(const unsigned int r);              // Hz
 
+   // ---
+   // Fast-time mode
+   // ---
+   bool isFastTimeEnabled() const;                           // Fast-time mode enabled?
+   unsigned int getFastTimeBgRatio() const;                  // Fast-time: T/C frames per background frame
+   bool isFastTimeNetworksEnabled() const;                   // Fast-time: networks are processed?
+   virtual bool setFastTimeEnabled(const bool enb);
+   virtual bool setFastTimeBgRatio(const unsigned int r);
+   virtual bool setFastTimeNetworksEnabled(const bool enb);
+
+   // Runs 'duration' seconds of simulated time, as fast as possible, in fast-time
+   // mode; returns the number of T/C frames that were run.
+   virtual unsigned int runFastTime(const double duration);
+
    // ---
    // Interoperability network(s) thread support
    // ---
@@ -256,6 +294,9 @@ public:
    virtual bool setSlotOwnshipName(const Basic::String* const);
    virtual bool setSlotFastForwardRate(const Basic::Number* const);
    virtual bool setSlotEnableUpdateTimers(const Basic::Number* const);
+   virtual bool setSlotFastTime(const Basic::Number* const);
+   virtual bool setSlotFastTimeBgRatio(const Basic::Number* const);
+   virtual bool setSlotFastTimeNetworks(const Basic::Number* const);
 
    // ---
    // Basic::Component functions
@@ -311,6 +352,11 @@ private:
    unsigned int bgStackSize;               // Background thread stack size (bytes or zero for system default size)
    SPtr<Basic::Thread> bgThread;           // The optional background thread
 
+   bool ftEnbl;                            // Fast-time mode enabled
+   unsigned int ftBgRatio;                 // Fast-time: T/C frames per background frame
+   bool ftNetEnbl;                         // Fast-time: process the networks
+   unsigned int ftFrameCnt;                // Fast-time: T/C frames since reset
+
    LCreal startupResetTimer;               // Startup RESET timer (sends a RESET_EVENT after timeout)
    const Basic::Time* startupResetTimer0;  // Init value of the startup RESET timer
 };
@@ -10,6 +10,11 @@
 //
 // Description: Very similar to SimLogger, except ASCII output is more verbose and
 //              formatted using tab characters
+//
+// Note: the high rate events (LogPlayerData, LogActiveTrack and LogPassiveTrack)
+//       should be created using their create() functions, which reuse events
+//       from the event's pool (see QPool).  The pools are recycled by the
+//       TabLogger's updateData(), after the logged events have been written.
 //------------------------------------------------------------------------------
 #ifndef __Eaagles_Simulation_TabLogger_H__
 #define __Eaagles_Simulation_TabLogger_H__
@@ -18,7 +23,7 @@
 
 namespace Eaagles {
 
-namespace Basic { class Identifier; }
+namespace Basic { class Identifier; class Number; }
 
 namespace Simulation {
 
@@ -34,6 +39,14 @@ class Simulation;
 // Base class:  Basic::Object -> Basic::Component -> Basic::Logger -> SimLogger -> TabLogger
 // Description: Simulation Event & Data Logger
 // Factory name: TabLogger
+// Slots:
+//    eventPoolSize  <Basic::Number>  ! Max number of recycled events held by each of the
+//                                    ! LogPlayerData, LogActiveTrack and LogPassiveTrack
+//                                    ! event pools; zero disables the pools (default: 1000)
+//
+// Note: the event pools are shared by all TabLoggers, so 'eventPoolSize' applies
+//       to all of them, and the pools' free events are freed when a TabLogger is
+//       shutdown.
 //------------------------------------------------------------------------------
 class TabLogger : public SimLogger
 {
@@ -47,6 +60,16 @@ public:
     virtual void updateTC(const LCreal dt = 0.0f);
     virtual void updateData(const LCreal dt = 0.0);
 
+    // Recycles the pooled events that are no longer referenced
+    static void recycleEvents();
+
+    // Frees the pooled events
+    static void clearEventPools();
+
+    // Max number of events held by each event pool
+    static unsigned int getEventPoolSize();
+    static void setEventPoolSize(const unsigned int n);
+
     //==============================================================================
     // ######### Simulation Log Event Classes #########
     //==============================================================================
@@ -102,9 +125,19 @@ public:
     public:
         LogPlayerData(int theType, const Player* const thePlayer);
         LogPlayerData(int theType, const Player* const thePlayer, const Player* const theSource);
+
+        // Creates an event using a recycled event from the pool, if available
+        static LogPlayerData* create(int theType, const Player* const thePlayer);
+        static LogPlayerData* create(int theType, const Player* const thePlayer, const Player* const theSource);
+        static QPool<LogPlayerData>& getPool()   { return pool; }
+
         virtual const char* getDescription();
         virtual void captureData();
+        virtual void clear();
     private:
+        void initData(int theType, const Player* const thePlayer, const Player* const theSource);
+        static QPool<LogPlayerData> pool;       // Pool of recycled events
+
         int theType;
         SPtr<const Player> thePlayer;
         SPtr<const Player> theSource;   // source of damage, usually a weapon, always a player
@@ -175,9 +208,18 @@ public:
         DECLARE_SUBCLASS(LogActiveTrack,TabLogEvent)
     public:
         LogActiveTrack(int theType, const TrackManager* const mgr, const Track* const trk);
+
+        // Creates an event using a recycled event from the pool, if available
+        static LogActiveTrack* create(int theType, const TrackManager* const mgr, const Track* const trk);
+        static QPool<LogActiveTrack>& getPool()   { return pool; }
+
         virtual const char* getDescription();
         virtual void captureData();
+        virtual void clear();
     private:
+        void initData(int theType, const TrackManager* const mgr, const Track* const trk);
+        static QPool<LogActiveTrack> pool;      // Pool of recycled events
+
         int theType;
         SPtr<const TrackManager> theManager;
         SPtr<const Track> theTrack;
@@ -203,9 +245,18 @@ public:
         DECLARE_SUBCLASS(LogPassiveTrack,TabLogEvent)
     public:
         LogPassiveTrack(int theType, const TrackManager* const mgr, const Track* const trk);
+
+        // Creates an event using a recycled event from the pool, if available
+        static LogPassiveTrack* create(int theType, const TrackManager* const mgr, const Track* const trk);
+        static QPool<LogPassiveTrack>& getPool()   { return pool; }
+
         virtual const char* getDescription();
         virtual void captureData();
+        virtual void clear();
     private:
+        void initData(int theType, const TrackManager* const mgr, const Track* const trk);
+        static QPool<LogPassiveTrack> pool;      // Pool of recycled events
+
         int theType;
         SPtr<const TrackManager> theManager;
         SPtr<const Track> theTrack;
@@ -219,6 +270,13 @@ public:
         osg::Vec3 tgtAngles;
         LCreal sn;              // Signal/Noise
     };
+
+protected:
+    // Slot functions
+    virtual bool setSlotEventPoolSize(const Basic::Number* const num);
+
+    // Basic::Component protected functions
+    virtual bool shutdownNotification();
 };
 
 } // End Simulation namespace
@@ -5,6 +5,7 @@
 #define __Eaagles_Simulation_TrackManager_H__
 
 #include "openeaagles/simulation/System.h"
+#include "openeaagles/basic/osg/Vec3"
 
 namespace Eaagles {
 namespace Simulation {
@@ -33,6 +34,18 @@ class Track;
 //
 //    logTrackUpdates <Boolean>  ! True to log all updates to tracks (default: true)
 //
+// Notes:
+//    1) Derived track managers can use associateReports() to associate new
+//       reports with the predicted track positions.  Only report/track pairs
+//       inside the position, range and range-rate gates are considered (the
+//       reports are binned into a uniform grid of position gate sized cells),
+//       and the gated pairs are then assigned one-to-one, minimizing the total
+//       normalized position error, using an auction algorithm.
+//
+//    2) smoothAndPredictTracks() updates the tracks using the alpha-beta
+//       filter; the track states are processed as a batch of component
+//       arrays, so the loop can be vectorized by the compiler.
+//
 //==============================================================================
 class TrackManager : public System
 {
@@ -64,6 +77,11 @@ public:
    virtual bool getLogTrackUpdates() const;
    virtual bool setLogTrackUpdates(const bool b);
 
+   // Report/track association gates
+   LCreal getPosGate() const                                { return posGate; }  // Position gate (meters)
+   LCreal getRngGate() const                                { return rngGate; }  // Range gate (meters)
+   LCreal getVelGate() const                                { return velGate; }  // Range rate gate (m/s)
+
    // Add a track
    virtual bool addTrack(Track* const t);
 
@@ -82,6 +100,7 @@ public:
 protected:
    static const unsigned int MAX_TRKS = EAAGLES_CONFIG_MAX_TRACKS;         // Max tracks
    static const unsigned int MAX_REPORTS = EAAGLES_CONFIG_MAX_REPORTS;     // Max number of reports
+   static const unsigned int MAX_GATED_PER_TRK = 8;                        // Max number of gated reports per track
 
    unsigned int getNewTrackID()                             { return nextTrkId++; }
 
@@ -96,6 +115,30 @@ protected:
    virtual bool setSlotGamma(const Basic::Number* const num);           // Sets gamma
    virtual bool setSlotLogTrackUpdates(const Basic::Number* const num); // Sets logTrackUpdates
 
+   // Association gates; the derived track managers that associate reports
+   // map their 'positionGate', 'rangeGate' and 'velocityGate' slots to these.
+   virtual bool setPositionGate(const Basic::Number* const num);        // Sets the position gate (meters)
+   virtual bool setRangeGate(const Basic::Number* const num);           // Sets the range gate (meters)
+   virtual bool setVelocityGate(const Basic::Number* const num);        // Sets the range rate gate (m/s)
+
+   // Associates the new reports, with ownship relative positions 'rptPos' and range
+   // rates 'rptRdot', with the current (predicted) tracks.  Results are returned in
+   // report2Track[] and track2Report[] (indices, or -1 if not associated), and the
+   // number of associated report/track pairs is returned.
+   unsigned int associateReports(
+         const osg::Vec3 rptPos[],        // Report positions (ownship relative) (meters)
+         const LCreal rptRdot[],          // Report range rates (m/s)
+         const unsigned int nReports,     // Number of reports
+         const LCreal pGate,              // Position gate (meters)
+         const LCreal rGate,              // Range gate (meters)
+         const LCreal vGate               // Range rate gate (m/s)
+      );
+
+   // Smooth and predict the track list for the next frame using the track input
+   // vectors 'u'.  Only tracks with 'haveU' set use their input vectors.  Input vectors
+   // larger than the position gate, 'pGate', reset the track's position (zero for no gate).
+   void smoothAndPredictTracks(const osg::Vec3 u[], const LCreal age[], const bool haveU[], const LCreal pGate);
+
    // Track List
    Track*              tracks[MAX_TRKS];   // Tracks
    unsigned int        nTrks;              // Number of tracks
@@ -109,12 +152,21 @@ protected:
    LCreal              alpha;              // Alpha parameter
    LCreal              beta;               // Beta parameter
    LCreal              gamma;              // Gamma parameter
+   LCreal              posGate;            // Position Gate (meters) (default: 2.0f * NM2M)
+   LCreal              rngGate;            // Range Gate (meters) (default: 500.0f)
+   LCreal              velGate;            // Velocity (range rate) Gate (m/s) (default: 10.0f)
 
    unsigned int        nextTrkId;          // Next track ID
    unsigned int        firstTrkId;         // First (starting) track ID
 
-   QQueue<Emission*>   emQueue;            // Emission input queue
-   QQueue<LCreal>      snQueue;            // S/N input queue.
+   // Report/track association (see associateReports())
+   int                 report2Track[MAX_REPORTS];  // Track index associated with each report (or -1)
+   int                 track2Report[MAX_TRKS];     // Report index associated with each track (or -1)
+
+   // The queues are only used while holding 'queueLock', which keeps each
+   // emission and its S/N value together, so they don't need their own locks.
+   QSpscQueue<Emission*> emQueue;          // Emission input queue
+   QSpscQueue<LCreal>  snQueue;            // S/N input queue.
    mutable long        queueLock;          // Semaphore to protect both emQueue and snQueue
 
    // System class Interface -- phase() callbacks
@@ -126,6 +178,17 @@ protected:
 private:
    void initData();
 
+   // Auction assignment of the gated report/track pairs
+   void auctionAssignment(const unsigned int nReports);
+
+   // Gated report/track pairs (used by associateReports())
+   struct GatedReport {
+      int    report;                       // Report index
+      LCreal benefit;                      // Assignment benefit (one minus the normalized position error)
+   };
+   GatedReport         gated[MAX_TRKS][MAX_GATED_PER_TRK];   // Gated reports for each track
+   unsigned int        nGated[MAX_TRKS];                     // Number of gated reports for each track
+
    LCreal              maxTrackAge;        // Max Track age (sec)
    short               type;               // Track type: the bit-wise OR of various type bits (see enum TypeBits in Track.h)
    bool                logTrackUpdates;    // input slot; if false, updates to tracks are not logged.
@@ -139,7 +202,10 @@ private:
 // Slots:
 //   positionGate   <Basic::Number>  ! Position Gate (meters) (default: 2.0f * NM2M)
 //   rangeGate      <Basic::Number>  ! Range Gate (meters) (default: 500.0f)
-//   velocityGate   <Basic::Number>  ! Velocity Gate (m/s) (default: 10.0f)
+//   velocityGate   <Basic::Number>  ! Velocity (range rate) Gate (m/s) (default: 10.0f)
+//
+// Note: reports are associated with the tracks using their positions, ranges
+//       and range rates (see TrackManager::associateReports()).
 //
 //==============================================================================
 class AirTrkMgr : public TrackManager
@@ -148,28 +214,11 @@ class AirTrkMgr : public TrackManager
 public:
     AirTrkMgr();
 
-    LCreal getPosGate()                             { return posGate;}
-    LCreal getRngGate()                             { return rngGate;}
-    LCreal getVelGate()                             { return velGate;}
-
 protected:
     virtual void processTrackList(const LCreal dt);     // Process the reports into a track list
 
 private:
     void initData();
-    bool setPositionGate(const Basic::Number* const num);
-    bool setRangeGate(const Basic::Number* const num);
-    bool setVelocityGate(const Basic::Number* const num);
-
-    // Prediction parameters
-    LCreal              posGate;            // Position Gate (meters)
-    LCreal              rngGate;            // Range Gate (meters)
-    LCreal              velGate;            // Velocity Gate (m/s)
-
-    // Used by processTrackList()
-   bool** report2TrackMatch;                 // Report/Track matched matrix
-   unsigned int* reportNumMatches;           // Number of matches for each report
-   unsigned int* trackNumMatches;            // Number of matcher for each track
 };
 
 //==============================================================================
@@ -177,6 +226,13 @@ private:
 //
 // Description: Very simple Ground Moving Target Indication (GMTI) Track Manager
 // Factory name: GmtiTrkMgr
+// Slots:
+//   positionGate   <Basic::Number>  ! Position Gate (meters) (default: 1000.0f)
+//   rangeGate      <Basic::Number>  ! Range Gate (meters) (default: 500.0f)
+//   velocityGate   <Basic::Number>  ! Velocity (range rate) Gate (m/s) (default: 10.0f)
+//
+// Note: reports are associated with the tracks using their positions, ranges
+//       and range rates (see TrackManager::associateReports()).
 //
 //==============================================================================
 class GmtiTrkMgr : public TrackManager
@@ -184,16 +240,12 @@ class GmtiTrkMgr : public TrackManager
     DECLARE_SUBCLASS(GmtiTrkMgr,TrackManager)
 public:
     GmtiTrkMgr();
+
 protected:
     virtual void processTrackList(const LCreal dt);     // Process the reports into a track list
 
 private:
     void initData();
-
-    // Used by processTrackList()
-   bool** report2TrackMatch;                 // Report/Track matched matrix
-   unsigned int* reportNumMatches;           // Number of matches for each report
-   unsigned int* trackNumMatches;            // Number of matcher for each track
 };
 
 //==============================================================================
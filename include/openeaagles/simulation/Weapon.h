@@ -252,6 +252,11 @@ public:
    // Check local players for the effects of the detonation
    virtual void checkDetonationEffect();
 
+   // Processes the effect of our detonation, at 'detPos', on player 'p';
+   // called by Simulation::processDetonations() for the players within range
+   // of detonations that were queued by checkDetonationEffect().
+   virtual bool detonationEffect(Player* const p, const osg::Vec3& detPos, const LCreal maxRng, const Player* const tgt);
+
    // Sets the target velocity (m/s) relative to ownship velocity
    virtual bool setTargetVelocity(const osg::Vec3d& newTgtVel);
 
@@ -82,6 +82,10 @@ Component::Component()
 
    // Child components and our container
    components = 0;
+   children = 0;
+   retired = 0;
+   traversals = 0;
+   childLock = 0;
    containerPtr = 0;
 
    // Nothing selected
@@ -107,6 +111,10 @@ void Component::copyData(const Component& org, const bool cc)
 
    if (cc) {
       components = 0;
+      children = 0;
+      retired = 0;
+      traversals = 0;
+      childLock = 0;
       containerPtr = 0;
       selected = 0;
       selection = 0;
@@ -137,7 +145,7 @@ void Component::copyData(const Component& org, const bool cc)
       tmp->unref();
    }
    else
-      components = 0;
+      swapComponents(0);
 
    // Timing statistics
    if (timingStats != 0) timingStats->unref();
@@ -166,7 +174,8 @@ void Component::deleteData()
     selected = 0;
 
     // Delete list of components
-    components = 0;
+    swapComponents(0);
+    freeRetiredChildren(true);
 
     if (timingStats != 0) {
        timingStats->unref();
@@ -304,66 +313,76 @@ void Component::printTimingStats()
 //------------------------------------------------------------------------------
 void Component::updateTC(const LCreal dt)
 {
-    // Update all my children
-    PairStream* subcomponents = getComponents();
-    if (subcomponents != 0) {
-        if (selection != 0) {
-            // When we've selected only one
-            if (selected != 0) selected->tcFrame(dt);
-        }
-        else {
-            // When we should update them all
-            List::Item* item = subcomponents->getFirstItem();
-            while (item != 0) {
-                Pair* pair = static_cast<Pair*>(item->getValue());
-                Component* obj = static_cast<Component*>( pair->object() );
-                if (obj != 0) obj->tcFrame(dt);
-                item = item->getNext();
+    // Update all my children (using our cached child array)
+    if (children != 0) {
+        Component** const list = beginTraversal();
+        if (list != 0) {
+            if (selection != 0) {
+                // When we've selected only one
+                if (selected != 0) updateChildTC(selected, dt);
+            }
+            else {
+                // When we should update them all
+                for (Component** p = list; *p != 0; p++) {
+                    updateChildTC(*p, dt);
+                }
             }
         }
-        subcomponents->unref();
-        subcomponents = 0;
+        endTraversal();
     }
     
     // Update our log file
     if (elog0 != 0) {
-        elog0->tcFrame(dt);
+        updateChildTC(elog0, dt);
     }
 }
 
+//------------------------------------------------------------------------------
+// updateChildTC() -- time critical update of one of our child components
+//------------------------------------------------------------------------------
+void Component::updateChildTC(Component* const child, const LCreal dt)
+{
+    child->tcFrame(dt);
+}
+
 
 //------------------------------------------------------------------------------
 // updateData() -- Update non-time critical (background) stuff here
 //------------------------------------------------------------------------------
 void Component::updateData(const LCreal dt)
 {
-    // Update all my children
-    PairStream* subcomponents = getComponents();
-    if (subcomponents != 0) {
-        if (selection != 0) {
-            // When we've selected only one
-            if (selected != 0) selected->updateData(dt);
-        }
-        else {
-            // When we should update them all
-            List::Item* item = subcomponents->getFirstItem();
-            while (item != 0) {
-                Pair* pair = static_cast<Pair*>(item->getValue());
-                Component* obj = static_cast<Component*>(pair->object());
-                if (obj != 0) obj->updateData(dt);
-                item = item->getNext();
+    // Update all my children (using our cached child array)
+    if (children != 0) {
+        Component** const list = beginTraversal();
+        if (list != 0) {
+            if (selection != 0) {
+                // When we've selected only one
+                if (selected != 0) updateChildData(selected, dt);
+            }
+            else {
+                // When we should update them all
+                for (Component** p = list; *p != 0; p++) {
+                    updateChildData(*p, dt);
+                }
             }
         }
-        subcomponents->unref();
-        subcomponents = 0;
+        endTraversal();
     }
     
     // Update our log file
     if (elog0 != 0) {
-        elog0->updateData(dt);
+        updateChildData(elog0, dt);
     }
 }
 
+//------------------------------------------------------------------------------
+// updateChildData() -- background update of one of our child components
+//------------------------------------------------------------------------------
+void Component::updateChildData(Component* const child, const LCreal dt)
+{
+    child->updateData(dt);
+}
+
 //------------------------------------------------------------------------------
 // getComponents() -- returns a ref()'d pointer to our list of components;
 //                    need to unref() when completed.
@@ -746,7 +765,7 @@ void Component::processComponents(
    // ---
    // Swap lists
    // ---
-   components = newList;
+   swapComponents(newList);
    newList->unref();
 
    // ---
@@ -770,6 +789,102 @@ void Component::processComponents(
    }
 }
 
+//------------------------------------------------------------------------------
+// swapComponents() -- sets our components list to 'newList' and rebuilds our
+// cached child array.  The old list and array are retired, and not freed until
+// there are no traversals of our children in progress, because updateTC() and
+// updateData() use the array without ref()'ing it.
+//------------------------------------------------------------------------------
+void Component::swapComponents(PairStream* const newList)
+{
+   // Build the new child array
+   Component** newChildren = 0;
+   if (newList != 0) {
+      newChildren = new Component*[newList->entries() + 1];
+      unsigned int n = 0;
+      List::Item* item = newList->getFirstItem();
+      while (item != 0) {
+         Pair* pair = static_cast<Pair*>(item->getValue());
+         Component* cp = static_cast<Component*>(pair->object());
+         if (cp != 0) newChildren[n++] = cp;
+         item = item->getNext();
+      }
+      newChildren[n] = 0;
+   }
+
+   lcLock(childLock);
+
+   // Swap
+   PairStream* oldList = components.getRefPtr();
+   Component** oldChildren = children;
+   components = newList;
+   children = newChildren;
+
+   // Retire the old list (and its ref()) and array
+   if (oldList != 0 || oldChildren != 0) {
+      RetiredChildren* r = new RetiredChildren();
+      r->children = oldChildren;
+      r->list = oldList;
+      r->next = retired;
+      retired = r;
+   }
+
+   lcUnlock(childLock);
+
+   freeRetiredChildren(false);
+}
+
+//------------------------------------------------------------------------------
+// beginTraversal() -- counts a traversal of our children and returns our child
+// array, which isn't freed until the matching endTraversal().
+//------------------------------------------------------------------------------
+Component** Component::beginTraversal()
+{
+   long n = lcAtomicLoad(traversals);
+   while (!lcAtomicCompareAndSwap(traversals, n, n + 1)) {
+      n = lcAtomicLoad(traversals);
+   }
+   return children;
+}
+
+//------------------------------------------------------------------------------
+// endTraversal() -- ends a traversal of our children; the last one out frees
+// the child arrays that were retired while it was in progress.
+//------------------------------------------------------------------------------
+void Component::endTraversal()
+{
+   long n = lcAtomicLoad(traversals);
+   while (!lcAtomicCompareAndSwap(traversals, n, n - 1)) {
+      n = lcAtomicLoad(traversals);
+   }
+   if (n == 1 && retired != 0) freeRetiredChildren(false);
+}
+
+//------------------------------------------------------------------------------
+// freeRetiredChildren() -- frees the retired child arrays, if there are no
+// traversals of our children in progress, or if 'all' is true.
+//------------------------------------------------------------------------------
+void Component::freeRetiredChildren(const bool all)
+{
+   // A traversal that starts after this check uses our current child array,
+   // which can't be retired while we hold the lock.
+   lcLock(childLock);
+   RetiredChildren* r = 0;
+   if (all || lcAtomicCompareAndSwap(traversals, 0, 0)) {
+      r = retired;
+      retired = 0;
+   }
+   lcUnlock(childLock);
+
+   while (r != 0) {
+      RetiredChildren* next = r->next;
+      if (r->children != 0) delete[] r->children;
+      if (r->list != 0) r->list->unref();
+      delete r;
+      r = next;
+   }
+}
+
 //------------------------------------------------------------------------------
 // setSelectionName() -- Name (or number) of component to selected
 //------------------------------------------------------------------------------
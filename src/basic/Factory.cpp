@@ -5,6 +5,7 @@
 #include "openeaagles/basic/Factory.h"
 
 #include "openeaagles/basic/Object.h"
+#include "openeaagles/basic/FactoryTable.h"
 
 #include "openeaagles/basic/Logger.h"
 #include "openeaagles/basic/FileReader.h"
@@ -72,409 +73,230 @@
 #include "openeaagles/basic/ubf/Agent.h"
 #include "openeaagles/basic/ubf/Arbiter.h"
 
-#include <cstring>
+#include <iostream>
 
 namespace Eaagles {
 namespace Basic {
 
-Factory::Factory()
-{}
+//------------------------------------------------------------------------------
+// Create functions for the depreciated UDP handler form names
+//------------------------------------------------------------------------------
+static Object* newBroadcastHandler()
+{
+    std::cerr << "\nWARNING! Name 'BroadcastHandler' has been depreciated, use 'UdpBroadcastHandler' instead.\n\n";
+    return new UdpBroadcastHandler();
+}
 
-Object* Factory::createObj(const char* name)
+static Object* newMulticastHandler()
 {
-    Object* obj = 0;
+    std::cerr << "\nWARNING! Name 'MulticastHandler' has been depreciated, use 'UdpMulticastHandler' instead.\n\n";
+    return new UdpMulticastHandler();
+}
 
+static Object* newUdpHandler()
+{
+    std::cerr << "\nWARNING! Name 'UdpHandler' has been depreciated, use 'UdpUnicastHandler' instead.\n\n";
+    return new UdpUnicastHandler();
+}
+
+//------------------------------------------------------------------------------
+// addClasses() -- adds our classes to the factory table
+//------------------------------------------------------------------------------
+static void addClasses(FactoryTable& table)
+{
     // Numbers
-    if ( std::strcmp(name, Number::getFactoryName()) == 0 ) {
-        obj = new Number();
-    }
-    else if ( std::strcmp(name, Complex::getFactoryName()) == 0 ) {
-        obj = new Complex();
-    }
-    else if ( std::strcmp(name, Integer::getFactoryName()) == 0 ) {
-        obj = new Integer();
-    }
-    else if ( std::strcmp(name, Float::getFactoryName()) == 0 ) {
-        obj = new Float();
-    }
-    else if ( std::strcmp(name, Boolean::getFactoryName()) == 0 ) {
-        obj = new Boolean();
-    }
-    else if ( std::strcmp(name, Decibel::getFactoryName()) == 0 ) {
-        obj = new Decibel();
-    }
-    else if ( std::strcmp(name, LatLon::getFactoryName()) == 0 ) {
-        obj = new LatLon();
-    }
-    else if ( std::strcmp(name, Add::getFactoryName()) == 0 ) {
-        obj = new Add();
-    }
-    else if ( std::strcmp(name, Subtract::getFactoryName()) == 0 ) {
-        obj = new Subtract();
-    }
-    else if ( std::strcmp(name, Multiply::getFactoryName()) == 0 ) {
-        obj = new Multiply();
-    }
-    else if ( std::strcmp(name, Divide::getFactoryName()) == 0 ) {
-        obj = new Divide();
-    }
- 
+    table.add<Number>();
+    table.add<Complex>();
+    table.add<Integer>();
+    table.add<Float>();
+    table.add<Boolean>();
+    table.add<Decibel>();
+    table.add<LatLon>();
+    table.add<Add>();
+    table.add<Subtract>();
+    table.add<Multiply>();
+    table.add<Divide>();
+
     // Components
-    else if ( std::strcmp(name, FileReader::getFactoryName()) == 0 ) {
-        obj = new FileReader();
-    }
-    else if ( std::strcmp(name, Logger::getFactoryName()) == 0 ) {
-        obj = new Logger();
-    }
-    else if ( std::strcmp(name, Statistic::getFactoryName()) == 0 ) {
-        obj = new Statistic();
-    }
+    table.add<FileReader>();
+    table.add<Logger>();
+    table.add<Statistic>();
 
     // Transformations
-    else if ( std::strcmp(name, Translation::getFactoryName()) == 0 ) {
-        obj = new Translation();
-    }
-    else if ( std::strcmp(name, Rotation::getFactoryName()) == 0 ) {
-        obj = new Rotation();
-    }
-    else if ( std::strcmp(name, Scale::getFactoryName()) == 0 ) {
-        obj = new Scale();
-    }
-    
+    table.add<Translation>();
+    table.add<Rotation>();
+    table.add<Scale>();
+
     // Tables
-    else if ( std::strcmp(name, Table1::getFactoryName()) == 0 ) {
-        obj = new Table1();
-    }
-    else if ( std::strcmp(name, Table2::getFactoryName()) == 0 ) {
-        obj = new Table2();
-    }
-    else if ( std::strcmp(name, Table3::getFactoryName()) == 0 ) {
-        obj = new Table3();
-    }
-    else if ( std::strcmp(name, Table4::getFactoryName()) == 0 ) {
-        obj = new Table4();
-    }
-    else if ( std::strcmp(name, Table5::getFactoryName()) == 0 ) {
-        obj = new Table5();
-    }
+    table.add<Table1>();
+    table.add<Table2>();
+    table.add<Table3>();
+    table.add<Table4>();
+    table.add<Table5>();
 
     // Timers
-    else if ( std::strcmp(name, UpTimer::getFactoryName()) == 0 ) {
-        obj = new UpTimer();
-    }
-    else if ( std::strcmp(name, DownTimer::getFactoryName()) == 0 ) {
-        obj = new DownTimer();
-    }
+    table.add<UpTimer>();
+    table.add<DownTimer>();
 
     // Units: Angles
-    else if ( std::strcmp(name, Degrees::getFactoryName()) == 0 ) {
-        obj = new Degrees();
-    }
-    else if ( std::strcmp(name, Radians::getFactoryName()) == 0 ) {
-        obj = new Radians();
-    }
-    else if ( std::strcmp(name, Semicircles::getFactoryName()) == 0 ) {
-        obj = new Semicircles();
-    }
+    table.add<Degrees>();
+    table.add<Radians>();
+    table.add<Semicircles>();
 
     // Units: Areas
-    else if ( std::strcmp(name, SquareMeters::getFactoryName()) == 0 ) {
-        obj = new SquareMeters();
-    }
-    else if ( std::strcmp(name, SquareFeet::getFactoryName()) == 0 ) {
-        obj = new SquareFeet();
-    }
-    else if ( std::strcmp(name, SquareInches::getFactoryName()) == 0 ) {
-        obj = new SquareInches();
-    }
-    else if ( std::strcmp(name, SquareYards::getFactoryName()) == 0 ) {
-        obj = new SquareYards();
-    }
-    else if ( std::strcmp(name, SquareMiles::getFactoryName()) == 0 ) {
-        obj = new SquareMiles();
-    }
-    else if ( std::strcmp(name, SquareCentiMeters::getFactoryName()) == 0 ) {
-        obj = new SquareCentiMeters();
-    }
-    else if ( std::strcmp(name, SquareMilliMeters::getFactoryName()) == 0 ) {
-        obj = new SquareMilliMeters();
-    }
-    else if ( std::strcmp(name, SquareKiloMeters::getFactoryName()) == 0 ) {
-        obj = new SquareKiloMeters();
-    }
-    else if ( std::strcmp(name, DecibelSquareMeters::getFactoryName()) == 0 ) {
-        obj = new DecibelSquareMeters();
-    }
+    table.add<SquareMeters>();
+    table.add<SquareFeet>();
+    table.add<SquareInches>();
+    table.add<SquareYards>();
+    table.add<SquareMiles>();
+    table.add<SquareCentiMeters>();
+    table.add<SquareMilliMeters>();
+    table.add<SquareKiloMeters>();
+    table.add<DecibelSquareMeters>();
 
     // Units: Distances
-    else if ( std::strcmp(name, Meters::getFactoryName()) == 0 ) {
-        obj = new Meters();
-    }
-    else if ( std::strcmp(name, CentiMeters::getFactoryName()) == 0 ) {
-        obj = new CentiMeters();
-    }
-    else if ( std::strcmp(name, MicroMeters::getFactoryName()) == 0 ) {
-        obj = new MicroMeters();
-    }
-    else if ( std::strcmp(name, Microns::getFactoryName()) == 0 ) {
-        obj = new Microns();
-    }
-    else if ( std::strcmp(name, KiloMeters::getFactoryName()) == 0 ) {
-        obj = new KiloMeters();
-    }
-    else if ( std::strcmp(name, Inches::getFactoryName()) == 0 ) {
-        obj = new Inches();
-    }
-    else if ( std::strcmp(name, Feet::getFactoryName()) == 0 ) {
-        obj = new Feet();
-    }
-    else if ( std::strcmp(name, NauticalMiles::getFactoryName()) == 0 ) {
-        obj = new NauticalMiles();
-    }
-    else if ( std::strcmp(name, StatuteMiles::getFactoryName()) == 0 ) {
-        obj = new StatuteMiles();
-    }
+    table.add<Meters>();
+    table.add<CentiMeters>();
+    table.add<MicroMeters>();
+    table.add<Microns>();
+    table.add<KiloMeters>();
+    table.add<Inches>();
+    table.add<Feet>();
+    table.add<NauticalMiles>();
+    table.add<StatuteMiles>();
 
     // Units: Energies
-    else if ( std::strcmp(name, KiloWattHours::getFactoryName()) == 0 ) {
-        obj = new KiloWattHours();
-    }
-    else if ( std::strcmp(name, BTUs::getFactoryName()) == 0 ) {
-        obj = new BTUs();
-    }
-    else if ( std::strcmp(name, Calories::getFactoryName()) == 0 ) {
-        obj = new Calories();
-    }
-    else if ( std::strcmp(name, FootPounds::getFactoryName()) == 0 ) {
-        obj = new FootPounds();
-    }
-    else if ( std::strcmp(name, Joules::getFactoryName()) == 0 ) {
-        obj = new Joules();
-    }
+    table.add<KiloWattHours>();
+    table.add<BTUs>();
+    table.add<Calories>();
+    table.add<FootPounds>();
+    table.add<Joules>();
 
     // Units: Forces
-    else if ( std::strcmp(name, Newtons::getFactoryName()) == 0 ) {
-        obj = new Newtons();
-    }
-    else if ( std::strcmp(name, KiloNewtons::getFactoryName()) == 0 ) {
-        obj = new KiloNewtons();
-    }
-    else if ( std::strcmp(name, Poundals::getFactoryName()) == 0 ) {
-        obj = new Poundals();
-    }
-    else if ( std::strcmp(name, PoundForces::getFactoryName()) == 0 ) {
-        obj = new PoundForces();
-    }
+    table.add<Newtons>();
+    table.add<KiloNewtons>();
+    table.add<Poundals>();
+    table.add<PoundForces>();
 
     // Units: Frequencies
-    else if ( std::strcmp(name, Hertz::getFactoryName()) == 0 ) {
-        obj = new Hertz();
-    }
-    else if ( std::strcmp(name, KiloHertz::getFactoryName()) == 0 ) {
-        obj = new KiloHertz();
-    }
-    else if ( std::strcmp(name, MegaHertz::getFactoryName()) == 0 ) {
-        obj = new MegaHertz();
-    }
-    else if ( std::strcmp(name, GigaHertz::getFactoryName()) == 0 ) {
-        obj = new GigaHertz();
-    }
-    else if ( std::strcmp(name, TeraHertz::getFactoryName()) == 0 ) {
-        obj = new TeraHertz();
-    }
+    table.add<Hertz>();
+    table.add<KiloHertz>();
+    table.add<MegaHertz>();
+    table.add<GigaHertz>();
+    table.add<TeraHertz>();
 
     // Units: Masses
-    else if ( std::strcmp(name, Grams::getFactoryName()) == 0 ) {
-        obj = new Grams();
-    }
-    else if ( std::strcmp(name, KiloGrams::getFactoryName()) == 0 ) {
-        obj = new KiloGrams();
-    }
-    else if ( std::strcmp(name, Slugs::getFactoryName()) == 0 ) {
-        obj = new Slugs();
-    }
+    table.add<Grams>();
+    table.add<KiloGrams>();
+    table.add<Slugs>();
 
     // Units: Powers
-    else if ( std::strcmp(name, KiloWatts::getFactoryName()) == 0 ) {
-        obj = new KiloWatts();
-    }
-    else if ( std::strcmp(name, Watts::getFactoryName()) == 0 ) {
-        obj = new Watts();
-    }
-    else if ( std::strcmp(name, MilliWatts::getFactoryName()) == 0 ) {
-        obj = new MilliWatts();
-    }
-    else if ( std::strcmp(name, Horsepower::getFactoryName()) == 0 ) {
-        obj = new Horsepower();
-    }
-    else if ( std::strcmp(name, DecibelWatts::getFactoryName()) == 0 ) {
-        obj = new DecibelWatts();
-    }
-    else if ( std::strcmp(name, DecibelMilliWatts::getFactoryName()) == 0 ) {
-        obj = new DecibelMilliWatts();
-    }
+    table.add<KiloWatts>();
+    table.add<Watts>();
+    table.add<MilliWatts>();
+    table.add<Horsepower>();
+    table.add<DecibelWatts>();
+    table.add<DecibelMilliWatts>();
 
     // Units: Time
-    else if ( std::strcmp(name, Seconds::getFactoryName()) == 0 ) {
-        obj = new Seconds();
-    }
-    else if ( std::strcmp(name, MilliSeconds::getFactoryName()) == 0 ) {
-        obj = new MilliSeconds();
-    }
-    else if ( std::strcmp(name, MicroSeconds::getFactoryName()) == 0 ) {
-        obj = new MicroSeconds();
-    }
-    else if ( std::strcmp(name, NanoSeconds::getFactoryName()) == 0 ) {
-        obj = new NanoSeconds();
-    }
-    else if ( std::strcmp(name, Minutes::getFactoryName()) == 0 ) {
-        obj = new Minutes();
-    }
-    else if ( std::strcmp(name, Hours::getFactoryName()) == 0 ) {
-        obj = new Hours();
-    }
-    else if ( std::strcmp(name, Days::getFactoryName()) == 0 ) {
-        obj = new Days();
-    }
+    table.add<Seconds>();
+    table.add<MilliSeconds>();
+    table.add<MicroSeconds>();
+    table.add<NanoSeconds>();
+    table.add<Minutes>();
+    table.add<Hours>();
+    table.add<Days>();
 
     // Units: Velocities
-    else if ( std::strcmp(name, AngularVelocity::getFactoryName()) == 0 ) {
-        obj = new AngularVelocity();
-    }
-    else if ( std::strcmp(name, LinearVelocity::getFactoryName()) == 0 ) {
-        obj = new LinearVelocity();
-    }
+    table.add<AngularVelocity>();
+    table.add<LinearVelocity>();
 
     // Colors
-    else if ( std::strcmp(name, Color::getFactoryName()) == 0 ) {
-        obj = new Color();
-    }
-    else if ( std::strcmp(name, Cie::getFactoryName()) == 0 ) {
-        obj = new Cie();
-    }
-    else if ( std::strcmp(name, Cmy::getFactoryName()) == 0 ) {
-        obj = new Cmy();
-    }
-    else if ( std::strcmp(name, Hls::getFactoryName()) == 0 ) {
-        obj = new Hls();
-    }
-    else if ( std::strcmp(name, Hsv::getFactoryName()) == 0 ) {
-        obj = new Hsv();
-    }
-    else if ( std::strcmp(name, Hsva::getFactoryName()) == 0 ) {
-        obj = new Hsva();
-    }
-    else if ( std::strcmp(name, Rgb::getFactoryName()) == 0 ) {
-        obj = new Rgb();
-    }
-    else if ( std::strcmp(name, Rgba::getFactoryName()) == 0 ) {
-        obj = new Rgba();
-    }
-    else if ( std::strcmp(name, Yiq::getFactoryName()) == 0 ) {
-        obj = new Yiq();
-    }
+    table.add<Color>();
+    table.add<Cie>();
+    table.add<Cmy>();
+    table.add<Hls>();
+    table.add<Hsv>();
+    table.add<Hsva>();
+    table.add<Rgb>();
+    table.add<Rgba>();
+    table.add<Yiq>();
 
     // Functions
-    else if ( std::strcmp(name, Func1::getFactoryName()) == 0 ) {
-        obj = new Func1();
-    }
-    else if ( std::strcmp(name, Func2::getFactoryName()) == 0 ) {
-        obj = new Func2();
-    }
-    else if ( std::strcmp(name, Func3::getFactoryName()) == 0 ) {
-        obj = new Func3();
-    }
-    else if ( std::strcmp(name, Func4::getFactoryName()) == 0 ) {
-        obj = new Func4();
-    }
-    else if ( std::strcmp(name, Func5::getFactoryName()) == 0 ) {
-        obj = new Func5();
-    }
-    else if ( std::strcmp(name, Polynomial::getFactoryName()) == 0 ) {
-        obj = new Polynomial();
-    }
+    table.add<Func1>();
+    table.add<Func2>();
+    table.add<Func3>();
+    table.add<Func4>();
+    table.add<Func5>();
+    table.add<Polynomial>();
 
     // Network handlers
-    else if ( std::strcmp(name, TcpClient::getFactoryName()) == 0 ) {
-        obj = new TcpClient();
-    }
-    else if ( std::strcmp(name, TcpServerSingle::getFactoryName()) == 0 ) {
-        obj = new TcpServerSingle();
-    }
-    else if ( std::strcmp(name, TcpServerMultiple::getFactoryName()) == 0 ) {
-        obj = new TcpServerMultiple();
-    }
-    else if ( std::strcmp(name, UdpBroadcastHandler::getFactoryName()) == 0 ) {
-        obj = new UdpBroadcastHandler();
-    }
-    else if ( std::strcmp(name, UdpMulticastHandler::getFactoryName()) == 0 ) {
-        obj = new UdpMulticastHandler();
-    }
-    else if ( std::strcmp(name, UdpUnicastHandler::getFactoryName()) == 0 ) {
-        obj = new UdpUnicastHandler();
-    }
+    table.add<TcpClient>();
+    table.add<TcpServerSingle>();
+    table.add<TcpServerMultiple>();
+    table.add<UdpBroadcastHandler>();
+    table.add<UdpMulticastHandler>();
+    table.add<UdpUnicastHandler>();
     // Network handlers (backward compatible form names for UDP oriented communication)
     // the mapping to old form names was added 16 Nov 2013 -- should be removed in the future
-    else if ( std::strcmp(name, "BroadcastHandler") == 0 ) {
-        std::cerr << "\nWARNING! Name 'BroadcastHandler' has been depreciated, use 'UdpBroadcastHandler' instead.\n\n";
-        obj = new UdpBroadcastHandler();
-    }
-    else if ( std::strcmp(name, "MulticastHandler") == 0 ) {
-        std::cerr << "\nWARNING! Name 'MulticastHandler' has been depreciated, use 'UdpMulticastHandler' instead.\n\n";
-        obj = new UdpMulticastHandler();
-    }
-    else if ( std::strcmp(name, "UdpHandler") == 0 ) {
-        std::cerr << "\nWARNING! Name 'UdpHandler' has been depreciated, use 'UdpUnicastHandler' instead.\n\n";
-        obj = new UdpUnicastHandler();
-    }
+    table.add("BroadcastHandler", newBroadcastHandler);
+    table.add("MulticastHandler", newMulticastHandler);
+    table.add("UdpHandler", newUdpHandler);
 
     // Random number generator and distributions
-    else if ( std::strcmp(name, Rng::getFactoryName()) == 0 ) {
-        obj = new Rng();
-    }
-    else if ( std::strcmp(name, Exponential::getFactoryName()) == 0 ) {
-        obj = new Exponential();
-    }
-    else if ( std::strcmp(name, Lognormal::getFactoryName()) == 0 ) {
-        obj = new Lognormal();
-    }
-    else if ( std::strcmp(name, Pareto::getFactoryName()) == 0 ) {
-        obj = new Pareto();
-    }
-    else if ( std::strcmp(name, Uniform::getFactoryName()) == 0 ) {
-        obj = new Uniform();
-    }
+    table.add<Rng>();
+    table.add<Exponential>();
+    table.add<Lognormal>();
+    table.add<Pareto>();
+    table.add<Uniform>();
 
     // General I/O Devices
-    else if ( std::strcmp(name, IoHandler::getFactoryName()) == 0 ) {
-        obj = new IoHandler();
-    }
-    else if ( std::strcmp(name, IoData::getFactoryName()) == 0 ) {
-        obj = new IoData();
-    }
+    table.add<IoHandler>();
+    table.add<IoData>();
 
     // Earth models
-    else if ( std::strcmp(name, EarthModel::getFactoryName()) == 0 ) {
-        obj = new EarthModel();
-    }
+    table.add<EarthModel>();
 
     // Thread pool
-    else if ( std::strcmp(name, ThreadPool::getFactoryName()) == 0 ) {
-       obj = new ThreadPool();
-    }
+    table.add<ThreadPool>();
 
     // Ubf
-    else if ( std::strcmp(name, Ubf::Agent::getFactoryName()) == 0 ) {
-        obj = new Ubf::Agent();
-    }
-    else if ( std::strcmp(name, Ubf::Arbiter::getFactoryName()) == 0 ) {
-        obj = new Ubf::Arbiter();
-    }
+    table.add<Ubf::Agent>();
+    table.add<Ubf::Arbiter>();
+}
+
+static FactoryTable factoryTable(addClasses);
+
+// Factory names registered by the user libraries (constructed on first use, so
+// names can be registered by static initializers)
+static FactoryTable& userTable()
+{
+    static FactoryTable table;
+    return table;
+}
 
+Factory::Factory()
+{}
+
+Object* Factory::createObj(const char* name)
+{
+    Object* obj = factoryTable.createObj(name);
+    if (obj == 0) obj = userTable().createObj(name);
     return obj;
 }
 
+//------------------------------------------------------------------------------
+// registerObj() -- registers a user factory name; the names of our own classes
+// can not be replaced.
+//------------------------------------------------------------------------------
+bool Factory::registerObj(const char* const name, FactoryTable::CreateFunc func)
+{
+    bool ok = false;
+    if (name != 0 && func != 0 && factoryTable.find(name) == 0) {
+        ok = userTable().add(name, func);
+    }
+    return ok;
+}
+
 }  // end namespace Basic
 }  // end namespace Eaagles
-
-
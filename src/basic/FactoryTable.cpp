@@ -0,0 +1,181 @@
+//------------------------------------------------------------------------------
+// Class: FactoryTable
+//------------------------------------------------------------------------------
+
+#include "openeaagles/basic/FactoryTable.h"
+#include "openeaagles/basic/support.h"
+
+#include <cstring>
+
+namespace Eaagles {
+namespace Basic {
+
+//------------------------------------------------------------------------------
+// Constructor & destructor
+//------------------------------------------------------------------------------
+FactoryTable::FactoryTable(InitFunc init)
+{
+   table = 0;
+   size = 0;
+   n = 0;
+   initFunc = init;
+   initialized = 0;
+   lock = 0;
+}
+
+FactoryTable::~FactoryTable()
+{
+   if (table != 0) {
+      for (unsigned int i = 0; i < size; i++) {
+         if (table[i].name != 0) delete[] table[i].name;
+      }
+      delete[] table;
+      table = 0;
+   }
+   size = 0;
+   n = 0;
+}
+
+//------------------------------------------------------------------------------
+// createObj() -- returns a new object of factory name 'name', or zero
+//------------------------------------------------------------------------------
+Object* FactoryTable::createObj(const char* const name)
+{
+   Object* obj = 0;
+   CreateFunc func = find(name);
+   if (func != 0) obj = func();
+   return obj;
+}
+
+//------------------------------------------------------------------------------
+// find() -- returns the create function of factory name 'name', or zero
+//------------------------------------------------------------------------------
+FactoryTable::CreateFunc FactoryTable::find(const char* const name)
+{
+   if (name == 0) return 0;
+   if (lcAtomicLoad(initialized) == 0) initialize();
+
+   CreateFunc func = 0;
+   lcLock(lock);
+   const Entry* p = lookup(name);
+   if (p != 0) func = p->func;
+   lcUnlock(lock);
+   return func;
+}
+
+//------------------------------------------------------------------------------
+// add() -- adds factory name 'name'; returns false if it's already in the table
+//------------------------------------------------------------------------------
+bool FactoryTable::add(const char* const name, CreateFunc func)
+{
+   if (name == 0 || func == 0) return false;
+   if (lcAtomicLoad(initialized) == 0) initialize();
+
+   lcLock(lock);
+   bool ok = insert(name, func);
+   lcUnlock(lock);
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// entries() -- number of factory names in the table
+//------------------------------------------------------------------------------
+unsigned int FactoryTable::entries()
+{
+   if (lcAtomicLoad(initialized) == 0) initialize();
+   return n;
+}
+
+//------------------------------------------------------------------------------
+// initialize() -- fills the table using the 'init' function
+//------------------------------------------------------------------------------
+void FactoryTable::initialize()
+{
+   // The init function adds the classes to a private table using its add(),
+   // which locks the private table, not us; other threads wait on our lock.
+   lcLock(lock);
+   if (initialized == 0) {
+      FactoryTable tmp;
+      tmp.initialized = 1;
+      if (initFunc != 0) initFunc(tmp);
+      take(tmp);
+      lcAtomicStore(initialized, 1);
+   }
+   lcUnlock(lock);
+}
+
+//------------------------------------------------------------------------------
+// take() -- moves the 'src' table's entries to our empty table (table is locked)
+//------------------------------------------------------------------------------
+void FactoryTable::take(FactoryTable& src)
+{
+   delete[] table;
+   table = src.table;
+   size = src.size;
+   n = src.n;
+
+   src.table = 0;
+   src.size = 0;
+   src.n = 0;
+}
+
+//------------------------------------------------------------------------------
+// insert() -- inserts 'name' into the hash table (table is locked)
+//------------------------------------------------------------------------------
+bool FactoryTable::insert(const char* const name, CreateFunc func)
+{
+   if (lookup(name) != 0) return false;
+
+   // Grow the table to keep it less than half full
+   if ( (n + 1) * 2 > size ) {
+      const unsigned int newSize = (size > 0 ? size * 2 : 64);
+      Entry* newTable = new Entry[newSize];
+      for (unsigned int i = 0; i < newSize; i++) {
+         newTable[i].name = 0;
+         newTable[i].hash = 0;
+         newTable[i].func = 0;
+      }
+      for (unsigned int i = 0; i < size; i++) {
+         if (table[i].name != 0) {
+            unsigned int k = (table[i].hash & (newSize - 1));
+            while (newTable[k].name != 0) k = ((k + 1) & (newSize - 1));
+            newTable[k] = table[i];
+         }
+      }
+      delete[] table;
+      table = newTable;
+      size = newSize;
+   }
+
+   const unsigned int h = lcStrhash(name);
+   unsigned int k = (h & (size - 1));
+   while (table[k].name != 0) k = ((k + 1) & (size - 1));
+
+   const size_t len = std::strlen(name) + 1;
+   table[k].name = new char[len];
+   lcStrcpy(table[k].name, len, name);
+   table[k].hash = h;
+   table[k].func = func;
+   n++;
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// lookup() -- finds the entry for 'name' (table is locked)
+//------------------------------------------------------------------------------
+const FactoryTable::Entry* FactoryTable::lookup(const char* const name) const
+{
+   if (table == 0) return 0;
+
+   const unsigned int h = lcStrhash(name);
+   unsigned int k = (h & (size - 1));
+   while (table[k].name != 0) {
+      if (table[k].hash == h && std::strcmp(table[k].name, name) == 0) return &table[k];
+      k = ((k + 1) & (size - 1));
+   }
+   return 0;
+}
+
+} // End Basic namespace
+} // End Eaagles namespace
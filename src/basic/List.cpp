@@ -11,18 +11,76 @@ namespace Basic {
 
 IMPLEMENT_EMPTY_SLOTTABLE_SUBCLASS(List,"List")
 
+//------------------------------------------------------------------------------
+// List::Item pool -- items are allocated from slabs of ITEMS_PER_SLAB items, and
+// the deleted items are kept on a free list for reuse by any list.  The slabs
+// are never released.
+//------------------------------------------------------------------------------
+static const unsigned int ITEMS_PER_SLAB = 256;
+
+struct FreeItem {
+    FreeItem* next;
+};
+
+static FreeItem* freeItems = 0;     // Free list
+static long poolLock = 0;           // Free list semaphore
+
+void* List::Item::operator new(size_t size)
+{
+    if (size != sizeof(Item)) return ::operator new(size);
+
+    lcLock(poolLock);
+    FreeItem* p = freeItems;
+    if (p == 0) {
+        // The free list is empty, so allocate (outside of the lock) a new slab
+        lcUnlock(poolLock);
+        char* slab = static_cast<char*>( ::operator new(ITEMS_PER_SLAB * sizeof(Item)) );
+        lcLock(poolLock);
+        for (unsigned int i = 1; i < ITEMS_PER_SLAB; i++) {
+            FreeItem* q = reinterpret_cast<FreeItem*>(slab + i * sizeof(Item));
+            q->next = freeItems;
+            freeItems = q;
+        }
+        p = reinterpret_cast<FreeItem*>(slab);
+    }
+    else {
+        freeItems = p->next;
+    }
+    lcUnlock(poolLock);
+    return p;
+}
+
+void List::Item::operator delete(void* p, size_t size)
+{
+    if (p == 0) return;
+    if (size != sizeof(Item)) {
+        ::operator delete(p);
+        return;
+    }
+
+    FreeItem* q = static_cast<FreeItem*>(p);
+    lcLock(poolLock);
+    q->next = freeItems;
+    freeItems = q;
+    lcUnlock(poolLock);
+}
+
 //------------------------------------------------------------------------------
 // Constructor(s)
 //------------------------------------------------------------------------------
-List::List() : headP(0), tailP(0), num(0)
+List::List()
 {
     STANDARD_CONSTRUCTOR()
+
+    initData();
 }
 
-List::List(const LCreal values[], const unsigned int nv) : headP(0), tailP(0), num(0)
+List::List(const LCreal values[], const unsigned int nv)
 {
     STANDARD_CONSTRUCTOR()
 
+    initData();
+
     // Create Float's for each value and add to the list.
     for (unsigned int i = 0; i < nv; i++) {
         Float* p = new Float(values[i]);
@@ -31,10 +89,12 @@ List::List(const LCreal values[], const unsigned int nv) : headP(0), tailP(0), n
     }
 }
 
-List::List(const int values[], const unsigned int nv) : headP(0), tailP(0), num(0)
+List::List(const int values[], const unsigned int nv)
 {
     STANDARD_CONSTRUCTOR()
 
+    initData();
+
     // Create Integer's for each value and add to the list.
     for (unsigned int i = 0; i < nv; i++) {
         Integer* p = new Integer(values[i]);
@@ -44,6 +104,20 @@ List::List(const int values[], const unsigned int nv) : headP(0), tailP(0), num(
 }
 
 
+void List::initData()
+{
+    headP = 0;
+    tailP = 0;
+    num = 0;
+    changeCnt = 1;
+
+    posIndex = 0;
+    maxPosIndex = 0;
+    posIndexCnt = 0;
+    posLookupCnt = 0;
+    indexLock = 0;
+}
+
 //------------------------------------------------------------------------------
 // copyData(), deleteData() -- copy (delete) member data
 //------------------------------------------------------------------------------
@@ -51,12 +125,8 @@ void List::copyData(const List& org, const bool cc)
 {
     BaseClass::copyData(org);
 
-    if (cc) {
-        // When called from copy constructor, init these pointers
-        headP = 0;
-        tailP = 0;
-        num = 0;
-    }
+    // When called from copy constructor, init our pointers
+    if (cc) initData();
 
     // Clear the old list (if any)
     clear();
@@ -75,6 +145,11 @@ void List::copyData(const List& org, const bool cc)
 void List::deleteData()
 {
     clear();
+
+    if (posIndex != 0) delete[] posIndex;
+    posIndex = 0;
+    maxPosIndex = 0;
+    posIndexCnt = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -264,6 +339,7 @@ Object* List::removeHead()
         headP = headP->next;
         p = d->getValue();
         num--;
+        changed();
         if (headP != 0) headP->previous = 0;
         else tailP = 0;
         delete d;
@@ -283,6 +359,7 @@ Object* List::removeTail()
         tailP = tailP->previous;
         p = d->getValue();
         num--;
+        changed();
         if (tailP != 0) tailP->next = 0;
         else headP = 0;
         delete d;
@@ -307,6 +384,7 @@ bool List::insert(List::Item* newItem, List::Item* refItem)
             newItem->previous->next = newItem;
             newItem->next = refItem;
             num++;
+            changed();
         }
     }
     else {
@@ -329,6 +407,7 @@ Object* List::remove(List::Item* item)
     else if (item != 0) {
         value = item->getValue();
         num--;
+        changed();
         Item* p = item->getPrevious();
         Item* n = item->getNext();
         n->previous = p;
@@ -349,6 +428,7 @@ void List::addHead(List::Item* item)
     headP = item;
     if (tailP == 0) tailP = item;
     num++;
+    changed();
 }
 
 //------------------------------------------------------------------------------
@@ -362,6 +442,7 @@ void List::addTail(List::Item* item)
     tailP = item;
     if (headP == 0) headP = item;
     num++;
+    changed();
 }
 
 //------------------------------------------------------------------------------
@@ -397,11 +478,49 @@ bool List::operator!=(const List& l) const
 const Object* List::getPosition1(const unsigned int n) const
 {
     if (n < 1 || n > num) return 0;
-    unsigned int i = 1;
-    const Item* p = getFirstItem();
-    while (i < n && p != 0) {
-        p = p->getNext();
-        i++;
+
+    // ---
+    // Large lists: use the index, which is built by the second lookup since
+    // the list was last changed (so a list that's changed between each lookup
+    // isn't indexed each time).
+    // ---
+    if (num >= MIN_INDEX_ENTRIES) {
+        const Object* obj = 0;
+        bool found = false;
+        lcLock(indexLock);
+        if (posIndexCnt != changeCnt && posLookupCnt == changeCnt) {
+            buildPosIndex();
+        }
+        if (posIndexCnt == changeCnt) {
+            obj = posIndex[n-1]->getValue();
+            found = true;
+        }
+        else {
+            posLookupCnt = changeCnt;
+        }
+        lcUnlock(indexLock);
+        if (found) return obj;
+    }
+
+    // ---
+    // Walk the list from the nearest end
+    // ---
+    const Item* p = 0;
+    if (n <= (num / 2)) {
+        unsigned int i = 1;
+        p = getFirstItem();
+        while (i < n && p != 0) {
+            p = p->getNext();
+            i++;
+        }
+    }
+    else {
+        unsigned int i = num;
+        p = getLastItem();
+        while (i > n && p != 0) {
+            p = p->getPrevious();
+            i--;
+        }
     }
     if (p != 0)
         return p->getValue();
@@ -409,6 +528,26 @@ const Object* List::getPosition1(const unsigned int n) const
         return 0;
 }
 
+//------------------------------------------------------------------------------
+// buildPosIndex() -- builds the position index (called with 'indexLock' locked)
+//------------------------------------------------------------------------------
+void List::buildPosIndex() const
+{
+    if (maxPosIndex < num) {
+        if (posIndex != 0) delete[] posIndex;
+        maxPosIndex = num;
+        posIndex = new Item*[maxPosIndex];
+    }
+
+    unsigned int i = 0;
+    Item* p = headP;
+    while (p != 0 && i < num) {
+        posIndex[i++] = p;
+        p = p->getNext();
+    }
+    posIndexCnt = changeCnt;
+}
+
 
 //------------------------------------------------------------------------------
 // serialize() -- print the value of this object to the output stream sout.
@@ -82,17 +82,26 @@ bool Object::isClassType(const std::type_info& type) const
 // Check factory name
 bool Object::isFactoryName(const char name[]) const
 {
-    if (name == 0) return false;
-    if ( std::strcmp(_static.fname, name) == 0 )  return true;
-    else return false;
+    return findFactoryName(&_static, name);
 }
 
 // Check form name
 bool Object::isFormName(const char name[]) const
+{
+    return findFactoryName(&_static, name);
+}
+
+// Check the factory names of class 'p' and its base classes; the name is
+// hashed once and compared with each class' factory name hash, so the names
+// are only compared when the hashes match.
+bool Object::findFactoryName(const _Static* const p, const char name[])
 {
     if (name == 0) return false;
-    if ( std::strcmp(_static.fname, name) == 0 )  return true;
-    else return false;
+    const unsigned int h = lcStrhash(name);
+    for (const _Static* s = p; s != 0; s = s->bstatic) {
+        if (s->fhash == h && s->fname != 0 && std::strcmp(s->fname, name) == 0) return true;
+    }
+    return false;
 }
 
 // Copy object data -- derived classes should call
@@ -201,6 +210,20 @@ bool Object::setSlotByName(const char* const slotname, Object* const obj)
     return ok;
 }
 
+//------------------------------------------------------------------------------
+// setSlotAtIndex() -- set the value of the slot at SlotTable index 'slotindex'
+//                 (e.g., a slot index that was resolved by slotName2Index()).
+//                 Returns true if the slot and object were processed; returns
+//                 false if there was an error.
+//------------------------------------------------------------------------------
+bool Object::setSlotAtIndex(const int slotindex, Object* const obj)
+{
+    bool ok = false;
+    if (obj == 0) return ok;
+    if (slotindex > 0 && slotindex <= static_cast<int>(slotTable->n())) ok = setSlotByIndex(slotindex,obj);
+    return ok;
+}
+
 //------------------------------------------------------------------------------
 // getSlotByName() -- Returns a pointer to the slot named 'slotname'.
 //------------------------------------------------------------------------------
@@ -351,7 +374,7 @@ Object::_Static::_Static(
       const char* const fn,
       const SlotTable* const p,
       const _Static* const bs
-   ) : classIndex(ci), cname(cn), fname(fn), st(p), bstatic(bs), count(0), mc(0), tc(0)
+   ) : classIndex(ci), cname(cn), fname(fn), fhash(lcStrhash(fn)), st(p), bstatic(bs), count(0), mc(0), tc(0)
 {
 }
 
@@ -1,7 +1,9 @@
 #include "openeaagles/basic/PairStream.h"
 #include "openeaagles/basic/Pair.h"
 
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
 
 namespace Eaagles {
 namespace Basic {
@@ -14,14 +16,37 @@ IMPLEMENT_EMPTY_SLOTTABLE_SUBCLASS(PairStream, "PairStream")
 PairStream::PairStream()
 {
     STANDARD_CONSTRUCTOR()
+
+    initData();
 }
 
+void PairStream::initData()
+{
+    nameIndex = 0;
+    nNameIndex = 0;
+    maxNameIndex = 0;
+    nameIndexCnt = 0;
+    nameLookupCnt = 0;
+    nameLock = 0;
+}
 
 //------------------------------------------------------------------------------
 // copyData(), deleteData() -- copy (delete) member data
 //------------------------------------------------------------------------------
-EMPTY_COPYDATA(PairStream)
-EMPTY_DELETEDATA(PairStream)
+void PairStream::copyData(const PairStream& org, const bool cc)
+{
+    BaseClass::copyData(org);
+    if (cc) initData();
+}
+
+void PairStream::deleteData()
+{
+    if (nameIndex != 0) delete[] nameIndex;
+    nameIndex = 0;
+    nNameIndex = 0;
+    maxNameIndex = 0;
+    nameIndexCnt = 0;
+}
 
 
 //------------------------------------------------------------------------------
@@ -57,30 +82,101 @@ const Pair* PairStream::findByType(const std::type_info& type) const
 //------------------------------------------------------------------------------
 Pair* PairStream::findByName(const char* const slotname)
 {
-    Pair* p = 0;
-    if (slotname != 0) {
-        const Item* item = getFirstItem();
-        while (item != 0 && p == 0) {
-            Pair* pair = const_cast<Pair*>(static_cast<const Pair*>(item->getValue()));
-            if ( *(pair->slot()) == slotname ) p = pair;
-            item = item->getNext();
+    return const_cast<Pair*>(findByName1(slotname));
+}
+
+const Pair* PairStream::findByName(const char* const slotname) const
+{
+    return findByName1(slotname);
+}
+
+const Pair* PairStream::findByName1(const char* const slotname) const
+{
+    if (slotname == 0) return 0;
+
+    // ---
+    // Large streams: binary search of the name index, which is built by the
+    // second lookup since the stream was last changed.
+    // ---
+    if (entries() >= MIN_INDEX_ENTRIES) {
+        const Pair* p = 0;
+        bool indexed = false;
+        lcLock(nameLock);
+        if (nameIndexCnt != getChangeCount() && nameLookupCnt == getChangeCount()) {
+            buildNameIndex();
+        }
+        if (nameIndexCnt == getChangeCount()) {
+            // First entry that's not less than 'slotname' -- the matching pair
+            // with the lowest position, if any.
+            unsigned int lo = 0;
+            unsigned int hi = nNameIndex;
+            while (lo < hi) {
+                const unsigned int mid = lo + (hi - lo) / 2;
+                if (std::strcmp(nameIndex[mid].name, slotname) < 0) lo = mid + 1;
+                else hi = mid;
+            }
+            if (lo < nNameIndex && std::strcmp(nameIndex[lo].name, slotname) == 0) {
+                p = nameIndex[lo].pair;
+            }
+            indexed = true;
+        }
+        else {
+            nameLookupCnt = getChangeCount();
         }
+        lcUnlock(nameLock);
+        if (indexed) return p;
+    }
+
+    // ---
+    // Walk the stream
+    // ---
+    const Pair* p = 0;
+    const Item* item = getFirstItem();
+    while (item != 0 && p == 0) {
+        const Pair* pair = static_cast<const Pair*>(item->getValue());
+        if ( *(pair->slot()) == slotname ) p = pair;
+        item = item->getNext();
     }
     return p;
 }
 
-const Pair* PairStream::findByName(const char* const slotname) const
+//------------------------------------------------------------------------------
+// buildNameIndex() -- builds the name index (called with 'nameLock' locked);
+// pairs without a slot name are not indexed (they never match a name).
+//------------------------------------------------------------------------------
+bool PairStream::nameEntryLess(const NameEntry& a, const NameEntry& b)
 {
-    const Pair* p = 0;
-    if (slotname != 0) {
-        const Item* item = getFirstItem();
-        while (item != 0 && p == 0) {
-            const Pair* pair = static_cast<const Pair*>(item->getValue());
-            if ( *(pair->slot()) == slotname ) p = pair;
-            item = item->getNext();
+    const int c = std::strcmp(a.name, b.name);
+    return (c < 0 || (c == 0 && a.pos < b.pos));
+}
+
+void PairStream::buildNameIndex() const
+{
+    if (maxNameIndex < entries()) {
+        if (nameIndex != 0) delete[] nameIndex;
+        maxNameIndex = entries();
+        nameIndex = new NameEntry[maxNameIndex];
+    }
+
+    unsigned int n = 0;
+    unsigned int pos = 0;
+    const Item* item = getFirstItem();
+    while (item != 0 && n < maxNameIndex) {
+        const Pair* pair = static_cast<const Pair*>(item->getValue());
+        const Identifier* slot = pair->slot();
+        if (slot != 0 && !slot->isEmpty()) {
+            nameIndex[n].name = *slot;
+            nameIndex[n].pos = pos;
+            nameIndex[n].pair = pair;
+            n++;
         }
+        pos++;
+        item = item->getNext();
     }
-    return p;
+    std::sort(nameIndex, nameIndex + n, nameEntryLess);
+
+    nNameIndex = n;
+    nameIndexCnt = getChangeCount();
 }
 
 
@@ -0,0 +1,919 @@
+//------------------------------------------------------------------------------
+// Compiled (binary) description files
+//
+// Description: The description files, after they've been passed through the
+//    preprocessor, are parsed by lcParser(), which uses the form function to
+//    construct each object and then sets the object's slots by name.  These
+//    functions compile a description file into a binary form of its object
+//    tree, with each form name listed once and each slot name resolved to its
+//    slot table index, which is then loaded in a single pass without the
+//    preprocessor, the lexical generator or the parser.
+//
+// Functions:
+//
+//    bool lcCompile(filename, compiledFilename, func, numErrors)
+//       Compiles the (preprocessed) description file, 'filename', into the
+//       file 'compiledFilename'.  The form function, 'func', is used to
+//       resolve the slot indices, so it must construct the same objects as
+//       the form function that's passed to lcLoadCompiled().  The compiled
+//       file is not written if there were any errors.  Returns true if the
+//       compiled file was written.
+//
+//    Object* lcLoadCompiled(compiledFilename, func, numErrors)
+//       Returns an Object that was constructed from the compiled file.  Zero
+//       is returned if this isn't a valid compiled file, or if the slot table
+//       of any of its forms has changed since the file was compiled.
+//
+//    bool lcIsCompiledCurrent(compiledFilename)
+//       Returns true if the compiled file is valid and none of the files that
+//       it was compiled from have changed (see Dependencies below).  Use this to
+//       decide whether the description file needs to be passed through the
+//       preprocessor again before calling lcParserCached().
+//
+//    Object* lcParserCached(filename, compiledFilename, func, numErrors, sourceFilename)
+//       Loads the compiled file if it's newer than the source file (e.g., the
+//       original .epp file; default: 'filename') and none of its dependencies
+//       have changed.  Otherwise, or if the compiled file can't be loaded,
+//       parses 'filename' using lcParser() and then, if there were no errors,
+//       recompiles it into 'compiledFilename'.
+//
+// Dependencies:
+//    The compiled file lists the files that it was compiled from, each with
+//    its size and a hash of its contents: the (preprocessed) description file
+//    itself and every file named by the preprocessor's line markers (e.g.,
+//    # 1 "include.epp"), which is the closure of the #included files, even
+//    those that only define macros.  A compiled file is out of date when any
+//    of these files has changed, even if the source file's modification time
+//    hasn't.  The file names are as the preprocessor wrote them, so relative
+//    names are relative to the preprocessor's working directory.
+//
+// Compiled file format (host byte order):
+//
+//    header:     "OECF", version number and the byte order check (0x01020304)
+//    form table: number of forms, then for each form: its form name and a
+//                hash of its slot table's slot names
+//    dependency  number of files, then for each file: its name, its size and
+//      table:    a hash of its contents (size 0xffffffff: file didn't exist)
+//    root node:  NODE_FORM, NODE_PAIRSTREAM or NODE_PAIR
+//
+//    Nodes are a one byte node type followed by:
+//       NODE_FORM         form table index and the number of slots, then for
+//                         each slot: its slot table index and value (node)
+//       NODE_PAIRSTREAM   number of pairs, then for each pair: the slot name
+//                         and the value (node)
+//       NODE_PAIR         slot name and value (node)
+//       NODE_STRING       string
+//       NODE_IDENTIFIER   string
+//       NODE_BOOLEAN      one byte
+//       NODE_INTEGER      32 bit integer
+//       NODE_FLOAT        64 bit float
+//       NODE_LIST         number of numbers, then each number (node)
+//
+//    Strings are a 32 bit length followed by the characters and a null.
+//------------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "openeaagles/basic/Parser.h"
+#include "openeaagles/basic/support.h"
+#include "openeaagles/basic/Object.h"
+#include "openeaagles/basic/String.h"
+#include "openeaagles/basic/Identifier.h"
+#include "openeaagles/basic/Integer.h"
+#include "openeaagles/basic/Float.h"
+#include "openeaagles/basic/Boolean.h"
+#include "openeaagles/basic/Pair.h"
+#include "openeaagles/basic/PairStream.h"
+#include "openeaagles/basic/List.h"
+#include "Lexical.h"
+#include "Parser.hpp"
+
+namespace Eaagles {
+namespace Basic {
+
+static const char MAGIC[4] = { 'O', 'E', 'C', 'F' };
+static const unsigned int VERSION = 2;
+static const unsigned int BYTE_ORDER_CHECK = 0x01020304;
+
+static const unsigned int MAX_FORMS = 4096;          // Max number of form names in a file
+static const unsigned int FORM_HASH_SIZE = 8192;     // Form name hash table size (power of two)
+static const unsigned int MAX_DEPS = 1024;           // Max number of dependencies (files) of a file
+static const unsigned int NO_FILE = 0xffffffff;      // Dependency size of a file that doesn't exist
+
+// Node types
+enum {
+   NODE_FORM = 1,
+   NODE_PAIRSTREAM,
+   NODE_PAIR,
+   NODE_STRING,
+   NODE_IDENTIFIER,
+   NODE_BOOLEAN,
+   NODE_INTEGER,
+   NODE_FLOAT,
+   NODE_LIST
+};
+
+//------------------------------------------------------------------------------
+// hashString() -- FNV-1a hash of a string
+//------------------------------------------------------------------------------
+static unsigned int hashString(const char* const s, const unsigned int h0 = 2166136261u)
+{
+   unsigned int h = h0;
+   for (const char* p = s; *p != '\0'; p++) {
+      h ^= static_cast<unsigned char>(*p);
+      h *= 16777619u;
+   }
+   return h;
+}
+
+//------------------------------------------------------------------------------
+// hashSlotTable() -- hash of the names in the object's slot table; used to
+// detect forms whose slot tables have changed since the file was compiled.
+//------------------------------------------------------------------------------
+static unsigned int hashSlotTable(const Object* const obj)
+{
+   unsigned int h = 2166136261u;
+   const char* name = obj->slotIndex2Name(1);
+   for (int i = 2; name != 0; i++) {
+      h = hashString(name, h);
+      h ^= 0xff;           // separator
+      h *= 16777619u;
+      name = obj->slotIndex2Name(i);
+   }
+   return h;
+}
+
+//------------------------------------------------------------------------------
+// hashFile() -- size and FNV-1a hash of a file's contents; returns false
+// (with size NO_FILE) if the file can't be read.
+//------------------------------------------------------------------------------
+static bool hashFile(const char* const filename, unsigned int* const size, unsigned int* const hash)
+{
+   *size = NO_FILE;
+   *hash = 0;
+   std::ifstream fin;
+   fin.open(filename, std::ios::in | std::ios::binary);
+   if (!fin.is_open()) return false;
+
+   unsigned int n = 0;
+   unsigned int h = 2166136261u;
+   char buff[4096];
+   while (fin.good()) {
+      fin.read(buff, sizeof(buff));
+      const std::streamsize cnt = fin.gcount();
+      for (std::streamsize i = 0; i < cnt; i++) {
+         h ^= static_cast<unsigned char>(buff[i]);
+         h *= 16777619u;
+      }
+      n += static_cast<unsigned int>(cnt);
+   }
+   const bool ok = !fin.bad();
+   fin.close();
+
+   if (ok) {
+      *size = n;
+      *hash = h;
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// getDependencies() -- the names of the files that a preprocessed file was
+// made from: the file itself and the file names of its line markers, e.g.,
+//    # 21 "test.epp" 2
+//    #line 21 "test.epp"
+// (the same markers as the Lexical generator, but every marker is used, even
+// the markers of #included files that don't contain any tokens).  Names in
+// angle brackets, such as "<built-in>", aren't files.  Returns the number of
+// names, which are added to 'names' (at most 'max').
+//------------------------------------------------------------------------------
+static unsigned int getDependencies(const char* const filename, std::string names[], const unsigned int max)
+{
+   unsigned int n = 0;
+   names[n++] = filename;
+
+   std::ifstream fin;
+   fin.open(filename, std::ios::in);
+   std::string ln;
+   while (fin.is_open() && std::getline(fin, ln)) {
+      if (ln.empty() || ln[0] != '#') continue;
+
+      // '#', optional 'line', the line number, then the quoted file name
+      size_t i = 1;
+      if (ln.compare(i, 4, "line") == 0) i += 4;
+      const size_t j = ln.find_first_not_of(' ', i);
+      if (j == i || j == std::string::npos || ln[j] < '0' || ln[j] > '9') continue;
+      const size_t k = ln.find_first_not_of("0123456789", j);
+      if (k == std::string::npos || ln[k] != ' ') continue;
+      const size_t q = ln.find_first_not_of(' ', k);
+      if (q == std::string::npos || ln[q] != '"') continue;
+
+      std::string name;
+      bool closed = false;
+      for (size_t m = q + 1; m < ln.size() && !closed; m++) {
+         if (ln[m] == '\\' && m + 1 < ln.size()) name += ln[++m];
+         else if (ln[m] == '"') closed = true;
+         else name += ln[m];
+      }
+      if (!closed || name.empty() || name[0] == '<') continue;
+
+      bool found = false;
+      for (unsigned int d = 0; d < n && !found; d++) {
+         found = (names[d] == name);
+      }
+      if (!found && n < max) names[n++] = name;
+   }
+   fin.close();
+   return n;
+}
+
+//------------------------------------------------------------------------------
+// isNewer() -- Returns true if file 'a' exists and either file 'b' does not
+// exist or 'a' was modified no earlier than 'b'.
+//------------------------------------------------------------------------------
+static bool isNewer(const char* const a, const char* const b)
+{
+   struct stat sa;
+   if (stat(a, &sa) != 0) return false;
+   struct stat sb;
+   if (stat(b, &sb) != 0) return true;
+   return (sa.st_mtime >= sb.st_mtime);
+}
+
+//==============================================================================
+// Compiler -- a recursive descent version of the parser's grammar (see Parser.y)
+// that writes the compiled object tree instead of constructing the objects.
+//==============================================================================
+
+struct Compiler {
+   Lexical* lex;                       // Lex generator
+   ParserFormFunc func;                // Form function
+   int errCount;                       // Error count
+
+   int tok;                            // Current token
+   YYSTYPE val;                        // Current token's value
+   std::string str;                    // Current token's string value
+
+   std::string out;                    // Compiled object tree
+
+   char* formNames[MAX_FORMS];         // Form table: form names,
+   Object* forms[MAX_FORMS];           //   default objects (for slot names) and
+   unsigned int formHashes[MAX_FORMS]; //   slot table hashes
+   unsigned int nForms;                // Number of forms
+   int formIndex[FORM_HASH_SIZE];      // Form name hash table (form table index + 1)
+};
+
+static void compileError(Compiler& c, const char* const msg, const char* const arg = 0)
+{
+   std::cerr << c.lex->getFilename() << ", line ";
+   std::cerr << c.lex->getLineNumber() << ": ";
+   std::cerr << msg;
+   if (arg != 0) std::cerr << arg;
+   std::cerr << std::endl;
+   c.errCount++;
+}
+
+// Gets the next token
+static void nextToken(Compiler& c)
+{
+   c.tok = c.lex->yylex();
+   c.val = yylval;
+   if (c.tok == IDENT || c.tok == SLOT_ID || c.tok == STRING_LITERAL) {
+      c.str = c.val.cvalp;
+      delete[] c.val.cvalp;
+      c.val.cvalp = 0;
+   }
+}
+
+static void putBytes(Compiler& c, const void* const p, const size_t n)
+{
+   c.out.append(static_cast<const char*>(p), n);
+}
+
+static void putByte(Compiler& c, const unsigned char v)     { putBytes(c, &v, sizeof(v)); }
+static void putUInt(Compiler& c, const unsigned int v)      { putBytes(c, &v, sizeof(v)); }
+static void putInt(Compiler& c, const int v)                { putBytes(c, &v, sizeof(v)); }
+static void putDouble(Compiler& c, const double v)          { putBytes(c, &v, sizeof(v)); }
+
+static void putString(std::string& out, const char* const s)
+{
+   const unsigned int len = static_cast<unsigned int>(std::strlen(s));
+   out.append(reinterpret_cast<const char*>(&len), sizeof(len));
+   out.append(s, len + 1);
+}
+
+// Returns the form table index of form 'name', adding it if needed; also
+// returns the form's default object, if any, which is used to resolve slot names.
+static unsigned int compileFormName(Compiler& c, const char* const name, Object** const obj)
+{
+   unsigned int h = hashString(name) & (FORM_HASH_SIZE - 1);
+   while (c.formIndex[h] != 0) {
+      const unsigned int i = c.formIndex[h] - 1;
+      if (std::strcmp(c.formNames[i], name) == 0) {
+         *obj = c.forms[i];
+         return i;
+      }
+      h = (h + 1) & (FORM_HASH_SIZE - 1);
+   }
+
+   if (c.nForms >= MAX_FORMS) {
+      compileError(c, "too many form names: ", name);
+      *obj = 0;
+      return 0;
+   }
+
+   const unsigned int i = c.nForms++;
+   const size_t len = std::strlen(name) + 1;
+   c.formNames[i] = new char[len];
+   lcStrcpy(c.formNames[i], len, name);
+   c.forms[i] = (c.func != 0 ? c.func(name) : 0);
+   c.formHashes[i] = (c.forms[i] != 0 ? hashSlotTable(c.forms[i]) : 0);
+   c.formIndex[h] = i + 1;
+
+   if (c.forms[i] == 0) compileError(c, "undefined form name: ", name);
+
+   *obj = c.forms[i];
+   return i;
+}
+
+static bool compileValue(Compiler& c);
+
+// arglist -- writes the number of arguments followed by each argument; a form's
+// arguments are written using their slot indices, and a pair stream's arguments
+// are written using their slot names (see Parser.y for the positional names)
+static bool compileArgList(Compiler& c, const bool isForm, const Object* const form, const int closing)
+{
+   const size_t countPos = c.out.size();
+   putUInt(c, 0);
+
+   unsigned int n = 0;
+   while (c.tok != closing) {
+      std::string name;
+      if (c.tok == SLOT_ID) {
+         name = c.str;
+         nextToken(c);
+      }
+      else {
+         char cbuf[20];
+         std::sprintf(cbuf,"%i",n+1);
+         name = cbuf;
+      }
+
+      if (isForm) {
+         int slotindex = 0;
+         if (form != 0) {
+            slotindex = form->slotName2Index(name.c_str());
+            if (slotindex <= 0) compileError(c, "error while setting slot name: ", name.c_str());
+         }
+         putInt(c, slotindex);
+      }
+      else {
+         putString(c.out, name.c_str());
+      }
+
+      if (!compileValue(c)) return false;
+      n++;
+   }
+   nextToken(c);
+
+   std::memcpy(&c.out[countPos], &n, sizeof(n));
+   return true;
+}
+
+// form -- '(' IDENT arglist ')' or '{' arglist '}'
+static bool compileForm(Compiler& c)
+{
+   bool ok = false;
+   if (c.tok == '(') {
+      nextToken(c);
+      if (c.tok == IDENT) {
+         Object* form = 0;
+         const unsigned int i = compileFormName(c, c.str.c_str(), &form);
+         putByte(c, NODE_FORM);
+         putUInt(c, i);
+         nextToken(c);
+         ok = compileArgList(c, true, form, ')');
+      }
+   }
+   else if (c.tok == '{') {
+      nextToken(c);
+      putByte(c, NODE_PAIRSTREAM);
+      ok = compileArgList(c, false, 0, '}');
+   }
+   return ok;
+}
+
+// number -- INTEGERconstant or FLOATINGconstant
+static bool compileNumber(Compiler& c)
+{
+   bool ok = true;
+   if (c.tok == INTEGERconstant) {
+      putByte(c, NODE_INTEGER);
+      putInt(c, static_cast<int>(c.val.lval));
+   }
+   else if (c.tok == FLOATINGconstant) {
+      putByte(c, NODE_FLOAT);
+      putDouble(c, c.val.dval);
+   }
+   else {
+      ok = false;
+   }
+   if (ok) nextToken(c);
+   return ok;
+}
+
+// value -- form or prim
+static bool compileValue(Compiler& c)
+{
+   bool ok = true;
+   switch (c.tok) {
+      case '(' :
+      case '{' : {
+         ok = compileForm(c);
+      }
+      break;
+
+      case STRING_LITERAL : {
+         putByte(c, NODE_STRING);
+         putString(c.out, c.str.c_str());
+         nextToken(c);
+      }
+      break;
+
+      case IDENT : {
+         putByte(c, NODE_IDENTIFIER);
+         putString(c.out, c.str.c_str());
+         nextToken(c);
+      }
+      break;
+
+      case BOOLconstant : {
+         putByte(c, NODE_BOOLEAN);
+         putByte(c, (c.val.bval ? 1 : 0));
+         nextToken(c);
+      }
+      break;
+
+      case '[' : {
+         // numlist -- one or more numbers
+         nextToken(c);
+         putByte(c, NODE_LIST);
+         const size_t countPos = c.out.size();
+         putUInt(c, 0);
+         unsigned int n = 0;
+         while (ok && c.tok != ']') {
+            ok = compileNumber(c);
+            n++;
+         }
+         if (ok && n > 0) {
+            std::memcpy(&c.out[countPos], &n, sizeof(n));
+            nextToken(c);
+         }
+         else {
+            ok = false;
+         }
+      }
+      break;
+
+      default : {
+         ok = compileNumber(c);
+      }
+      break;
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// lcCompile() -- compiles the description file 'filename' into the compiled
+//      file 'compiledFilename'.  Func is the name of the form constructor
+//      function.
+//------------------------------------------------------------------------------
+bool lcCompile(const char* filename, const char* compiledFilename, ParserFormFunc func, int* numErrors)
+{
+   if (filename == 0 || compiledFilename == 0) return false;
+
+   // Open the file (someone else passed it through the preprocessor)
+   std::fstream fin;
+   fin.open(filename,std::ios::in);
+   if (fin.fail()) {
+      std::cerr << "lcCompile(): unable to open file: " << filename << std::endl;
+      if (numErrors != 0) *numErrors = 1;
+      return false;
+   }
+
+   Compiler* c = new Compiler();
+   c->lex = new Lexical(&fin);
+   c->func = func;
+   c->errCount = 0;
+   c->nForms = 0;
+   for (unsigned int i = 0; i < FORM_HASH_SIZE; i++) {
+      c->formIndex[i] = 0;
+   }
+
+   // file -- form or SLOT_ID form
+   nextToken(*c);
+   bool ok = true;
+   if (c->tok == SLOT_ID) {
+      putByte(*c, NODE_PAIR);
+      putString(c->out, c->str.c_str());
+      nextToken(*c);
+   }
+   ok = compileForm(*c);
+   if (!ok || c->tok != 0) {
+      compileError(*c, "syntax error");
+   }
+
+   // Write the compiled file
+   bool written = false;
+   if (c->errCount == 0) {
+      std::string head;
+      head.append(MAGIC, sizeof(MAGIC));
+      head.append(reinterpret_cast<const char*>(&VERSION), sizeof(VERSION));
+      head.append(reinterpret_cast<const char*>(&BYTE_ORDER_CHECK), sizeof(BYTE_ORDER_CHECK));
+      head.append(reinterpret_cast<const char*>(&c->nForms), sizeof(c->nForms));
+      for (unsigned int i = 0; i < c->nForms; i++) {
+         putString(head, c->formNames[i]);
+         head.append(reinterpret_cast<const char*>(&c->formHashes[i]), sizeof(c->formHashes[i]));
+      }
+
+      std::string* deps = new std::string[MAX_DEPS];
+      const unsigned int nDeps = getDependencies(filename, deps, MAX_DEPS);
+      head.append(reinterpret_cast<const char*>(&nDeps), sizeof(nDeps));
+      for (unsigned int i = 0; i < nDeps; i++) {
+         unsigned int size = 0;
+         unsigned int hash = 0;
+         hashFile(deps[i].c_str(), &size, &hash);
+         putString(head, deps[i].c_str());
+         head.append(reinterpret_cast<const char*>(&size), sizeof(size));
+         head.append(reinterpret_cast<const char*>(&hash), sizeof(hash));
+      }
+      delete[] deps;
+
+      std::ofstream fout;
+      fout.open(compiledFilename, std::ios::out | std::ios::binary | std::ios::trunc);
+      if (fout.is_open()) {
+         fout.write(head.data(), head.size());
+         fout.write(c->out.data(), c->out.size());
+         fout.close();
+         written = !fout.fail();
+      }
+      if (!written) {
+         std::cerr << "lcCompile(): unable to write file: " << compiledFilename << std::endl;
+         c->errCount++;
+      }
+   }
+
+   if (numErrors != 0) *numErrors = c->errCount;
+
+   for (unsigned int i = 0; i < c->nForms; i++) {
+      delete[] c->formNames[i];
+      if (c->forms[i] != 0) c->forms[i]->unref();
+   }
+   fin.close();
+   delete c->lex;
+   delete c;
+
+   return written;
+}
+
+//==============================================================================
+// Loader -- constructs the objects from a compiled file in a single pass
+//==============================================================================
+
+struct Loader {
+   const char* buff;                   // Compiled file
+   size_t size;                        // Size of the file
+   size_t pos;                         // Current position
+   bool ok;                            // File is (so far) valid
+   const char* filename;               // File name
+   ParserFormFunc func;                // Form function
+   int errCount;                       // Error count (objects and slots)
+   const char** formNames;             // Form table (in 'buff')
+   unsigned int nForms;                // Number of forms
+};
+
+static bool getBytes(Loader& r, void* const p, const size_t n)
+{
+   if (r.ok && n <= r.size - r.pos) {
+      std::memcpy(p, r.buff + r.pos, n);
+      r.pos += n;
+   }
+   else {
+      r.ok = false;
+   }
+   return r.ok;
+}
+
+static unsigned char getByte(Loader& r)  { unsigned char v = 0; getBytes(r, &v, sizeof(v)); return v; }
+static unsigned int getUInt(Loader& r)   { unsigned int v = 0;  getBytes(r, &v, sizeof(v)); return v; }
+static int getInt(Loader& r)             { int v = 0;           getBytes(r, &v, sizeof(v)); return v; }
+static double getDouble(Loader& r)       { double v = 0;        getBytes(r, &v, sizeof(v)); return v; }
+
+// Returns a pointer to the (null terminated) string in the buffer
+static const char* getString(Loader& r)
+{
+   const unsigned int len = getUInt(r);
+   const char* s = 0;
+   if (r.ok && len < r.size - r.pos && r.buff[r.pos + len] == '\0') {
+      s = r.buff + r.pos;
+      r.pos += len + 1;
+   }
+   else {
+      r.ok = false;
+   }
+   return s;
+}
+
+static void loadError(Loader& r, const char* const msg, const char* const arg)
+{
+   std::cerr << r.filename << ": " << msg;
+   if (arg != 0) std::cerr << arg;
+   std::cerr << std::endl;
+   r.errCount++;
+}
+
+static Object* loadNode(Loader& r)
+{
+   Object* obj = 0;
+   const unsigned char type = getByte(r);
+   if (!r.ok) return obj;
+
+   switch (type) {
+
+      case NODE_FORM : {
+         const unsigned int fi = getUInt(r);
+         const unsigned int n = getUInt(r);
+         if (!r.ok || fi >= r.nForms) {
+            r.ok = false;
+            break;
+         }
+
+         Object* form = r.func(r.formNames[fi]);
+         if (form == 0) loadError(r, "undefined form name: ", r.formNames[fi]);
+
+         for (unsigned int i = 0; r.ok && i < n; i++) {
+            const int slotindex = getInt(r);
+            Object* value = loadNode(r);
+            if (form != 0 && r.ok) {
+               if (!form->setSlotAtIndex(slotindex, value)) {
+                  loadError(r, "error while setting slot name: ", form->slotIndex2Name(slotindex));
+               }
+            }
+            if (value != 0) value->unref();
+         }
+
+         if (form != 0 && r.ok) {
+            if (!form->isValid()) loadError(r, "error: invalid form: ", r.formNames[fi]);
+         }
+         obj = form;
+      }
+      break;
+
+      case NODE_PAIRSTREAM : {
+         const unsigned int n = getUInt(r);
+         PairStream* ps = new PairStream();
+         for (unsigned int i = 0; r.ok && i < n; i++) {
+            const char* slot = getString(r);
+            Object* value = loadNode(r);
+            if (value != 0) {
+               if (r.ok) {
+                  Pair* p = new Pair(slot, value);
+                  ps->put(p);
+                  p->unref();
+               }
+               value->unref();
+            }
+         }
+         obj = ps;
+      }
+      break;
+
+      case NODE_PAIR : {
+         const char* slot = getString(r);
+         Object* value = loadNode(r);
+         if (value != 0) {
+            if (r.ok) obj = new Pair(slot, value);
+            value->unref();
+         }
+      }
+      break;
+
+      case NODE_STRING : {
+         const char* s = getString(r);
+         if (r.ok) obj = new String(s);
+      }
+      break;
+
+      case NODE_IDENTIFIER : {
+         const char* s = getString(r);
+         if (r.ok) obj = new Identifier(s);
+      }
+      break;
+
+      case NODE_BOOLEAN : {
+         const unsigned char v = getByte(r);
+         if (r.ok) obj = new Boolean(v != 0);
+      }
+      break;
+
+      case NODE_INTEGER : {
+         const int v = getInt(r);
+         if (r.ok) obj = new Integer(v);
+      }
+      break;
+
+      case NODE_FLOAT : {
+         const double v = getDouble(r);
+         if (r.ok) obj = new Float(v);
+      }
+      break;
+
+      case NODE_LIST : {
+         const unsigned int n = getUInt(r);
+         List* list = new List();
+         for (unsigned int i = 0; r.ok && i < n; i++) {
+            Object* value = loadNode(r);
+            if (value != 0) {
+               list->put(value);
+               value->unref();
+            }
+         }
+         obj = list;
+      }
+      break;
+
+      default : {
+         r.ok = false;
+      }
+      break;
+   }
+
+   // Discard anything that was loaded from an invalid file
+   if (!r.ok && obj != 0) {
+      obj->unref();
+      obj = 0;
+   }
+   return obj;
+}
+
+//------------------------------------------------------------------------------
+// loadCompiled() -- loads the compiled file; 'valid' is set false if it's not
+// a valid compiled file, if it's out of date with the form function or, when
+// 'checkDeps' is true, if any of its dependencies have changed.  With a zero
+// form function, only the header and the dependencies are checked.
+//------------------------------------------------------------------------------
+static Object* loadCompiled(const char* const compiledFilename, ParserFormFunc func, int* const numErrors, bool* const valid, const bool checkDeps)
+{
+   *valid = false;
+   if (numErrors != 0) *numErrors = 0;
+   if (compiledFilename == 0) return 0;
+
+   // Read the file
+   std::ifstream fin;
+   fin.open(compiledFilename, std::ios::in | std::ios::binary);
+   if (!fin.is_open()) return 0;
+   fin.seekg(0, std::ios::end);
+   const std::streamoff size = fin.tellg();
+   fin.seekg(0, std::ios::beg);
+   if (size <= 0) return 0;
+
+   char* buff = new char[static_cast<size_t>(size)];
+   fin.read(buff, size);
+   const bool readOk = !fin.fail();
+   fin.close();
+
+   Loader r;
+   r.buff = buff;
+   r.size = static_cast<size_t>(size);
+   r.pos = 0;
+   r.ok = readOk;
+   r.filename = compiledFilename;
+   r.func = func;
+   r.errCount = 0;
+   r.formNames = 0;
+   r.nForms = 0;
+
+   // Check the header
+   char magic[sizeof(MAGIC)];
+   getBytes(r, magic, sizeof(magic));
+   const unsigned int version = getUInt(r);
+   const unsigned int byteOrder = getUInt(r);
+   r.ok = r.ok && std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0 && version == VERSION && byteOrder == BYTE_ORDER_CHECK;
+
+   // Read the form table and check that the slot tables haven't changed
+   if (r.ok) {
+      r.nForms = getUInt(r);
+      if (r.ok && r.nForms <= MAX_FORMS) {
+         r.formNames = new const char*[r.nForms > 0 ? r.nForms : 1];
+      }
+      else {
+         r.ok = false;
+      }
+      for (unsigned int i = 0; r.ok && i < r.nForms; i++) {
+         r.formNames[i] = getString(r);
+         const unsigned int hash = getUInt(r);
+         if (r.ok && func != 0) {
+            Object* form = func(r.formNames[i]);
+            r.ok = (form != 0 && hashSlotTable(form) == hash);
+            if (form != 0) form->unref();
+         }
+      }
+   }
+
+   // Read the dependency table and check that the files haven't changed
+   if (r.ok) {
+      const unsigned int nDeps = getUInt(r);
+      r.ok = r.ok && nDeps <= MAX_DEPS;
+      for (unsigned int i = 0; r.ok && i < nDeps; i++) {
+         const char* name = getString(r);
+         const unsigned int size = getUInt(r);
+         const unsigned int hash = getUInt(r);
+         if (r.ok && checkDeps) {
+            unsigned int size1 = 0;
+            unsigned int hash1 = 0;
+            hashFile(name, &size1, &hash1);
+            r.ok = (size1 == size && hash1 == hash);
+         }
+      }
+   }
+
+   // Load the object tree
+   Object* q = 0;
+   if (r.ok && func != 0) {
+      q = loadNode(r);
+      if (r.ok && r.pos != r.size) {
+         r.ok = false;
+         if (q != 0) q->unref();
+         q = 0;
+      }
+   }
+
+   *valid = r.ok;
+   if (numErrors != 0) *numErrors = r.errCount;
+
+   delete[] r.formNames;
+   delete[] buff;
+   return q;
+}
+
+//------------------------------------------------------------------------------
+// lcLoadCompiled() -- Returns an Object that was constructed from the compiled
+//      file.  Func is the name of the form constructor function.
+//------------------------------------------------------------------------------
+Object* lcLoadCompiled(const char* compiledFilename, ParserFormFunc func, int* numErrors)
+{
+   bool valid = false;
+   Object* q = 0;
+   if (func != 0) q = loadCompiled(compiledFilename, func, numErrors, &valid, false);
+   if (!valid) {
+      std::cerr << "lcLoadCompiled(): invalid or out of date file: ";
+      std::cerr << (compiledFilename != 0 ? compiledFilename : "") << std::endl;
+      if (numErrors != 0) *numErrors = 1;
+   }
+   return q;
+}
+
+//------------------------------------------------------------------------------
+// lcIsCompiledCurrent() -- Returns true if the compiled file is valid and none
+//      of its dependencies have changed.
+//------------------------------------------------------------------------------
+bool lcIsCompiledCurrent(const char* compiledFilename)
+{
+   bool valid = false;
+   loadCompiled(compiledFilename, 0, 0, &valid, true);
+   return valid;
+}
+
+//------------------------------------------------------------------------------
+// lcParserCached() -- Returns an Object that was constructed from the compiled
+//      file, if it's up to date, or from parsing the input file.
+//------------------------------------------------------------------------------
+Object* lcParserCached(const char* filename, const char* compiledFilename, ParserFormFunc func, int* numErrors, const char* sourceFilename)
+{
+   const char* src = (sourceFilename != 0 ? sourceFilename : filename);
+
+   // Use the compiled file when it's up to date
+   if (compiledFilename != 0 && src != 0 && func != 0 && isNewer(compiledFilename, src)) {
+      bool valid = false;
+      Object* q = loadCompiled(compiledFilename, func, numErrors, &valid, true);
+      if (valid) return q;
+   }
+
+   // Otherwise, parse the file and recompile it
+   int errs = 0;
+   Object* q = lcParser(filename, func, &errs);
+   if (q != 0 && errs == 0 && compiledFilename != 0) {
+      lcCompile(filename, compiledFilename, func);
+   }
+
+   if (numErrors != 0) *numErrors = errs;
+   return q;
+}
+
+} // End Basic namespace
+} // End Eaagles namespace
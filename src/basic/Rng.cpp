@@ -7,14 +7,15 @@ namespace Basic {
 
 IMPLEMENT_SUBCLASS(Rng,"Rng")
 EMPTY_SERIALIZER(Rng)
-EMPTY_COPYDATA(Rng)
 EMPTY_DELETEDATA(Rng)
 
 //-----
 // slot table for this class type
 //-----
 BEGIN_SLOTTABLE(Rng)
-   "seed",     // seed
+   "seed",        // 1) seed
+   "stream",      // 2) counter-based stream ID
+   "streamSeed",  // 3) counter-based stream seed
 END_SLOTTABLE(Rng)
 
 //-----
@@ -22,8 +23,19 @@ END_SLOTTABLE(Rng)
 //-----
 BEGIN_SLOT_MAP(Rng)
    ON_SLOT(1,setSlotSeed,Number)
+   ON_SLOT(2,setSlotStream,Number)
+   ON_SLOT(3,setSlotStreamSeed,Number)
 END_SLOT_MAP()
 
+//-----
+// Philox4x32-10 constants
+//-----
+static const unsigned int PHILOX_M0 = 0xD2511F53;   // multipliers
+static const unsigned int PHILOX_M1 = 0xCD9E8D57;
+static const unsigned int PHILOX_W0 = 0x9E3779B9;   // key schedule (Weyl sequence)
+static const unsigned int PHILOX_W1 = 0xBB67AE85;
+static const unsigned int PHILOX_ROUNDS = 10;
+
 
 //==============================================================================
 // initialization of static private members
@@ -44,6 +56,7 @@ bool Rng::init = false;
 Rng::Rng()
 {
    STANDARD_CONSTRUCTOR()
+   initData();
    if (!init) {
       seed(5489);
    }
@@ -55,6 +68,7 @@ Rng::Rng()
 //-----
 Rng::Rng(unsigned int s)
 {
+   initData();
    seed(s);
    init = true;
 }
@@ -64,10 +78,58 @@ Rng::Rng(unsigned int s)
 //-----
 Rng::Rng(const unsigned int* array, int size)
 {
+   initData();
    seed(array, size);
    init = true;
 }
 
+//-----
+// initData() -- init member data
+//-----
+void Rng::initData()
+{
+   streamKey[0] = 5489;
+   streamKey[1] = 0;
+   for (unsigned int i = 0; i < 4; i++) {
+      streamCtr[i] = 0;
+      streamBuf[i] = 0;
+   }
+   streamIdx = 4;
+   streamFlg = false;
+   nCopies = 0;
+   gaussSpare = 0.0;
+}
+
+//-----
+// copyData() -- copy member data
+//-----
+void Rng::copyData(const Rng& org, const bool cc)
+{
+   BaseClass::copyData(org);
+   if (cc) initData();
+
+   // The copy of a counter-based stream draws from a new substream of the
+   // same key, starting at its beginning (see note 3)
+   streamKey[0] = org.streamKey[0];
+   streamKey[1] = org.streamKey[1];
+   streamFlg = org.streamFlg;
+   nCopies = 0;
+   if (streamFlg) {
+      const LCuint64 sub = mixSubstream(org.getSubstream(), ++org.nCopies);
+      streamCtr[2] = static_cast<unsigned int>(sub);
+      streamCtr[3] = static_cast<unsigned int>(sub >> 32);
+      setStreamPosition(0);
+   }
+   else {
+      for (unsigned int i = 0; i < 4; i++) {
+         streamCtr[i] = 0;
+         streamBuf[i] = 0;
+      }
+      streamIdx = 4;
+      gaussSpare = 0.0;
+   }
+}
+
 
 //==============================================================================
 // Rng class member functions
@@ -81,6 +143,158 @@ double Rng::draw()
    return 0.0;
 }
 
+//-----
+// drawN() -- fills 'v' with 'num' draw()s
+//-----
+void Rng::drawN(double* const v, const unsigned int num)
+{
+   if (v != 0) {
+      for (unsigned int i = 0; i < num; i++) {
+         v[i] = draw();
+      }
+   }
+}
+
+//-----
+// fillInt32() -- fills 'v' with 'num' 32 bit random integers; the same
+// numbers as 'num' calls to drawInt32()
+//-----
+void Rng::fillInt32(unsigned int* const v, const unsigned int num)
+{
+   if (v == 0) return;
+
+   unsigned int i = 0;
+   if (streamFlg) {
+      // the rest of the current block ...
+      while (i < num && streamIdx < 4) {
+         v[i++] = streamBuf[streamIdx++];
+      }
+      // ... then whole blocks directly into 'v'
+      while ((num - i) >= 4) {
+         philox(streamCtr, streamKey, &v[i]);
+         if (++streamCtr[0] == 0) ++streamCtr[1];
+         i += 4;
+      }
+   }
+   while (i < num) {
+      v[i++] = drawInt32();
+   }
+}
+
+//-----
+// fillHalfOpen() -- fills 'v' with 'num' doubles in the half-open
+// interval [0, 1); the same numbers as 'num' calls to drawHalfOpen()
+//-----
+void Rng::fillHalfOpen(double* const v, const unsigned int num)
+{
+   if (v == 0) return;
+
+   static const unsigned int CHUNK = 64;
+   unsigned int tmp[CHUNK];
+   unsigned int i = 0;
+   while (i < num) {
+      const unsigned int k = ((num - i) < CHUNK ? (num - i) : CHUNK);
+      fillInt32(tmp, k);
+      for (unsigned int j = 0; j < k; j++) {
+         v[i++] = static_cast<double>(tmp[j]) * (1. / 4294967296.);
+      }
+   }
+}
+
+//-----
+// philox() -- Philox4x32-10 counter-based generator (Salmon, et al., "Parallel
+// random numbers: as easy as 1, 2, 3", SC11); computes the four random
+// numbers, 'out', of counter 'ctr' and key 'key'
+//-----
+void Rng::philox(const unsigned int ctr[4], const unsigned int key[2], unsigned int out[4])
+{
+   unsigned int c0 = ctr[0];
+   unsigned int c1 = ctr[1];
+   unsigned int c2 = ctr[2];
+   unsigned int c3 = ctr[3];
+   unsigned int k0 = key[0];
+   unsigned int k1 = key[1];
+
+   for (unsigned int r = 0; r < PHILOX_ROUNDS; r++) {
+      if (r > 0) {
+         k0 += PHILOX_W0;
+         k1 += PHILOX_W1;
+      }
+      const LCuint64 p0 = static_cast<LCuint64>(PHILOX_M0) * c0;
+      const LCuint64 p1 = static_cast<LCuint64>(PHILOX_M1) * c2;
+      const unsigned int hi0 = static_cast<unsigned int>(p0 >> 32);
+      const unsigned int lo0 = static_cast<unsigned int>(p0);
+      const unsigned int hi1 = static_cast<unsigned int>(p1 >> 32);
+      const unsigned int lo1 = static_cast<unsigned int>(p1);
+      c0 = hi1 ^ c1 ^ k0;
+      c1 = lo1;
+      c2 = hi0 ^ c3 ^ k1;
+      c3 = lo0;
+   }
+
+   out[0] = c0;
+   out[1] = c1;
+   out[2] = c2;
+   out[3] = c3;
+}
+
+//-----
+// nextBlock() -- computes the next block of the counter-based stream
+//-----
+void Rng::nextBlock()
+{
+   philox(streamCtr, streamKey, streamBuf);
+   if (++streamCtr[0] == 0) ++streamCtr[1];
+   streamIdx = 0;
+}
+
+//-----
+// setStream() -- use stream 'id' of seed 's' (from its beginning)
+//-----
+void Rng::setStream(const unsigned int s, const unsigned int id)
+{
+   streamKey[0] = s;
+   streamKey[1] = id;
+   streamCtr[2] = 0;
+   streamCtr[3] = 0;
+   streamFlg = true;
+   nCopies = 0;
+   setStreamPosition(0);
+}
+
+//-----
+// mixSubstream() -- substream of copy number 'copy' (one is the first copy)
+// of substream 'sub' (SplitMix64 finalizer; zero is never returned)
+//-----
+LCuint64 Rng::mixSubstream(const LCuint64 sub, const unsigned int copy)
+{
+   LCuint64 z = sub + static_cast<LCuint64>(copy) * 0x9E3779B97F4A7C15ULL;
+   z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+   z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+   z = z ^ (z >> 31);
+   return (z != 0 ? z : 1);
+}
+
+//-----
+// setStreamPosition() -- the next number drawn from the counter-based
+// stream (or substream) will be number 'pos' (zero is the first number)
+//-----
+void Rng::setStreamPosition(const LCuint64 pos)
+{
+   const LCuint64 block = (pos >> 2);
+   streamCtr[0] = static_cast<unsigned int>(block);
+   streamCtr[1] = static_cast<unsigned int>(block >> 32);
+   streamIdx = 4;
+   gaussSpare = 0.0;
+
+   // part way into a block?
+   const unsigned int idx = static_cast<unsigned int>(pos & 3);
+   if (idx > 0) {
+      nextBlock();
+      streamIdx = idx;
+   }
+}
+
 //-----
 // generate new state vector
 //-----
@@ -157,6 +371,32 @@ bool Rng::setSlotSeed(const Number* const x)
    return ok;
 }
 
+//-----
+// setSlotStream()
+//-----
+bool Rng::setSlotStream(const Number* const x)
+{
+   bool ok = false;
+   if(x != 0) {
+      setStream(getStreamSeed(), static_cast<unsigned int>(x->getInt()));
+      ok = true;
+   }
+   return ok;
+}
+
+//-----
+// setSlotStreamSeed()
+//-----
+bool Rng::setSlotStreamSeed(const Number* const x)
+{
+   bool ok = false;
+   if(x != 0) {
+      setStream(static_cast<unsigned int>(x->getInt()), getStreamId());
+      ok = true;
+   }
+   return ok;
+}
+
 //-----
 // getSlotByIndex()
 //-----
@@ -1,5 +1,6 @@
 
 #include "openeaagles/basic/SlotTable.h"
+#include "openeaagles/basic/support.h"
 #include <cstring>
 
 namespace Eaagles {
@@ -13,6 +14,12 @@ SlotTable::SlotTable(const char* s[], const unsigned int ns, const SlotTable& ba
    baseTable = const_cast<SlotTable*>(&base);
    slots1 = const_cast<char**>(s);
    nslots1 = ns;
+   htable = 0;
+   hsize = 0;
+   names = 0;
+   ntotal = 0;
+   indexBuilt = 0;
+   indexLock = 0;
 }
 
 SlotTable::SlotTable(const char* s[], const unsigned int ns)
@@ -20,10 +27,17 @@ SlotTable::SlotTable(const char* s[], const unsigned int ns)
    baseTable = static_cast<SlotTable*>(0);
    slots1 = const_cast<char**>(s);
    nslots1 = ns;
+   htable = 0;
+   hsize = 0;
+   names = 0;
+   ntotal = 0;
+   indexBuilt = 0;
+   indexLock = 0;
 }
 
 void SlotTable::copyData(const SlotTable& org)
 {
+   clearIndex();
    baseTable = org.baseTable;
    slots1 = org.slots1;
    nslots1 = org.nslots1;
@@ -31,6 +45,7 @@ void SlotTable::copyData(const SlotTable& org)
 
 void SlotTable::deleteData()
 {
+   clearIndex();
    baseTable = 0;
    slots1 = 0;
    nslots1 = 0;
@@ -41,6 +56,7 @@ void SlotTable::deleteData()
 //------------------------------------------------------------------------------
 SlotTable::~SlotTable()
 {
+   clearIndex();
    baseTable = 0;
    slots1 = 0;
    nslots1 = 0;
@@ -51,7 +67,9 @@ SlotTable::~SlotTable()
 //------------------------------------------------------------------------------
 unsigned int SlotTable::n() const
 {
-   if (baseTable != 0)
+   if (lcAtomicLoad(indexBuilt) != 0)
+      return ntotal;
+   else if (baseTable != 0)
       return baseTable->n() + nslots1;
    else 
       return nslots1;
@@ -63,23 +81,12 @@ unsigned int SlotTable::n() const
 //------------------------------------------------------------------------------
 const char* SlotTable::name(const unsigned int slotindex) const
 {
-   // early out if it's not between 1 .. n()
-   if (slotindex == 0 || slotindex > n()) return 0;
-
-   const char* name = 0;
-
-   // check base table first
-   if (baseTable != 0) name = baseTable->name(slotindex);
+   if (lcAtomicLoad(indexBuilt) == 0) buildIndex();
 
-   // if not in baseTable, check our table
-   if (name == 0) {
-      int i = static_cast<int>(slotindex);      // a) start with slotindex
-      if (baseTable != 0) i -= baseTable->n();  // b) subt baseTable->n()
-      --i;                                      // c) make it zero based
-      if (i >= 0) name = slots1[i];             // d) get the name
-   }
+   // early out if it's not between 1 .. n()
+   if (slotindex == 0 || slotindex > ntotal) return 0;
 
-   return name;
+   return names[slotindex];
 }
 
 
@@ -88,27 +95,96 @@ const char* SlotTable::name(const unsigned int slotindex) const
 //------------------------------------------------------------------------------
 unsigned int SlotTable::index(const char* const slotname) const
 {
-   unsigned int i = 0;
-
-   // First, check our slot names
-   {
-      // search our table
-      unsigned int j;
-      for (j = 0; j < nslots1; j++) {
-         if (std::strcmp(slotname, slots1[j]) == 0) break;
-      }
-      if (j < nslots1) {
-         // if we're here, we found a match
-         i = j;                                    // a) start with j
-         i++;                                      // b) make it one based
-         if (baseTable != 0) i += baseTable->n();  // c) add baseTable->n()
+   if (slotname == 0) return 0;
+   if (lcAtomicLoad(indexBuilt) == 0) buildIndex();
+
+   const unsigned int h = lcStrhash(slotname);
+   unsigned int k = (h & (hsize - 1));
+   while (htable[k].name != 0) {
+      if (htable[k].hash == h && std::strcmp(slotname, htable[k].name) == 0) {
+         return htable[k].index;
       }
+      k = ((k + 1) & (hsize - 1));
    }
+   return 0;
+}
+
+//------------------------------------------------------------------------------
+// buildIndex() -- builds the hash table of our slot names and all of our base
+// class slot names.  Our names are added first, followed by our base table's
+// names, and so on, so our slot names override any base class slots with the
+// same names, and within a table the first of any duplicate names is used.
+// The index is published by setting 'indexBuilt' (release) only after it's
+// complete, so readers that see 'indexBuilt' (acquire) see the whole index.
+//------------------------------------------------------------------------------
+void SlotTable::buildIndex() const
+{
+   lcLock(indexLock);
+   if (indexBuilt == 0) {
+      unsigned int nn = nslots1;
+      if (baseTable != 0) nn += baseTable->n();
+
+      unsigned int size = 16;
+      while (size < (nn * 2)) size *= 2;
+
+      Slot* ht = new Slot[size];
+      for (unsigned int k = 0; k < size; k++) {
+         ht[k].name = 0;
+         ht[k].hash = 0;
+         ht[k].index = 0;
+      }
+      const char** nm = new const char*[nn + 1];
+      nm[0] = 0;
+
+      for (const SlotTable* t = this; t != 0; t = t->baseTable) {
+         unsigned int offset = 0;
+         if (t->baseTable != 0) offset = t->baseTable->n();
+
+         for (unsigned int j = 0; j < t->nslots1; j++) {
+            const unsigned int idx = offset + j + 1;
+            const char* const name = t->slots1[j];
+            nm[idx] = name;
+
+            const unsigned int h = lcStrhash(name);
+            unsigned int k = (h & (size - 1));
+            bool found = false;
+            while (!found && ht[k].name != 0) {
+               if (ht[k].hash == h && std::strcmp(name, ht[k].name) == 0) found = true;
+               else k = ((k + 1) & (size - 1));
+            }
+            if (!found) {
+               ht[k].name = name;
+               ht[k].hash = h;
+               ht[k].index = idx;
+            }
+         }
+      }
 
-   // Second, check our baseTable
-   if (i == 0 && baseTable != 0) i = baseTable->index(slotname);
+      names = nm;
+      ntotal = nn;
+      hsize = size;
+      htable = ht;
+      lcAtomicStore(indexBuilt, 1);
+   }
+   lcUnlock(indexLock);
+}
 
-   return i;
+//------------------------------------------------------------------------------
+// clearIndex() -- clears the slot name index
+//------------------------------------------------------------------------------
+void SlotTable::clearIndex()
+{
+   indexBuilt = 0;
+   if (htable != 0) {
+      delete[] htable;
+      htable = 0;
+   }
+   if (names != 0) {
+      delete[] names;
+      names = 0;
+   }
+   hsize = 0;
+   ntotal = 0;
 }
 
 
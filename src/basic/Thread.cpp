@@ -321,7 +321,7 @@ EMPTY_SERIALIZER(ThreadPeriodicTask)
 // Constructor
 //------------------------------------------------------------------------------
 ThreadPeriodicTask::ThreadPeriodicTask(Component* const p, const LCreal pri, const LCreal rt)
-                                       : Thread(p, pri), rate(rt), bfStats(), tcnt(0), vdtFlg(false)
+                                       : Thread(p, pri), rate(rt), bfStats(), tcnt(0), vdtFlg(false), shutdownThread(false)
 {
    STANDARD_CONSTRUCTOR()
 }
@@ -1,6 +1,7 @@
 
 #include "openeaagles/basic/ThreadPool.h"
 #include "openeaagles/basic/Thread.h"
+#include "openeaagles/basic/Component.h"
 
 namespace Eaagles {
 namespace Basic {
@@ -21,6 +22,13 @@ public:
 protected:
    Object* getPersistentObj();
    void setCurrentObj(Object* const obj);
+   void setCurrentTask(Object* const obj, ThreadPoolTask* const task, const bool refd);
+   void releaseCurrentTask();
+   bool waitForConfigured();
+   void endThread(const bool idle);
+
+   // ThreadSyncTask class functions
+   virtual bool configThread();
 
 private:
    virtual unsigned long userFunc();
@@ -30,6 +38,9 @@ private:
    ThreadPoolManager* manager;
    Object* persistentObj; //The persistent callback object for this thread
    Object* currentObj;    //The active callback object for this thread
+   ThreadPoolTask* currentTask; //The active callback's completion handle (ref()'d), or zero
+   bool currentRefd;      //The active callback object was ref()'d by the pool
+   long configured;       //Thread has been configured: 1 ok, -1 error, 0 not yet (atomic)
 };
 
 
@@ -39,25 +50,30 @@ EMPTY_COPYDATA(ThreadPoolThread)
 EMPTY_SERIALIZER(ThreadPoolThread)
 
 ThreadPoolThread::ThreadPoolThread(Component* const parent, ThreadPool*const pool, ThreadPoolManager*const mgr, const LCreal priority, Object* const obj)
-   : ThreadSyncTask(parent, priority), threadPool(pool), manager(mgr), persistentObj(obj)
+   : ThreadSyncTask(parent, priority), threadPool(pool), manager(mgr), persistentObj(obj),
+     currentObj(0), currentTask(0), currentRefd(false), configured(0)
 {
    STANDARD_CONSTRUCTOR()
 }
 
 unsigned long ThreadPoolThread::userFunc()
 {
-   //Execute the thread callback methods
-   if(manager != 0)
+   bool more = true;
+   while (more)
    {
-      manager->execute(persistentObj);
-      manager->execute(persistentObj, currentObj);
-   }
+      //Execute the thread callback methods
+      if(manager != 0)
+      {
+         manager->execute(persistentObj);
+         manager->execute(persistentObj, currentObj);
+      }
 
-   //Clear the current callback object because we're done with it
-   currentObj = 0;
+      //Complete the callback and clear the current callback object because we're done with it
+      releaseCurrentTask();
 
-   //Add the thread back to the pool
-   threadPool->threadAvailable(this);
+      //Execute the next queued callback, or add the thread back to the pool
+      more = threadPool->nextTask(this);
+   }
 
    return 0;
 }
@@ -78,6 +94,199 @@ void ThreadPoolThread::setCurrentObj(Object* const obj)
    currentObj = obj;
 }
 
+//------------------------------------------------------------------------------
+// configThread() -- called by the child thread; our signals are created here,
+// so the thread can't be given a callback until it's been configured.
+//------------------------------------------------------------------------------
+bool ThreadPoolThread::configThread()
+{
+   bool ok = BaseClass::configThread();
+   lcAtomicStore(configured, (ok ? 1 : -1));
+   return ok;
+}
+
+bool ThreadPoolThread::waitForConfigured()
+{
+   while (lcAtomicLoad(configured) == 0) {
+      lcSleep(1);
+   }
+   return (lcAtomicLoad(configured) > 0);
+}
+
+void ThreadPoolThread::setCurrentTask(Object* const obj, ThreadPoolTask* const task, const bool refd)
+{
+   currentObj = obj;
+   currentTask = task;
+   currentRefd = refd;
+}
+
+//------------------------------------------------------------------------------
+// releaseCurrentTask() -- completes the current callback's handle and releases
+// the current callback object
+//------------------------------------------------------------------------------
+void ThreadPoolThread::releaseCurrentTask()
+{
+   if(currentTask != 0)
+   {
+      currentTask->setCompleted();
+      currentTask->unref();
+      currentTask = 0;
+   }
+   if(currentRefd && currentObj != 0)
+      currentObj->unref();
+   currentObj = 0;
+   currentRefd = false;
+}
+
+//------------------------------------------------------------------------------
+// endThread() -- ends the thread.  If our parent has been shutdown then the
+// thread ends its start/complete loop on its own, but an 'idle' thread (i.e.,
+// waiting for its start signal) needs to be started first.  Otherwise the
+// thread is terminated.  A callback that the thread was given, but didn't
+// finish, is completed.
+//------------------------------------------------------------------------------
+void ThreadPoolThread::endThread(const bool idle)
+{
+   Component* const parent = getParent();
+   if (!isTerminated() && parent != 0 && parent->isShutdown()) {
+      if (idle) signalStart();
+      while (!isTerminated()) {
+         lcSleep(1);
+      }
+   }
+   terminate();
+   releaseCurrentTask();
+}
+
+
+//==============================================================================
+// ThreadPoolTask
+//==============================================================================
+IMPLEMENT_SUBCLASS(ThreadPoolTask,"ThreadPoolTask")
+EMPTY_SLOTTABLE(ThreadPoolTask)
+EMPTY_SERIALIZER(ThreadPoolTask)
+
+ThreadPoolTask::ThreadPoolTask() : priority(0), completed(0), completedSig(0)
+{
+   STANDARD_CONSTRUCTOR()
+   createSignal();
+}
+
+void ThreadPoolTask::copyData(const ThreadPoolTask& org, const bool cc)
+{
+   BaseClass::copyData(org);
+   if (cc) {
+      completedSig = 0;
+      createSignal();
+   }
+   priority = org.priority;
+   completed = lcAtomicLoad(org.completed);
+}
+
+void ThreadPoolTask::deleteData()
+{
+   closeSignal();
+}
+
+int ThreadPoolTask::getPriority() const
+{
+   return priority;
+}
+
+bool ThreadPoolTask::isCompleted() const
+{
+   return (lcAtomicLoad(completed) != 0);
+}
+
+void ThreadPoolTask::setPriority(const int pri)
+{
+   priority = pri;
+}
+
+//------------------------------------------------------------------------------
+// Completed signal -- Window/Linux specific code: a manual reset event, or
+// a condition variable, which stays set once the handle's been completed.
+//------------------------------------------------------------------------------
+#if defined(WIN32)
+
+bool ThreadPoolTask::createSignal()
+{
+   completedSig = CreateEvent(NULL, TRUE, FALSE, NULL);
+   return (completedSig != 0);
+}
+
+void ThreadPoolTask::closeSignal()
+{
+   if (completedSig != 0) {
+      CloseHandle(static_cast<HANDLE>(completedSig));
+      completedSig = 0;
+   }
+}
+
+void ThreadPoolTask::setCompleted()
+{
+   lcAtomicStore(completed, 1);
+   SetEvent(static_cast<HANDLE>(completedSig));
+}
+
+void ThreadPoolTask::waitForCompleted() const
+{
+   if (!isCompleted()) {
+      WaitForSingleObject(static_cast<HANDLE>(completedSig), INFINITE);
+   }
+}
+
+#else
+
+// Linux completed signal
+struct TaskSignal {
+   pthread_mutex_t mutex;
+   pthread_cond_t cond;
+};
+
+bool ThreadPoolTask::createSignal()
+{
+   TaskSignal* sig = new TaskSignal;
+   pthread_mutex_init(&sig->mutex, NULL);
+   pthread_cond_init(&sig->cond, NULL);
+   completedSig = sig;
+   return true;
+}
+
+void ThreadPoolTask::closeSignal()
+{
+   if (completedSig != 0) {
+      TaskSignal* sig = static_cast<TaskSignal*>(completedSig);
+      completedSig = 0;
+      pthread_cond_destroy(&sig->cond);
+      pthread_mutex_destroy(&sig->mutex);
+      delete sig;
+   }
+}
+
+void ThreadPoolTask::setCompleted()
+{
+   TaskSignal* sig = static_cast<TaskSignal*>(completedSig);
+   pthread_mutex_lock(&sig->mutex);
+   lcAtomicStore(completed, 1);
+   pthread_cond_broadcast(&sig->cond);
+   pthread_mutex_unlock(&sig->mutex);
+}
+
+void ThreadPoolTask::waitForCompleted() const
+{
+   if (!isCompleted()) {
+      TaskSignal* sig = static_cast<TaskSignal*>(completedSig);
+      pthread_mutex_lock(&sig->mutex);
+      while (!isCompleted()) {
+         pthread_cond_wait(&sig->cond, &sig->mutex);
+      }
+      pthread_mutex_unlock(&sig->mutex);
+   }
+}
+
+#endif
+
 
 //==============================================================================
 // ThreadPoolManager
@@ -126,13 +335,15 @@ EMPTY_SERIALIZER(ThreadPool)
 //------------------------------------------------------------------------------
 
 BEGIN_SLOTTABLE(ThreadPool)
-   "numThreads",  // Number of threads to use - 0 = don't use threading
-   "priority"     // Thread priority (zero(0) is lowest, one(1) is highest)
+   "numThreads",  // Number of threads to use - 0 = don't use threading, negative = scale with the processors
+   "priority",    // Thread priority (zero(0) is lowest, one(1) is highest)
+   "maxQueued"    // Max number of queued callbacks (backlog)
 END_SLOTTABLE(ThreadPool)
 
 BEGIN_SLOT_MAP(ThreadPool)
    ON_SLOT( 1,  setSlotNumThreads, Number)
    ON_SLOT( 2,  setSlotPriority,   Number)
+   ON_SLOT( 3,  setSlotMaxQueued,  Number)
 END_SLOT_MAP()
 
    //------------------------------------------------------------------------------
@@ -140,14 +351,14 @@ END_SLOT_MAP()
    //------------------------------------------------------------------------------
 
 ThreadPool::ThreadPool()
-   : manager(0), numThreads(0), priority(0.5)
+   : manager(0), numThreads(0), priority(0.5), maxQueued(0)
 {
    STANDARD_CONSTRUCTOR()
    initData();
 }
 
 ThreadPool::ThreadPool( ThreadPoolManager* mgr )
-   : manager(0), numThreads(0), priority(0.5)
+   : manager(0), numThreads(0), priority(0.5), maxQueued(0)
 {
    STANDARD_CONSTRUCTOR()
    setManager(mgr);
@@ -155,7 +366,7 @@ ThreadPool::ThreadPool( ThreadPoolManager* mgr )
 }
 
 ThreadPool::ThreadPool( ThreadPoolManager* mgr, const unsigned int num )
-   : manager(0), numThreads(num), priority(0.5)
+   : manager(0), numThreads(static_cast<int>(num)), priority(0.5), maxQueued(0)
 {
    STANDARD_CONSTRUCTOR()
    setManager(mgr);
@@ -163,7 +374,15 @@ ThreadPool::ThreadPool( ThreadPoolManager* mgr, const unsigned int num )
 }
 
 ThreadPool::ThreadPool( ThreadPoolManager* mgr, const unsigned int num, const LCreal pri )
-   : manager(0), numThreads(num), priority(pri)
+   : manager(0), numThreads(static_cast<int>(num)), priority(pri), maxQueued(0)
+{
+   STANDARD_CONSTRUCTOR()
+   setManager(mgr);
+   initData();
+}
+
+ThreadPool::ThreadPool( ThreadPoolManager* mgr, const int num, const LCreal pri, const unsigned int maxq )
+   : manager(0), numThreads(num), priority(pri), maxQueued(maxq)
 {
    STANDARD_CONSTRUCTOR()
    setManager(mgr);
@@ -173,6 +392,12 @@ ThreadPool::ThreadPool( ThreadPoolManager* mgr, const unsigned int num, const LC
 void ThreadPool::initData()
 {
    actualThreads = 0;
+   allThreads = 0;
+   availableThreads = 0;
+   numAvailable = 0;
+   queue = 0;
+   numQueued = 0;
+   queueSeq = 0;
    availableThreadsLock = 0;
    unthreadedObj = 0;
 }
@@ -197,11 +422,24 @@ void ThreadPool::initialize(Component* const parent)
 {
    destroy();
 
+   // Number of threads; negative values are relative to the number of processors
+   unsigned int num = 0;
+   if (numThreads > 0) {
+      num = static_cast<unsigned int>(numThreads);
+   }
+   else if (numThreads < 0) {
+      const int n = static_cast<int>(Thread::getNumProcessors()) + numThreads + 1;
+      num = (n > 1 ? static_cast<unsigned int>(n) : 1);
+      if (num > MAX_THREADS) num = MAX_THREADS;
+   }
+
    // Create the thread pool
-   if (numThreads > 0)
+   if (num > 0)
    {
       std::cout << "Running thread pool in multi-threaded mode" << std::endl;
-      for (unsigned int i = 0; i < numThreads; i++)
+      allThreads = new ThreadPoolThread*[num];
+      availableThreads = new ThreadPoolThread*[num];
+      for (unsigned int i = 0; i < num; i++)
       {
          //Get the callback object for this thread
          Object* callbackObj = 0;
@@ -211,12 +449,13 @@ void ThreadPool::initialize(Component* const parent)
          //Add the thread to the master array
          allThreads[actualThreads] = new ThreadPoolThread(parent, this, manager, priority, callbackObj);
 
-         //Create the thread
+         //Create the thread, and wait for it to be ready for its first callback
          bool ok = allThreads[actualThreads]->create();
+         if (ok) ok = allThreads[actualThreads]->waitForConfigured();
          if (ok)
          {
             std::cout << "Created thread pool thread[" << actualThreads << "] = " << allThreads[actualThreads] << std::endl;
-            availableThreads[actualThreads] = allThreads[actualThreads];
+            availableThreads[numAvailable++] = allThreads[actualThreads];
             actualThreads++;
          }
          else
@@ -228,6 +467,11 @@ void ThreadPool::initialize(Component* const parent)
             }
          }
       }
+
+      // The backlog
+      if (actualThreads > 0 && maxQueued > 0) {
+         queue = new QueuedTask[maxQueued];
+      }
    }
 
    //Use single-threaded mode if we're not using threads or if threading failed
@@ -258,88 +502,184 @@ void ThreadPool::execute(Object* cur)
       return;
    }
 
-   //Try to get an available thread from the pool
-   ThreadPoolThread* availableThread = getAvailableThread();
+   //Use an available thread, or the backlog, waiting for a thread if we have to
+   startTask(cur, 0, 0, true);
+}
 
-   //If we didn't get one, we'll have to wait
-   if(availableThread == 0)
+ThreadPoolTask* ThreadPool::submit(Object* cur, const int pri)
+{
+   ThreadPoolTask* task = new ThreadPoolTask();
+   task->setPriority(pri);
+
+   //If we're unthreaded, just use this thread
+   if(actualThreads == 0)
+   {
+      execute(cur);
+      task->setCompleted();
+      return task;
+   }
+
+   //Use an available thread or the backlog (the pool has its own reference)
+   task->ref();
+   if (!startTask(cur, task, pri, false))
    {
-      //Wait for one to become available
-      ThreadSyncTask** pp = reinterpret_cast<ThreadSyncTask**>( &allThreads[0] );
-      if (ThreadSyncTask::waitForAnyCompleted(pp, actualThreads) == -1)
+      task->unref();
+      task->unref();
+      task = 0;
+   }
+   return task;
+}
+
+//------------------------------------------------------------------------------
+// startTask() -- gives the callback to an available thread, or queues it on
+// the backlog; if 'wait' is true then blocks until one or the other is possible.
+// Returns false if the callback wasn't started or queued.
+//------------------------------------------------------------------------------
+bool ThreadPool::startTask(Object* const cur, ThreadPoolTask* const task, const int pri, const bool wait)
+{
+   ThreadPoolThread* availableThread = 0;
+   bool queued = false;
+   bool done = false;
+   while (!done)
+   {
+      //Try to get an available thread from the pool, or room on the backlog.
+      //(The threads check the backlog before they're returned to the pool,
+      //so the backlog is only used while all threads are busy)
+      lcLock(availableThreadsLock);
+      if (numAvailable > 0)
       {
-         //Error
-         if (isMessageEnabled(MSG_ERROR)) {
-            std::cerr << "ThreadPool::execute(): ERROR, unknown error while waiting for completed thread signal!" << std::endl;
-         }
-         return;
+         availableThread = availableThreads[--numAvailable];
+         availableThreads[numAvailable] = 0;
       }
+      else if (numQueued < maxQueued)
+      {
+         pushQueued(cur, task, pri);
+         queued = true;
+      }
+      lcUnlock(availableThreadsLock);
 
-      //Should have at least one now - try again
-      availableThread = getAvailableThread();
+      done = (availableThread != 0 || queued || !wait);
+
+      //If we didn't get one, we'll have to wait
+      if (!done)
+      {
+         //Wait for one to become available
+         ThreadSyncTask** pp = reinterpret_cast<ThreadSyncTask**>( &allThreads[0] );
+         if (ThreadSyncTask::waitForAnyCompleted(pp, actualThreads) == -1)
+         {
+            //Error
+            if (isMessageEnabled(MSG_ERROR)) {
+               std::cerr << "ThreadPool::execute(): ERROR, unknown error while waiting for completed thread signal!" << std::endl;
+            }
+            done = true;
+         }
+      }
    }
 
+   if (queued) return true;
+
    //Do we have one now (we should)?
    if(availableThread == 0)
    {
       //Error
-      if (isMessageEnabled(MSG_ERROR)) {
+      if (wait && isMessageEnabled(MSG_ERROR)) {
          std::cerr << "ThreadPool::execute(): ERROR, could not get an available thread!" << std::endl;
       }
-      return;
+      return false;
    }
 
    //Prepare the thread
    if(manager != 0)
       manager->prepare(availableThread->getPersistentObj());
 
-   //Launch the thread
-   availableThread->setCurrentObj(cur);
+   //Launch the thread (submit() doesn't block the caller, so we hold our own reference)
+   const bool refd = (task != 0 && cur != 0);
+   if (refd) cur->ref();
+   availableThread->setCurrentTask(cur, task, refd);
    availableThread->signalStart();
+   return true;
 }
 
-ThreadPoolThread* ThreadPool::getAvailableThread()
+//------------------------------------------------------------------------------
+// nextTask() -- called by a pool thread when it's finished its callback
+//------------------------------------------------------------------------------
+bool ThreadPool::nextTask(ThreadPoolThread* const thread)
 {
-   ThreadPoolThread* availableThread = 0;
+   QueuedTask qt;
+   bool found = false;
+
    lcLock(availableThreadsLock);
-   for(int i = actualThreads - 1 ; i >= 0 ; i--)
+   if (numQueued > 0)
    {
-      if(availableThreads[i] != 0)
-      {
-         availableThread = availableThreads[i];
-         availableThreads[i] = 0;
-         break;
-      }
+      popQueued(&qt);
+      found = true;
+   }
+   else
+   {
+      //Add the thread back to the pool
+      availableThreads[numAvailable++] = thread;
    }
    lcUnlock(availableThreadsLock);
-   return availableThread;
-}
 
-void ThreadPool::threadAvailable(ThreadPoolThread* availableThread)
-{
-   lcLock(availableThreadsLock);
-   for(unsigned int i = 0 ; i < actualThreads ; i++)
+   if (found)
    {
-      if(availableThreads[i] == 0)
-      {
-         availableThreads[i] = availableThread;
-         break;
-      }
+      //Prepare the thread (from the pool thread) and give it the callback
+      if(manager != 0)
+         manager->prepare(thread->getPersistentObj());
+      thread->setCurrentTask(qt.cur, qt.task, true);
    }
-   lcUnlock(availableThreadsLock);
+   return found;
 }
 
 void ThreadPool::destroy()
 {
-   //Delete all threads
+   //The idle threads (no more callbacks are given to them)
+   bool* idle = 0;
+   if (actualThreads > 0) {
+      idle = new bool[actualThreads];
+      lcLock(availableThreadsLock);
+      for (unsigned int i = 0; i < actualThreads; i++) {
+         idle[i] = false;
+         for (unsigned int j = 0; j < numAvailable && !idle[i]; j++) {
+            idle[i] = (availableThreads[j] == allThreads[i]);
+         }
+      }
+      numAvailable = 0;
+      lcUnlock(availableThreadsLock);
+   }
+
+   //End and delete all threads
    for (unsigned int i = 0; i < actualThreads; i++) {
-      allThreads[i]->terminate();
+      allThreads[i]->endThread(idle[i]);
       allThreads[i]->unref();
       allThreads[i] = 0;
    }
+   if (idle != 0) delete[] idle;
+
    lcLock(availableThreadsLock);
-   for (unsigned int i = 0; i < actualThreads; i++) {
-      availableThreads[i] = 0;
+   if (allThreads != 0) {
+      delete[] allThreads;
+      allThreads = 0;
+   }
+   if (availableThreads != 0) {
+      delete[] availableThreads;
+      availableThreads = 0;
+   }
+   numAvailable = 0;
+
+   //Release the callbacks that are still queued
+   while (numQueued > 0) {
+      QueuedTask qt;
+      popQueued(&qt);
+      if (qt.task != 0) {
+         qt.task->setCompleted();
+         qt.task->unref();
+      }
+      if (qt.cur != 0) qt.cur->unref();
+   }
+   if (queue != 0) {
+      delete[] queue;
+      queue = 0;
    }
    lcUnlock(availableThreadsLock);
    actualThreads = 0;
@@ -353,6 +693,73 @@ void ThreadPool::destroy()
    }
 }
 
+unsigned int ThreadPool::getNumThreads() const
+{
+   return actualThreads;
+}
+
+unsigned int ThreadPool::getNumQueued() const
+{
+   return numQueued;
+}
+
+unsigned int ThreadPool::getMaxQueued() const
+{
+   return maxQueued;
+}
+
+//------------------------------------------------------------------------------
+// Backlog (heap) functions -- the backlog is locked
+//------------------------------------------------------------------------------
+
+// True if queued callback 'a' is to be executed before 'b'
+bool ThreadPool::isBefore(const QueuedTask& a, const QueuedTask& b)
+{
+   if (a.pri != b.pri) return (a.pri > b.pri);
+   return (static_cast<int>(a.seq - b.seq) < 0);
+}
+
+void ThreadPool::pushQueued(Object* const cur, ThreadPoolTask* const task, const int pri)
+{
+   QueuedTask qt;
+   qt.cur = cur;
+   qt.task = task;
+   qt.pri = pri;
+   qt.seq = queueSeq++;
+   if (cur != 0) cur->ref();
+
+   // Sift up
+   unsigned int i = numQueued++;
+   while (i > 0) {
+      const unsigned int parent = (i - 1) / 2;
+      if (!isBefore(qt, queue[parent])) break;
+      queue[i] = queue[parent];
+      i = parent;
+   }
+   queue[i] = qt;
+}
+
+void ThreadPool::popQueued(QueuedTask* const qt)
+{
+   *qt = queue[0];
+
+   // Sift down the last callback
+   const QueuedTask last = queue[--numQueued];
+   unsigned int i = 0;
+   bool done = (numQueued == 0);
+   while (!done) {
+      unsigned int child = 2 * i + 1;
+      if (child >= numQueued) break;
+      if (child + 1 < numQueued && isBefore(queue[child + 1], queue[child])) child++;
+      if (isBefore(queue[child], last)) {
+         queue[i] = queue[child];
+         i = child;
+      }
+      else done = true;
+   }
+   if (numQueued > 0) queue[i] = last;
+}
+
 //------------------------------------------------------------------------------
 // Object overloads
 //------------------------------------------------------------------------------
@@ -360,17 +767,20 @@ void ThreadPool::destroy()
 void ThreadPool::copyData(const ThreadPool& org, const bool cc)
 {
    BaseClass::copyData(org);
-   destroy();
-   if(cc)
+   if(cc) {
+      manager = 0;
       initData();
+   }
+   destroy();
 
-   // Copy the manager, number of threads, and priority
+   // Copy the manager, number of threads, priority and backlog size
    if (org.manager != 0)
       setManager( static_cast<ThreadPoolManager*>(org.manager->clone()) );
    else
       setManager(0);
    numThreads = org.numThreads;
    priority = org.priority;
+   maxQueued = org.maxQueued;
 }
 
 void ThreadPool::deleteData()
@@ -388,12 +798,12 @@ bool ThreadPool::setSlotNumThreads(const Number* const msg)
    bool ok = false;
    if (msg != 0) {
       int num = msg->getInt();
-      if (num >= 0 && num <= static_cast<int>(MAX_THREADS)) {
-         numThreads = static_cast<unsigned int>(num);
+      if (num >= -static_cast<int>(MAX_THREADS) && num <= static_cast<int>(MAX_THREADS)) {
+         numThreads = num;
          ok = true;
       }
       else {
-         std::cerr << "ThreadPool::setSlotNumThreads: numThreads is invalid, range: [0 .. " << MAX_THREADS << "]" << std::endl;
+         std::cerr << "ThreadPool::setSlotNumThreads: numThreads is invalid, range: [-" << MAX_THREADS << " .. " << MAX_THREADS << "]" << std::endl;
       }
    }
    return ok;
@@ -415,6 +825,22 @@ bool ThreadPool::setSlotPriority(const Number* const msg)
    return ok;
 }
 
+bool ThreadPool::setSlotMaxQueued(const Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      int num = msg->getInt();
+      if (num >= 0) {
+         maxQueued = static_cast<unsigned int>(num);
+         ok = true;
+      }
+      else {
+         std::cerr << "ThreadPool::setSlotMaxQueued: maxQueued is invalid, must be zero or greater" << std::endl;
+      }
+   }
+   return ok;
+}
+
 Object* ThreadPool::getSlotByIndex(const int si)
 {
    return BaseClass::getSlotByIndex(si);
@@ -60,6 +60,19 @@ double Uniform::draw()
   return min * (1 - u) + max * u;
 }
 
+//------------------------------------------------------------
+// drawN() -- fills 'v' with 'num' draw()s
+//------------------------------------------------------------
+void Uniform::drawN(double* const v, const unsigned int num)
+{
+  if (v == 0) return;
+  fillHalfOpen(v, num);
+  for (unsigned int i = 0; i < num; i++) {
+    const double u = v[i];
+    v[i] = min * (1 - u) + max * u;
+  }
+}
+
 //------------------------------------------------------------
 //------------------------------------------------------------
 bool Uniform::setSlotMin(const Number* const x)
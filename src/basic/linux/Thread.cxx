@@ -162,6 +162,27 @@ bool Thread::terminate()
 // class ThreadPeriodicTask
 //==============================================================================
 
+//-----------------------------------------------------------------------------
+// Create the thread
+//-----------------------------------------------------------------------------
+bool ThreadPeriodicTask::create()
+{
+   shutdownThread = false;
+   return BaseClass::create();
+}
+
+//-----------------------------------------------------------------------------
+// Terminate the thread -- ends the main loop and waits for the thread to end
+//-----------------------------------------------------------------------------
+bool ThreadPeriodicTask::terminate()
+{
+   shutdownThread = true;
+   while (!isTerminated()) {
+      lcSleep(1);
+   }
+   return isTerminated();
+}
+
 //-----------------------------------------------------------------------------
 // Our main thread function
 //-----------------------------------------------------------------------------
@@ -197,7 +218,7 @@ unsigned long ThreadPeriodicTask::mainThreadFunc()
    }
    pthread_cond_timedwait(&cond, &mutex, &tp);
 
-   while (!getParent()->isShutdown()) {
+   while (!getParent()->isShutdown() && !shutdownThread) {
 
       // ---
       // User defined tasks
@@ -834,6 +834,21 @@ int lcStrncasecmp(const char* const s1, const char* const s2, const size_t n)
    return 0;
 }
 
+//------------
+// String hash function: returns a hash (FNV-1a) of the null terminated string 's'
+//------------
+unsigned int lcStrhash(const char* const s)
+{
+   unsigned int h = 2166136261u;
+   if (s != 0) {
+      for (const char* p = s; *p != '\0'; p++) {
+         h ^= static_cast<unsigned char>(*p);
+         h *= 16777619u;
+      }
+   }
+   return h;
+}
+
 //------------
 // returns number of digits in the whole number part (i.e. left of decimal)
 // of a floating point number 
@@ -131,6 +131,15 @@ LCreal Polygon::calcZ(const osg::Vec2& p) const
    return calcZ(p,*getPlaneCoeff());
 }
 
+//------------------------------------------------------------------------------
+// setLayer() -- sets the polygon's layer (the top layer is used when polygons
+// have the same Z value; see Scanline)
+//------------------------------------------------------------------------------
+void Polygon::setLayer(const unsigned int newLayer)
+{
+   layerValue = newLayer;
+}
+
 //------------------------------------------------------------------------------
 // drawFunc()
 //------------------------------------------------------------------------------
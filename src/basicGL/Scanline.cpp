@@ -6,10 +6,72 @@
 #include "openeaagles/basicGL/Clip3D.h"
 #include "openeaagles/basicGL/Polygon.h"
 #include "openeaagles/basic/units/Angles.h"
+#include "openeaagles/basic/ThreadPool.h"
 
 namespace Eaagles {
 namespace BasicGL {
 
+//==============================================================================
+// Scanline::BandManager class -- thread pool manager that scans the bands,
+// which are passed as the pool's current callback objects
+//==============================================================================
+class Scanline::BandManager : public Basic::ThreadPoolManager {
+   DECLARE_SUBCLASS(BandManager,Basic::ThreadPoolManager)
+public:
+   BandManager();
+protected:
+   virtual void execute(Basic::Object* const obj, Basic::Object* cur);
+};
+
+IMPLEMENT_PARTIAL_SUBCLASS(Scanline::BandManager,"ScanlineBandManager")
+EMPTY_SLOTTABLE(Scanline::BandManager)
+EMPTY_SERIALIZER(Scanline::BandManager)
+
+Scanline::BandManager::BandManager()
+{
+   STANDARD_CONSTRUCTOR()
+}
+
+Scanline::BandManager::BandManager(const Scanline::BandManager& org)
+{
+   STANDARD_CONSTRUCTOR()
+   copyData(org,true);
+}
+
+Scanline::BandManager::~BandManager()
+{
+   STANDARD_DESTRUCTOR()
+}
+
+Scanline::BandManager& Scanline::BandManager::operator=(const Scanline::BandManager& org)
+{
+   if (this != &org) copyData(org,false);
+   return *this;
+}
+
+Scanline::BandManager* Scanline::BandManager::clone() const
+{
+   return new Scanline::BandManager(*this);
+}
+
+void Scanline::BandManager::copyData(const Scanline::BandManager& org, const bool)
+{
+   BaseClass::copyData(org);
+}
+
+void Scanline::BandManager::deleteData()
+{
+}
+
+void Scanline::BandManager::execute(Basic::Object* const, Basic::Object* cur)
+{
+   Band* band = static_cast<Band*>(cur);
+   if (band != 0) band->scan();
+}
+
+//==============================================================================
+// Scanline class
+//==============================================================================
 IMPLEMENT_ABSTRACT_SUBCLASS(Scanline,"Scanline")
 EMPTY_SLOTTABLE(Scanline)
 EMPTY_SERIALIZER(Scanline)
@@ -58,6 +120,7 @@ Scanline::Scanline()
    nAET = 0;
    refAET = 0;
 
+   threadPool = 0;
 
    setMatrix();
 
@@ -96,6 +159,9 @@ void Scanline::copyData(const Scanline& org, const bool cc)
       nAET = 0;
       refAET = 0;
 
+      // (copies are single-threaded until given their own thread pool)
+      threadPool = 0;
+
       clipper = new Clip3D();
    }
 }
@@ -106,6 +172,28 @@ void Scanline::copyData(const Scanline& org, const bool cc)
 //------------------------------------------------------------------------------
 void Scanline::deleteData()
 {
+   if (threadPool != 0) threadPool->unref();
+   threadPool = 0;
+}
+
+//------------------------------------------------------------------------------
+// setThreadPool() -- sets the thread pool used by scan(); zero for a
+// single-threaded scan()
+//------------------------------------------------------------------------------
+bool Scanline::setThreadPool(Basic::ThreadPool* const pool, Basic::Component* const parent)
+{
+   if (threadPool != 0) threadPool->unref();
+   threadPool = pool;
+   if (threadPool != 0) {
+      threadPool->ref();
+
+      // Our pool threads scan the bands
+      BandManager* mgr = new BandManager();
+      threadPool->setManager(mgr);
+      mgr->unref();
+      threadPool->initialize(parent);
+   }
+   return true;
 }
 
 //------------------------------------------------------------------------------
@@ -339,7 +427,7 @@ void Scanline::add2EdgeTable(Edge* tbl[], const int n)
 bool Scanline::addPolygon(const Polygon* const polygon)
 {
    // quick outs
-   if (polygon == 0) return false;
+   if (polygon == 0 || nPT >= MAX_POLYS) return false;
 
    // number of vertices must be at least three
    unsigned int n = polygon->getNumberOfVertices();
@@ -412,13 +500,14 @@ bool Scanline::addPolygon(const Polygon* const polygon)
       PolyData* newPolyData = new PolyData();
       newPolyData->polygon = clipPolygon;
       newPolyData->orig = polygon;
+      newPolyData->index = nPT;
 
       // Add to the polygon table
       pt[nPT++] = newPolyData;
 
       // Create the edges and store them in a Temporary Edge Table
       int  nTET = 0;
-      Edge* tet[100];     // temp edge table
+      Edge** tet = new Edge*[cn];     // temp edge table
       {
          const osg::Vec3* cvect = clipPolygon->getVertices();
          const osg::Vec3* cnorms = clipPolygon->getNormals();
@@ -444,14 +533,25 @@ bool Scanline::addPolygon(const Polygon* const polygon)
       // end point check the edges in the temporary table
       // endPointCheck(tet,nTET);
 
-      // add the temporary edge table to the real edge table
-      add2EdgeTable(tet,nTET);
+      // add the temporary edge table to the real edge table, if all
+      // of the polygon's edges will fit
+      const bool fits = ((nET + nTET) <= MAX_EDGES);
+      if (fits) add2EdgeTable(tet,nTET);
 
       for (int i = 0; i < nTET; i++) {
          tet[i]->unref();
          tet[i] = 0;
       }
       nTET = 0;
+      delete[] tet;
+
+      // the clipped polygon is now owned by the PolyData
+      clipPolygon->unref();
+
+      if (!fits) return false;
+   }
+   else if (clipPolygon != 0) {
+      clipPolygon->unref();
    }
 
    return true;
@@ -465,20 +565,81 @@ void Scanline::scan()
 {
    reset();
 
-   // ---
-   // Main loop --
-   //   scanlines are y = { 0 .. iy-1 }
-   //   pixels in each scanline are x = { 0 .. ix-1 }
-   // ---
-   for (unsigned int y = 0; y < iy; y++) {
-      scanline(y);
-      for (unsigned int x = 0; x < ix; x++) {
-         const PolyData* p = step(x);
-         callback(p,x,y);
+   const unsigned int nt = (threadPool != 0 ? threadPool->getNumThreads() : 0);
+   if (nt > 0 && iy > 1) {
+      // Multi-threaded: one band for each pool thread, plus one for us
+      scanBands(nt + 1);
+   }
+   else {
+      // ---
+      // Main loop --
+      //   scanlines are y = { 0 .. iy-1 }
+      //   pixels in each scanline are x = { 0 .. ix-1 }
+      // ---
+      for (unsigned int y = 0; y < iy; y++) {
+         scanline(y);
+         for (unsigned int x = 0; x < ix; x++) {
+            const PolyData* p = step(x);
+            callback(p,x,y);
+         }
       }
    }
 }
 
+//------------------------------------------------------------------------------
+// scanBands() -- scans the image as 'num' bands of scanlines in parallel
+//------------------------------------------------------------------------------
+void Scanline::scanBands(const unsigned int num)
+{
+   const unsigned int n = (num < iy ? num : iy);
+
+   // Each band's scan state of the polygons
+   for (unsigned int k = 0; k < nPT; k++) {
+      pt[k]->bandState = new PolyData::BandState[n];
+      pt[k]->nBands = n;
+      pt[k]->bandLines = iy;
+   }
+
+   // Split the scanlines into bands of (about) the same size; band i is
+   // scanlines [ (iy*i)/n .. (iy*(i+1))/n - 1 ] (see PolyData::getNorm())
+   Band** bands = new Band*[n];
+   for (unsigned int i = 0; i < n; i++) {
+      const unsigned int y0 = (iy * i) / n;
+      const unsigned int y1 = (iy * (i+1)) / n;
+      bands[i] = new Band(this, i, y0, y1);
+   }
+
+   // The pool threads scan all but the first band, which we scan, along
+   // with any bands that the pool couldn't take.
+   Basic::ThreadPoolTask** tasks = new Basic::ThreadPoolTask*[n];
+   tasks[0] = 0;
+   for (unsigned int i = 1; i < n; i++) {
+      tasks[i] = threadPool->submit(bands[i]);
+   }
+   bands[0]->scan();
+   for (unsigned int i = 1; i < n; i++) {
+      if (tasks[i] == 0) bands[i]->scan();
+   }
+
+   // Wait for the pool threads
+   for (unsigned int i = 1; i < n; i++) {
+      if (tasks[i] != 0) {
+         tasks[i]->waitForCompleted();
+         tasks[i]->unref();
+      }
+   }
+   delete[] tasks;
+
+   for (unsigned int i = 0; i < n; i++) {
+      bands[i]->unref();
+   }
+   delete[] bands;
+
+   for (unsigned int k = 0; k < nPT; k++) {
+      pt[k]->clearBandState();
+   }
+}
+
 
 //------------------------------------------------------------------------------
 // scanline() -- select the scanline and setup the AET
@@ -503,7 +664,7 @@ void Scanline::scanline(const int y)
    }
 
    // Move new edges from ET and put into the AET
-   while (refET < nET && curY >= et[refET]->lv[1]) {
+   while (refET < nET && nAET < MAX_ACTIVE_EDGES && curY >= et[refET]->lv[1]) {
       aet[nAET++] = et[refET++];
    }
 
@@ -586,7 +747,7 @@ void Scanline::toggleActivePolygon()
    }
 
    // if it wasn't in the table -- add it to table iif there is a second edge
-   if (!found) {
+   if (!found && nAPT < MAX_ACTIVE_POLYS) {
 
       // search for second edge
       for (unsigned int j = refAET+1; j < nAET; j++) {
@@ -624,14 +785,21 @@ Scanline::PolyData::PolyData() : polygon(0), orig(0)
    STANDARD_CONSTRUCTOR()
 
    x0 = 0.0f;
+   index = 0;
    n0.set(0.0f,0.0f,1.0f);
    nslope.set(0.0f,0.0f,0.0f);
    aptEdge2 = false;
+   bandState = 0;
+   nBands = 0;
+   bandLines = 0;
 }
 
 Scanline::PolyData::PolyData(const Scanline::PolyData& org) : polygon(0), orig(0)
 { 
    STANDARD_CONSTRUCTOR()
+   bandState = 0;
+   nBands = 0;
+   bandLines = 0;
    copyData(org,true);
 }
 
@@ -660,6 +828,7 @@ void Scanline::PolyData::copyData(const Scanline::PolyData& org, const bool)
    BaseClass::copyData(org);
 
    x0 = org.x0;
+   index = org.index;
    n0 = org.n0;
    nslope = org.nslope;
    aptEdge2 = org.aptEdge2;
@@ -675,6 +844,9 @@ void Scanline::PolyData::copyData(const Scanline::PolyData& org, const bool)
       const Polygon* p = org.orig;
       orig = p;
    }
+
+   // (the band scan states are only used during a scan)
+   clearBandState();
 }
 
 //------------------------------------------------------------------------------
@@ -682,6 +854,7 @@ void Scanline::PolyData::copyData(const Scanline::PolyData& org, const bool)
 //------------------------------------------------------------------------------
 void Scanline::PolyData::deleteData()
 {
+   clearBandState();
 }
 
 //------------------------------------------------------------------------------
@@ -694,6 +867,27 @@ void Scanline::PolyData::getNorm(osg::Vec3& cnorm, const LCreal x) const
    cnorm = n0 + nslope * dist;
 }
 
+void Scanline::PolyData::getNorm(osg::Vec3& cnorm, const LCreal x, const unsigned int y) const
+{
+   if (nBands > 0) {
+      // The band of scanline 'y' (see Scanline::scanBands())
+      const BandState& s = bandState[ ((y+1) * nBands - 1) / bandLines ];
+      LCreal dist = x - s.x0;
+      cnorm = s.n0 + s.nslope * dist;
+   }
+   else {
+      getNorm(cnorm, x);
+   }
+}
+
+void Scanline::PolyData::clearBandState()
+{
+   if (bandState != 0) delete[] bandState;
+   bandState = 0;
+   nBands = 0;
+   bandLines = 0;
+}
+
 //==============================================================================
 // Edge routines
 //==============================================================================
@@ -866,6 +1060,280 @@ void Scanline::Edge::incEdgeStart()
 }
 
 
+//==============================================================================
+// Scanline::Band class -- the same scan line algorithm as the Scanline's
+// scanline(), step() and toggleActivePolygon() functions, using the band's
+// own tables and its own scan state of each polygon (PolyData::bandState).
+//==============================================================================
+IMPLEMENT_PARTIAL_SUBCLASS(Scanline::Band,"ScanlineBand")
+EMPTY_SLOTTABLE(Scanline::Band)
+EMPTY_SERIALIZER(Scanline::Band)
+
+Scanline::Band::Band()
+{
+   STANDARD_CONSTRUCTOR()
+
+   scanner = 0;
+   index = 0;
+   y0 = 0;
+   y1 = 0;
+   curX = 0;
+   curY = 0;
+   nAPT = 0;
+   nAET = 0;
+   refAET = 0;
+   refET = 0;
+}
+
+Scanline::Band::Band(Scanline* const s, const unsigned int idx, const unsigned int yy0, const unsigned int yy1)
+{
+   STANDARD_CONSTRUCTOR()
+
+   scanner = s;
+   index = idx;
+   y0 = yy0;
+   y1 = yy1;
+   curX = 0;
+   curY = 0;
+   nAPT = 0;
+   nAET = 0;
+   refAET = 0;
+   refET = 0;
+}
+
+Scanline::Band::Band(const Scanline::Band& org)
+{
+   STANDARD_CONSTRUCTOR()
+   copyData(org,true);
+}
+
+Scanline::Band::~Band()
+{
+   STANDARD_DESTRUCTOR()
+}
+
+Scanline::Band& Scanline::Band::operator=(const Scanline::Band& org)
+{
+   if (this != &org) copyData(org,false);
+   return *this;
+}
+
+Scanline::Band* Scanline::Band::clone() const
+{
+   return new Scanline::Band(*this);
+}
+
+//------------------------------------------------------------------------------
+// copyData() -- copy this object's data
+//------------------------------------------------------------------------------
+void Scanline::Band::copyData(const Scanline::Band& org, const bool)
+{
+   BaseClass::copyData(org);
+
+   scanner = org.scanner;
+   index = org.index;
+   y0 = org.y0;
+   y1 = org.y1;
+   curX = 0;
+   curY = 0;
+   nAPT = 0;
+   nAET = 0;
+   refAET = 0;
+   refET = 0;
+}
+
+//------------------------------------------------------------------------------
+// deleteData() -- delete this object's data
+//------------------------------------------------------------------------------
+void Scanline::Band::deleteData()
+{
+}
+
+//------------------------------------------------------------------------------
+// scan() -- scans our band of scanlines
+//------------------------------------------------------------------------------
+void Scanline::Band::scan()
+{
+   if (scanner == 0) return;
+
+   // The order of the edges in the AET depends on the previous scanlines
+   // (edges with the same X values), so the AET is updated from the first
+   // scanline, but only our scanlines are stepped through.
+   for (unsigned int y = 0; y < y1; y++) {
+      scanline(y);
+      if (y >= y0) {
+         for (unsigned int x = 0; x < scanner->ix; x++) {
+            const PolyData* p = step(x);
+            scanner->callback(p,x,y);
+         }
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// scanline() -- select the scanline and setup the AET
+//------------------------------------------------------------------------------
+void Scanline::Band::scanline(const int y)
+{
+   // reset some values
+   curX = 0.0f;
+   curY = static_cast<LCreal>(y);
+   refAET = 0;
+   nAPT = 0;
+
+   // Purge old edges from the AET
+   for (int i = nAET-1; i >= 0; i--) {
+      if (curY > aet[i].edge->uv[1]) {
+         for (unsigned int j = i; j < nAET-1; j++) {
+            aet[j] = aet[j+1];
+         }
+         nAET--;
+      }
+   }
+
+   // Move new edges from ET and put into the AET
+   Edge* const* et = scanner->et;
+   const unsigned int nET = scanner->nET;
+   while (refET < nET && nAET < MAX_ACTIVE_EDGES && curY >= et[refET]->lv[1]) {
+      aet[nAET++].edge = et[refET++];
+   }
+
+   // Update x positions and normals of edges in the AET
+   for (unsigned int i = 0; i < nAET; i++) {
+      const Edge* e = aet[i].edge;
+      LCreal dist = curY - e->lv[1];
+      aet[i].x = static_cast<LCreal>(e->lv[0]) + e->slope*dist;
+      aet[i].cn = e->lvn + e->nslope * dist;
+   }
+
+   // Sort the AET
+   sortEdges();
+}
+
+//------------------------------------------------------------------------------
+// sortEdges() -- sort the AET by x; simple bubble up sort
+//------------------------------------------------------------------------------
+void Scanline::Band::sortEdges()
+{
+   const int n = nAET;
+   for (int i = n-2; i >= 0; i--) {
+      int j = i;
+      while (j < (n-1) && aet[j].x > aet[j+1].x) {
+         ActiveEdge p = aet[j];
+         aet[j] = aet[j+1];
+         aet[j+1] = p;
+         j++;
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// step() -- step down the scan line to x
+//------------------------------------------------------------------------------
+const Scanline::PolyData* Scanline::Band::step(const int x)
+{
+   const PolyData* curPoly = 0;
+   curX = static_cast<LCreal>(x);
+
+   // Hit an edge?  Update the active polygon table.
+   while (refAET < nAET && curX >= aet[refAET].x) {
+      toggleActivePolygon();
+      refAET++;
+   }
+
+   // purge old polygons
+   purgePolygons();
+
+   // Choose a polygon based on Z
+   if (nAPT == 1) {
+      // when there is only one active polygon, we choose it
+      curPoly = apt[0];
+   }
+   else if (nAPT > 1) {
+      // when there are several active polygon, we choose the one on top
+      osg::Vec2 point(curX,curY);
+      LCreal zmin = apt[0]->polygon->calcZ(point);
+      curPoly = apt[0];
+      for (unsigned int i = 1; i < nAPT; i++) {
+         LCreal z = apt[i]->polygon->calcZ(point);
+         if (z > zmin) {
+            // when this polygon is higher than the previous
+            zmin = z;
+            curPoly = apt[i];
+         }
+         else if (z == zmin) {
+            // use layers when this polygon is very close to the previous
+            if (apt[i]->polygon->getLayer() > curPoly->polygon->getLayer()) {
+               curPoly = apt[i];
+            }
+         }
+      }
+   }
+
+   return curPoly;    // return the top polygon
+}
+
+//------------------------------------------------------------------------------
+// toggleActivePolygon() -- toggle a polygon to and from the active table
+//------------------------------------------------------------------------------
+void Scanline::Band::toggleActivePolygon()
+{
+   // q is the polygon we're looking at, and s is our scan state of it
+   const PolyData* q = aet[refAET].edge->polygon;
+   PolyData* p = const_cast<PolyData*>(q);
+   PolyData::BandState* s = &p->bandState[index];
+
+   // If it's in the table -- remove it
+   bool found = false;
+   for (unsigned int i = 0; i < nAPT && !found; i++) {
+      if (apt[i] == p) {
+         s->aptEdge2 = true;
+         found = true;
+      }
+   }
+
+   // if it wasn't in the table -- add it to table iif there is a second edge
+   if (!found && nAPT < MAX_ACTIVE_POLYS) {
+
+      // search for second edge
+      for (unsigned int j = refAET+1; j < nAET; j++) {
+         if (aet[j].edge->polygon == q) {
+            // found second edge -- add it to table
+            s->aptEdge2 = false;
+            s->n0 = aet[refAET].cn;
+            s->x0 = aet[refAET].x;
+            LCreal deltaX = (aet[j].x - s->x0);
+            if (deltaX > 0.0f) {
+               osg::Vec3 deltaNorm = aet[j].cn - aet[refAET].cn;
+               s->nslope = deltaNorm * (1.0f/deltaX);
+            }
+            else {
+               s->nslope.set(0.0f, 0.0f, 0.0f);
+            }
+            apt[nAPT++] = p;
+            break;
+         }
+      }
+
+   }
+}
+
+//------------------------------------------------------------------------------
+// purgePolygons() -- purge the active polygon list of polygons that have
+// reached the seconds edge
+//------------------------------------------------------------------------------
+void Scanline::Band::purgePolygons()
+{
+   for (int i = nAPT-1; i >= 0; i--) {
+      if (apt[i]->bandState[index].aptEdge2) {
+         for (unsigned int j = i; j < nAPT-1; j++) {
+            apt[j] = apt[j+1];
+         }
+         nAPT--;
+      }
+   }
+}
+
 } // End BasicGL namespace
 } // End Eaagles namespace
 
@@ -6,6 +6,7 @@
 #include "openeaagles/basic/Pair.h"
 #include "openeaagles/basic/units/Angles.h"
 #include "openeaagles/basic/units/Distances.h"
+#include <algorithm>
 
 // Disable all deprecation warnings for now.  Until we fix them,
 // they are quite annoying to see over and over again...
@@ -23,6 +24,7 @@ BEGIN_SLOTTABLE(SymbolLoader)
    "templates",         // 1) List of templates to use for navaids
    "showOnlyInRange",   // 2) only show symbols within map range
    "interconnect",      // 3) Interconnect the symbols
+   "maxSymbols",        // 4) Max number of symbols
 END_SLOTTABLE(SymbolLoader)
 
 // Map slot table to handles
@@ -30,6 +32,7 @@ BEGIN_SLOT_MAP(SymbolLoader)
    ON_SLOT(1,setSlotTemplates,Basic::PairStream)
    ON_SLOT(2,setSlotShowInRangeOnly,Basic::Number)
    ON_SLOT(3,setSlotInterconnect,Basic::Number)
+   ON_SLOT(4,setSlotMaxSymbols,Basic::Number)
 END_SLOT_MAP()
 
 //------------------------------------------------------------------------------
@@ -45,11 +48,27 @@ SymbolLoader::SymbolLoader()
 void SymbolLoader::initData()
 {
    templates = 0;
-   for (int i = 0; i < MAX_SYMBOLS; i++) {
-      symbols[i] = 0;
-   }
+   symbols = 0;
+   links = 0;
+   symbolsSize = 0;
+   symbolsHigh = 0;
+   numSymbols = 0;
+   maxSymbols = MAX_SYMBOLS;
+   freeSlots = 0;
+   numFree = 0;
+   typeHeads = 0;
+   typeHeadsSize = 0;
+   idBuckets = 0;
+   idBucketsSize = 0;
    showInRangeOnly = true;
    interconnect = false;
+
+   mapRefLat = 0;
+   mapRefLon = 0;
+   mapHdg = 0;
+   mapScale = 0;
+   mapNorthUp = false;
+   mapValid = false;
 }
 
 //------------------------------------------------------------------------------
@@ -75,6 +94,8 @@ void SymbolLoader::copyData(const SymbolLoader& org, const bool cc)
 
    showInRangeOnly = org.showInRangeOnly;
    interconnect = org.interconnect;
+   maxSymbols = org.maxSymbols;
+   mapValid = false;
 }
 
 //------------------------------------------------------------------------------
@@ -86,26 +107,43 @@ void SymbolLoader::deleteData()
    templates = 0;
 
    // go through our whole array and 0 everyone out
-   for (int i = 0; i < MAX_SYMBOLS; i++) {
+   for (int i = 0; i < symbolsHigh; i++) {
       if (symbols[i] != 0) {
          symbols[i]->setSymbolPair(0);
          symbols[i]->setValue(0);
          symbols[i]->unref();
       }
    }
-}
 
+   if (symbols != 0) delete[] symbols;
+   symbols = 0;
+   if (links != 0) delete[] links;
+   links = 0;
+   if (freeSlots != 0) delete[] freeSlots;
+   freeSlots = 0;
+   if (typeHeads != 0) delete[] typeHeads;
+   typeHeads = 0;
+   if (idBuckets != 0) delete[] idBuckets;
+   idBuckets = 0;
+   symbolsSize = 0;
+   symbolsHigh = 0;
+   numSymbols = 0;
+   numFree = 0;
+   typeHeadsSize = 0;
+   idBucketsSize = 0;
+}
 
 //------------------------------------------------------------------------------
-// getNumberOfActiveSymbols() - returns the count of active symbols
+// setMaxSymbols() - sets the max number of symbols
 //------------------------------------------------------------------------------
-int SymbolLoader::getNumberOfActiveSymbols() const
+bool SymbolLoader::setMaxSymbols(const int max)
 {
-   int num = 0;
-   for (int i = 0; i < MAX_SYMBOLS; i++) {
-      if(symbols[i] != 0) num++;
+   bool ok = false;
+   if (max >= 1 && max >= symbolsHigh) {
+      maxSymbols = max;
+      ok = true;
    }
-   return num;
+   return ok;
 }
 
 //------------------------------------------------------------------------------
@@ -115,7 +153,7 @@ int SymbolLoader::getSymbolType(const int idx) const
 {
    int result = 0;
 
-   if (idx >= 1 && idx <= MAX_SYMBOLS) {
+   if (idx >= 1 && idx <= symbolsHigh) {
       const int i = (idx - 1);
       if(symbols[i] != 0){
          result = symbols[i]->getType();
@@ -132,7 +170,7 @@ int SymbolLoader::getSymbolType(const int idx) const
 int SymbolLoader::getSymbolIndex(const BasicGL::Graphic* const mySymbol) const
 {
    int index = 0;
-   for (int i = 0; i < MAX_SYMBOLS; i++) {
+   for (int i = 0; i < symbolsHigh && index == 0; i++) {
       if (symbols[i] != 0) {
          Basic::Pair* p = symbols[i]->getSymbolPair();
          BasicGL::Graphic* graph = static_cast<BasicGL::Graphic*>(p->object());
@@ -142,6 +180,43 @@ int SymbolLoader::getSymbolIndex(const BasicGL::Graphic* const mySymbol) const
    return index;
 }
 
+//------------------------------------------------------------------------------
+// getSymbolIndexById() - returns the lowest index of the symbols with ID 'id',
+// or zero if not found.
+//------------------------------------------------------------------------------
+int SymbolLoader::getSymbolIndexById(const char* const id) const
+{
+   int index = 0;
+   if (id != 0 && idBucketsSize > 0) {
+      // (IDs are limited to SlSymbol::MAX_ID_SIZE characters)
+      char key[SlSymbol::MAX_ID_SIZE+1];
+      strncpy(key, id, SlSymbol::MAX_ID_SIZE);
+      key[SlSymbol::MAX_ID_SIZE] = '\0';
+      const unsigned int b = (lcStrhash(key) & (idBucketsSize - 1));
+      for (int i = idBuckets[b]; i >= 0; i = links[i].idNext) {
+         if ( (index == 0 || i < (index - 1)) && strcmp(symbols[i]->getId(), key) == 0 ) {
+            index = (i + 1);
+         }
+      }
+   }
+   return index;
+}
+
+//------------------------------------------------------------------------------
+// getSymbolIndexesByType() - gets the indexes of up to 'max' symbols of type
+// 'nType'; returns the number of indexes
+//------------------------------------------------------------------------------
+int SymbolLoader::getSymbolIndexesByType(const int nType, int* const indexes, const int max) const
+{
+   int n = 0;
+   if (indexes != 0 && nType >= 0 && nType < typeHeadsSize) {
+      for (int i = typeHeads[nType]; i >= 0 && n < max; i = links[i].typeNext) {
+         indexes[n++] = (i + 1);
+      }
+   }
+   return n;
+}
+
 //------------------------------------------------------------------------------
 // getSymbol() - gets a symbol based on the pixel x,y (from center) position specified
 //------------------------------------------------------------------------------
@@ -176,7 +251,7 @@ SlSymbol* SymbolLoader::getSymbol(const int xPixel, const int yPixel)
       double lastDist = 500000;
 
       // now search our symbols for the closest symbol
-      for (int i = 0; i < MAX_SYMBOLS; i++) {
+      for (int i = 0; i < symbolsHigh; i++) {
          if (symbols[i] != 0) {
             symX = symbols[i]->getScreenXPos();
             symY = symbols[i]->getScreenYPos();
@@ -219,41 +294,42 @@ int SymbolLoader::addSymbol(const int nType, const char* const id, int specName)
          if (tg != 0) {
 
             // Find an empty symbol slot in our master symbol table
-            for (int i = 0; i < MAX_SYMBOLS && idx == 0; i++) {
-               if ( symbols[i] == 0 ) {
-
-                  // Create a new SlSymbol object to manage this symbol.
-                  symbols[i] = symbolFactory();
-
-                  // Clone the graphic template and set it as the
-                  // symbol's graphical component.
-                  Basic::Pair* newPair = tpair->clone();
-                  BasicGL::Graphic* newGraph = static_cast<BasicGL::Graphic*>(newPair->object());
-
-                  // Set the new graphical component's select name
-                  GLuint mySelName = 0;
-                  if (specName > 0) mySelName = specName;
-                  else mySelName = BasicGL::Graphic::getNewSelectName();
-                  newGraph->setSelectName(mySelName);
-
-                  // Add the symbol's graphical component to our component list.
-                  {
-                     Basic::PairStream* comp = getComponents();
-                      Basic::Component::processComponents(comp, typeid(BasicGL::Graphic), newPair);
-                     if (comp != 0) comp->unref();
-                  }
+            const int i = allocSlot();
+            if (i >= 0) {
+
+               // Create a new SlSymbol object to manage this symbol.
+               symbols[i] = symbolFactory();
+
+               // Clone the graphic template and set it as the
+               // symbol's graphical component.
+               Basic::Pair* newPair = tpair->clone();
+               BasicGL::Graphic* newGraph = static_cast<BasicGL::Graphic*>(newPair->object());
+
+               // Set the new graphical component's select name
+               GLuint mySelName = 0;
+               if (specName > 0) mySelName = specName;
+               else mySelName = BasicGL::Graphic::getNewSelectName();
+               newGraph->setSelectName(mySelName);
+
+               // Add the symbol's graphical component to our component list.
+               {
+                  Basic::PairStream* comp = getComponents();
+                   Basic::Component::processComponents(comp, typeid(BasicGL::Graphic), newPair);
+                  if (comp != 0) comp->unref();
+               }
 
-                  // Set the symbol's graphical component pointer
-                  symbols[i]->setSymbolPair( newPair );
-                  newPair->unref(); // symbol[i] now owns it.
+               // Set the symbol's graphical component pointer
+               symbols[i]->setSymbolPair( newPair );
+               newPair->unref(); // symbol[i] now owns it.
 
-                  // Set the symbol's type and ID.
-                  symbols[i]->setType( nType );
-                  symbols[i]->setId( id );
+               // Set the symbol's type and ID, and index them.
+               symbols[i]->setType( nType );
+               symbols[i]->setId( id );
+               linkSymbol(i);
+               numSymbols++;
 
-                  // And this is the new symbol's index
-                  idx = (i + 1);
-               }
+               // And this is the new symbol's index
+               idx = (i + 1);
             }
          }
       }
@@ -270,7 +346,7 @@ bool SymbolLoader::setSymbolType(const int idx, const int nType)
    bool ok = false;
 
    // Find the symbol
-   if (idx >= 1 && idx <= MAX_SYMBOLS) {
+   if (idx >= 1 && idx <= symbolsHigh) {
       const int i = (idx - 1);
       if (symbols[i] != 0) {
 
@@ -307,7 +383,9 @@ bool SymbolLoader::setSymbolType(const int idx, const int nType)
                   newPair->unref(); // symbol[i] now owns it.
 
                   // Set new type
+                  unlinkSymbol(i);
                   symbols[i]->setType( nType );
+                  linkSymbol(i);
 
                   ok = true;
                }
@@ -328,7 +406,7 @@ bool SymbolLoader::removeSymbol(const int idx)
    bool ok = false;
 
    // Find the symbol
-   if (idx >= 1 && idx <= MAX_SYMBOLS) {
+   if (idx >= 1 && idx <= symbolsHigh) {
       const int i = (idx - 1);
       if (symbols[i] != 0) {
 
@@ -348,9 +426,12 @@ bool SymbolLoader::removeSymbol(const int idx)
          // ---
          // and remove it from our master symbol table
          // ---
+         unlinkSymbol(i);
          symbols[i]->setSymbolPair(0);
          symbols[i]->unref();
          symbols[i] = 0;
+         freeSlot(i);
+         numSymbols--;
 
          ok = true;
       }
@@ -365,12 +446,245 @@ bool SymbolLoader::removeSymbol(const int idx)
 bool SymbolLoader::clearLoader()
 {
    bool ok = false;
-   for (int idx = 1; idx <= MAX_SYMBOLS; idx++) {
-      removeSymbol(idx);
+   if (numSymbols > 0) {
+
+      // Sorted list of the symbols' graphical components
+      BasicGL::Graphic** gs = new BasicGL::Graphic*[numSymbols];
+      int n = 0;
+      for (int i = 0; i < symbolsHigh; i++) {
+         if (symbols[i] != 0 && n < numSymbols) {
+            gs[n++] = static_cast<BasicGL::Graphic*>(symbols[i]->getSymbolPair()->object());
+         }
+      }
+      std::sort(gs, gs + n);
+
+      // Rebuild our subcomponent list without them, with a single call
+      // to processComponents() rather than one per symbol.
+      Basic::PairStream* comp = getComponents();
+      if (comp != 0) {
+         Basic::PairStream* newList = new Basic::PairStream();
+         Basic::List::Item* item = comp->getFirstItem();
+         while (item != 0) {
+            Basic::Pair* pair = static_cast<Basic::Pair*>(item->getValue());
+            BasicGL::Graphic* g = static_cast<BasicGL::Graphic*>(pair->object());
+            if ( !std::binary_search(gs, gs + n, g) ) newList->put(pair);
+            item = item->getNext();
+         }
+         Basic::Component::processComponents(newList, typeid(BasicGL::Graphic));
+         newList->unref();
+         comp->unref();
+      }
+      delete[] gs;
+
+      // and clear our master symbol table
+      for (int i = 0; i < symbolsHigh; i++) {
+         if (symbols[i] != 0) {
+            symbols[i]->setSymbolPair(0);
+            symbols[i]->unref();
+            symbols[i] = 0;
+         }
+      }
+   }
+
+   // Reset the free slots and the type and ID indexes
+   symbolsHigh = 0;
+   numSymbols = 0;
+   numFree = 0;
+   for (int t = 0; t < typeHeadsSize; t++) {
+      typeHeads[t] = -1;
+   }
+   for (unsigned int b = 0; b < idBucketsSize; b++) {
+      idBuckets[b] = -1;
    }
    return ok;
 }
 
+//------------------------------------------------------------------------------
+// updateSymbolId() - change an existing symbol's ID
+//------------------------------------------------------------------------------
+bool SymbolLoader::updateSymbolId(const int idx, const char* const id)
+{
+   bool ok = false;
+   if (idx >= 1 && idx <= symbolsHigh) {
+      const int i = (idx - 1);
+      if (symbols[i] != 0) {
+         unlinkSymbol(i);
+         symbols[i]->setId(id);
+         linkSymbol(i);
+         ok = true;
+      }
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// growSymbols() - doubles the size of the symbol table (up to maxSymbols);
+// returns false if the table is already at its max size
+//------------------------------------------------------------------------------
+bool SymbolLoader::growSymbols()
+{
+   int newSize = (symbolsSize > 0 ? (symbolsSize * 2) : 32);
+   if (newSize > maxSymbols) newSize = maxSymbols;
+   if (newSize <= symbolsSize) return false;
+
+   SlSymbol** newSymbols = new SlSymbol*[newSize];
+   SymbolLinks* newLinks = new SymbolLinks[newSize];
+   int* newFree = new int[newSize];
+   for (int i = 0; i < newSize; i++) {
+      if (i < symbolsSize) {
+         newSymbols[i] = symbols[i];
+         newLinks[i] = links[i];
+      }
+      else {
+         newSymbols[i] = 0;
+      }
+   }
+   for (int i = 0; i < numFree; i++) {
+      newFree[i] = freeSlots[i];
+   }
+
+   if (symbols != 0) delete[] symbols;
+   if (links != 0) delete[] links;
+   if (freeSlots != 0) delete[] freeSlots;
+   symbols = newSymbols;
+   links = newLinks;
+   freeSlots = newFree;
+   symbolsSize = newSize;
+
+   // Keep about one ID bucket per symbol
+   rehashIds();
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// allocSlot() - returns the lowest free symbol slot, or -1 if full
+//------------------------------------------------------------------------------
+int SymbolLoader::allocSlot()
+{
+   int i = -1;
+   if (numFree > 0) {
+      // Pop the lowest free slot from the min-heap
+      i = freeSlots[0];
+      const int last = freeSlots[--numFree];
+      int k = 0;
+      for (;;) {
+         int c = (2 * k + 1);
+         if (c >= numFree) break;
+         if ((c + 1) < numFree && freeSlots[c + 1] < freeSlots[c]) c++;
+         if (last <= freeSlots[c]) break;
+         freeSlots[k] = freeSlots[c];
+         k = c;
+      }
+      if (numFree > 0) freeSlots[k] = last;
+   }
+   else {
+      if (symbolsHigh >= symbolsSize) growSymbols();
+      if (symbolsHigh < symbolsSize && symbolsHigh < maxSymbols) i = symbolsHigh++;
+   }
+   return i;
+}
+
+//------------------------------------------------------------------------------
+// freeSlot() - returns symbol slot 'i' to the free slot min-heap
+//------------------------------------------------------------------------------
+void SymbolLoader::freeSlot(const int i)
+{
+   int k = numFree++;
+   while (k > 0) {
+      const int p = ((k - 1) / 2);
+      if (freeSlots[p] <= i) break;
+      freeSlots[k] = freeSlots[p];
+      k = p;
+   }
+   freeSlots[k] = i;
+}
+
+//------------------------------------------------------------------------------
+// linkSymbol() - adds symbol 'i' to its type list and ID bucket
+//------------------------------------------------------------------------------
+void SymbolLoader::linkSymbol(const int i)
+{
+   SymbolLinks& lnk = links[i];
+
+   // Type list (grown on demand)
+   const int t = symbols[i]->getType();
+   if (t >= 0) {
+      if (t >= typeHeadsSize) {
+         const int newSize = (t + 1);
+         int* newHeads = new int[newSize];
+         for (int k = 0; k < newSize; k++) {
+            newHeads[k] = (k < typeHeadsSize ? typeHeads[k] : -1);
+         }
+         if (typeHeads != 0) delete[] typeHeads;
+         typeHeads = newHeads;
+         typeHeadsSize = newSize;
+      }
+      lnk.typePrev = -1;
+      lnk.typeNext = typeHeads[t];
+      if (lnk.typeNext >= 0) links[lnk.typeNext].typePrev = i;
+      typeHeads[t] = i;
+   }
+   else {
+      lnk.typePrev = -1;
+      lnk.typeNext = -1;
+   }
+
+   // ID bucket
+   lnk.idBucket = (lcStrhash(symbols[i]->getId()) & (idBucketsSize - 1));
+   lnk.idPrev = -1;
+   lnk.idNext = idBuckets[lnk.idBucket];
+   if (lnk.idNext >= 0) links[lnk.idNext].idPrev = i;
+   idBuckets[lnk.idBucket] = i;
+}
+
+//------------------------------------------------------------------------------
+// unlinkSymbol() - removes symbol 'i' from its type list and ID bucket
+//------------------------------------------------------------------------------
+void SymbolLoader::unlinkSymbol(const int i)
+{
+   const SymbolLinks& lnk = links[i];
+
+   const int t = symbols[i]->getType();
+   if (t >= 0 && t < typeHeadsSize) {
+      if (lnk.typePrev >= 0) links[lnk.typePrev].typeNext = lnk.typeNext;
+      else if (typeHeads[t] == i) typeHeads[t] = lnk.typeNext;
+      if (lnk.typeNext >= 0) links[lnk.typeNext].typePrev = lnk.typePrev;
+   }
+
+   if (lnk.idPrev >= 0) links[lnk.idPrev].idNext = lnk.idNext;
+   else idBuckets[lnk.idBucket] = lnk.idNext;
+   if (lnk.idNext >= 0) links[lnk.idNext].idPrev = lnk.idPrev;
+}
+
+//------------------------------------------------------------------------------
+// rehashIds() - resizes the ID buckets to the symbol table size and
+// rebuilds the ID chains
+//------------------------------------------------------------------------------
+void SymbolLoader::rehashIds()
+{
+   unsigned int newSize = 1;
+   while (newSize < static_cast<unsigned int>(symbolsSize)) newSize *= 2;
+   if (newSize == idBucketsSize) return;
+
+   if (idBuckets != 0) delete[] idBuckets;
+   idBuckets = new int[newSize];
+   idBucketsSize = newSize;
+   for (unsigned int b = 0; b < idBucketsSize; b++) {
+      idBuckets[b] = -1;
+   }
+
+   for (int i = 0; i < symbolsHigh; i++) {
+      if (symbols[i] != 0) {
+         SymbolLinks& lnk = links[i];
+         lnk.idBucket = (lcStrhash(symbols[i]->getId()) & (idBucketsSize - 1));
+         lnk.idPrev = -1;
+         lnk.idNext = idBuckets[lnk.idBucket];
+         if (lnk.idNext >= 0) links[lnk.idNext].idPrev = i;
+         idBuckets[lnk.idBucket] = i;
+      }
+   }
+}
+
 //------------------------------------------------------------------------------
    // Sets the show in-range symbols only flag
 //------------------------------------------------------------------------------
@@ -386,7 +700,7 @@ bool SymbolLoader::setShowInRangeOnly(const bool x)
 bool SymbolLoader::updateSymbolPositionLL(const int idx, const double nLat, const double nLon)
 {
    bool ok = false;
-   if (idx >= 1 && idx <= MAX_SYMBOLS) {
+   if (idx >= 1 && idx <= symbolsHigh) {
       const int i = (idx - 1);
       if (symbols[i] != 0) {
          symbols[i]->setXPosition( nLat );
@@ -407,7 +721,7 @@ bool SymbolLoader::updateSymbolPositionLL(const int idx, const double nLat, cons
 bool SymbolLoader::updateSymbolPositionXY(const int idx, const double xPos, const double yPos)
 {
    bool ok = false;
-   if (idx >= 1 && idx <= MAX_SYMBOLS) {
+   if (idx >= 1 && idx <= symbolsHigh) {
       const int i = (idx - 1);
       if (symbols[i] != 0) {
          symbols[i]->setXPosition( xPos );
@@ -427,7 +741,7 @@ bool SymbolLoader::updateSymbolPositionXY(const int idx, const double xPos, cons
 bool SymbolLoader::updateSymbolPositionXYAircraft(const int idx, const double xPos, const double yPos)
 {
    bool ok = false;
-   if (idx >= 1 && idx <= MAX_SYMBOLS) {
+   if (idx >= 1 && idx <= symbolsHigh) {
       const int i = (idx - 1);
       if (symbols[i] != 0) {
          symbols[i]->setXPosition( xPos );
@@ -449,7 +763,7 @@ bool SymbolLoader::updateSymbolPositionXYAircraft(const int idx, const double xP
 bool SymbolLoader::updateSymbolPositionXYScreen(const int idx, const double xPos, const double yPos)
 {
    bool ok = false;
-   if (idx >= 1 && idx <= MAX_SYMBOLS) {
+   if (idx >= 1 && idx <= symbolsHigh) {
       const int i = (idx - 1);
       if (symbols[i] != 0) {
          symbols[i]->setXScreenPos( xPos );
@@ -470,7 +784,7 @@ bool SymbolLoader::updateSymbolPositionXYScreen(const int idx, const double xPos
 bool SymbolLoader::updateSymbolHeading(const int idx, const LCreal hdg)
 {
    bool ok = false;
-   if (idx >= 1 && idx <= MAX_SYMBOLS) {
+   if (idx >= 1 && idx <= symbolsHigh) {
       const int i = (idx - 1);
       if (symbols[i] != 0) {
          symbols[i]->setHeadingDeg( hdg );
@@ -486,7 +800,7 @@ bool SymbolLoader::updateSymbolHeading(const int idx, const LCreal hdg)
 bool SymbolLoader::updateSymbolValue(const int idx, Basic::Object* const value)
 {
    bool ok = false;
-   if (idx >= 1 && idx <= MAX_SYMBOLS) {
+   if (idx >= 1 && idx <= symbolsHigh) {
       const int i = (idx - 1);
       if (symbols[i] != 0) {
          symbols[i]->setValue( value );
@@ -504,7 +818,7 @@ bool SymbolLoader::updateSymbolText(const int idx, const char* name, const char
    bool ok = false;
 
    // Find the symbol
-   if (idx >= 1 && idx <= MAX_SYMBOLS) {
+   if (idx >= 1 && idx <= symbolsHigh) {
       const int i = (idx - 1);
       if (symbols[i] != 0) {
 
@@ -554,7 +868,7 @@ bool SymbolLoader::updateSymbolText(const int idx, const char* name, const LCrea
    bool ok = false;
 
    // Find the symbol
-   if (idx >= 1 && idx <= MAX_SYMBOLS) {
+   if (idx >= 1 && idx <= symbolsHigh) {
       const int i = (idx - 1);
       if(symbols[i] != 0){
 
@@ -604,7 +918,7 @@ bool SymbolLoader:: setSymbolVisible(const int idx, const char* name, bool visib
    bool ok = false;
 
    // Find the symbol
-   if (idx >= 1 && idx <= MAX_SYMBOLS) {
+   if (idx >= 1 && idx <= symbolsHigh) {
       const int i = (idx - 1);
       if (symbols[i] != 0) {
          // if no name is passed, the symbol is invisible, otherwise just
@@ -650,7 +964,7 @@ bool SymbolLoader::setSymbolFlashRate(const int idx, const char* name, const LCr
    bool ok = false;
 
    // Find the symbol
-   if (idx >= 1 && idx <= MAX_SYMBOLS) {
+   if (idx >= 1 && idx <= symbolsHigh) {
       const int i = (idx - 1);
       if (symbols[i] != 0) {
 
@@ -693,7 +1007,7 @@ bool SymbolLoader::setSymbolColor(const int idx, const char* name, const Basic::
    bool ok = false;
 
    // Find the symbol
-   if (idx >= 1 && idx <= MAX_SYMBOLS) {
+   if (idx >= 1 && idx <= symbolsHigh) {
       const int i = (idx - 1);
       if(symbols[i] != 0) {
 
@@ -736,7 +1050,7 @@ bool SymbolLoader::setSymbolColor(const int idx, const char* name, const Basic::
    bool ok = false;
 
    // Find the symbol
-   if (idx >= 1 && idx <= MAX_SYMBOLS) {
+   if (idx >= 1 && idx <= symbolsHigh) {
       const int i = (idx - 1);
       if(symbols[i] != 0) {
 
@@ -776,7 +1090,7 @@ bool SymbolLoader::setSymbolColor(const int idx, const char* name, const Basic::
 bool SymbolLoader::updateSymbolSelectName(const int idx, const int newSN)
 {
    bool ok = false;
-   if (idx >= 1 && idx <= MAX_SYMBOLS) {
+   if (idx >= 1 && idx <= symbolsHigh) {
       const int i = (idx - 1);
       if (symbols[i] != 0) {
 
@@ -823,7 +1137,7 @@ void SymbolLoader::drawFunc()
     if (interconnect) {
         glPushMatrix();
         glBegin(GL_LINE_STRIP);
-        for (int i = 0; i < MAX_SYMBOLS; i++) {
+        for (int i = 0; i < symbolsHigh; i++) {
             if (symbols[i] != 0)
                 glVertex2f(static_cast<GLfloat>(symbols[i]->getScreenXPos()),
                            static_cast<GLfloat>(symbols[i]->getScreenYPos()));
@@ -852,10 +1166,13 @@ void SymbolLoader::draw()
       else radius = getOuterRadius();
       LCreal radius2 = radius * radius;
 
+      // Has the map moved since the last frame?
+      const bool mapChanged = isMapChanged();
+
       // ---
       // Setup the drawing parameters for all of our symbols ...
       // ---
-      for (int i = 0; i < MAX_SYMBOLS; i++) {
+      for (int i = 0; i < symbolsHigh; i++) {
 
          if (symbols[i] != 0) {
 
@@ -870,7 +1187,9 @@ void SymbolLoader::draw()
                LCreal xScn = static_cast<LCreal>(symbols[i]->getScreenXPos());
                LCreal yScn = static_cast<LCreal>(symbols[i]->getScreenYPos());
 
-               if ( !(symbols[i]->isPositionScreen()) ) {
+               // Only recompute the screen position when the map or the
+               // symbol's position has changed since the last frame
+               if ( !(symbols[i]->isPositionScreen()) && (mapChanged || symbols[i]->isPositionDirty()) ) {
 
                   // But when we were not give screen coordinates,
                   // we'll need to compute them from A/C coordinates
@@ -910,6 +1229,7 @@ void SymbolLoader::draw()
                   // 4) Save the screen coordinates (inches)
                   symbols[i]->setXScreenPos(xScn);
                   symbols[i]->setYScreenPos(yScn);
+                  symbols[i]->setPositionDirty(false);
                }
 
                // In range?  Do we care?
@@ -963,6 +1283,10 @@ void SymbolLoader::draw()
                Basic::Pair* p = symbols[i]->getSymbolPair();
                BasicGL::Graphic* g = static_cast<BasicGL::Graphic*>(p->object());
                g->setVisibility(false);
+
+               // The map change is used up by this frame, so a hidden symbol's
+               // screen position is recomputed when it's visible again
+               if (mapChanged) symbols[i]->setPositionDirty(true);
             }
          }
       }
@@ -975,7 +1299,7 @@ void SymbolLoader::draw()
       // ---
       // now restore the matrices on all of our graphical components
       // ---
-      for (int i = 0; i < MAX_SYMBOLS; i++) {
+      for (int i = 0; i < symbolsHigh; i++) {
          if (symbols[i] != 0) {
             Basic::Pair* p = symbols[i]->getSymbolPair();
             BasicGL::Graphic* g = static_cast<BasicGL::Graphic*>(p->object());
@@ -986,21 +1310,46 @@ void SymbolLoader::draw()
    }
 }
 
+//------------------------------------------------------------------------------
+// isMapChanged() - returns true if the map's reference point, heading, scale
+// or orientation has changed since the last call
+//------------------------------------------------------------------------------
+bool SymbolLoader::isMapChanged()
+{
+   const double lat = getReferenceLatDeg();
+   const double lon = getReferenceLonDeg();
+   const LCreal hdg = getHeadingDeg();
+   const LCreal scale = getScale();
+   const bool northUp = getNorthUp();
+
+   const bool changed = !mapValid || lat != mapRefLat || lon != mapRefLon ||
+      hdg != mapHdg || scale != mapScale || northUp != mapNorthUp;
+
+   mapRefLat = lat;
+   mapRefLon = lon;
+   mapHdg = hdg;
+   mapScale = scale;
+   mapNorthUp = northUp;
+   mapValid = true;
+
+   return changed;
+}
+
 //------------------------------------------------------------------------------
 // Gets our list of symbols, and returns the number of symbols
 //------------------------------------------------------------------------------
 int SymbolLoader::getSymbols(SPtr<SlSymbol>* const newSyms, const int max)
 {
-   int numSymbols = 0;
+   int num = 0;
    if (max > 0) {
-      for(int i = 0; i < MAX_SYMBOLS; i++) {
+      for(int i = 0; i < symbolsHigh && i < max; i++) {
          if (symbols[i] != 0) {
             newSyms[i] = symbols[i];
-            numSymbols = i;
+            num = i;
          }
       }
    }
-   return numSymbols;
+   return num;
 }
 
 
@@ -1037,6 +1386,19 @@ bool SymbolLoader::setSlotInterconnect(const Basic::Number* const msg)
    return ok;
 }
 
+// sets the max number of symbols
+bool SymbolLoader::setSlotMaxSymbols(const Basic::Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) ok = setMaxSymbols(msg->getInt());
+   if (!ok) {
+      if (isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "SymbolLoader::setSlotMaxSymbols(): invalid max number of symbols" << std::endl;
+      }
+   }
+   return ok;
+}
+
 
 //------------------------------------------------------------------------------
 // getSlotByIndex()
@@ -1079,6 +1441,7 @@ void SlSymbol::initData()
 
    xScreenPos = 0;
    yScreenPos = 0;
+   dirty = true;
 
    hdg = 0;
    hdgValid = false;
@@ -1107,6 +1470,7 @@ void SlSymbol::copyData(const SlSymbol& org, const bool cc)
 
    xScreenPos = org.xScreenPos;
    yScreenPos = org.yScreenPos;
+   dirty = org.dirty;
 
    hdg = org.hdg;
    hdgValid = org.hdgValid;
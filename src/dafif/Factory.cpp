@@ -5,34 +5,33 @@
 #include "openeaagles/dafif/Factory.h"
 
 #include "openeaagles/basic/Object.h"
+#include "openeaagles/basic/FactoryTable.h"
 
 #include "openeaagles/dafif/AirportLoader.h"
 #include "openeaagles/dafif/NavaidLoader.h"
 #include "openeaagles/dafif/WaypointLoader.h"
 
-#include <cstring>
-
 namespace Eaagles {
 namespace Dafif {
 
+//------------------------------------------------------------------------------
+// addClasses() -- adds our classes to the factory table
+//------------------------------------------------------------------------------
+static void addClasses(Basic::FactoryTable& table)
+{
+    table.add<AirportLoader>();
+    table.add<NavaidLoader>();
+    table.add<WaypointLoader>();
+}
+
+static Basic::FactoryTable factoryTable(addClasses);
+
 Factory::Factory()
 {}
 
 Basic::Object* Factory::createObj(const char* name)
 {
-    Basic::Object* obj = 0;
-
-    if ( std::strcmp(name, AirportLoader::getFactoryName()) == 0 ) {
-        obj = new AirportLoader();
-    }
-    else if ( std::strcmp(name, NavaidLoader::getFactoryName()) == 0 ) {
-        obj = new NavaidLoader();
-    }
-    else if ( std::strcmp(name, WaypointLoader::getFactoryName()) == 0 ) {
-        obj = new WaypointLoader();
-    }
-
-    return obj;
+    return factoryTable.createObj(name);
 }
 
 }  // end namespace Dafif
@@ -5,35 +5,34 @@
 #include "openeaagles/dis/Factory.h"
 
 #include "openeaagles/basic/Object.h"
+#include "openeaagles/basic/FactoryTable.h"
 
 #include "openeaagles/dis/NetIO.h"
 #include "openeaagles/dis/Ntm.h"
 #include "openeaagles/dis/EmissionPduHandler.h"
 
-#include <cstring>
-
 namespace Eaagles {
 namespace Network {
 namespace Dis {
 
+//------------------------------------------------------------------------------
+// addClasses() -- adds our classes to the factory table
+//------------------------------------------------------------------------------
+static void addClasses(Basic::FactoryTable& table)
+{
+    table.add<Dis::NetIO>();
+    table.add<Ntm>();
+    table.add<EmissionPduHandler>();
+}
+
+static Basic::FactoryTable factoryTable(addClasses);
+
 Factory::Factory()
 {}
 
 Basic::Object* Factory::createObj(const char* name)
 {
-    Basic::Object* obj = 0;
-
-    if ( std::strcmp(name, Dis::NetIO::getFactoryName()) == 0 ) {
-        obj = new Dis::NetIO();
-    }
-    else if ( std::strcmp(name, Ntm::getFactoryName()) == 0 ) {
-        obj = new Ntm();
-    }
-    else if ( std::strcmp(name, EmissionPduHandler::getFactoryName()) == 0 ) {
-        obj = new EmissionPduHandler();
-    }
-
-    return obj;
+    return factoryTable.createObj(name);
 }
 
 } // End Dis namespace
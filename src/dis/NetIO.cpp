@@ -148,6 +148,10 @@ NetIO::NetIO() : netInput(0), netOutput(0)
 {
    STANDARD_CONSTRUCTOR()
 
+   inputNtmTable = 0;
+   inputNtmTableSize = 0;
+   nInputNtmTable = 0;
+
    initData();
 }
 
@@ -179,6 +183,14 @@ void NetIO::initData()
 //------------------------------------------------------------------------------
 void NetIO::copyData(const NetIO& org, const bool cc)
 {
+   // The base class copies the incoming NTMs using our addInputEntityType(),
+   // which fills our NTM table, so it's cleared first.
+   if (cc) {
+      inputNtmTable = 0;
+      inputNtmTableSize = 0;
+      nInputNtmTable = 0;
+   }
+
    BaseClass::copyData(org);
    if (cc) initData();
 
@@ -217,6 +229,7 @@ void NetIO::copyData(const NetIO& org, const bool cc)
 void NetIO::deleteData()
 {
     clearEmissionPduHandlers();
+    clearInputNtmTable();
     netInput = 0;
     netOutput = 0;
 }
@@ -918,17 +931,158 @@ const Dis::Ntm* NetIO::findNtmByTypeCodes(
          const unsigned char  extra
       ) const
 {
-   const Dis::Ntm* result = 0;
-
-   const Dis::NtmInputNode* disRoot = dynamic_cast<const Dis::NtmInputNode*>( getRootNtmInputNode() );
-   if (disRoot != 0) {
+   // The same NTM as the quick lookup tree (see note #7): the deepest level
+   // that has an NTM for the entity type, from the extra level up to the
+   // category level.
+   const unsigned int kdc = (static_cast<unsigned int>(kind) << 24) | (static_cast<unsigned int>(domain) << 16) | countryCode;
+   const unsigned int csse = (static_cast<unsigned int>(category) << 24) | (static_cast<unsigned int>(subcategory) << 16) |
+                             (static_cast<unsigned int>(specific) << 8) | extra;
+
+   const Dis::Ntm* result = lookupInputNtmTable(Dis::NtmInputNode::EXTRA_LVL, kdc, csse);
+   if (result == 0) result = lookupInputNtmTable(Dis::NtmInputNode::SPECIFIC_LVL, kdc, (csse & 0xffffff00));
+   if (result == 0) result = lookupInputNtmTable(Dis::NtmInputNode::SUBCATEGORY_LVL, kdc, (csse & 0xffff0000));
+   if (result == 0) result = lookupInputNtmTable(Dis::NtmInputNode::CATEGORY_LVL, kdc, (csse & 0xff000000));
+   return result;
+}
 
-      result = disRoot->findNtmByTypeCodes(kind, domain, countryCode, category, subcategory, specific, extra);
+//------------------------------------------------------------------------------
+// Finds the network type mapper by NIB type codes
+//------------------------------------------------------------------------------
+const Simulation::Ntm* NetIO::findNetworkTypeMapper(const Simulation::Nib* const nib) const
+{
+   const Simulation::Ntm* result = 0;
 
+   const Dis::Nib* disNib = dynamic_cast<const Dis::Nib*>( nib );
+   if (disNib != 0) {
+      result = findNtmByTypeCodes(
+            disNib->getEntityKind(),
+            disNib->getEntityDomain(),
+            disNib->getEntityCountry(),
+            disNib->getEntityCategory(),
+            disNib->getEntitySubcategory(),
+            disNib->getEntitySpecific(),
+            disNib->getEntityExtra()
+         );
    }
    return result;
 }
 
+//------------------------------------------------------------------------------
+// Finds the network type mapper by Player
+//------------------------------------------------------------------------------
+const Simulation::Ntm* NetIO::findNetworkTypeMapper(const Simulation::Player* const p) const
+{
+   return BaseClass::findNetworkTypeMapper(p);
+}
+
+//------------------------------------------------------------------------------
+// Incoming entity types: the NTM is added to the quick lookup tree and table
+//------------------------------------------------------------------------------
+bool NetIO::addInputEntityType(Simulation::Ntm* const ntm)
+{
+   const bool ok = BaseClass::addInputEntityType(ntm);
+   if (ok) {
+      const Dis::Ntm* disNtm = dynamic_cast<const Dis::Ntm*>( ntm );
+      if (disNtm != 0) insertInputNtmTable(disNtm);
+   }
+   return ok;
+}
+
+bool NetIO::clearInputEntityTypes()
+{
+   clearInputNtmTable();
+   return BaseClass::clearInputEntityTypes();
+}
+
+//------------------------------------------------------------------------------
+// Incoming NTM quick lookup table functions
+//------------------------------------------------------------------------------
+
+// Hash of the table key
+unsigned int NetIO::hashNtmCodes(const unsigned int level, const unsigned int kdc, const unsigned int csse)
+{
+   unsigned int h = (kdc * 0x9e3779b1u) ^ (csse + level);
+   h ^= (h >> 15);
+   h *= 0x85ebca6bu;
+   h ^= (h >> 13);
+   return h;
+}
+
+// Finds the NTM for the level and codes
+const Ntm* NetIO::lookupInputNtmTable(const unsigned int level, const unsigned int kdc, const unsigned int csse) const
+{
+   if (inputNtmTable == 0) return 0;
+
+   unsigned int k = (hashNtmCodes(level, kdc, csse) & (inputNtmTableSize - 1));
+   while (inputNtmTable[k].level != 0) {
+      const NtmTypeEntry& e = inputNtmTable[k];
+      if (e.level == level && e.kdc == kdc && e.csse == csse) return e.ntm;
+      k = ((k + 1) & (inputNtmTableSize - 1));
+   }
+   return 0;
+}
+
+// Adds the NTM to the table; as with the quick lookup tree, the first NTM for
+// an entity type is used.
+void NetIO::insertInputNtmTable(const Ntm* const ntm)
+{
+   // The NTM's level: its codes after this level are all wild cards (zero)
+   unsigned int level = Dis::NtmInputNode::CATEGORY_LVL;
+   if (ntm->getEntityExtra() != 0) level = Dis::NtmInputNode::EXTRA_LVL;
+   else if (ntm->getEntitySpecific() != 0) level = Dis::NtmInputNode::SPECIFIC_LVL;
+   else if (ntm->getEntitySubcategory() != 0) level = Dis::NtmInputNode::SUBCATEGORY_LVL;
+
+   const unsigned int kdc = (static_cast<unsigned int>(ntm->getEntityKind()) << 24) |
+                            (static_cast<unsigned int>(ntm->getEntityDomain()) << 16) | ntm->getEntityCountry();
+   const unsigned int csse = (static_cast<unsigned int>(ntm->getEntityCategory()) << 24) |
+                             (static_cast<unsigned int>(ntm->getEntitySubcategory()) << 16) |
+                             (static_cast<unsigned int>(ntm->getEntitySpecific()) << 8) | ntm->getEntityExtra();
+
+   if (lookupInputNtmTable(level, kdc, csse) != 0) return;
+
+   // Grow the table to keep it less than half full
+   if ( (nInputNtmTable + 1) * 2 > inputNtmTableSize ) {
+      const unsigned int newSize = (inputNtmTableSize > 0 ? inputNtmTableSize * 2 : 64);
+      NtmTypeEntry* newTable = new NtmTypeEntry[newSize];
+      for (unsigned int i = 0; i < newSize; i++) {
+         newTable[i].level = 0;
+         newTable[i].kdc = 0;
+         newTable[i].csse = 0;
+         newTable[i].ntm = 0;
+      }
+      for (unsigned int i = 0; i < inputNtmTableSize; i++) {
+         const NtmTypeEntry& e = inputNtmTable[i];
+         if (e.level != 0) {
+            unsigned int k = (hashNtmCodes(e.level, e.kdc, e.csse) & (newSize - 1));
+            while (newTable[k].level != 0) k = ((k + 1) & (newSize - 1));
+            newTable[k] = e;
+         }
+      }
+      if (inputNtmTable != 0) delete[] inputNtmTable;
+      inputNtmTable = newTable;
+      inputNtmTableSize = newSize;
+   }
+
+   unsigned int k = (hashNtmCodes(level, kdc, csse) & (inputNtmTableSize - 1));
+   while (inputNtmTable[k].level != 0) k = ((k + 1) & (inputNtmTableSize - 1));
+   inputNtmTable[k].level = level;
+   inputNtmTable[k].kdc = kdc;
+   inputNtmTable[k].csse = csse;
+   inputNtmTable[k].ntm = ntm;
+   nInputNtmTable++;
+}
+
+// Clears the table
+void NetIO::clearInputNtmTable()
+{
+   if (inputNtmTable != 0) {
+      delete[] inputNtmTable;
+      inputNtmTable = 0;
+   }
+   inputNtmTableSize = 0;
+   nInputNtmTable = 0;
+}
+
 //------------------------------------------------------------------------------
 // Data access (get) routines
 //------------------------------------------------------------------------------
@@ -1830,17 +1984,20 @@ std::ostream& NetIO::serialize(std::ostream& sout, const int i, const bool slots
 }
 
 //------------------------------------------------------------------------------
-// Test quick lookup of incoming entity types
+// Test quick lookup of incoming entity types -- 'n' lookups of the NTMs from
+// the main NTM list, in order (i.e., with 'n' equal to the number of NTMs,
+// each NTM is looked up once).  The quick lookup table's NTM is compared
+// with the original NTM and with the quick lookup tree's NTM.  Returns the
+// number of lookups where the table and the tree differ.
 //------------------------------------------------------------------------------
-void NetIO::testInputEntityTypes(const unsigned int n)
+unsigned int NetIO::testInputEntityTypes(const unsigned int n)
 {
-   const NtmInputNode* root = getRootNtmInputNode();
+   unsigned int nDiffs = 0;
+   const Dis::NtmInputNode* root = dynamic_cast<const Dis::NtmInputNode*>( getRootNtmInputNode() );
    const unsigned int maxTypes = getNumInputEntityTypes();
    if (n > 0 && root != 0 && maxTypes > 0) {
       for (unsigned int i = 0; i < n; i++) {
-         int r = rand();
-         LCreal nr = (LCreal(r) / LCreal(RAND_MAX));
-         int idx = nint(nr * (maxTypes - 1));
+         const unsigned int idx = (i % maxTypes);
          const Ntm* origNtm = static_cast<const Ntm*>(getInputEntityType(idx));
          std::cout << "i= " << i;
          std::cout << "; idx= " << idx;
@@ -1867,6 +2024,16 @@ void NetIO::testInputEntityTypes(const unsigned int n)
                   origNtm->getEntityExtra()
                );
 
+            const Ntm* treeNtm = root->findNtmByTypeCodes(
+                  origNtm->getEntityKind(),
+                  origNtm->getEntityDomain(),
+                  origNtm->getEntityCountry(),
+                  origNtm->getEntityCategory(),
+                  origNtm->getEntitySubcategory(),
+                  origNtm->getEntitySpecific(),
+                  origNtm->getEntityExtra()
+               );
+
             std::cout << "; foundNtm= " << foundNtm;
             if (foundNtm != 0) {
                const Simulation::Player* foundP = origNtm->getTemplatePlayer();
@@ -1880,28 +2047,39 @@ void NetIO::testInputEntityTypes(const unsigned int n)
             else {
                std::cout << "; NO match!!";
             }
+            if (treeNtm != foundNtm) {
+               std::cout << "; Table and tree differ: treeNtm= " << treeNtm;
+               nDiffs++;
+            }
          }
 
          std::cout << std::endl;
       }
    }
+   if (nDiffs > 0 && isMessageEnabled(MSG_ERROR)) {
+      std::cerr << "NetIO::testInputEntityTypes(): ERROR, the quick lookup table and tree differ for ";
+      std::cerr << nDiffs << " of " << n << " lookups" << std::endl;
+   }
+   return nDiffs;
 }
 
 //------------------------------------------------------------------------------
 // Test quick lookup of outgoing entity types -- this routine is used to
-// test the quick lookup tree.  We do 'n' quick lookups by doing a random
-// draw of a Ntm from the main NTM list, getting and cloning the template
-// player, optionally modifying the type string, and doing a lookup.
+// test the quick lookup tree and table.  We do 'n' quick lookups of the NTMs
+// from the main NTM list, in order, by getting and cloning the template
+// player, optionally modifying the type string, and doing a lookup.  Each
+// player is looked up twice (the second lookup is from the quick lookup
+// table), and the results are compared with the quick lookup tree's NTM.
+// Returns the number of lookups where the table and the tree differ.
 //------------------------------------------------------------------------------
-void NetIO::testOutputEntityTypes(const unsigned int n)
+unsigned int NetIO::testOutputEntityTypes(const unsigned int n)
 {
+   unsigned int nDiffs = 0;
    const NtmOutputNode* root = getRootNtmOutputNode();
    const unsigned int maxTypes = getNumOutputEntityTypes();
    if (n > 0 && root != 0 && maxTypes > 0) {
       for (unsigned int i = 0; i < n; i++) {
-         int r = rand();
-         LCreal nr = (LCreal(r) / LCreal(RAND_MAX));
-         int idx = nint(nr * (maxTypes - 1));
+         const unsigned int idx = (i % maxTypes);
          const Ntm* origNtm = static_cast<const Ntm*>(getOutputEntityTypes(idx));
          std::cout << "i= " << i;
          std::cout << "; idx= " << idx;
@@ -1927,12 +2105,15 @@ void NetIO::testOutputEntityTypes(const unsigned int n)
 
                Basic::String* newType = new Basic::String(cbuff);
                origP1->setType(newType);
+               newType->unref();
 
                Basic::String* origType1 = const_cast<Basic::String*>(static_cast<const Basic::String*>(origP1->getType()));
                std::cout << "; type1: " << *origType1;
             }
 
             const Ntm* foundNtm = static_cast<const Ntm*>(root->findNetworkTypeMapper(origP1));
+            const Ntm* tableNtm1 = static_cast<const Ntm*>(findNetworkTypeMapper(origP1));
+            const Ntm* tableNtm2 = static_cast<const Ntm*>(findNetworkTypeMapper(origP1));
             std::cout << "; foundNtm= " << foundNtm;
             if (foundNtm != 0) {
                std::cout << "; [ ";
@@ -1951,10 +2132,20 @@ void NetIO::testOutputEntityTypes(const unsigned int n)
             else {
                std::cout << "; NO match!!";
             }
+            if (tableNtm1 != foundNtm || tableNtm2 != foundNtm) {
+               std::cout << "; Table and tree differ: tableNtm= " << tableNtm1 << ", " << tableNtm2;
+               nDiffs++;
+            }
+            origP1->unref();
          }
          std::cout << std::endl;
       }
    }
+   if (nDiffs > 0 && isMessageEnabled(MSG_ERROR)) {
+      std::cerr << "NetIO::testOutputEntityTypes(): ERROR, the quick lookup table and tree differ for ";
+      std::cerr << nDiffs << " of " << n << " lookups" << std::endl;
+   }
+   return nDiffs;
 }
 
 //==============================================================================
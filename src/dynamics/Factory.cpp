@@ -4,37 +4,36 @@
 #include "openeaagles/dynamics/Factory.h"
 
 #include "openeaagles/basic/Object.h"
+#include "openeaagles/basic/FactoryTable.h"
 
 #include "openeaagles/dynamics/JSBSimModel.h"
 #include "openeaagles/dynamics/RacModel.h"
 #include "openeaagles/dynamics/LaeroModel.h"
 
-#include <cstring>
-
 namespace Eaagles {
 namespace Dynamics {
 
-Factory::Factory()
-{}
-
-Basic::Object* Factory::createObj(const char* name)
+//------------------------------------------------------------------------------
+// addClasses() -- adds our classes to the factory table
+//------------------------------------------------------------------------------
+static void addClasses(Basic::FactoryTable& table)
 {
-    Basic::Object* obj = 0;
-
     // RAC model
-    if ( std::strcmp(name, RacModel::getFactoryName()) == 0 ) {
-        obj = new RacModel();
-    }
+    table.add<RacModel>();
     // JSBSim model
-    else if ( std::strcmp(name, JSBSimModel::getFactoryName()) == 0 ) {
-        obj = new JSBSimModel();
-    }
+    table.add<JSBSimModel>();
     // Laero model
-    else if ( std::strcmp(name, LaeroModel::getFactoryName()) == 0 ) {
-        obj = new LaeroModel();
-    }
+    table.add<LaeroModel>();
+}
+
+static Basic::FactoryTable factoryTable(addClasses);
 
-    return obj;
+Factory::Factory()
+{}
+
+Basic::Object* Factory::createObj(const char* name)
+{
+    return factoryTable.createObj(name);
 }
 
 }  // end namespace Dynamics
@@ -10,6 +10,7 @@
 #include "openeaagles/basic/List.h"
 #include "openeaagles/basic/PairStream.h"
 #include "openeaagles/basic/String.h"
+#include "openeaagles/basic/Thread.h"
 
 // JSBSim model headers
 #include <JSBSim/FGFDMExec.h>
@@ -44,6 +45,213 @@
 namespace Eaagles {
 namespace Dynamics {
 
+//==============================================================================
+// Model cache -- ready (newly loaded and never used) JSBSim executives, and
+// their property managers, keyed by root directory and model name.
+//==============================================================================
+
+static const unsigned int MAX_CACHED_MODELS = 32;      // Max number of models
+static const unsigned int MAX_CACHED_INSTANCES = 64;   // Max ready instances of each model
+
+struct CachedModel {
+   std::string rootDir;                                        // Root directory
+   std::string model;                                          // Model name
+   JSBSim::FGFDMExec* fdmex[MAX_CACHED_INSTANCES];             // Ready executives
+   JSBSim::FGPropertyManager* propMgr[MAX_CACHED_INSTANCES];   // and their property managers
+   unsigned int nReady;                                        // Number of ready instances
+};
+
+static CachedModel cache[MAX_CACHED_MODELS];
+static unsigned int nCache = 0;
+static long cacheLock = 0;       // Model cache semaphore
+static long loadLock = 0;        // Model loader semaphore (held while a model is being loaded)
+
+// Finds the model's cache entry; creates a new entry if 'create' is true.
+// (the caller must have locked the cache)
+static CachedModel* findCachedModel(const char* const root, const char* const mdl, const bool create)
+{
+   for (unsigned int i = 0; i < nCache; i++) {
+      if (cache[i].rootDir == root && cache[i].model == mdl) return &cache[i];
+   }
+   if (!create || nCache >= MAX_CACHED_MODELS) return 0;
+
+   CachedModel* cm = &cache[nCache++];
+   cm->rootDir = root;
+   cm->model = mdl;
+   cm->nReady = 0;
+   return cm;
+}
+
+// Takes a ready instance of the model from the cache; returns false if none
+static bool getCachedModel(const char* const root, const char* const mdl, JSBSim::FGFDMExec** fdmex, JSBSim::FGPropertyManager** propMgr)
+{
+   bool ok = false;
+   lcLock(cacheLock);
+   CachedModel* cm = findCachedModel(root, mdl, false);
+   if (cm != 0 && cm->nReady > 0) {
+      cm->nReady--;
+      *fdmex = cm->fdmex[cm->nReady];
+      *propMgr = cm->propMgr[cm->nReady];
+      ok = true;
+   }
+   lcUnlock(cacheLock);
+   return ok;
+}
+
+// Adds a newly loaded instance of the model to the cache; returns false if the cache is full
+static bool putCachedModel(const char* const root, const char* const mdl, JSBSim::FGFDMExec* const fdmex, JSBSim::FGPropertyManager* const propMgr)
+{
+   bool ok = false;
+   lcLock(cacheLock);
+   CachedModel* cm = findCachedModel(root, mdl, true);
+   if (cm != 0 && cm->nReady < MAX_CACHED_INSTANCES) {
+      cm->fdmex[cm->nReady] = fdmex;
+      cm->propMgr[cm->nReady] = propMgr;
+      cm->nReady++;
+      ok = true;
+   }
+   lcUnlock(cacheLock);
+   return ok;
+}
+
+// Loads a new instance of the model.  JSBSim's loader isn't thread safe, so the
+// models are loaded one at a time, under 'loadLock'; other loaders sleep (instead
+// of spinning on the semaphore) until the current load is complete.  The lock is
+// released on every path out of the load, including JSBSim exceptions, and the
+// loader threads are never terminated during a load (see JSBSimModel::stopLoader()).
+static bool loadModel(const char* const root, const char* const mdl, JSBSim::FGFDMExec** fdmex, JSBSim::FGPropertyManager** propMgr)
+{
+   while (!lcAtomicCompareAndSwap(loadLock, 0, 1)) {
+      lcSleep(10);
+   }
+
+   JSBSim::FGPropertyManager* pm = 0;
+   JSBSim::FGFDMExec* fe = 0;
+   bool ok = false;
+   try {
+      pm = new JSBSim::FGPropertyManager();
+      fe = new JSBSim::FGFDMExec(pm);
+
+      std::string RootDir(root);
+      fe->SetAircraftPath(RootDir + "aircraft");
+      fe->SetEnginePath(RootDir + "engine");
+      fe->SetSystemsPath(RootDir + "systems"); // JSBSim-1.0 or after only
+
+      ok = fe->LoadModel(mdl);
+   }
+   catch (...) {
+      ok = false;
+   }
+
+   lcAtomicStore(loadLock, 0);
+
+   if (ok) {
+      *fdmex = fe;
+      *propMgr = pm;
+   }
+   else {
+      std::cerr << "JSBSimModel: unable to load model: " << mdl << std::endl;
+      if (fe != 0) delete fe;
+      if (pm != 0) delete pm;
+   }
+   return ok;
+}
+
+// Deletes all of the ready instances in the model cache
+void JSBSimModel::clearModelCache()
+{
+   for (unsigned int i = 0; i < MAX_CACHED_MODELS; i++) {
+      JSBSim::FGFDMExec* fe = 0;
+      JSBSim::FGPropertyManager* pm = 0;
+
+      // Take one instance at a time, and delete it outside of the lock
+      bool more = true;
+      while (more) {
+         more = false;
+         lcLock(cacheLock);
+         if (i < nCache && cache[i].nReady > 0) {
+            cache[i].nReady--;
+            fe = cache[i].fdmex[cache[i].nReady];
+            pm = cache[i].propMgr[cache[i].nReady];
+            more = true;
+         }
+         lcUnlock(cacheLock);
+         if (more) {
+            delete fe;
+            delete pm;
+         }
+      }
+   }
+}
+
+unsigned int JSBSimModel::getNumCachedModels(const char* const root, const char* const mdl)
+{
+   unsigned int n = 0;
+   if (root != 0 && mdl != 0) {
+      lcLock(cacheLock);
+      const CachedModel* cm = findCachedModel(root, mdl, false);
+      if (cm != 0) n = cm->nReady;
+      lcUnlock(cacheLock);
+   }
+   return n;
+}
+
+//==============================================================================
+// Model loader thread -- loads instances of a model into the model cache
+//==============================================================================
+
+class ModelLoader : public Basic::ThreadSingleTask {
+   DECLARE_SUBCLASS(ModelLoader,Basic::ThreadSingleTask)
+public: ModelLoader(Basic::Component* const parent, const char* const root, const char* const mdl, const unsigned int n, const unsigned int s);
+public: void stop();       // Requests the loader to stop after the current load
+private: virtual unsigned long userFunc();
+   std::string rootDir;    // Root directory
+   std::string model;      // Model name
+   unsigned int num;       // Number of instances to load
+   unsigned int spares;    // then load until the cache has this many ready instances
+   long stopReq;           // Stop requested
+};
+
+IMPLEMENT_SUBCLASS(ModelLoader,"JSBSimModelLoader")
+EMPTY_SLOTTABLE(ModelLoader)
+EMPTY_COPYDATA(ModelLoader)
+EMPTY_DELETEDATA(ModelLoader)
+EMPTY_SERIALIZER(ModelLoader)
+
+ModelLoader::ModelLoader(Basic::Component* const parent, const char* const root, const char* const mdl, const unsigned int n, const unsigned int s)
+: Basic::ThreadSingleTask(parent, 0.0f), rootDir(root), model(mdl), num(n), spares(s), stopReq(0)
+{
+   STANDARD_CONSTRUCTOR()
+}
+
+void ModelLoader::stop()
+{
+   lcAtomicStore(stopReq, 1);
+}
+
+unsigned long ModelLoader::userFunc()
+{
+   unsigned int i = 0;
+   while (lcAtomicLoad(stopReq) == 0 &&
+          (i < num || JSBSimModel::getNumCachedModels(rootDir.c_str(), model.c_str()) < spares)) {
+      i++;
+      JSBSim::FGFDMExec* fe = 0;
+      JSBSim::FGPropertyManager* pm = 0;
+      if (!loadModel(rootDir.c_str(), model.c_str(), &fe, &pm)) break;
+      if (!putCachedModel(rootDir.c_str(), model.c_str(), fe, pm)) {
+         // Cache is full
+         delete fe;
+         delete pm;
+         break;
+      }
+   }
+   return 0;
+}
+
+//==============================================================================
+// JSBSimModel class
+//==============================================================================
+
 IMPLEMENT_SUBCLASS(JSBSimModel,"JSBSimModel")
 
 //------------------------------------------------------------------------------
@@ -52,12 +260,16 @@ IMPLEMENT_SUBCLASS(JSBSimModel,"JSBSimModel")
 BEGIN_SLOTTABLE(JSBSimModel)
     "rootDir",      //  1 root directory for JSBSim models
     "model",        //  2 JSBSim model
+    "preload",      //  3 number of spare instances kept in the model cache
+    "asyncLoad",    //  4 asynchronous model loading
 END_SLOTTABLE(JSBSimModel)
 
 // Map slot table to handles 
 BEGIN_SLOT_MAP(JSBSimModel)
     ON_SLOT(1,setRootDir,Basic::String)
     ON_SLOT(2,setModel,Basic::String)
+    ON_SLOT(3,setSlotPreload,Basic::Number)
+    ON_SLOT(4,setSlotAsyncLoad,Basic::Number)
 END_SLOT_MAP()
 
 EMPTY_SERIALIZER(JSBSimModel)
@@ -78,6 +290,10 @@ void JSBSimModel::initData()
     model = 0;
     fdmex = 0;
     propMgr = 0;
+    loader = 0;
+    preload = 0;
+    asyncLoad = false;
+    loadPending = false;
     pitchTrimPos         = static_cast<LCreal>(0.0);
     pitchTrimRate        = static_cast<LCreal>(0.1);
     pitchTrimSw          = static_cast<LCreal>(0.0);
@@ -103,11 +319,22 @@ void JSBSimModel::copyData(const JSBSimModel& org, const bool cc)
     BaseClass::copyData(org);
     if (cc) initData();
 
-    fdmex = 0;
-    propMgr = 0;
+    // Our executive isn't copied (we'll get our own at reset)
+    if (fdmex != 0) {
+        delete fdmex;
+        fdmex = 0;
+    }
+    if (propMgr != 0) {
+        delete propMgr;
+        propMgr = 0;
+    }
+    stopLoader();
+    loadPending = false;
 
     setRootDir( org.rootDir );
     setModel( org.model );
+    preload = org.preload;
+    asyncLoad = org.asyncLoad;
 
     pitchTrimPos = org.pitchTrimPos;
     pitchTrimRate = org.pitchTrimRate;
@@ -127,10 +354,14 @@ void JSBSimModel::copyData(const JSBSimModel& org, const bool cc)
 }
 
 //------------------------------------------------------------------------------
-// deleteData() -- delete instance of JSBSim, if any
+// deleteData() -- delete member data
+//
+// Our executive has been used, so it's deleted rather than returned to the
+// model cache (JSBSim can't fully reset an executive to its loaded state).
 //------------------------------------------------------------------------------
 void JSBSimModel::deleteData()
 {
+    stopLoader();
     if (fdmex != 0) {
         delete fdmex;
         fdmex = 0;
@@ -141,6 +372,16 @@ void JSBSimModel::deleteData()
     }
 }
 
+//------------------------------------------------------------------------------
+// shutdownNotification() -- stop our loader and free the model cache
+//------------------------------------------------------------------------------
+bool JSBSimModel::shutdownNotification()
+{
+    stopLoader();
+    clearModelCache();
+    return BaseClass::shutdownNotification();
+}
+
 //------------------------------------------------------------------------------
 // Get Vehicle data
 //------------------------------------------------------------------------------
@@ -659,6 +900,17 @@ void JSBSimModel::dynamics(const LCreal dt)
     Simulation::Player* p = static_cast<Simulation::Player*>( findContainerByType(typeid(Simulation::Player)) );
     if (p == 0) return;
 
+    // Waiting for an asynchronous load?
+    if (loadPending) {
+        if (!attachModel()) {
+            // Still loading?  If not, our instance was taken by another model, so load another.
+            if (loader == 0 || loader->isTerminated()) startLoader(1);
+            return;
+        }
+        loadPending = false;
+        initModel(p);
+    }
+
     if (fdmex == 0) return;
 
     JSBSim::FGPropagate* Propagate = fdmex->GetPropagate();
@@ -827,18 +1079,100 @@ void JSBSimModel::reset()
 
     // Must also have the JSBSim object
     if (fdmex == 0) {
-        // must have a JSBSim property manager
-        if (propMgr == 0) {
-            propMgr = new JSBSim::FGPropertyManager();
+        if (!attachModel()) {
+            if (asyncLoad) {
+                // Load it using a worker thread
+                loadPending = true;
+                startLoader(1);
+                return;
+            }
+            JSBSim::FGFDMExec* fe = 0;
+            JSBSim::FGPropertyManager* pm = 0;
+            if (!loadModel(rootDir->getString(), model->getString(), &fe, &pm)) return;
+            fdmex = fe;
+            propMgr = pm;
+            setHoldFlags();
+        }
+    }
+
+    // Top up the spare instances
+    if (preload > 0 && getNumCachedModels(rootDir->getString(), model->getString()) < preload) {
+        startLoader(0);
+    }
+
+    initModel(p);
+}
+
+//------------------------------------------------------------------------------
+// attachModel() -- gets a ready instance of our model from the model cache
+//------------------------------------------------------------------------------
+bool JSBSimModel::attachModel()
+{
+    if (rootDir == 0 || model == 0) return false;
+
+    JSBSim::FGFDMExec* fe = 0;
+    JSBSim::FGPropertyManager* pm = 0;
+    if (!getCachedModel(rootDir->getString(), model->getString(), &fe, &pm)) return false;
+
+    fdmex = fe;
+    propMgr = pm;
+    setHoldFlags();
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// startLoader() -- loads 'n' instances of our model, plus any needed spares,
+// into the model cache using a worker thread
+//------------------------------------------------------------------------------
+void JSBSimModel::startLoader(const unsigned int n)
+{
+    if (rootDir == 0 || model == 0) return;
+
+    // Only one loader thread at a time
+    if (loader != 0) {
+        if (!loader->isTerminated()) return;
+        loader->unref();
+        loader = 0;
+    }
+    if (isShutdown()) return;
+
+    loader = new ModelLoader(this, rootDir->getString(), model->getString(), n, preload);
+    if (!loader->create()) {
+        if (isMessageEnabled(MSG_ERROR)) {
+            std::cerr << "JSBSimModel::startLoader(): ERROR, failed to create the loader thread!" << std::endl;
+        }
+        loader->unref();
+        loader = 0;
+        loadPending = false;
+    }
+}
+
+//------------------------------------------------------------------------------
+// stopLoader() -- stops our loader thread, if any.  The thread is never
+// terminated during a load; we wait for it to finish its current load.
+//------------------------------------------------------------------------------
+void JSBSimModel::stopLoader()
+{
+    if (loader != 0) {
+        loader->stop();
+        while (!loader->isTerminated()) {
+            lcSleep(10);
         }
-        fdmex = new JSBSim::FGFDMExec(propMgr);
+        loader->unref();
+        loader = 0;
+    }
+}
 
-        std::string RootDir(rootDir->getString());
-        fdmex->SetAircraftPath(RootDir + "aircraft");
-        fdmex->SetEnginePath(RootDir + "engine");
-        fdmex->SetSystemsPath(RootDir + "systems"); // JSBSim-1.0 or after only
+//------------------------------------------------------------------------------
+// setHoldFlags() -- checks the model for the autopilot hold properties
+//------------------------------------------------------------------------------
+void JSBSimModel::setHoldFlags()
+{
+    hasHeadingHold = false;
+    hasVelocityHold = false;
+    hasAltitudeHold = false;
 
-        fdmex->LoadModel(model->getString());
+    if (fdmex != 0) {
         JSBSim::FGPropertyManager* propMgr = fdmex->GetPropertyManager();
         if (propMgr != 0) {
             hasHeadingHold = propMgr->HasNode("ap/heading_hold") && propMgr->HasNode("ap/heading_setpoint");
@@ -861,7 +1195,15 @@ void JSBSimModel::reset()
 #endif
         }
     }
-    
+}
+
+//------------------------------------------------------------------------------
+// initModel() -- sets the JSBSim model's initial conditions
+//------------------------------------------------------------------------------
+void JSBSimModel::initModel(Simulation::Player* const p)
+{
+    if (fdmex == 0 || p == 0) return;
+
 #if 0
     // CGB TBD
     reset = 0;
@@ -938,6 +1280,44 @@ bool JSBSimModel::setModel(const Basic::String* const mdl)
     return true;
 }
 
+// Sets the number of spare instances that are kept in the model cache
+bool JSBSimModel::setPreload(const unsigned int n)
+{
+    preload = (n < MAX_CACHED_INSTANCES ? n : MAX_CACHED_INSTANCES);
+    return true;
+}
+
+// Sets the asynchronous model loading flag
+bool JSBSimModel::setAsyncLoad(const bool flg)
+{
+    asyncLoad = flg;
+    return true;
+}
+
+bool JSBSimModel::setSlotPreload(const Basic::Number* const msg)
+{
+    bool ok = false;
+    if (msg != 0) {
+        const int n = msg->getInt();
+        if (n >= 0) {
+            ok = setPreload(static_cast<unsigned int>(n));
+        }
+        else {
+            std::cerr << "JSBSimModel::setSlotPreload(): invalid number of instances; must be zero or greater" << std::endl;
+        }
+    }
+    return ok;
+}
+
+bool JSBSimModel::setSlotAsyncLoad(const Basic::Number* const msg)
+{
+    bool ok = false;
+    if (msg != 0) {
+        ok = setAsyncLoad(msg->getBoolean());
+    }
+    return ok;
+}
+
 //------------------------------------------------------------------------------
 // getSlotByIndex()
 //------------------------------------------------------------------------------
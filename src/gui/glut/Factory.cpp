@@ -5,59 +5,42 @@
 #include "openeaagles/gui/glut/Factory.h"
 
 #include "openeaagles/basic/Object.h"
+#include "openeaagles/basic/FactoryTable.h"
 
 #include "openeaagles/gui/glut/GlutDisplay.h"
 #include "openeaagles/gui/glut/Shapes3D.h"
 
-#include <cstring>
-
 namespace Eaagles {
 namespace Glut {
 
+//------------------------------------------------------------------------------
+// addClasses() -- adds our classes to the factory table
+//------------------------------------------------------------------------------
+static void addClasses(Basic::FactoryTable& table)
+{
+    // General graphics support
+    table.add<GlutDisplay>();
+    // glut shapes support
+    table.add<Sphere>();
+    table.add<Cylinder>();
+    table.add<Cone>();
+    table.add<Cube>();
+    table.add<Torus>();
+    table.add<Dodecahedron>();
+    table.add<Tetrahedron>();
+    table.add<Icosahedron>();
+    table.add<Octahedron>();
+    table.add<Teapot>();
+}
+
+static Basic::FactoryTable factoryTable(addClasses);
+
 Factory::Factory()
 {}
 
 Basic::Object* Factory::createObj(const char* name)
 {
-    Basic::Object* obj = 0;
-
-    // General graphics support
-    if ( std::strcmp(name, GlutDisplay::getFactoryName()) == 0 ) {
-      obj = new GlutDisplay();
-    }
-    // glut shapes support
-    else if ( std::strcmp(name, Sphere::getFactoryName()) == 0 ) {
-      obj = new Sphere();
-    }
-    else if ( std::strcmp(name, Cylinder::getFactoryName()) == 0 ) {
-      obj = new Cylinder();
-    }
-    else if ( std::strcmp(name, Cone::getFactoryName()) == 0 ) {
-      obj = new Cone();
-    }
-    else if ( std::strcmp(name, Cube::getFactoryName()) == 0 ) {
-      obj = new Cube();
-    }
-    else if ( std::strcmp(name, Torus::getFactoryName()) == 0 ) {
-      obj = new Torus();
-    }
-    else if ( std::strcmp(name, Dodecahedron::getFactoryName()) == 0 ) {
-      obj = new Dodecahedron();
-    }
-    else if ( std::strcmp(name, Tetrahedron::getFactoryName()) == 0 ) {
-      obj = new Tetrahedron();
-    }
-    else if ( std::strcmp(name, Icosahedron::getFactoryName()) == 0 ) {
-      obj = new Icosahedron();
-    }
-    else if ( std::strcmp(name, Octahedron::getFactoryName()) == 0 ) {
-      obj = new Octahedron();
-    }
-    else if ( std::strcmp(name, Teapot::getFactoryName()) == 0 ) {
-      obj = new Teapot();
-    }
-
-    return obj;
+    return factoryTable.createObj(name);
 }
 
 }  // end namespace Glut
@@ -5,6 +5,7 @@
 #include "openeaagles/instruments/Factory.h"
 
 #include "openeaagles/basic/Object.h"
+#include "openeaagles/basic/FactoryTable.h"
 
 // Top Level objects
 #include "openeaagles/instruments/Instrument.h"
@@ -52,128 +53,78 @@
 // Eadi3D
 #include "openeaagles/instruments/eadi3D/Eadi3DPage.h"
 
-#include <cstring>
-
 namespace Eaagles {
 namespace Instruments {
 
-Factory::Factory()
-{}
-
-Basic::Object* Factory::createObj(const char* name)
+//------------------------------------------------------------------------------
+// addClasses() -- adds our classes to the factory table
+//------------------------------------------------------------------------------
+static void addClasses(Basic::FactoryTable& table)
 {
-    Basic::Object* obj = 0;
-
     // Instrument
-    if ( std::strcmp(name, Instrument::getFactoryName()) == 0 ) {
-        obj = new Instrument;
-    }
+    table.add<Instrument>();
     // Analog Dial
-    else if ( std::strcmp(name, AnalogDial::getFactoryName()) == 0 ) {
-        obj = new AnalogDial;
-    }
+    table.add<AnalogDial>();
     // Tick Marks for the analog dial
-    else if ( std::strcmp(name, DialTickMarks::getFactoryName()) == 0 ) {
-        obj = new DialTickMarks;
-    }
+    table.add<DialTickMarks>();
     // Arc Segments for the analog dial
-    else if ( std::strcmp(name, DialArcSegment::getFactoryName()) == 0 ) {
-        obj = new DialArcSegment;
-    }
+    table.add<DialArcSegment>();
     // Dial Pointer
-    else if ( std::strcmp(name, DialPointer::getFactoryName()) == 0 ) {
-        obj = new DialPointer;
-    }
+    table.add<DialPointer>();
     // CompassRose
-    else if ( std::strcmp(name, CompassRose::getFactoryName()) == 0 ) {
-        obj = new CompassRose;
-    }
+    table.add<CompassRose>();
     // Bearing Pointer
-    else if ( std::strcmp(name, BearingPointer::getFactoryName()) == 0 ) {
-        obj = new BearingPointer;
-    }
+    table.add<BearingPointer>();
     // AltitudeDial
-    else if ( std::strcmp(name, AltitudeDial::getFactoryName()) == 0 ) {
-        obj = new AltitudeDial;
-    }
+    table.add<AltitudeDial>();
     // GMeterDial
-    else if ( std::strcmp(name, GMeterDial::getFactoryName()) == 0 ) {
-        obj = new GMeterDial;
-    }    
+    table.add<GMeterDial>();
     // Here is the analog gauge and its pieces
     // AnalogGauge
-    else if ( std::strcmp(name, AnalogGauge::getFactoryName()) == 0 ) {
-        obj = new AnalogGauge;
-    }
-    else if ( std::strcmp(name, GaugeSlider::getFactoryName()) == 0 ) {
-        obj = new GaugeSlider;
-    }
+    table.add<AnalogGauge>();
+    table.add<GaugeSlider>();
     // Tape
-    else if ( std::strcmp(name, Tape::getFactoryName()) == 0 ) {
-        obj = new Tape;
-    }
+    table.add<Tape>();
     // digital AOA gauge
-    else if ( std::strcmp(name, AoAIndexer::getFactoryName()) == 0 ) {
-        obj = new AoAIndexer;
-    }
+    table.add<AoAIndexer>();
     // Tick Marks (horizontal and vertical)
-    else if ( std::strcmp(name, TickMarks::getFactoryName()) == 0 ) {
-        obj = new TickMarks;
-    }
+    table.add<TickMarks>();
     // Landing Gear
-    else if ( std::strcmp(name, LandingGear::getFactoryName()) == 0 ) {
-        obj = new LandingGear;
-    }
+    table.add<LandingGear>();
     // Landing Lights
-    else if ( std::strcmp(name, LandingLight::getFactoryName()) == 0 ) {
-        obj = new LandingLight;
-    }
+    table.add<LandingLight>();
     // EngPage
-    else if ( std::strcmp(name, EngPage::getFactoryName()) == 0 ) {
-        obj = new EngPage;
-    }
+    table.add<EngPage>();
     // Button
-    else if (std::strcmp(name, Button::getFactoryName()) == 0 ) {
-        obj = new Button;
-    }
+    table.add<Button>();
     // Push Button
-    else if (std::strcmp(name, PushButton::getFactoryName()) == 0 ) {
-        obj = new PushButton;
-    }
+    table.add<PushButton>();
     // Rotary Switch
-    else if (std::strcmp(name, RotarySwitch::getFactoryName()) == 0 ) {
-        obj = new RotarySwitch;
-    }
+    table.add<RotarySwitch>();
     // Knob
-    else if (std::strcmp(name, Knob::getFactoryName()) == 0 ) {
-        obj = new Knob;
-    }
+    table.add<Knob>();
     // Switch
-    else if (std::strcmp(name, Switch::getFactoryName()) == 0 ) {
-        obj = new Switch;
-    }
+    table.add<Switch>();
     // Hold Switch
-    else if (std::strcmp(name, SolenoidSwitch::getFactoryName()) == 0 ) {
-        obj = new SolenoidSwitch;
-    }
+    table.add<SolenoidSwitch>();
     // Hold Button
-    else if (std::strcmp(name, SolenoidButton::getFactoryName()) == 0 ) {
-        obj = new SolenoidButton;
-    }
+    table.add<SolenoidButton>();
     // Adi
-    else if (std::strcmp(name, Adi::getFactoryName()) == 0 ) {
-        obj = new Adi;
-    }
+    table.add<Adi>();
     // Ghost Horizon
-    else if (std::strcmp(name, GhostHorizon::getFactoryName()) == 0 ) {
-        obj = new GhostHorizon;
-    }
+    table.add<GhostHorizon>();
     // Eadi3D
-    else if (std::strcmp(name, Eadi3DPage::getFactoryName()) == 0 ) {
-        obj = new Eadi3DPage;
-    }
+    table.add<Eadi3DPage>();
+}
+
+static Basic::FactoryTable factoryTable(addClasses);
 
-    return obj;
+Factory::Factory()
+{}
+
+Basic::Object* Factory::createObj(const char* name)
+{
+    return factoryTable.createObj(name);
 }
 
 }  // end namespace Instruments
@@ -5,6 +5,7 @@
 #include "openeaagles/ioDevice/Factory.h"
 
 #include "openeaagles/basic/Object.h"
+#include "openeaagles/basic/FactoryTable.h"
 
 #include "openeaagles/ioDevice/Ai2DiSwitch.h"
 #include "openeaagles/ioDevice/AnalogInput.h"
@@ -14,8 +15,6 @@
 #include "openeaagles/ioDevice/IoData.h"
 #include "openeaagles/ioDevice/SignalGen.h"
 
-#include <cstring>
-
 #if defined(WIN32)
    #include "./windows/UsbJoystickImp.h"
 #else
@@ -25,48 +24,38 @@
 namespace Eaagles {
 namespace IoDevice {
 
-Factory::Factory()
-{}
-
-Basic::Object* Factory::createObj(const char* name)
+//------------------------------------------------------------------------------
+// addClasses() -- adds our classes to the factory table
+//------------------------------------------------------------------------------
+static void addClasses(Basic::FactoryTable& table)
 {
-    Basic::Object* obj = 0;
-
     // Data buffers
-    if ( std::strcmp(name, IoData::getFactoryName()) == 0 ) {
-        obj = new IoData();
-    }
+    table.add<IoData>();
 
     // Data Handlers
-    else if ( std::strcmp(name, DiscreteInput::getFactoryName()) == 0 ) {
-        obj = new DiscreteInput();
-    }
-    else if ( std::strcmp(name, DiscreteOutput::getFactoryName()) == 0 ) {
-        obj = new DiscreteOutput();
-    }
-    else if ( std::strcmp(name, AnalogInput::getFactoryName()) == 0 ) {
-        obj = new AnalogInput();
-    }
-    else if ( std::strcmp(name, AnalogOutput::getFactoryName()) == 0 ) {
-        obj = new AnalogOutput();
-    }
+    table.add<DiscreteInput>();
+    table.add<DiscreteOutput>();
+    table.add<AnalogInput>();
+    table.add<AnalogOutput>();
 
     // Signal converters and generators
-    else if ( std::strcmp(name, Ai2DiSwitch::getFactoryName()) == 0 ) {
-        obj = new Ai2DiSwitch();
-    }
-    else if ( std::strcmp(name, SignalGen::getFactoryName()) == 0 ) {
-        obj = new SignalGen();
-    }
+    table.add<Ai2DiSwitch>();
+    table.add<SignalGen>();
 
     // ---
     // Device handler implementations (Linux and/or Windows)
     // ---
-    else if ( std::strcmp(name, UsbJoystickImp::getFactoryName()) == 0 ) {
-        obj = new UsbJoystickImp();
-    }
+    table.add<UsbJoystickImp>();
+}
+
+static Basic::FactoryTable factoryTable(addClasses);
 
-    return obj;
+Factory::Factory()
+{}
+
+Basic::Object* Factory::createObj(const char* name)
+{
+    return factoryTable.createObj(name);
 }
 
 }  // end namespace IoDevice
@@ -4,33 +4,34 @@
 #include "openeaagles/maps/Factory.h"
 
 #include "openeaagles/basic/Object.h"
+#include "openeaagles/basic/FactoryTable.h"
 
 //
 #include "openeaagles/maps/rpfMap/MapDrawer.h"
 #include "openeaagles/maps/rpfMap/CadrgMap.h"
 
-#include <cstring>
-
 namespace Eaagles {
 namespace Maps {
 
+//------------------------------------------------------------------------------
+// addClasses() -- adds our classes to the factory table
+//------------------------------------------------------------------------------
+static void addClasses(Basic::FactoryTable& table)
+{
+    // Map Drawer
+    table.add<Rpf::MapDrawer>();
+    // CadrgMap
+    table.add<Rpf::CadrgMap>();
+}
+
+static Basic::FactoryTable factoryTable(addClasses);
+
 Factory::Factory()
 {}
 
 Basic::Object* Factory::createObj(const char* name)
 {
-    Basic::Object* obj = 0;
-
-    // Map Drawer
-    if ( std::strcmp(name, Rpf::MapDrawer::getFactoryName()) == 0 ) {
-        obj = new Rpf::MapDrawer();
-    }
-    // CadrgMap
-    else if ( std::strcmp(name, Rpf::CadrgMap::getFactoryName()) == 0 ) {
-        obj = new Rpf::CadrgMap();
-    }
-
-    return obj;
+    return factoryTable.createObj(name);
 }
 
 }  // end namespace Maps
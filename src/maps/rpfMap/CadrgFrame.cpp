@@ -5,6 +5,7 @@
 #include "openeaagles/maps/rpfMap/CadrgFrame.h"
 #include "openeaagles/basic/String.h"
 #include "openeaagles/maps/rpfMap/CadrgFrameEntry.h"
+#include <cstring>
 
 namespace Eaagles {
 namespace Maps {
@@ -347,43 +348,31 @@ int CadrgFrame::decompressSubframe(int x, int y, Subframe& subFrame)
     // This should never occur since all subFrames should be present,
     // but if it does occur, just put up black pixels on the screen.
     if (((ptr = subFrameTable[y][x]) == 0) || masked[y][x]) {
-        for (int i = 0; i < 256; i ++) {
-            for (int j = 0; j < 256; j ++) {
-                subFrame.image[i][j] = (unsigned char)blackpixel;
-            }
-        }
+        std::memset(subFrame.image, (unsigned char)blackpixel, sizeof(subFrame.image));
     }
     else {
+        // Each 3 bytes are two 12-bit indexes into the VQ table, and each table
+        // entry is a 4 x 4 block of pixels; the block's rows are copied as
+        // 4 byte words.
         for (int i = 0; i < 256; i += 4) {
             for (int j = 0; j < 256; j += 8, ptr += 3) {
                 unsigned int vals = ptr[0] << 16 | ptr[1] << 8 | ptr[2];
+
                 // Get first 12-bit value as index into VQ table
-                unsigned char* imagePtr = &subFrame.image[j][i];
                 val = (vals >> 12) & 0xfff;
-                unsigned char* lutPtr = &lookupTable[val][0][0];
-                for (int e = 0; e < 4; e++) {
-                    for (int t = 0; t < 4; t++) {
-                        *imagePtr = *lutPtr;
-                        imagePtr++;
-                        lutPtr++;
-                    }
-                    // 256 - 4
-                    imagePtr += 252;
-                }
+                const unsigned char* lutPtr = &lookupTable[val][0][0];
+                std::memcpy(&subFrame.image[j][i],     lutPtr,      4);
+                std::memcpy(&subFrame.image[j + 1][i], lutPtr + 4,  4);
+                std::memcpy(&subFrame.image[j + 2][i], lutPtr + 8,  4);
+                std::memcpy(&subFrame.image[j + 3][i], lutPtr + 12, 4);
 
                 // Get second 12-bit value as index
-                imagePtr = &subFrame.image[j + 4][i];
                 val = vals & 0xfff;
                 lutPtr = &lookupTable[val][0][0];
-                for (int e = 0; e < 4; e++) {
-                    for (int t = 0; t < 4; t++) {
-                        *imagePtr = *lutPtr;
-                        imagePtr++;
-                        lutPtr++;
-                    }
-                    // 256 - 4
-                    imagePtr += 252;
-                }
+                std::memcpy(&subFrame.image[j + 4][i], lutPtr,      4);
+                std::memcpy(&subFrame.image[j + 5][i], lutPtr + 4,  4);
+                std::memcpy(&subFrame.image[j + 6][i], lutPtr + 8,  4);
+                std::memcpy(&subFrame.image[j + 7][i], lutPtr + 12, 4);
             }
         }
     }
@@ -8,6 +8,7 @@
 #include "openeaagles/maps/rpfMap/CadrgTocEntry.h"
 #include "openeaagles/maps/rpfMap/TexturePager.h"
 #include "openeaagles/maps/rpfMap/MapDrawer.h"
+#include "openeaagles/maps/rpfMap/TileCache.h"
 #include "openeaagles/basicGL/Texture.h"
 #include "openeaagles/basic/Pair.h"
 #include "openeaagles/basic/PairStream.h"
@@ -23,12 +24,18 @@ BEGIN_SLOTTABLE(CadrgMap)
     "pathNames",        // Path names to our TOC file
     "maxTableSize",     // Max table size to set up
     "mapLevel",         // Map level we are going to set (if it exists)
+    "decodeThreads",    // Number of tile decoding threads
+    "tileCacheSize",    // Number of decoded tiles that are cached
+    "prefetchTime",     // Prefetch look ahead time (seconds)
 END_SLOTTABLE(CadrgMap)
 
 BEGIN_SLOT_MAP(CadrgMap)
     ON_SLOT(1, setSlotPathnames, Basic::PairStream)
     ON_SLOT(2, setSlotMaxTableSize, Basic::Number)
     ON_SLOT(3, setSlotMapLevel, Basic::String)
+    ON_SLOT(4, setSlotDecodeThreads, Basic::Number)
+    ON_SLOT(5, setSlotTileCacheSize, Basic::Number)
+    ON_SLOT(6, setSlotPrefetchTime, Basic::Number)
 END_SLOT_MAP()
 
 
@@ -52,6 +59,16 @@ CadrgMap::CadrgMap()
     setMaxTableSize(3);
     mapLevel = 0;
     initLevelLoaded = false;
+
+    tileCache = 0;
+    decodeThreads = 0;
+    tileCacheSize = 64;
+    prefetchTime = 20.0f;
+    prevLat = 0;
+    prevLon = 0;
+    latRate = 0;
+    lonRate = 0;
+    trackValid = false;
 }
 
 //------------------------------------------------------------------------------
@@ -66,6 +83,7 @@ void CadrgMap::copyData(const CadrgMap& org, const bool cc)
         curCadrgFile = 0;
         stack = 0;
         mapLevel = 0;
+        tileCache = 0;
     }
     for (int i = 0; i < MAX_FILES; i++) {
         if (cadrgFiles[i] != 0) cadrgFiles[i]->unref();
@@ -91,6 +109,14 @@ void CadrgMap::copyData(const CadrgMap& org, const bool cc)
     maxTableSize = org.maxTableSize;
     numFiles = org.numFiles;
     initLevelLoaded = org.initLevelLoaded;
+
+    // Our own tile cache
+    tileCacheSize = org.tileCacheSize;
+    prefetchTime = org.prefetchTime;
+    setDecodeThreads(org.decodeThreads);
+    latRate = 0;
+    lonRate = 0;
+    trackValid = false;
 }
 
 //------------------------------------------------------------------------------
@@ -111,6 +137,12 @@ void CadrgMap::deleteData()
 
     if (stack != 0) stack->unref();
     stack = 0;
+
+    if (tileCache != 0) {
+        tileCache->stop();
+        tileCache->unref();
+    }
+    tileCache = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -645,6 +677,13 @@ void* CadrgMap::getPixels(const int row, const int column, TexturePager* tp)
             }
 
 
+            // Using the decoding threads?
+            if (tileCache != 0) {
+                if (!tileCache->isStarted()) tileCache->start(this);
+                if (tileCache->getTile(currentToc, row, column, outTile)) return (void *) &outTile;
+                return 0;
+            }
+
             int frameRow = row / 6;
             int frameCol = column / 6;
             CadrgFrameEntry* frameEntry = currentToc->getFrameEntry(frameRow, frameCol);
@@ -673,14 +712,7 @@ void* CadrgMap::getPixels(const int row, const int column, TexturePager* tp)
                     // Decompress our subframe
                     frame->decompressSubframe(row, column, subframe);
                     // Set our color based on subframe image
-                    for (int i = 0; i < 256; i++) {
-                        for (int j = 0; j < 256; j++) {
-                            CadrgClut::Rgb rgb = frameEntry->getClut().getColor(subframe.image[j][255-i]);
-                            outTile.texel[i][j].red = rgb.red;
-                            outTile.texel[i][j].green = rgb.green;
-                            outTile.texel[i][j].blue = rgb.blue;
-                        }
-                    }
+                    subframeToTile(subframe, frameEntry->getClut(), outTile);
                 }
             }
         }
@@ -689,6 +721,48 @@ void* CadrgMap::getPixels(const int row, const int column, TexturePager* tp)
     return (void *) &outTile;
 }
 
+// ------------------------------------------------------------------------
+// subframeToTile() - Sets a tile's colors from a decompressed subframe.
+// ------------------------------------------------------------------------
+void CadrgMap::subframeToTile(const Subframe& subframe, const CadrgClut& clut, ColorArray& tile)
+{
+    for (int i = 0; i < 256; i++) {
+        for (int j = 0; j < 256; j++) {
+            const CadrgClut::Rgb& rgb = clut.getColor(subframe.image[j][255-i]);
+            tile.texel[i][j].red = rgb.red;
+            tile.texel[i][j].green = rgb.green;
+            tile.texel[i][j].blue = rgb.blue;
+        }
+    }
+}
+
+// ------------------------------------------------------------------------
+// prefetchTiles() - Queues the tiles of the texture table around the position
+// that's predicted 'prefetchTime' seconds ahead, using our reference
+// position's ground track and speed, for the decoding threads.
+// ------------------------------------------------------------------------
+void CadrgMap::prefetchTiles(TexturePager* tp)
+{
+    if (tileCache == 0 || tp == 0 || tp->getToc() == 0 || !trackValid || prefetchTime <= 0) return;
+    if (latRate == 0 && lonRate == 0) return;
+
+    // Predicted position
+    const double pLat = getReferenceLatDeg() + latRate * prefetchTime;
+    const double pLon = getReferenceLonDeg() + lonRate * prefetchTime;
+
+    float oRow = 0, oCol = 0, pRow = 0, pCol = 0;
+    int tRow = 0, tCol = 0;
+    latLonToTileRowColumn(pLat, pLon, oRow, oCol, tRow, tCol, pRow, pCol, tp);
+
+    // Tiles of a texture table centered on the predicted position
+    const int n = tp->getTable().getMaxTableSize() / 2;
+    for (int r = -n; r <= n; r++) {
+        for (int c = -n; c <= n; c++) {
+            if (isValidFrame(tRow + r, tCol + c, tp)) tileCache->prefetchTile(tp->getToc(), tRow + r, tCol + c);
+        }
+    }
+}
+
 // ------------------------------------------------------------------------
 // releaseFrame() - Release the current frame within the frame entry
 // at the specific row and column, if it exists.  This frees us space
@@ -739,12 +813,125 @@ void CadrgMap::updateData(LCreal dt)
 {
     BaseClass::updateData(dt);
 
+    // Estimate our reference position's ground track and speed (filtered
+    // lat/lon rates) for prefetching; jumps of more than a degree (e.g., the
+    // map was moved) reset the rates.
+    const double lat = getReferenceLatDeg();
+    const double lon = getReferenceLonDeg();
+    if (trackValid && dt > 0) {
+        double dLat = lat - prevLat;
+        double dLon = lon - prevLon;
+        if (dLon > 180.0) dLon -= 360.0;
+        else if (dLon < -180.0) dLon += 360.0;
+        if (dLat > -1.0 && dLat < 1.0 && dLon > -1.0 && dLon < 1.0) {
+            latRate += 0.2 * (dLat / dt - latRate);
+            lonRate += 0.2 * (dLon / dt - lonRate);
+        }
+        else {
+            latRate = 0;
+            lonRate = 0;
+        }
+    }
+    prevLat = lat;
+    prevLon = lon;
+    trackValid = true;
+
     if (!initLevelLoaded && mapLevel != 0 && !mapLevel->isEmpty()) {
         setMapLevel(mapLevel->getString());
         initLevelLoaded = true;
     }
 }
 
+//------------------------------------------------------------------------------
+// shutdownNotification() - Stop the decoding threads.
+//------------------------------------------------------------------------------
+bool CadrgMap::shutdownNotification()
+{
+    if (tileCache != 0) tileCache->stop();
+    return BaseClass::shutdownNotification();
+}
+
+//------------------------------------------------------------------------------
+// setDecodeThreads() - Sets the number of tile decoding threads; zero to
+// decode using the drawing thread.
+//------------------------------------------------------------------------------
+bool CadrgMap::setDecodeThreads(const int n)
+{
+    if (n < 0) return false;
+
+    if (tileCache != 0) {
+        tileCache->stop();
+        tileCache->unref();
+        tileCache = 0;
+    }
+
+    decodeThreads = n;
+    if (decodeThreads > 0) {
+        tileCache = new TileCache();
+        tileCache->setCacheSize(tileCacheSize);
+        if (!tileCache->setNumThreads(decodeThreads)) {
+            std::cerr << "CadrgMap::setDecodeThreads() - invalid number of threads: " << decodeThreads << std::endl;
+            tileCache->unref();
+            tileCache = 0;
+            decodeThreads = 0;
+            return false;
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// setTileCacheSize() - Sets the number of decoded tiles that are cached.
+//------------------------------------------------------------------------------
+bool CadrgMap::setTileCacheSize(const int n)
+{
+    if (n < 1) return false;
+    tileCacheSize = n;
+    // Resize our cache
+    if (tileCache != 0) return setDecodeThreads(decodeThreads);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// setPrefetchTime() - Sets the prefetch look ahead time (seconds).
+//------------------------------------------------------------------------------
+bool CadrgMap::setPrefetchTime(const LCreal t)
+{
+    if (t < 0) return false;
+    prefetchTime = t;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// setSlotDecodeThreads() - Sets the number of tile decoding threads.
+//------------------------------------------------------------------------------
+bool CadrgMap::setSlotDecodeThreads(const Basic::Number* const x)
+{
+    bool ok = false;
+    if (x != 0) ok = setDecodeThreads(x->getInt());
+    return ok;
+}
+
+//------------------------------------------------------------------------------
+// setSlotTileCacheSize() - Sets the number of decoded tiles that are cached.
+//------------------------------------------------------------------------------
+bool CadrgMap::setSlotTileCacheSize(const Basic::Number* const x)
+{
+    bool ok = false;
+    if (x != 0) ok = setTileCacheSize(x->getInt());
+    return ok;
+}
+
+//------------------------------------------------------------------------------
+// setSlotPrefetchTime() - Sets the prefetch look ahead time (seconds).
+//------------------------------------------------------------------------------
+bool CadrgMap::setSlotPrefetchTime(const Basic::Number* const x)
+{
+    bool ok = false;
+    if (x != 0) ok = setPrefetchTime(x->getReal());
+    return ok;
+}
+
 //------------------------------------------------------------------------------
 // getSlotByIndex() - Get the slot data.
 //------------------------------------------------------------------------------
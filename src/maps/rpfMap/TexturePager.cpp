@@ -141,6 +141,9 @@ void TexturePager::updateTextures(const int tRow, const int tCol)
         reuseTextures();
     }
     loadNewTextures();
+
+    // Decode the tiles that we'll need next (if using the decoding threads)
+    map->prefetchTiles(this);
 }
 
 //------------------------------------------------------------------------------
@@ -258,12 +261,15 @@ void TexturePager::loadNewTextures()
                             Basic::List::Item* item = stack->getFirstItem();
                             if (item != 0) {
                                 BasicGL::Texture* obj = dynamic_cast<BasicGL::Texture*>(item->getValue());
-                                if (obj != 0) {
+                                // Get the frame data; if the map's decoding threads haven't
+                                // finished this tile yet, try the next position.
+                                void* pixels = 0;
+                                if (obj != 0) pixels = map->getPixels(r + row, c + col, this);
+                                if (pixels != 0) {
                                     // Set our new texture object there, and remove it from our stack.
                                     table.setTextureObject(r, c, obj);
                                     stack->removeHead();
                                     // Now load the frame data onto our new texture.
-                                    void* pixels = map->getPixels(r + row, c + col, this);
                                     map->loadFrameToTexture(obj, pixels);
                                     // The return is here because we only want to load one texture at a time.
                                     return;
@@ -0,0 +1,441 @@
+// ------------------------------------------------------------------------------
+// Class: TileCache
+// ------------------------------------------------------------------------------
+
+#include "openeaagles/maps/rpfMap/TileCache.h"
+#include "openeaagles/maps/rpfMap/CadrgFrame.h"
+#include "openeaagles/maps/rpfMap/CadrgFrameEntry.h"
+#include "openeaagles/maps/rpfMap/CadrgTocEntry.h"
+#include "openeaagles/basic/Component.h"
+#include "openeaagles/basic/Thread.h"
+
+namespace Eaagles {
+namespace Maps {
+namespace Rpf {
+
+// Semaphore to protect the loading of the color lookup tables
+static long clutLock = 0;
+
+//==============================================================================
+// Worker thread -- decodes the queued tiles until the cache is stopped or our
+// parent is shutdown
+//==============================================================================
+
+class TileDecoder : public Basic::ThreadSingleTask {
+    DECLARE_SUBCLASS(TileDecoder, Basic::ThreadSingleTask)
+public: TileDecoder(Basic::Component* const parent, TileCache* const cache);
+private: virtual unsigned long userFunc();
+    TileCache* cache;       // Our tile cache (ref()'d)
+};
+
+IMPLEMENT_SUBCLASS(TileDecoder, "RpfTileDecoder")
+EMPTY_SLOTTABLE(TileDecoder)
+EMPTY_COPYDATA(TileDecoder)
+EMPTY_SERIALIZER(TileDecoder)
+
+TileDecoder::TileDecoder(Basic::Component* const parent, TileCache* const c)
+: Basic::ThreadSingleTask(parent, 0.0f), cache(c)
+{
+    STANDARD_CONSTRUCTOR()
+    if (cache != 0) cache->ref();
+}
+
+void TileDecoder::deleteData()
+{
+    if (cache != 0) cache->unref();
+    cache = 0;
+}
+
+unsigned long TileDecoder::userFunc()
+{
+    if (cache == 0) return 0;
+
+    // Our own frame and decode buffer
+    CadrgFrame* frame = new CadrgFrame();
+    CadrgMap::ColorArray* buffer = new CadrgMap::ColorArray;
+
+    Basic::Component* parent = getParent();
+    while ( !cache->isStopping() && (parent == 0 || !parent->isShutdown()) ) {
+        // Sleep when there's nothing to do
+        if (!cache->decodeNext(frame, buffer)) lcSleep(5);
+    }
+
+    delete buffer;
+    frame->unref();
+    return 0;
+}
+
+//==============================================================================
+// TileCache class
+//==============================================================================
+
+IMPLEMENT_SUBCLASS(TileCache, "TileCache")
+EMPTY_SLOTTABLE(TileCache)
+EMPTY_SERIALIZER(TileCache)
+
+//------------------------------------------------------------------------------
+// Constructor()
+//------------------------------------------------------------------------------
+TileCache::TileCache()
+{
+    STANDARD_CONSTRUCTOR()
+
+    tiles = 0;
+    cacheSize = 0;
+    useCount = 0;
+    numRequests = 0;
+    for (int i = 0; i < MAX_THREADS; i++) {
+        threads[i] = 0;
+    }
+    numThreads = 1;
+    started = false;
+    stopping = false;
+    numDecoded = 0;
+    decodeTime = 0;
+    numHits = 0;
+    numMisses = 0;
+    lock = 0;
+
+    setCacheSize(64);
+}
+
+//------------------------------------------------------------------------------
+// copyData() -- copies our settings; not the cached tiles or the threads
+//------------------------------------------------------------------------------
+void TileCache::copyData(const TileCache& org, const bool cc)
+{
+    // Copy our baseclass stuff first
+    BaseClass::copyData(org);
+
+    if (cc) {
+        tiles = 0;
+        cacheSize = 0;
+        useCount = 0;
+        numRequests = 0;
+        for (int i = 0; i < MAX_THREADS; i++) {
+            threads[i] = 0;
+        }
+        started = false;
+        stopping = false;
+        lock = 0;
+    }
+
+    setCacheSize(org.cacheSize);
+    numThreads = org.numThreads;
+    numDecoded = 0;
+    decodeTime = 0;
+    numHits = 0;
+    numMisses = 0;
+}
+
+//------------------------------------------------------------------------------
+// deleteData()
+//------------------------------------------------------------------------------
+void TileCache::deleteData()
+{
+    stop();
+    setCacheSize(0);
+}
+
+//------------------------------------------------------------------------------
+// setCacheSize() - Sets the number of decoded tiles that are cached.
+//------------------------------------------------------------------------------
+bool TileCache::setCacheSize(const int n)
+{
+    if (n < 0 || started) return false;
+
+    clearCache();
+    if (tiles != 0) {
+        for (int i = 0; i < cacheSize; i++) {
+            delete tiles[i].pixels;
+        }
+        delete[] tiles;
+    }
+    tiles = 0;
+    cacheSize = 0;
+
+    if (n > 0) {
+        tiles = new Tile[n];
+        for (int i = 0; i < n; i++) {
+            tiles[i].toc = 0;
+            tiles[i].row = 0;
+            tiles[i].column = 0;
+            tiles[i].pixels = new CadrgMap::ColorArray;
+            tiles[i].lastUsed = 0;
+        }
+        cacheSize = n;
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// setNumThreads() - Sets the number of worker threads.
+//------------------------------------------------------------------------------
+bool TileCache::setNumThreads(const int n)
+{
+    if (n < 1 || n > MAX_THREADS || started) return false;
+    numThreads = n;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// start() - Creates the worker threads.
+//------------------------------------------------------------------------------
+bool TileCache::start(Basic::Component* const parent)
+{
+    if (started) return true;
+
+    stopping = false;
+    for (int i = 0; i < numThreads; i++) {
+        TileDecoder* t = new TileDecoder(parent, this);
+        if (t->create()) {
+            threads[i] = t;
+        }
+        else {
+            std::cerr << "TileCache::start(): ERROR, failed to create a worker thread!" << std::endl;
+            t->unref();
+        }
+    }
+    started = true;
+    return (threads[0] != 0);
+}
+
+//------------------------------------------------------------------------------
+// stop() - Stops the worker threads and waits for them to finish.
+//------------------------------------------------------------------------------
+void TileCache::stop()
+{
+    stopping = true;
+    for (int i = 0; i < MAX_THREADS; i++) {
+        if (threads[i] != 0) {
+            while (!threads[i]->isTerminated()) lcSleep(1);
+            threads[i]->unref();
+            threads[i] = 0;
+        }
+    }
+    started = false;
+
+    // Clear the queue
+    lcLock(lock);
+    while (numRequests > 0) removeRequest(numRequests - 1);
+    lcUnlock(lock);
+}
+
+//------------------------------------------------------------------------------
+// getTile() - Copies the tile from the cache, or queues it (high priority).
+//------------------------------------------------------------------------------
+bool TileCache::getTile(CadrgTocEntry* const toc, const int row, const int column, CadrgMap::ColorArray& tile)
+{
+    bool found = false;
+    lcLock(lock);
+    Tile* p = findTile(toc, row, column);
+    if (p != 0) {
+        tile = *p->pixels;
+        p->lastUsed = ++useCount;
+        numHits++;
+        found = true;
+    }
+    else {
+        numMisses++;
+        queueRequest(toc, row, column, false);
+    }
+    lcUnlock(lock);
+    return found;
+}
+
+//------------------------------------------------------------------------------
+// prefetchTile() - Queues the tile (low priority), if it's not already cached;
+// a cached tile is marked as used, so it's not the next one replaced.
+//------------------------------------------------------------------------------
+void TileCache::prefetchTile(CadrgTocEntry* const toc, const int row, const int column)
+{
+    lcLock(lock);
+    Tile* p = findTile(toc, row, column);
+    if (p != 0) p->lastUsed = ++useCount;
+    else queueRequest(toc, row, column, true);
+    lcUnlock(lock);
+}
+
+//------------------------------------------------------------------------------
+// decodeNext() - Decodes the next queued tile (high priority requests first)
+// into the cache; the caller's buffer is swapped with the replaced tile's
+// buffer.  Returns false if the queue was empty.
+//------------------------------------------------------------------------------
+bool TileCache::decodeNext(CadrgFrame* const frame, CadrgMap::ColorArray*& buffer)
+{
+    if (frame == 0 || buffer == 0 || cacheSize == 0) return false;
+
+    // Our next request
+    lcLock(lock);
+    int idx = -1;
+    for (int i = 0; i < numRequests && idx < 0; i++) {
+        if (!requests[i].busy && !requests[i].prefetch) idx = i;
+    }
+    for (int i = 0; i < numRequests && idx < 0; i++) {
+        if (!requests[i].busy) idx = i;
+    }
+    CadrgTocEntry* toc = 0;
+    int row = 0;
+    int column = 0;
+    if (idx >= 0) {
+        requests[idx].busy = true;
+        toc = requests[idx].toc;
+        toc->ref();
+        row = requests[idx].row;
+        column = requests[idx].column;
+    }
+    lcUnlock(lock);
+
+    if (toc == 0) return false;
+
+    // Decode the tile
+    const double t0 = getComputerTime();
+    const bool ok = decodeTile(toc, row, column, frame, *buffer);
+    const double t1 = getComputerTime();
+
+    lcLock(lock);
+    if (ok) {
+        // Replace the least recently used tile
+        Tile* p = &tiles[0];
+        for (int i = 1; i < cacheSize && p->toc != 0; i++) {
+            if (tiles[i].toc == 0 || tiles[i].lastUsed < p->lastUsed) p = &tiles[i];
+        }
+        if (p->toc != 0) p->toc->unref();
+        toc->ref();
+        p->toc = toc;
+        p->row = row;
+        p->column = column;
+        p->lastUsed = ++useCount;
+        CadrgMap::ColorArray* tmp = p->pixels;
+        p->pixels = buffer;
+        buffer = tmp;
+
+        numDecoded++;
+        decodeTime += (t1 - t0);
+    }
+    const int k = findRequest(toc, row, column);
+    if (k >= 0) removeRequest(k);
+    lcUnlock(lock);
+
+    toc->unref();
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// decodeTile() - Loads (if needed) and decodes a tile, and converts it to RGB.
+//------------------------------------------------------------------------------
+bool TileCache::decodeTile(CadrgTocEntry* const toc, const int row, const int column, CadrgFrame* const frame, CadrgMap::ColorArray& tile)
+{
+    bool ok = false;
+    if (toc != 0 && frame != 0) {
+        CadrgFrameEntry* frameEntry = toc->getFrameEntry(row / 6, column / 6);
+        if (frameEntry != 0) {
+            // Color lookup table (shared by the threads)
+            lcLock(clutLock);
+            frameEntry->loadClut();
+            lcUnlock(clutLock);
+
+            // Load the frame, if it's not already loaded
+            if (frame->getFrameEntry() != frameEntry) frame->load(frameEntry);
+
+            // Decompress our subframe and set our colors
+            Subframe subframe;
+            frame->decompressSubframe(row, column, subframe);
+            CadrgMap::subframeToTile(subframe, frameEntry->getClut(), tile);
+            ok = true;
+        }
+    }
+    return ok;
+}
+
+//------------------------------------------------------------------------------
+// findTile() - Finds a cached tile (lock the cache first)
+//------------------------------------------------------------------------------
+TileCache::Tile* TileCache::findTile(const CadrgTocEntry* const toc, const int row, const int column)
+{
+    for (int i = 0; i < cacheSize; i++) {
+        if (tiles[i].toc == toc && tiles[i].row == row && tiles[i].column == column && toc != 0) return &tiles[i];
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// findRequest() - Finds a queued tile (lock the cache first)
+//------------------------------------------------------------------------------
+int TileCache::findRequest(const CadrgTocEntry* const toc, const int row, const int column) const
+{
+    for (int i = 0; i < numRequests; i++) {
+        if (requests[i].toc == toc && requests[i].row == row && requests[i].column == column) return i;
+    }
+    return -1;
+}
+
+//------------------------------------------------------------------------------
+// queueRequest() - Queues a tile, if it's not already queued; when the queue
+// is full, the oldest prefetch request (or, for a high priority request, the
+// oldest request) is dropped.  (lock the cache first)
+//------------------------------------------------------------------------------
+void TileCache::queueRequest(CadrgTocEntry* const toc, const int row, const int column, const bool prefetch)
+{
+    if (toc == 0) return;
+
+    const int k = findRequest(toc, row, column);
+    if (k >= 0) {
+        // Already queued; but it might be needed now
+        if (!prefetch) requests[k].prefetch = false;
+        return;
+    }
+
+    if (numRequests >= MAX_REQUESTS) {
+        int idx = -1;
+        for (int i = 0; i < numRequests && idx < 0; i++) {
+            if (!requests[i].busy && requests[i].prefetch) idx = i;
+        }
+        for (int i = 0; i < numRequests && idx < 0 && !prefetch; i++) {
+            if (!requests[i].busy) idx = i;
+        }
+        if (idx < 0) return;
+        removeRequest(idx);
+    }
+
+    toc->ref();
+    Request* p = &requests[numRequests++];
+    p->toc = toc;
+    p->row = row;
+    p->column = column;
+    p->prefetch = prefetch;
+    p->busy = false;
+}
+
+//------------------------------------------------------------------------------
+// removeRequest() - Removes a tile from the queue (lock the cache first)
+//------------------------------------------------------------------------------
+void TileCache::removeRequest(const int idx)
+{
+    if (idx < 0 || idx >= numRequests) return;
+
+    requests[idx].toc->unref();
+    for (int i = idx + 1; i < numRequests; i++) {
+        requests[i - 1] = requests[i];
+    }
+    numRequests--;
+}
+
+//------------------------------------------------------------------------------
+// clearCache() - Clears the cached tiles
+//------------------------------------------------------------------------------
+void TileCache::clearCache()
+{
+    lcLock(lock);
+    for (int i = 0; i < cacheSize; i++) {
+        if (tiles[i].toc != 0) tiles[i].toc->unref();
+        tiles[i].toc = 0;
+        tiles[i].lastUsed = 0;
+    }
+    useCount = 0;
+    lcUnlock(lock);
+}
+
+} // End Rpf namespace
+} // End Maps namespace
+} // End Eaagles namespace
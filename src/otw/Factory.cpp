@@ -4,36 +4,35 @@
 #include "openeaagles/otw/Factory.h"
 
 #include "openeaagles/basic/Object.h"
+#include "openeaagles/basic/FactoryTable.h"
 
 #include "openeaagles/otw/OtwCigiCl.h"
 #include "openeaagles/otw/OtwPC.h"
 
-#include <cstring>
-
 namespace Eaagles {
 namespace Otw {
 
-Factory::Factory()
-{}
-
-Basic::Object* Factory::createObj(const char* name)
+//------------------------------------------------------------------------------
+// addClasses() -- adds our classes to the factory table
+//------------------------------------------------------------------------------
+static void addClasses(Basic::FactoryTable& table)
 {
-    Basic::Object* obj = 0;
-
     // Common Image Generation Interface (CIGI)
-    if ( std::strcmp(name, OtwCigiCl::getFactoryName()) == 0 ) {
-        obj = new OtwCigiCl();
-    }
-    else if ( std::strcmp(name, CigiClNetwork::getFactoryName()) == 0 ) {
-        obj = new CigiClNetwork();
-    }
+    table.add<OtwCigiCl>();
+    table.add<CigiClNetwork>();
 
     // PC Visual Driver
-    else if ( std::strcmp(name, OtwPC::getFactoryName()) == 0 ) {
-        obj = new OtwPC();
-    }
+    table.add<OtwPC>();
+}
+
+static Basic::FactoryTable factoryTable(addClasses);
 
-    return obj;
+Factory::Factory()
+{}
+
+Basic::Object* Factory::createObj(const char* name)
+{
+    return factoryTable.createObj(name);
 }
 
 }  // end namespace Otw
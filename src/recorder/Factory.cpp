@@ -4,6 +4,7 @@
 #include "openeaagles/recorder/Factory.h"
 
 #include "openeaagles/basic/Object.h"
+#include "openeaagles/basic/FactoryTable.h"
 
 #include "openeaagles/recorder/DataRecorder.h"
 #include "openeaagles/recorder/FileWriter.h"
@@ -15,47 +16,33 @@
 #include "openeaagles/recorder/PrintPlayer.h"
 #include "openeaagles/recorder/PrintSelected.h"
 
-#include <cstring>
-
 namespace Eaagles {
 namespace Recorder {
 
+//------------------------------------------------------------------------------
+// addClasses() -- adds our classes to the factory table
+//------------------------------------------------------------------------------
+static void addClasses(Basic::FactoryTable& table)
+{
+    table.add<FileWriter>();
+    table.add<FileReader>();
+    table.add<NetInput>();
+    table.add<NetOutput>();
+    table.add<OutputHandler>();
+    table.add<TabPrinter>();
+    table.add<PrintPlayer>();
+    table.add<DataRecorder>();
+    table.add<PrintSelected>();
+}
+
+static Basic::FactoryTable factoryTable(addClasses);
+
 Factory::Factory()
 {}
 
 Basic::Object* Factory::createObj(const char* name)
 {
-    Basic::Object* obj = 0;
-
-    if ( std::strcmp(name, FileWriter::getFactoryName()) == 0 ) {
-        obj = new FileWriter();
-    }
-    else if ( std::strcmp(name, FileReader::getFactoryName()) == 0 ) {
-        obj = new FileReader();
-    }
-    else if ( std::strcmp(name, NetInput::getFactoryName()) == 0 ) {
-        obj = new NetInput();
-    }
-    else if ( std::strcmp(name, NetOutput::getFactoryName()) == 0 ) {
-        obj = new NetOutput();
-    }
-    else if ( std::strcmp(name, OutputHandler::getFactoryName()) == 0 ) {
-        obj = new OutputHandler();
-    }
-    else if ( std::strcmp(name, TabPrinter::getFactoryName()) == 0 ) {
-        obj = new TabPrinter();
-    }
-    else if ( std::strcmp(name, PrintPlayer::getFactoryName()) == 0 ) {
-        obj = new PrintPlayer();
-    }
-    else if ( std::strcmp(name, DataRecorder::getFactoryName()) == 0 ) {
-        obj = new DataRecorder();
-    }
-    else if ( std::strcmp(name, PrintSelected::getFactoryName()) == 0 ) {
-        obj = new PrintSelected();
-    }
-
-    return obj;
+    return factoryTable.createObj(name);
 }
 
 }  // end namespace Recorder
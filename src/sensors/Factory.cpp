@@ -4,35 +4,34 @@
 #include "openeaagles/sensors/Factory.h"
 
 #include "openeaagles/basic/Object.h"
+#include "openeaagles/basic/FactoryTable.h"
 
 #include "openeaagles/sensors/Gmti.h"
 #include "openeaagles/sensors/Tws.h"
 #include "openeaagles/sensors/Stt.h"
 
-#include <cstring>
-
 namespace Eaagles {
 namespace Sensor {
 
+//------------------------------------------------------------------------------
+// addClasses() -- adds our classes to the factory table
+//------------------------------------------------------------------------------
+static void addClasses(Basic::FactoryTable& table)
+{
+    // Sensors
+    table.add<Gmti>();
+    table.add<Stt>();
+    table.add<Tws>();
+}
+
+static Basic::FactoryTable factoryTable(addClasses);
+
 Factory::Factory()
 {}
 
 Basic::Object* Factory::createObj(const char* name)
 {
-    Basic::Object* obj = 0;
-
-    // Sensors
-    if ( std::strcmp(name, Gmti::getFactoryName()) == 0 ) {
-        obj = new Gmti();
-    }
-    else if ( std::strcmp(name, Stt::getFactoryName()) == 0 ) {
-        obj = new Stt();
-    }
-    else if ( std::strcmp(name, Tws::getFactoryName()) == 0 ) {
-        obj = new Tws();
-    }
-
-    return obj;
+    return factoryTable.createObj(name);
 }
 
 }  // end namespace Sensor
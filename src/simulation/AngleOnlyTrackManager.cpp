@@ -503,7 +503,7 @@ void AirAngleOnlyTrkMgr::processTrackList(const LCreal dt)
 
             // TabLogger is deprecated
             if (getLogTrackUpdates()  &&  (getAnyEventLogger() != 0)) {
-                TabLogger::TabLogEvent* evt = new TabLogger::LogPassiveTrack(2, this,tracks[i]); // type 2 for "update"
+                TabLogger::TabLogEvent* evt = TabLogger::LogPassiveTrack::create(2, this,tracks[i]); // type 2 for "update"
                 getAnyEventLogger()->log(evt);
                 evt->unref();
             }
@@ -554,7 +554,7 @@ void AirAngleOnlyTrkMgr::processTrackList(const LCreal dt)
 
             // TabLogger is deprecated
             if (getAnyEventLogger() != 0) {
-                TabLogger::TabLogEvent* evt = new TabLogger::LogPassiveTrack(3, this,trk); // type 3 for "remove"
+                TabLogger::TabLogEvent* evt = TabLogger::LogPassiveTrack::create(3, this,trk); // type 3 for "remove"
                 getAnyEventLogger()->log(evt);
                 evt->unref();
             }
@@ -610,7 +610,7 @@ void AirAngleOnlyTrkMgr::processTrackList(const LCreal dt)
 
             // TabLogger is deprecated
             if (getAnyEventLogger() != 0) {
-                TabLogger::TabLogEvent* evt = new TabLogger::LogPassiveTrack(1, this,newTrk); // type 1 for "new"
+                TabLogger::TabLogEvent* evt = TabLogger::LogPassiveTrack::create(1, this,newTrk); // type 1 for "new"
                 getAnyEventLogger()->log(evt);
                 evt->unref();
             }
@@ -720,7 +720,7 @@ void AirAngleOnlyTrkMgrPT::removeAgedTracks()
 
             // TabLogger is deprecated
             if (getAnyEventLogger() != 0) {
-                TabLogger::TabLogEvent* evt = new TabLogger::LogPassiveTrack(3, this,trk); // type 3 for "remove"
+                TabLogger::TabLogEvent* evt = TabLogger::LogPassiveTrack::create(3, this,trk); // type 3 for "remove"
                 getAnyEventLogger()->log(evt);
                 evt->unref();
             }
@@ -1081,7 +1081,7 @@ void AirAngleOnlyTrkMgrPT::processTrackList(const LCreal dt)
 
             // TabLogger is deprecated
             if (getAnyEventLogger() != 0) {
-                TabLogger::TabLogEvent* evt = new TabLogger::LogPassiveTrack(1, this,newTrk); // type 1 for "new"
+                TabLogger::TabLogEvent* evt = TabLogger::LogPassiveTrack::create(1, this,newTrk); // type 1 for "new"
                 getAnyEventLogger()->log(evt);
                 evt->unref();
             }
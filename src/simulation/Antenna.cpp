@@ -55,18 +55,14 @@ END_EVENT_HANDLER()
 //------------------------------------------------------------------------------
 // constructor(s)
 //------------------------------------------------------------------------------
-Antenna::Antenna() : freeEmStack(MAX_EMISSIONS), freeEmLock(0),
-                     inUseEmQueue(MAX_EMISSIONS), inUseEmLock(0),
-                     sys(0), gainPattern(0)
+Antenna::Antenna() : emPool(MAX_EMISSIONS), sys(0), gainPattern(0)
 {
    STANDARD_CONSTRUCTOR()
 
    initData();
 }
 
-Antenna::Antenna(const Antenna& org) : freeEmStack(MAX_EMISSIONS), freeEmLock(0),
-                                       inUseEmQueue(MAX_EMISSIONS), inUseEmLock(0),
-                                       sys(0), gainPattern(0)
+Antenna::Antenna(const Antenna& org) : emPool(MAX_EMISSIONS), sys(0), gainPattern(0)
 { 
     STANDARD_CONSTRUCTOR()
     copyData(org,true);
@@ -166,33 +162,10 @@ void Antenna::process(const LCreal dt)
 
    // ---
    // Recycle emissions ...
-   // Update emission queues: from 'in-use' to 'free' 
+   // Update emission pool: from 'in-use' to 'free' 
    // ---
    if (recycle) {
-      unsigned int n = inUseEmQueue.entries();
-
-      for (unsigned int i = 0; i < n; i++) {
-
-         lcLock(inUseEmLock);
-         Emission* em = inUseEmQueue.get();
-         lcUnlock(inUseEmLock);
-
-         if (em != 0 && em->getRefCount() > 1) {
-            // Others are still referencing the emission, put back on in-use queue
-            lcLock(inUseEmLock);
-            inUseEmQueue.put(em);
-            lcUnlock(inUseEmLock);
-         }
-
-         else if (em != 0 && em->getRefCount() <= 1) {
-            // No one else is referencing the emission, push to the free stack
-            em->clear();
-            lcLock(freeEmLock);
-            if (freeEmStack.isNotFull()) freeEmStack.push(em);
-            else em->unref();
-            lcUnlock(freeEmLock);
-         }
-      }
+      emPool.recycle();
    }
 
 }
@@ -210,25 +183,11 @@ bool Antenna::setSystem(RfSystem* const s)
 }
 
 //------------------------------------------------------------------------------
-// clearQueues() -- clear out all queues
+// clearQueues() -- clear out all queues (and the emission pool)
 //------------------------------------------------------------------------------
 void Antenna::clearQueues()
 {
-   lcLock(freeEmLock);
-    Emission* em = freeEmStack.pop();
-    while (em != 0) {
-        em->unref();
-        em = freeEmStack.pop();
-    }
-   lcUnlock(freeEmLock);
-
-   lcLock(inUseEmLock);
-    em = inUseEmQueue.get();
-    while (em != 0) {
-        em->unref();
-        em = inUseEmQueue.get();
-    }
-   lcUnlock(inUseEmLock);
+   emPool.clear();
 }       
 
 //------------------------------------------------------------------------------
@@ -390,6 +349,7 @@ bool Antenna::setGain(const double value)
 bool Antenna::setEmissionRecycleFlag(const bool enable)
 {
    recycle = enable;
+   if (!recycle) emPool.clear();
    return true;
 }
 
@@ -530,9 +490,7 @@ void Antenna::rfTransmit(Emission* const xmit)
             // Get a free emission packet
             Emission* em(0);
             if (recycle) {
-               lcLock(freeEmLock);
-               em = freeEmStack.pop();
-               lcUnlock(freeEmLock);
+               em = emPool.get();
             }
 
             bool cloned = false;
@@ -568,16 +526,9 @@ void Antenna::rfTransmit(Emission* const xmit)
                // c) Send the emission to the target
                targets[i]->event(RF_EMISSION, em);
 
-               // d) Recycle the emission
-               bool recycled = false;
+               // d) Recycle the emission (the pool takes our reference)
                if (recycle) {
-                  lcLock(inUseEmLock);
-                  if (inUseEmQueue.isNotFull()) {
-                     // Store for future reference
-                     inUseEmQueue.put(em);
-                     recycled = true;
-                  }
-                  lcUnlock(inUseEmLock);
+                  emPool.release(em);
                }
 
                // or just forget it
@@ -0,0 +1,807 @@
+//------------------------------------------------------------------------------
+// Class: Benchmark
+//------------------------------------------------------------------------------
+#include "openeaagles/simulation/Benchmark.h"
+
+#include "openeaagles/simulation/DataRecorder.h"
+#include "openeaagles/simulation/Player.h"
+#include "openeaagles/simulation/Simulation.h"
+#include "openeaagles/simulation/Station.h"
+
+#include "openeaagles/basic/Number.h"
+#include "openeaagles/basic/Pair.h"
+#include "openeaagles/basic/PairStream.h"
+#include "openeaagles/basic/Rng.h"
+#include "openeaagles/basic/String.h"
+#include "openeaagles/basic/units/Distances.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+namespace Eaagles {
+namespace Simulation {
+
+IMPLEMENT_SUBCLASS(Benchmark,"Benchmark")
+
+// Series names used in the JSON results
+static const char* const seriesNames[Benchmark::NUM_SERIES] = {
+   "tcFrame", "phaseDynamics", "phaseTransmit", "phaseReceive", "phaseProcess", "bgFrame"
+};
+
+// Nearest-rank percentile of the 'n' sorted samples 'v'
+static double percentile(const double* const v, const unsigned int n, const double pct)
+{
+   double x = 0;
+   if (n > 0) {
+      double p = pct;
+      if (p < 0) p = 0;
+      if (p > 100.0) p = 100.0;
+      unsigned int rank = static_cast<unsigned int>(std::ceil(p / 100.0 * n));
+      if (rank > 0) rank--;
+      if (rank >= n) rank = n - 1;
+      x = v[rank];
+   }
+   return x;
+}
+
+// Mean of the 'n' samples 'v'
+static double mean(const double* const v, const unsigned int n)
+{
+   double x = 0;
+   if (n > 0) {
+      double sum = 0;
+      for (unsigned int i = 0; i < n; i++) {
+         sum += v[i];
+      }
+      x = sum / n;
+   }
+   return x;
+}
+
+//------------------------------------------------------------------------------
+// Slot table
+//------------------------------------------------------------------------------
+BEGIN_SLOTTABLE(Benchmark)
+   "station",        //  1: Station under test
+   "templates",      //  2: Template players
+   "numPlayers",     //  3: Number of template clones
+   "numFrames",      //  4: Number of measured T/C frames
+   "warmupFrames",   //  5: Number of unmeasured warm-up frames
+   "bgRatio",        //  6: Number of T/C frames per background frame
+   "seed",           //  7: Placement seed
+   "areaRadius",     //  8: Placement radius
+   "firstPlayerId",  //  9: Player ID of the first clone
+   "outputFile",     // 10: JSON results file name
+END_SLOTTABLE(Benchmark)
+
+BEGIN_SLOT_MAP(Benchmark)
+   ON_SLOT( 1, setSlotStation,       Station)
+   ON_SLOT( 2, setSlotTemplates,     Basic::PairStream)
+   ON_SLOT( 3, setSlotNumPlayers,    Basic::Number)
+   ON_SLOT( 4, setSlotNumFrames,     Basic::Number)
+   ON_SLOT( 5, setSlotWarmupFrames,  Basic::Number)
+   ON_SLOT( 6, setSlotBgRatio,       Basic::Number)
+   ON_SLOT( 7, setSlotSeed,          Basic::Number)
+   ON_SLOT( 8, setSlotAreaRadius,    Basic::Distance)
+   ON_SLOT( 8, setSlotAreaRadius,    Basic::Number)
+   ON_SLOT( 9, setSlotFirstPlayerId, Basic::Number)
+   ON_SLOT(10, setSlotOutputFile,    Basic::String)
+END_SLOT_MAP()
+
+//------------------------------------------------------------------------------
+// Constructor(s)
+//------------------------------------------------------------------------------
+Benchmark::Benchmark()
+{
+   STANDARD_CONSTRUCTOR()
+   initData();
+}
+
+void Benchmark::initData()
+{
+   station = 0;
+   templates = 0;
+   outputFile = 0;
+
+   numPlayers = 0;
+   numFrames = 1000;
+   warmupFrames = 10;
+   bgRatio = 1;
+   seed = 12345;
+   areaRadius = 100000.0;
+   firstPlayerId = 1001;
+
+   for (unsigned int i = 0; i < NUM_SERIES; i++) {
+      samples[i] = 0;
+      nSamples[i] = 0;
+   }
+   for (unsigned int i = 0; i < 2; i++) {
+      subsysSamples[i] = 0;
+      nSubsysSamples[i] = 0;
+   }
+   maxSamples = 0;
+   totalTime = 0;
+}
+
+//------------------------------------------------------------------------------
+// copyData() -- copy member data
+//------------------------------------------------------------------------------
+void Benchmark::copyData(const Benchmark& org, const bool cc)
+{
+   BaseClass::copyData(org);
+   if (cc) initData();
+
+   {
+      Station* copy = 0;
+      if (org.station != 0) copy = org.station->clone();
+      setStation(copy);
+      if (copy != 0) copy->unref();
+   }
+
+   if (org.templates != 0) {
+      Basic::PairStream* copy = org.templates->clone();
+      templates = copy;
+      copy->unref();
+   }
+   else {
+      templates = 0;
+   }
+
+   setSlotOutputFile(org.outputFile);
+
+   numPlayers = org.numPlayers;
+   numFrames = org.numFrames;
+   warmupFrames = org.warmupFrames;
+   bgRatio = org.bgRatio;
+   seed = org.seed;
+   areaRadius = org.areaRadius;
+   firstPlayerId = org.firstPlayerId;
+
+   // Results aren't copied
+   freeSamples();
+}
+
+//------------------------------------------------------------------------------
+// deleteData() -- delete member data
+//------------------------------------------------------------------------------
+void Benchmark::deleteData()
+{
+   setStation(0);
+   templates = 0;
+   setSlotOutputFile(0);
+   freeSamples();
+}
+
+//------------------------------------------------------------------------------
+// run() -- runs the benchmark and writes the results
+//------------------------------------------------------------------------------
+bool Benchmark::run()
+{
+   if (station == 0 || station->getSimulation() == 0 || station->getTimeCriticalRate() <= 0) {
+      if (isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "Benchmark::run(): ERROR, requires a station with a simulation and a T/C rate" << std::endl;
+      }
+      return false;
+   }
+
+   if (!allocateSamples()) return false;
+
+   Simulation* const sim = station->getSimulation();
+
+   // Restore the initial scenario, then add our clones
+   station->event(RESET_EVENT);
+   if (!populate()) return false;
+
+   const LCreal dt = 1.0f / station->getTimeCriticalRate();
+   const LCreal bgDt = dt * static_cast<LCreal>(bgRatio);
+
+   const bool phaseTiming = sim->isPhaseTimingEnabled();
+   sim->setPhaseTimingEnabled(true);
+
+   // Run the frames; unpaced
+   double startTime = 0;
+   const unsigned int n = warmupFrames + numFrames;
+   for (unsigned int f = 0; f < n; f++) {
+      const bool measured = (f >= warmupFrames);
+      if (f == warmupFrames) startTime = getComputerTime();
+
+      const double t0 = getComputerTime();
+      station->tcFrame(dt);
+      const double t1 = getComputerTime();
+
+      if (measured) {
+         samples[TC_FRAME][nSamples[TC_FRAME]++] = (t1 - t0);
+         for (unsigned int p = 0; p < 4; p++) {
+            const unsigned int s = PHASE_DYNAMICS + p;
+            samples[s][nSamples[s]++] = sim->getPhaseTime(p);
+         }
+         for (unsigned int s = 0; s < Simulation::NUM_SUBSYSTEMS; s++) {
+            subsysSamples[0][s*maxSamples + nSubsysSamples[0]] = sim->getTcSubsystemTime(s);
+         }
+         nSubsysSamples[0]++;
+      }
+
+      if ( ((f + 1) % bgRatio) == 0 ) {
+         station->processBackgroundTasks(bgDt);
+         if (station->getDataRecorder() != 0) station->getDataRecorder()->processRecords();
+         if (measured) {
+            samples[BG_FRAME][nSamples[BG_FRAME]++] = (getComputerTime() - t1);
+            for (unsigned int s = 0; s < Simulation::NUM_SUBSYSTEMS; s++) {
+               subsysSamples[1][s*maxSamples + nSubsysSamples[1]] = sim->getBgSubsystemTime(s);
+            }
+            nSubsysSamples[1]++;
+         }
+      }
+   }
+   totalTime = getComputerTime() - startTime;
+
+   sim->setPhaseTimingEnabled(phaseTiming);
+
+   // Sorted samples make the percentiles easy
+   for (unsigned int i = 0; i < NUM_SERIES; i++) {
+      std::sort(samples[i], samples[i] + nSamples[i]);
+   }
+   for (unsigned int i = 0; i < 2; i++) {
+      for (unsigned int s = 0; s < Simulation::NUM_SUBSYSTEMS; s++) {
+         double* const v = &subsysSamples[i][s*maxSamples];
+         std::sort(v, v + nSubsysSamples[i]);
+      }
+   }
+
+   // Write the results
+   bool ok = false;
+   if (outputFile != 0) {
+      std::ofstream fout(*outputFile);
+      if (fout.is_open()) {
+         ok = writeResults(fout);
+      }
+      else if (isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "Benchmark::run(): ERROR, unable to open: " << *outputFile << std::endl;
+      }
+   }
+   else {
+      ok = writeResults(std::cout);
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// populate() -- adds 'numPlayers' clones of the template players, in turn, to
+// the simulation at random positions within 'areaRadius' of the gaming area's
+// center.
+//------------------------------------------------------------------------------
+bool Benchmark::populate()
+{
+   if (numPlayers == 0) return true;
+
+   unsigned int nTemplates = 0;
+   if (templates != 0) nTemplates = templates->entries();
+   if (nTemplates == 0) {
+      if (isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "Benchmark::populate(): ERROR, no template players" << std::endl;
+      }
+      return false;
+   }
+
+   if ( (firstPlayerId + numPlayers) > Simulation::MIN_WPN_ID ) {
+      if (isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "Benchmark::populate(): ERROR, clone IDs overlap the released weapon IDs;";
+         std::cerr << " firstPlayerId = " << firstPlayerId << ", numPlayers = " << numPlayers << std::endl;
+      }
+      return false;
+   }
+
+   Simulation* const sim = station->getSimulation();
+   Basic::Rng rng(seed);
+
+   unsigned int nAdded = 0;
+   const Basic::List::Item* item = templates->getFirstItem();
+   while (nAdded < numPlayers) {
+
+      const Basic::Pair* pair = static_cast<const Basic::Pair*>(item->getValue());
+      const Player* tmpl = dynamic_cast<const Player*>(pair->object());
+      if (tmpl != 0) {
+         Player* p = tmpl->clone();
+
+         const unsigned short id = static_cast<unsigned short>(firstPlayerId + nAdded);
+         p->setID(id);
+
+         // Uniform within the circle
+         const double r = areaRadius * std::sqrt(rng.drawClosed());
+         const double a = 2.0 * PI * rng.drawHalfOpen();
+         p->setInitPosition(r * std::cos(a), r * std::sin(a));
+
+         char name[64];
+         std::sprintf(name, "%.40s_%05d", static_cast<const char*>(*pair->slot()), id);
+         sim->addNewPlayer(name, p);
+         p->unref();
+         nAdded++;
+
+         // The new player queue only holds so many; let the simulation take them.
+         if ( (nAdded % Simulation::MAX_NEW_PLAYERS) == 0 ) sim->updateData(0);
+      }
+      else if (isMessageEnabled(MSG_WARNING)) {
+         std::cerr << "Benchmark::populate(): template is not a Player: " << *pair->slot() << std::endl;
+      }
+
+      // Next template (wrapping)
+      item = item->getNext();
+      if (item == 0) {
+         if (nAdded == 0) return false;
+         item = templates->getFirstItem();
+      }
+   }
+   sim->updateData(0);
+
+   // Now that they're in the player list, reset our clones to their initial conditions
+   Basic::PairStream* players = sim->getPlayers();
+   if (players != 0) {
+      const unsigned short lastPlayerId = static_cast<unsigned short>(firstPlayerId + numPlayers);
+      Basic::List::Item* item = players->getFirstItem();
+      while (item != 0) {
+         Basic::Pair* pair = static_cast<Basic::Pair*>(item->getValue());
+         Player* p = static_cast<Player*>(pair->object());
+         if (p->isLocalPlayer() && p->getID() >= firstPlayerId && p->getID() < lastPlayerId) {
+            p->event(RESET_EVENT);
+         }
+         item = item->getNext();
+      }
+      players->unref();
+   }
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// writeResults() -- writes the results as JSON
+//------------------------------------------------------------------------------
+bool Benchmark::writeResults(std::ostream& sout) const
+{
+   static const double pcts[] = { 50.0, 90.0, 95.0, 99.0 };
+   static const char* const pctNames[] = { "p50", "p90", "p95", "p99" };
+   static const unsigned int NUM_PCTS = 4;
+
+   unsigned int nPlayers = 0;
+   {
+      const Basic::PairStream* players = station->getPlayers();
+      if (players != 0) {
+         nPlayers = players->entries();
+         players->unref();
+      }
+   }
+
+   const double dt = 1.0 / station->getTimeCriticalRate();
+   double simTime = dt * numFrames;
+   double rtRatio = 0;
+   if (totalTime > 0) rtRatio = simTime / totalTime;
+
+   const std::streamsize prec = sout.precision(9);
+
+   sout << "{" << std::endl;
+   sout << "   \"numPlayers\": " << nPlayers << "," << std::endl;
+   sout << "   \"numClones\": " << numPlayers << "," << std::endl;
+   sout << "   \"numFrames\": " << numFrames << "," << std::endl;
+   sout << "   \"warmupFrames\": " << warmupFrames << "," << std::endl;
+   sout << "   \"bgRatio\": " << bgRatio << "," << std::endl;
+   sout << "   \"seed\": " << seed << "," << std::endl;
+   sout << "   \"dt\": " << dt << "," << std::endl;
+   sout << "   \"simTime\": " << simTime << "," << std::endl;
+   sout << "   \"totalTime\": " << totalTime << "," << std::endl;
+   sout << "   \"realTimeRatio\": " << rtRatio << "," << std::endl;
+   sout << "   \"series\": {" << std::endl;
+   for (unsigned int i = 0; i < NUM_SERIES; i++) {
+      const Series s = static_cast<Series>(i);
+      sout << "      \"" << seriesNames[i] << "\": { ";
+      sout << "\"samples\": " << getNumSamples(s);
+      sout << ", \"mean\": " << getMean(s);
+      for (unsigned int j = 0; j < NUM_PCTS; j++) {
+         sout << ", \"" << pctNames[j] << "\": " << getPercentile(s, pcts[j]);
+      }
+      sout << ", \"max\": " << getPercentile(s, 100.0);
+      sout << " }";
+      if (i < (NUM_SERIES - 1)) sout << ",";
+      sout << std::endl;
+   }
+   sout << "   }," << std::endl;
+   sout << "   \"subsystems\": {" << std::endl;
+   for (unsigned int i = 0; i < 2; i++) {
+      const bool tc = (i == 0);
+      sout << "      \"" << (tc ? "tcFrame" : "bgFrame") << "\": {" << std::endl;
+      for (unsigned int s = 0; s < Simulation::NUM_SUBSYSTEMS; s++) {
+         sout << "         \"" << Simulation::getSubsystemName(s) << "\": { ";
+         sout << "\"samples\": " << getNumSubsystemSamples(tc);
+         sout << ", \"mean\": " << getSubsystemMean(tc, s);
+         for (unsigned int j = 0; j < NUM_PCTS; j++) {
+            sout << ", \"" << pctNames[j] << "\": " << getSubsystemPercentile(tc, s, pcts[j]);
+         }
+         sout << ", \"max\": " << getSubsystemPercentile(tc, s, 100.0);
+         sout << " }";
+         if (s < (Simulation::NUM_SUBSYSTEMS - 1)) sout << ",";
+         sout << std::endl;
+      }
+      sout << "      }";
+      if (i == 0) sout << ",";
+      sout << std::endl;
+   }
+   sout << "   }" << std::endl;
+   sout << "}" << std::endl;
+
+   sout.precision(prec);
+   return sout.good();
+}
+
+//------------------------------------------------------------------------------
+// Sample buffers
+//------------------------------------------------------------------------------
+bool Benchmark::allocateSamples()
+{
+   freeSamples();
+   if (numFrames == 0) return false;
+
+   for (unsigned int i = 0; i < NUM_SERIES; i++) {
+      samples[i] = new double[numFrames];
+      nSamples[i] = 0;
+   }
+   for (unsigned int i = 0; i < 2; i++) {
+      subsysSamples[i] = new double[numFrames * Simulation::NUM_SUBSYSTEMS];
+      nSubsysSamples[i] = 0;
+   }
+   maxSamples = numFrames;
+   totalTime = 0;
+   return true;
+}
+
+void Benchmark::freeSamples()
+{
+   for (unsigned int i = 0; i < NUM_SERIES; i++) {
+      if (samples[i] != 0) {
+         delete[] samples[i];
+         samples[i] = 0;
+      }
+      nSamples[i] = 0;
+   }
+   for (unsigned int i = 0; i < 2; i++) {
+      if (subsysSamples[i] != 0) {
+         delete[] subsysSamples[i];
+         subsysSamples[i] = 0;
+      }
+      nSubsysSamples[i] = 0;
+   }
+   maxSamples = 0;
+   totalTime = 0;
+}
+
+//------------------------------------------------------------------------------
+// Get functions
+//------------------------------------------------------------------------------
+Station* Benchmark::getStation()
+{
+   return station;
+}
+
+const Station* Benchmark::getStation() const
+{
+   return station;
+}
+
+unsigned int Benchmark::getNumPlayers() const
+{
+   return numPlayers;
+}
+
+unsigned int Benchmark::getNumFrames() const
+{
+   return numFrames;
+}
+
+unsigned int Benchmark::getWarmupFrames() const
+{
+   return warmupFrames;
+}
+
+unsigned int Benchmark::getBgRatio() const
+{
+   return bgRatio;
+}
+
+unsigned int Benchmark::getSeed() const
+{
+   return seed;
+}
+
+unsigned int Benchmark::getNumSamples(const Series s) const
+{
+   unsigned int n = 0;
+   if (s < NUM_SERIES) n = nSamples[s];
+   return n;
+}
+
+// Nearest-rank percentile of the (sorted) samples
+double Benchmark::getPercentile(const Series s, const double pct) const
+{
+   double v = 0;
+   const unsigned int n = getNumSamples(s);
+   if (n > 0) v = percentile(samples[s], n, pct);
+   return v;
+}
+
+double Benchmark::getMean(const Series s) const
+{
+   double v = 0;
+   const unsigned int n = getNumSamples(s);
+   if (n > 0) v = mean(samples[s], n);
+   return v;
+}
+
+unsigned int Benchmark::getNumSubsystemSamples(const bool tc) const
+{
+   return nSubsysSamples[tc ? 0 : 1];
+}
+
+// Nearest-rank percentile of the (sorted) subsystem samples
+double Benchmark::getSubsystemPercentile(const bool tc, const unsigned int s, const double pct) const
+{
+   double v = 0;
+   const unsigned int i = (tc ? 0 : 1);
+   if (s < Simulation::NUM_SUBSYSTEMS && nSubsysSamples[i] > 0) {
+      v = percentile(&subsysSamples[i][s*maxSamples], nSubsysSamples[i], pct);
+   }
+   return v;
+}
+
+double Benchmark::getSubsystemMean(const bool tc, const unsigned int s) const
+{
+   double v = 0;
+   const unsigned int i = (tc ? 0 : 1);
+   if (s < Simulation::NUM_SUBSYSTEMS && nSubsysSamples[i] > 0) {
+      v = mean(&subsysSamples[i][s*maxSamples], nSubsysSamples[i]);
+   }
+   return v;
+}
+
+double Benchmark::getTotalTime() const
+{
+   return totalTime;
+}
+
+//------------------------------------------------------------------------------
+// Set functions
+//------------------------------------------------------------------------------
+bool Benchmark::setStation(Station* const p)
+{
+   if (station != 0) station->unref();
+   station = p;
+   if (station != 0) station->ref();
+   return true;
+}
+
+bool Benchmark::setNumPlayers(const unsigned int n)
+{
+   numPlayers = n;
+   return true;
+}
+
+bool Benchmark::setNumFrames(const unsigned int n)
+{
+   numFrames = n;
+   return true;
+}
+
+bool Benchmark::setWarmupFrames(const unsigned int n)
+{
+   warmupFrames = n;
+   return true;
+}
+
+bool Benchmark::setBgRatio(const unsigned int n)
+{
+   bool ok = false;
+   if (n > 0) {
+      bgRatio = n;
+      ok = true;
+   }
+   return ok;
+}
+
+bool Benchmark::setSeed(const unsigned int s)
+{
+   seed = s;
+   return true;
+}
+
+bool Benchmark::setAreaRadius(const double r)
+{
+   bool ok = false;
+   if (r >= 0) {
+      areaRadius = r;
+      ok = true;
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// Slot functions
+//------------------------------------------------------------------------------
+bool Benchmark::setSlotStation(Station* const msg)
+{
+   return setStation(msg);
+}
+
+bool Benchmark::setSlotTemplates(Basic::PairStream* const msg)
+{
+   templates = msg;
+   return true;
+}
+
+bool Benchmark::setSlotNumPlayers(const Basic::Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      const int v = msg->getInt();
+      if (v >= 0) ok = setNumPlayers( static_cast<unsigned int>(v) );
+      if (!ok) std::cerr << "Benchmark::setSlotNumPlayers(): invalid number of players: " << v << std::endl;
+   }
+   return ok;
+}
+
+bool Benchmark::setSlotNumFrames(const Basic::Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      const int v = msg->getInt();
+      if (v > 0) ok = setNumFrames( static_cast<unsigned int>(v) );
+      if (!ok) std::cerr << "Benchmark::setSlotNumFrames(): invalid number of frames: " << v << std::endl;
+   }
+   return ok;
+}
+
+bool Benchmark::setSlotWarmupFrames(const Basic::Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      const int v = msg->getInt();
+      if (v >= 0) ok = setWarmupFrames( static_cast<unsigned int>(v) );
+      if (!ok) std::cerr << "Benchmark::setSlotWarmupFrames(): invalid number of frames: " << v << std::endl;
+   }
+   return ok;
+}
+
+bool Benchmark::setSlotBgRatio(const Basic::Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      const int v = msg->getInt();
+      if (v > 0) ok = setBgRatio( static_cast<unsigned int>(v) );
+      if (!ok) std::cerr << "Benchmark::setSlotBgRatio(): invalid ratio: " << v << "; use one or more" << std::endl;
+   }
+   return ok;
+}
+
+bool Benchmark::setSlotSeed(const Basic::Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      ok = setSeed( static_cast<unsigned int>(msg->getInt()) );
+   }
+   return ok;
+}
+
+bool Benchmark::setSlotAreaRadius(const Basic::Distance* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      ok = setAreaRadius( Basic::Meters::convertStatic(*msg) );
+      if (!ok) std::cerr << "Benchmark::setSlotAreaRadius(): invalid radius" << std::endl;
+   }
+   return ok;
+}
+
+bool Benchmark::setSlotAreaRadius(const Basic::Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      ok = setAreaRadius( msg->getDouble() );
+      if (!ok) std::cerr << "Benchmark::setSlotAreaRadius(): invalid radius" << std::endl;
+   }
+   return ok;
+}
+
+bool Benchmark::setSlotFirstPlayerId(const Basic::Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      const int v = msg->getInt();
+      if (v > 0 && v < Simulation::MIN_WPN_ID) {
+         firstPlayerId = static_cast<unsigned short>(v);
+         ok = true;
+      }
+      else {
+         std::cerr << "Benchmark::setSlotFirstPlayerId(): invalid ID: " << v;
+         std::cerr << "; use [ 1 .. " << (Simulation::MIN_WPN_ID - 1) << " ]" << std::endl;
+      }
+   }
+   return ok;
+}
+
+bool Benchmark::setSlotOutputFile(const Basic::String* const msg)
+{
+   if (outputFile != 0) outputFile->unref();
+   outputFile = msg;
+   if (outputFile != 0) outputFile->ref();
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// getSlotByIndex()
+//------------------------------------------------------------------------------
+Basic::Object* Benchmark::getSlotByIndex(const int si)
+{
+   return BaseClass::getSlotByIndex(si);
+}
+
+//------------------------------------------------------------------------------
+// serialize
+//------------------------------------------------------------------------------
+std::ostream& Benchmark::serialize(std::ostream& sout, const int i, const bool slotsOnly) const
+{
+   int j = 0;
+   if ( !slotsOnly ) {
+      indent(sout,i);
+      sout << "( " << getFactoryName() << std::endl;
+      j = 4;
+   }
+
+   if (station != 0) {
+      indent(sout,i+j);
+      sout << "station: " << std::endl;
+      station->serialize(sout,(i+j+4));
+   }
+
+   if (templates != 0) {
+      indent(sout,i+j);
+      sout << "templates: {" << std::endl;
+      templates->serialize(sout,i+j+4);
+      indent(sout,i+j);
+      sout << "}" << std::endl;
+   }
+
+   indent(sout,i+j);
+   sout << "numPlayers: " << numPlayers << std::endl;
+
+   indent(sout,i+j);
+   sout << "numFrames: " << numFrames << std::endl;
+
+   indent(sout,i+j);
+   sout << "warmupFrames: " << warmupFrames << std::endl;
+
+   indent(sout,i+j);
+   sout << "bgRatio: " << bgRatio << std::endl;
+
+   indent(sout,i+j);
+   sout << "seed: " << seed << std::endl;
+
+   indent(sout,i+j);
+   sout << "areaRadius: ( Meters " << areaRadius << " )" << std::endl;
+
+   indent(sout,i+j);
+   sout << "firstPlayerId: " << firstPlayerId << std::endl;
+
+   if (outputFile != 0) {
+      indent(sout,i+j);
+      sout << "outputFile: \"" << *outputFile << "\"" << std::endl;
+   }
+
+   BaseClass::serialize(sout,i+j,true);
+
+   if ( !slotsOnly ) {
+      indent(sout,i);
+      sout << ")" << std::endl;
+   }
+
+   return sout;
+}
+
+} // End Simulation namespace
+} // End Eaagles namespace
@@ -65,6 +65,9 @@ void CollisionDetect::initData()
    players = 0;
    maxPlayers = 0;
    resizePoiList(20);         // Default: 20 POI
+
+   candidates = 0;
+   maxCandidates = 0;
 }
 
 void CollisionDetect::copyData(const CollisionDetect& org, const bool cc)
@@ -87,6 +90,10 @@ void CollisionDetect::copyData(const CollisionDetect& org, const bool cc)
 void CollisionDetect::deleteData()
 {
    resizePoiList(0);
+
+   if (candidates != 0) delete[] candidates;
+   candidates = 0;
+   maxCandidates = 0;
 }
 
 
@@ -206,18 +213,44 @@ void CollisionDetect::updateData(const LCreal dt)
    }
 
    // ---
-   // Scan the player list --- 
+   // Candidate players from the simulation's broad phase, which requires a
+   // max range and our gaming area position; the candidates are in player
+   // list order.  If the broad phase isn't available then we'll scan the
+   // player list.
    // ---
-   Basic::PairStream* plist = sim->getPlayers();
-   if (plist != 0) {
+   int nc = -1;
+   if (maxRange2Players > 0.0 && ownship->isPositionVectorValid()) {
+      nc = sim->findNearbyPlayers(ownship->getPosition(), static_cast<LCreal>(maxRange2Players), candidates, maxCandidates);
+      if (nc > static_cast<int>(maxCandidates)) {
+         // Grow the candidate array and try again
+         if (candidates != 0) delete[] candidates;
+         maxCandidates = static_cast<unsigned int>(nc) * 2;
+         candidates = new Player*[maxCandidates];
+         nc = sim->findNearbyPlayers(ownship->getPosition(), static_cast<LCreal>(maxRange2Players), candidates, maxCandidates);
+      }
+   }
 
-      Basic::List::Item* item = plist->getFirstItem();
+   // ---
+   // Scan the candidates or the player list --- 
+   // ---
+   Basic::PairStream* plist = 0;
+   if (nc < 0) plist = sim->getPlayers();
+   if (nc >= 0 || plist != 0) {
+
+      Basic::List::Item* item = (plist != 0 ? plist->getFirstItem() : 0);
+      int ic = 0;
       bool finished = false;
-      while ( item != 0 && !finished ) {
+      while ( (item != 0 || ic < nc) && !finished ) {
 
          // Get the pointer to the target player
-         Basic::Pair* pair = static_cast<Basic::Pair*>(item->getValue());
-         Player* target = static_cast<Player*>(pair->object());
+         Player* target = 0;
+         if (item != 0) {
+            Basic::Pair* pair = static_cast<Basic::Pair*>(item->getValue());
+            target = static_cast<Player*>(pair->object());
+         }
+         else {
+            target = candidates[ic++];
+         }
 
          // Did we complete the local only players?
          finished = localOnly && target->isNetworkedPlayer();
@@ -285,11 +318,11 @@ void CollisionDetect::updateData(const LCreal dt)
          }
 
          // Next player ...
-         item = item->getNext();
+         if (item != 0) item = item->getNext();
       }
 
       // Unref the player list
-      plist->unref();
+      if (plist != 0) plist->unref();
    }
 
    // ---
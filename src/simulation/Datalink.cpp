@@ -25,6 +25,8 @@ BEGIN_SLOTTABLE(Datalink)
    "maxRange",          // 2: Max range of the datalink (w/o a radio model)
    "radioName",         // 3: Name of the (optional) communication radio mode
    "trackManagerName",  // 4: Track Manager Name
+   "network",           // 5: Datalink network ID
+   "sideMask",          // 6: Sides of the players whose messages are received
 END_SLOTTABLE(Datalink)
 
 //  Map slot table 
@@ -33,6 +35,8 @@ BEGIN_SLOT_MAP(Datalink)
     ON_SLOT(2,setSlotMaxRange,Basic::Distance)
     ON_SLOT(3,setRadioName,Basic::String)
     ON_SLOT(4,setTrackManagerName,Basic::String)
+    ON_SLOT(5,setSlotNetwork,Basic::Number)
+    ON_SLOT(6,setSlotSideMask,Basic::Number)
 END_SLOT_MAP()
 
 //------------------------------------------------------------------------------
@@ -55,6 +59,8 @@ Datalink::Datalink()
 void Datalink::initData()
 {
    noRadioMaxRange = 5000; //default is high in case someone doesn't set it correctly
+   networkId = 0;
+   sideMask = 0xff;
 
    radioId = 0;
    useRadioIdFlg = false;
@@ -78,6 +84,8 @@ void Datalink::copyData(const Datalink& org, const bool cc)
    if (cc) initData();
 
    noRadioMaxRange = org.noRadioMaxRange;
+   networkId = org.networkId;
+   sideMask = org.sideMask;
    radioId = org.radioId;
    useRadioIdFlg = org.useRadioIdFlg;
 
@@ -157,6 +165,20 @@ bool Datalink::setMaxRange(const double nm)
    return true;
 }
 
+// Datalink network ID
+bool Datalink::setNetworkId(const unsigned int id)
+{
+   networkId = id;
+   return true;
+}
+
+// Sides of the players whose messages we receive
+bool Datalink::setSideMask(const unsigned int mask)
+{
+   sideMask = mask;
+   return true;
+}
+
 // Send to local players flag
 bool Datalink::setLocalSendEnabled(const bool flg)
 {
@@ -285,56 +307,43 @@ void Datalink::reset()
 //------------------------------------------------------------------------------
 void Datalink::dynamics(const LCreal)
 {
-    //age queues
+    // Age queues: get the messages (one lock), remove the expired
+    // messages and put the others back (one lock)
     Eaagles::Basic::Object* tempInQueue[MAX_MESSAGES];
-    int numIn = 0;
-    Eaagles::Simulation::Message *msg = 0;
-    while((numIn < MAX_MESSAGES) && inQueue->isNotEmpty()) {
-        Eaagles::Basic::Object* tempObj = inQueue->get();
-        msg = dynamic_cast<Eaagles::Simulation::Message*>(tempObj);        
-        if(msg != 0) {
-            if(getComputerTime() - msg->getTimeStamp() > msg->getLifeSpan()) {
-                //remove message by not adding to list to be put back into queue
-                msg->unref();
-            }
-            else {
-                tempInQueue[numIn++] = msg;
-            }
+    const unsigned int nIn = inQueue->getN(tempInQueue, MAX_MESSAGES);
+    unsigned int numIn = 0;
+    for (unsigned int i = 0; i < nIn; i++) {
+        Eaagles::Basic::Object* tempObj = tempInQueue[i];
+        Eaagles::Simulation::Message* msg = dynamic_cast<Eaagles::Simulation::Message*>(tempObj);
+        if (msg != 0 && (getComputerTime() - msg->getTimeStamp() > msg->getLifeSpan())) {
+            //remove message by not adding to list to be put back into queue
+            msg->unref();
         }
-        else if(tempObj != 0) {
+        else if (tempObj != 0) {
             tempInQueue[numIn++] = tempObj;
         }
     }
-    if(numIn != 0) {
-        for(int i = 0; i < numIn; i++) {
-            inQueue->put(tempInQueue[i]);
-        }
-    }
+    // (messages that don't fit, because new messages were queued, are dropped)
+    const unsigned int putIn = inQueue->putN(tempInQueue, numIn);
+    for (unsigned int i = putIn; i < numIn; i++) tempInQueue[i]->unref();
 
     Eaagles::Basic::Object* tempOutQueue[MAX_MESSAGES];
-    int numOut = 0;
-    msg = 0;
-    while((numOut < MAX_MESSAGES) && outQueue->isNotEmpty()) {
-        Eaagles::Basic::Object* tempObj = outQueue->get();
-        msg = dynamic_cast<Eaagles::Simulation::Message*>(tempObj);        
-        if(msg != 0) {
-            if(getComputerTime() - msg->getTimeStamp() > msg->getLifeSpan()) {
-                //remove message by not adding to list to be put back into queue
-                msg->unref();
-            }
-            else {
-                tempOutQueue[numOut++] = msg;
-            }
-            }
-        else if(tempObj != 0) {
+    const unsigned int nOut = outQueue->getN(tempOutQueue, MAX_MESSAGES);
+    unsigned int numOut = 0;
+    for (unsigned int i = 0; i < nOut; i++) {
+        Eaagles::Basic::Object* tempObj = tempOutQueue[i];
+        Eaagles::Simulation::Message* msg = dynamic_cast<Eaagles::Simulation::Message*>(tempObj);
+        if (msg != 0 && (getComputerTime() - msg->getTimeStamp() > msg->getLifeSpan())) {
+            //remove message by not adding to list to be put back into queue
+            msg->unref();
+        }
+        else if (tempObj != 0) {
             tempOutQueue[numOut++] = tempObj;
         }
     }
-    if(numOut != 0) {
-        for(int i = 0; i < numOut; i++) {
-            outQueue->put(tempOutQueue[i]);
-        }
-    }    
+    // (messages that don't fit, because new messages were queued, are dropped)
+    const unsigned int putOut = outQueue->putN(tempOutQueue, numOut);
+    for (unsigned int i = putOut; i < numOut; i++) tempOutQueue[i]->unref();
 }
 
 //------------------------------------------------------------------------------
@@ -354,39 +363,14 @@ bool Datalink::sendMessage(Basic::Object* const msg)
       }
 
       // ---
-      // No comm radio -- then we'll send this out to the other players ourself.
+      // No comm radio -- then the simulation will deliver this to the other
+      // players, within our max range, at the end of the phase.
       // ---
       else if (getOwnship() != 0) {
          Simulation* sim = getSimulation();
          if (sim != 0) {
-
-            Basic::PairStream* players = sim->getPlayers();
-            if (players != 0) {
-
-            Basic::List::Item* playerItem = players->getFirstItem();
-            while (playerItem != 0) {
-
-               Basic::Pair* playerPair = static_cast<Basic::Pair*>(playerItem->getValue());
-               Player* player = static_cast<Player*>(playerPair->object());
-
-               if (player->isLocalPlayer()) {
-                  // Send to active, local players only (and not to ourself)
-                     if ((player->isActive() || player->isMode(Player::PRE_RELEASE)) && player != getOwnship() ) {
-                     player->event(DATALINK_MESSAGE, msg);
-                  }
-                  playerItem = playerItem->getNext();
-               }
-               else {
-                  // Networked players are at the end of the list,
-                  // so we can stop now.
-                  playerItem = 0;
-               }
-
-            }
-
-               players->unref();
-               players = 0;
-            }
+            const LCreal rng = static_cast<LCreal>(noRadioMaxRange * Basic::Distance::NM2M);
+            sim->queueDatalinkMessage(this, msg, rng);
          }
          sent = true;
       }
@@ -540,6 +524,30 @@ bool Datalink::setSlotMaxRange(const Basic::Distance* const msg)
    return ok;
 }
 
+bool Datalink::setSlotNetwork(const Basic::Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      int v = msg->getInt();
+      if (v >= 0) {
+         ok = setNetworkId(static_cast<unsigned int>(v));
+      }
+   }
+   return ok;
+}
+
+bool Datalink::setSlotSideMask(const Basic::Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      int v = msg->getInt();
+      if (v >= 0 && v <= 0xff) {
+         ok = setSideMask(static_cast<unsigned int>(v));
+      }
+   }
+   return ok;
+}
+
 //------------------------------------------------------------------------------
 // getSlotByIndex()
 //------------------------------------------------------------------------------
@@ -0,0 +1,268 @@
+//------------------------------------------------------------------------------
+// Class: DeadReckoningBatch
+//------------------------------------------------------------------------------
+
+#include "openeaagles/simulation/DeadReckoningBatch.h"
+#include "openeaagles/simulation/Nib.h"
+
+namespace Eaagles {
+namespace Simulation {
+
+//------------------------------------------------------------------------------
+// Constructor & destructor
+//------------------------------------------------------------------------------
+DeadReckoningBatch::DeadReckoningBatch()
+{
+   nibs = 0;
+   times = 0;
+   algs = 0;
+   sNibs = 0;
+   data = 0;
+   t = 0;
+   alg = 0;
+   resets = 0;
+   px = 0;
+   py = 0;
+   pz = 0;
+   vx = 0;
+   vy = 0;
+   vz = 0;
+   ax = 0;
+   ay = 0;
+   az = 0;
+   rpy = 0;
+   np = 0;
+   maxNp = 0;
+}
+
+DeadReckoningBatch::~DeadReckoningBatch()
+{
+   clear();
+   resize(0);
+}
+
+//------------------------------------------------------------------------------
+// resize() -- resize the arrays for 'n' NIBs (zero to free the arrays); the
+// NIBs that have already been added are kept.
+//------------------------------------------------------------------------------
+bool DeadReckoningBatch::resize(const unsigned int n)
+{
+   Nib** oldNibs = nibs;
+   double* oldTimes = times;
+   unsigned char* oldAlgs = algs;
+   const unsigned int oldNp = np;
+
+   if (sNibs != 0)   { delete[] sNibs;   sNibs = 0; }
+   if (data != 0)    { delete[] data;    data = 0; }
+   if (alg != 0)     { delete[] alg;     alg = 0; }
+   if (resets != 0)  { delete[] resets;  resets = 0; }
+   if (rpy != 0)     { delete[] rpy;     rpy = 0; }
+   nibs = 0;
+   times = 0;
+   algs = 0;
+   t = 0;
+   px = 0; py = 0; pz = 0;
+   vx = 0; vy = 0; vz = 0;
+   ax = 0; ay = 0; az = 0;
+   maxNp = 0;
+   np = 0;
+
+   if (n > 0) {
+      unsigned int size = 64;
+      while (size < n) size *= 2;
+      nibs = new Nib*[size];
+      times = new double[size];
+      algs = new unsigned char[size];
+      sNibs = new Nib*[size];
+      alg = new unsigned char[size];
+      resets = new unsigned int[size];
+      rpy = new osg::Vec3d[size];
+
+      // The DR times and SoA vectors are all in one block
+      data = new double[size*10];
+      t  = &data[0];
+      px = &data[size];
+      py = &data[size*2];
+      pz = &data[size*3];
+      vx = &data[size*4];
+      vy = &data[size*5];
+      vz = &data[size*6];
+      ax = &data[size*7];
+      ay = &data[size*8];
+      az = &data[size*9];
+      maxNp = size;
+
+      // Keep the NIBs that have already been added
+      for (unsigned int i = 0; i < oldNp && i < maxNp; i++) {
+         nibs[i] = oldNibs[i];
+         times[i] = oldTimes[i];
+         algs[i] = oldAlgs[i];
+         np++;
+      }
+   }
+
+   if (oldNibs != 0)  delete[] oldNibs;
+   if (oldTimes != 0) delete[] oldTimes;
+   if (oldAlgs != 0)  delete[] oldAlgs;
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// add() -- adds a NIB to the batch
+//------------------------------------------------------------------------------
+void DeadReckoningBatch::add(Nib* const nib, const double dT)
+{
+   if (nib == 0) return;
+   if (np >= maxNp) resize(np + 1);
+
+   nibs[np] = nib;
+   times[np] = dT;
+   algs[np] = nib->getDeadReckoning();
+   np++;
+}
+
+//------------------------------------------------------------------------------
+// sort() -- groups the NIBs by their DR algorithm (counting sort; stable)
+//------------------------------------------------------------------------------
+void DeadReckoningBatch::sort()
+{
+   // Algorithm start indexes; unknown algorithms are grouped with OTHER_DRM,
+   // which the NIB dead reckons itself.
+   unsigned int start[NUM_ALGORITHMS+1];
+   for (unsigned int k = 0; k <= NUM_ALGORITHMS; k++) {
+      start[k] = 0;
+   }
+   for (unsigned int i = 0; i < np; i++) {
+      if (algs[i] >= NUM_ALGORITHMS) algs[i] = Nib::OTHER_DRM;
+      start[algs[i] + 1]++;
+   }
+   for (unsigned int k = 0; k < NUM_ALGORITHMS; k++) {
+      start[k+1] += start[k];
+   }
+
+   for (unsigned int i = 0; i < np; i++) {
+      const unsigned int j = start[algs[i]]++;
+      sNibs[j] = nibs[i];
+      t[j] = times[i];
+      alg[j] = algs[i];
+   }
+}
+
+//------------------------------------------------------------------------------
+// compute() -- dead reckons the idx'th part of 'n' parts of the batch
+//------------------------------------------------------------------------------
+void DeadReckoningBatch::compute(const unsigned int idx, const unsigned int n)
+{
+   if (idx == 0 || idx > n || np == 0) return;
+
+   // Our part of the (sorted) batch: [ i0 .. i1-1 ]
+   const unsigned int i0 = (np * (idx-1)) / n;
+   const unsigned int i1 = (np * idx) / n;
+
+   // ---
+   // Load the NIBs' T0 vectors; the reset counts are loaded first, so the
+   // results are discarded if the NIB's DR is reset while we're loading.
+   // ---
+   for (unsigned int i = i0; i < i1; i++) {
+      const Nib* const nib = sNibs[i];
+      resets[i] = nib->drResetCnt;
+      px[i] = nib->drP0[0];
+      py[i] = nib->drP0[1];
+      pz[i] = nib->drP0[2];
+      vx[i] = nib->drV0[0];
+      vy[i] = nib->drV0[1];
+      vz[i] = nib->drV0[2];
+      ax[i] = nib->drA0[0];
+      ay[i] = nib->drA0[1];
+      az[i] = nib->drA0[2];
+   }
+
+   // ---
+   // Dead reckon each run of NIBs with the same algorithm; the position
+   // vectors are replaced by the DR positions.
+   // ---
+   unsigned int b = i0;
+   while (b < i1) {
+      const unsigned char dr = alg[b];
+      unsigned int e = b + 1;
+      while (e < i1 && alg[e] == dr) e++;
+
+      switch (dr) {
+
+         // World, 1st order linear (with and without rotation)
+         case Nib::FPW_DRM:
+         case Nib::RPW_DRM: {
+            for (unsigned int i = b; i < e; i++) {
+               const double dT = t[i];
+               px[i] = px[i] + vx[i]*dT;
+               py[i] = py[i] + vy[i]*dT;
+               pz[i] = pz[i] + vz[i]*dT;
+            }
+         }
+         break;
+
+         // World, 2nd order linear (with and without rotation)
+         case Nib::RVW_DRM:
+         case Nib::FVW_DRM: {
+            for (unsigned int i = b; i < e; i++) {
+               const double dT = t[i];
+               const double dT2 = 0.5*dT*dT;
+               px[i] = px[i] + vx[i]*dT + ax[i]*dT2;
+               py[i] = py[i] + vy[i]*dT + ay[i]*dT2;
+               pz[i] = pz[i] + vz[i]*dT + az[i]*dT2;
+            }
+         }
+         break;
+
+         // Body axis, static and user defined algorithms: the NIB's own DR
+         default: {
+            for (unsigned int i = b; i < e; i++) {
+               osg::Vec3d pos;
+               sNibs[i]->mainDeadReckoning(t[i], &pos, &rpy[i]);
+               px[i] = pos[0];
+               py[i] = pos[1];
+               pz[i] = pos[2];
+            }
+         }
+         break;
+      }
+
+      // Euler angles of the world algorithms
+      if (dr == Nib::RPW_DRM || dr == Nib::RVW_DRM) {
+         for (unsigned int i = b; i < e; i++) {
+            sNibs[i]->drComputeWorldAngles(t[i], &rpy[i]);
+         }
+      }
+      else if (dr == Nib::FPW_DRM || dr == Nib::FVW_DRM) {
+         for (unsigned int i = b; i < e; i++) {
+            rpy[i] = sNibs[i]->drRPY0;
+         }
+      }
+
+      b = e;
+   }
+
+   // ---
+   // Store the results with the NIBs
+   // ---
+   for (unsigned int i = i0; i < i1; i++) {
+      Nib* const nib = sNibs[i];
+      nib->drBatchPos.set(px[i], py[i], pz[i]);
+      nib->drBatchAngles = rpy[i];
+      nib->drBatchTime = t[i];
+      nib->drBatchResetCnt = resets[i];
+      nib->drBatchValid = true;
+   }
+}
+
+//------------------------------------------------------------------------------
+// clear() -- clears the batch
+//------------------------------------------------------------------------------
+void DeadReckoningBatch::clear()
+{
+   np = 0;
+}
+
+} // End Simulation namespace
+} // End Eaagles namespace
@@ -21,6 +21,11 @@ Emission::Emission()
 {
     STANDARD_CONSTRUCTOR()
 
+    initData();
+}
+
+void Emission::initData()
+{
     freq  = 0.0;
     lambda = 0.0;
     pw    = 0.0;
@@ -81,12 +86,13 @@ void Emission::deleteData()
 }
 
 //------------------------------------------------------------------------------
-// clear() -- clears out the emissions
+// clear() -- clears out the emission (i.e., returns it to its constructed state)
 //------------------------------------------------------------------------------
 void Emission::clear()
 {
    BaseClass::clear();
    setTransmitter(0);
+   initData();
 }
 
 //------------------------------------------------------------------------------
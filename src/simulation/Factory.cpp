@@ -4,6 +4,7 @@
 #include "openeaagles/simulation/Factory.h"
 
 #include "openeaagles/basic/Object.h"
+#include "openeaagles/basic/FactoryTable.h"
 
 #include "openeaagles/simulation/Aam.h"
 #include "openeaagles/simulation/Actions.h"
@@ -13,6 +14,7 @@
 #include "openeaagles/simulation/Antenna.h"
 #include "openeaagles/simulation/Autopilot.h"
 #include "openeaagles/simulation/AvionicsPod.h"
+#include "openeaagles/simulation/Benchmark.h"
 #include "openeaagles/simulation/Bomb.h"
 #include "openeaagles/simulation/Buildings.h"
 #include "openeaagles/simulation/Bullseye.h"
@@ -73,359 +75,172 @@
 #include "openeaagles/simulation/TrackManager.h"
 #include "openeaagles/simulation/Weapon.h"
 
-#include <cstring>
-
 namespace Eaagles {
 namespace Simulation {
 
-Factory::Factory()
-{}
-
-Basic::Object* Factory::createObj(const char* name)
+//------------------------------------------------------------------------------
+// addClasses() -- adds our classes to the factory table
+//------------------------------------------------------------------------------
+static void addClasses(Basic::FactoryTable& table)
 {
-    Basic::Object* obj = 0;
-
     // Basic Simulations
-    if ( std::strcmp(name, Simulation::getFactoryName()) == 0 ) {
-        obj = new Simulation();
-    }
-    else if ( std::strcmp(name, Station::getFactoryName()) == 0 ) {
-        obj = new Station();
-    }
+    table.add<Simulation>();
+    table.add<Station>();
+    table.add<Benchmark>();
 
     // Basic Player types
-    else if ( std::strcmp(name, Player::getFactoryName()) == 0 ) {
-        obj = new Player();
-    }
-    else if ( std::strcmp(name, AirVehicle::getFactoryName()) == 0 ) {
-        obj = new AirVehicle();
-    }
-    else if ( std::strcmp(name, Building::getFactoryName()) == 0 ) {
-        obj = new Building();
-    }
-    else if ( std::strcmp(name, GroundVehicle::getFactoryName()) == 0 ) {
-        obj = new GroundVehicle();
-    }
-    else if ( std::strcmp(name, LifeForm::getFactoryName()) == 0 ) {
-        obj = new LifeForm();
-    }
-    else if ( std::strcmp(name, Ship::getFactoryName()) == 0 ) {
-        obj = new Ship();
-    }
-    else if ( std::strcmp(name, SpaceVehicle::getFactoryName()) == 0 ) {
-        obj = new SpaceVehicle();
-    }
+    table.add<Player>();
+    table.add<AirVehicle>();
+    table.add<Building>();
+    table.add<GroundVehicle>();
+    table.add<LifeForm>();
+    table.add<Ship>();
+    table.add<SpaceVehicle>();
 
     // General Air Vehicles
-    else if ( std::strcmp(name, Aircraft::getFactoryName()) == 0 ) {
-        obj = new Aircraft();
-    }
-    else if ( std::strcmp(name, Helicopter::getFactoryName()) == 0 ) {
-        obj = new Helicopter();
-    }
-    else if ( std::strcmp(name, UnmannedAirVehicle::getFactoryName()) == 0 ) {
-        obj = new UnmannedAirVehicle();
-    }
+    table.add<Aircraft>();
+    table.add<Helicopter>();
+    table.add<UnmannedAirVehicle>();
 
     // General Ground Vehicles
-    else if ( std::strcmp(name, Tank::getFactoryName()) == 0 ) {
-        obj = new Tank();
-    }
-    else if ( std::strcmp(name, ArmoredVehicle::getFactoryName()) == 0 ) {
-        obj = new ArmoredVehicle();
-    }
-    else if ( std::strcmp(name, WheeledVehicle::getFactoryName()) == 0 ) {
-        obj = new WheeledVehicle();
-    }
-    else if ( std::strcmp(name, Artillery::getFactoryName()) == 0 ) {
-        obj = new Artillery();
-    }
-    else if ( std::strcmp(name, SamVehicle::getFactoryName()) == 0 ) {
-        obj = new SamVehicle();
-    }
-    else if ( std::strcmp(name, GroundStation::getFactoryName()) == 0 ) {
-        obj = new GroundStation();
-    }
-    else if ( std::strcmp(name, GroundStationRadar::getFactoryName()) == 0 ) {
-        obj = new GroundStationRadar();
-    }
-    else if ( std::strcmp(name, GroundStationUav::getFactoryName()) == 0 ) {
-        obj = new GroundStationUav();
-    }
+    table.add<Tank>();
+    table.add<ArmoredVehicle>();
+    table.add<WheeledVehicle>();
+    table.add<Artillery>();
+    table.add<SamVehicle>();
+    table.add<GroundStation>();
+    table.add<GroundStationRadar>();
+    table.add<GroundStationUav>();
 
     // General Space Vehicles
-    else if ( std::strcmp(name, MannedSpaceVehicle::getFactoryName()) == 0 ) {
-        obj = new MannedSpaceVehicle();
-    }
-    else if ( std::strcmp(name, UnmannedSpaceVehicle::getFactoryName()) == 0 ) {
-        obj = new UnmannedSpaceVehicle();
-    }
-    else if ( std::strcmp(name, BoosterSpaceVehicle::getFactoryName()) == 0 ) {
-        obj = new BoosterSpaceVehicle();
-    }
+    table.add<MannedSpaceVehicle>();
+    table.add<UnmannedSpaceVehicle>();
+    table.add<BoosterSpaceVehicle>();
 
     // System
-    else if ( std::strcmp(name, System::getFactoryName()) == 0 ) {
-        obj = new System();
-    }
-    else if ( std::strcmp(name, AvionicsPod::getFactoryName()) == 0 ) {
-        obj = new AvionicsPod();
-    }
+    table.add<System>();
+    table.add<AvionicsPod>();
 
     // Basic Pilot types
-    else if ( std::strcmp(name, Pilot::getFactoryName()) == 0 ) {
-        obj = new Pilot();
-    }
-    else if ( std::strcmp(name, Autopilot::getFactoryName()) == 0 ) {
-        obj = new Autopilot();
-    }
+    table.add<Pilot>();
+    table.add<Autopilot>();
 
     // Navigation types
-    else if ( std::strcmp(name, Navigation::getFactoryName()) == 0 ) {
-        obj = new Navigation();
-    }
-    else if ( std::strcmp(name, Ins::getFactoryName()) == 0 ) {
-        obj = new Ins();
-    }
-    else if ( std::strcmp(name, Gps::getFactoryName()) == 0 ) {
-        obj = new Gps();
-    }
-    else if ( std::strcmp(name, Route::getFactoryName()) == 0 ) {
-        obj = new Route();
-    }
-    else if ( std::strcmp(name, Steerpoint::getFactoryName()) == 0 ) {
-        obj = new Steerpoint();
-    }
+    table.add<Navigation>();
+    table.add<Ins>();
+    table.add<Gps>();
+    table.add<Route>();
+    table.add<Steerpoint>();
     
     // Target Data
-    else if (std::strcmp(name, TargetData::getFactoryName()) == 0 ) {
-        obj = new TargetData();
-    }
+    table.add<TargetData>();
 
     // Bullseye
-    else if (std::strcmp(name, Bullseye::getFactoryName()) == 0 ) {
-        obj = new Bullseye();
-    }
+    table.add<Bullseye>();
 
     // Actions
-    else if ( std::strcmp(name, ActionImagingSar::getFactoryName()) == 0 ) {
-        obj = new ActionImagingSar();
-    }
-    else if ( std::strcmp(name, ActionWeaponRelease::getFactoryName()) == 0 ) {
-        obj = new ActionWeaponRelease();
-    }
-    else if ( std::strcmp(name, ActionDecoyRelease::getFactoryName()) == 0 ) {
-        obj = new ActionDecoyRelease();
-    }
-    else if ( std::strcmp(name, ActionCamouflageType::getFactoryName()) == 0 ) {
-        obj = new ActionCamouflageType();
-    }
+    table.add<ActionImagingSar>();
+    table.add<ActionWeaponRelease>();
+    table.add<ActionDecoyRelease>();
+    table.add<ActionCamouflageType>();
 
     // Bombs and Missiles
-    else if ( std::strcmp(name, Bomb::getFactoryName()) == 0 ) {
-        obj = new Bomb();
-    }
-    else if ( std::strcmp(name, Missile::getFactoryName()) == 0 ) {
-        obj = new Missile();
-    }
-    else if ( std::strcmp(name, Aam::getFactoryName()) == 0 ) {
-        obj = new Aam();
-    }
-    else if ( std::strcmp(name, Agm::getFactoryName()) == 0 ) {
-        obj = new Agm();
-    }
-    else if ( std::strcmp(name, Sam::getFactoryName()) == 0 ) {
-        obj = new Sam();
-    }
+    table.add<Bomb>();
+    table.add<Missile>();
+    table.add<Aam>();
+    table.add<Agm>();
+    table.add<Sam>();
 
     // Effects
-    else if ( std::strcmp(name, Chaff::getFactoryName()) == 0 ) {
-        obj = new Chaff();
-    }
-    else if ( std::strcmp(name, Decoy::getFactoryName()) == 0 ) {
-        obj = new Decoy();
-    }
-    else if ( std::strcmp(name, Flare::getFactoryName()) == 0 ) {
-        obj = new Flare();
-    }
+    table.add<Chaff>();
+    table.add<Decoy>();
+    table.add<Flare>();
 
     // Stores, stores manager and external stores (FuelTank, Gun & Bullets (used by the Gun))
-    else if ( std::strcmp(name, Stores::getFactoryName()) == 0 ) {
-        obj = new Stores();
-    }
-    else if ( std::strcmp(name, SimpleStoresMgr::getFactoryName()) == 0 ) {
-        obj = new SimpleStoresMgr();
-    }
-    else if ( std::strcmp(name, FuelTank::getFactoryName()) == 0 ) {
-        obj = new FuelTank();
-    }
-    else if ( std::strcmp(name, Gun::getFactoryName()) == 0 ) {
-        obj = new Gun();
-    }
-    else if ( std::strcmp(name, Bullet::getFactoryName()) == 0 ) {
-        obj = new Bullet();
-    }
+    table.add<Stores>();
+    table.add<SimpleStoresMgr>();
+    table.add<FuelTank>();
+    table.add<Gun>();
+    table.add<Bullet>();
 
     // Data links
-    else if ( std::strcmp(name, Datalink::getFactoryName()) == 0 ) {
-        obj = new Datalink();
-    }
+    table.add<Datalink>();
 
     // Gimbals, Antennas and Optics
-    else if ( std::strcmp(name, Gimbal::getFactoryName()) == 0 ) {
-        obj = new Gimbal();
-    }
-    else if ( std::strcmp(name, ScanGimbal::getFactoryName()) == 0 ) {
-        obj = new ScanGimbal();
-    }
-    else if ( std::strcmp(name, StabilizingGimbal::getFactoryName()) == 0 ) {
-        obj = new StabilizingGimbal();
-    }
-    else if ( std::strcmp(name, Antenna::getFactoryName()) == 0 ) {
-        obj = new Antenna();
-    }
-    else if ( std::strcmp(name, IrSeeker::getFactoryName()) == 0 ) {
-        obj = new IrSeeker();
-    }
+    table.add<Gimbal>();
+    table.add<ScanGimbal>();
+    table.add<StabilizingGimbal>();
+    table.add<Antenna>();
+    table.add<IrSeeker>();
 
     // IR Atmospheres
-    else if ( std::strcmp(name, IrAtmosphere::getFactoryName()) == 0 ) {
-        obj = new IrAtmosphere;
-    }
-    else if ( std::strcmp(name, IrAtmosphere1::getFactoryName()) == 0 ) {
-        obj = new IrAtmosphere1;
-    }
+    table.add<IrAtmosphere>();
+    table.add<IrAtmosphere1>();
 
     // R/F Signatures
-    else if ( std::strcmp(name, SigConstant::getFactoryName()) == 0 ) {
-        obj = new SigConstant();
-    }
-    else if ( std::strcmp(name, SigSphere::getFactoryName()) == 0 ) {
-        obj = new SigSphere();
-    }
-    else if ( std::strcmp(name, SigPlate::getFactoryName()) == 0 ) {
-        obj = new SigPlate();
-    }
-    else if ( std::strcmp(name, SigDihedralCR::getFactoryName()) == 0 ) {
-        obj = new SigDihedralCR();
-    }
-    else if ( std::strcmp(name, SigTrihedralCR::getFactoryName()) == 0 ) {
-        obj = new SigTrihedralCR();
-    }
-    else if ( std::strcmp(name, SigSwitch::getFactoryName()) == 0 ) {
-        obj = new SigSwitch();
-    }
-    else if ( std::strcmp(name, SigAzEl::getFactoryName()) == 0 ) {
-        obj = new SigAzEl();
-    }
+    table.add<SigConstant>();
+    table.add<SigSphere>();
+    table.add<SigPlate>();
+    table.add<SigDihedralCR>();
+    table.add<SigTrihedralCR>();
+    table.add<SigSwitch>();
+    table.add<SigAzEl>();
     // IR Signatures
-    else if ( std::strcmp(name, IrSignature::getFactoryName()) == 0 ) {
-        obj = new IrSignature();
-    }
-    else if ( std::strcmp(name, AircraftIrSignature::getFactoryName()) == 0 ) {
-        obj = new AircraftIrSignature;
-    }
-    else if ( std::strcmp(name, IrShape::getFactoryName()) == 0 ) {
-        obj = new IrShape();
-    }
-    else if ( std::strcmp(name, IrSphere::getFactoryName()) == 0 ) {
-        obj = new IrSphere();
-    }
-    else if ( std::strcmp(name, IrBox::getFactoryName()) == 0 ) {
-        obj = new IrBox();
-    }
+    table.add<IrSignature>();
+    table.add<AircraftIrSignature>();
+    table.add<IrShape>();
+    table.add<IrSphere>();
+    table.add<IrBox>();
 
     // Onboard Computers
-    else if ( std::strcmp(name, OnboardComputer::getFactoryName()) == 0 ) {
-        obj = new OnboardComputer();
-    }
+    table.add<OnboardComputer>();
 
     // Radios
-    else if ( std::strcmp(name, Radio::getFactoryName()) == 0 ) {
-        obj = new Radio();
-    }
-    else if ( std::strcmp(name, CommRadio::getFactoryName()) == 0 ) {
-        obj = new CommRadio();
-    }
-    else if ( std::strcmp(name, NavRadio::getFactoryName()) == 0 ) {
-        obj = new NavRadio();
-    }
-    else if ( std::strcmp(name, TacanRadio::getFactoryName()) == 0 ) {
-        obj = new TacanRadio();
-    }
-    else if ( std::strcmp(name, IlsRadio::getFactoryName()) == 0 ) {
-        obj = new IlsRadio();
-    }
-    else if ( std::strcmp(name, Iff::getFactoryName()) == 0 ) {
-        obj = new Iff();
-    }
+    table.add<Radio>();
+    table.add<CommRadio>();
+    table.add<NavRadio>();
+    table.add<TacanRadio>();
+    table.add<IlsRadio>();
+    table.add<Iff>();
 
     // Sensors
-    else if ( std::strcmp(name, RfSensor::getFactoryName()) == 0 ) {
-        obj = new RfSensor();
-    }
-    else if ( std::strcmp(name, SensorMgr::getFactoryName()) == 0 ) {
-        obj = new SensorMgr();
-    }
-    else if ( std::strcmp(name, Radar::getFactoryName()) == 0 ) {
-        obj = new Radar();
-    }
-    else if ( std::strcmp(name, Rwr::getFactoryName()) == 0 ) {
-        obj = new Rwr();
-    }
-    else if ( std::strcmp(name, Sar::getFactoryName()) == 0 ) {
-        obj = new Sar();
-    }
-    else if ( std::strcmp(name, Jammer::getFactoryName()) == 0 ) {
-        obj = new Jammer();
-    }
-    else if ( std::strcmp(name, IrSensor::getFactoryName()) == 0 ) {
-        obj = new IrSensor();
-    }
-    else if ( std::strcmp(name, MergingIrSensor::getFactoryName()) == 0 ) {
-        obj = new MergingIrSensor();
-    }
+    table.add<RfSensor>();
+    table.add<SensorMgr>();
+    table.add<Radar>();
+    table.add<Rwr>();
+    table.add<Sar>();
+    table.add<Jammer>();
+    table.add<IrSensor>();
+    table.add<MergingIrSensor>();
 
     // Tracks
-    else if ( std::strcmp(name, Track::getFactoryName()) == 0 ) {
-        obj = new Track();
-    }
+    table.add<Track>();
 
     // Track Managers
-    else if ( std::strcmp(name, GmtiTrkMgr::getFactoryName()) == 0 ) {
-        obj = new GmtiTrkMgr();
-    }
-    else if ( std::strcmp(name, AirTrkMgr::getFactoryName()) == 0 ) {
-        obj = new AirTrkMgr();
-    }
-    else if ( std::strcmp(name, RwrTrkMgr::getFactoryName()) == 0 ) {
-        obj = new RwrTrkMgr();
-    }
-    else if ( std::strcmp(name, AirAngleOnlyTrkMgr::getFactoryName()) == 0 ) {
-        obj = new AirAngleOnlyTrkMgr();
-    }
+    table.add<GmtiTrkMgr>();
+    table.add<AirTrkMgr>();
+    table.add<RwrTrkMgr>();
+    table.add<AirAngleOnlyTrkMgr>();
 
     // UBF Agents
-    else if ( std::strcmp(name, SimAgent::getFactoryName()) == 0 ) {
-        obj = new SimAgent();
-    }
-    else if ( std::strcmp(name, MultiActorAgent::getFactoryName()) == 0 ) {
-        obj = new MultiActorAgent();
-    }
+    table.add<SimAgent>();
+    table.add<MultiActorAgent>();
 
     // Collision detection component
-    else if ( std::strcmp(name, CollisionDetect::getFactoryName()) == 0 ) {
-        obj = new CollisionDetect();
-    }
-
-    else if ( std::strcmp(name, TabLogger::getFactoryName()) == 0 ) {
-        obj = new TabLogger();
-    }
-    else if ( std::strcmp(name, Otm::getFactoryName()) == 0 ) {
-        obj = new Otm();
-    }
-
-    return obj;
+    table.add<CollisionDetect>();
+
+    table.add<TabLogger>();
+    table.add<Otm>();
+}
+
+static Basic::FactoryTable factoryTable(addClasses);
+
+Factory::Factory()
+{}
+
+Basic::Object* Factory::createObj(const char* name)
+{
+    return factoryTable.createObj(name);
 }
 
 }  // end namespace Simulation
@@ -19,12 +19,31 @@ namespace Simulation {
 //==============================================================================
 // Class: Bullet
 //==============================================================================
-IMPLEMENT_EMPTY_SLOTTABLE_SUBCLASS(Bullet,"Bullet")
+IMPLEMENT_SUBCLASS(Bullet,"Bullet")
 EMPTY_SERIALIZER(Bullet)
 
 // Default Parameters
 const LCreal Bullet::DEFAULT_MUZZLE_VEL = 1000.0f;     // Meters / second
 const LCreal Bullet::DEFAULT_MAX_TOF = 3.0f;           // Seconds
+const int    Bullet::DEFAULT_MAX_BURSTS = 100;         // Burst budget
+const LCreal Bullet::DEFAULT_HIT_RADIUS = 10.0f;       // Meters
+const LCreal Bullet::MAX_CHECK_RADIUS = 250.0f;        // Meters (see checkForTargetHit())
+const LCreal Bullet::LIFE_FORM_HIT_RADIUS = 1.0f;      // Meters
+
+// Slot table
+BEGIN_SLOTTABLE(Bullet)
+    "maxBursts",        //  1: Burst budget; max number of active burst trajectories
+    "hitRadius",        //  2: Radius of the hit sphere around the players (meters)
+    "drag",             //  3: Drag coefficient, k, where the drag deceleration is k * V^2 (1/meters)
+END_SLOTTABLE(Bullet)
+
+// Map slot table to handles
+BEGIN_SLOT_MAP(Bullet)
+    ON_SLOT(1, setSlotMaxBursts, Basic::Number)
+    ON_SLOT(2, setSlotHitRadius, Basic::Distance)
+    ON_SLOT(2, setSlotHitRadius, Basic::Number)
+    ON_SLOT(3, setSlotDrag,      Basic::Number)
+END_SLOT_MAP()
 
 int Bullet::getCategory() const               { return (GRAVITY); }
 const char* Bullet::getDescription() const    { return "Bullets"; }
@@ -41,38 +60,121 @@ Bullet::Bullet()
    static Basic::String generic("Bullet");
    setType(&generic);
 
-   nbt = 0;
+   initData();
 
    setMaxTOF( DEFAULT_MAX_TOF );
+}
 
+void Bullet::initData()
+{
    muzzleVel = DEFAULT_MUZZLE_VEL;
+   hitRadius = DEFAULT_HIT_RADIUS;
+   drag = 0;
    hitPlayer = 0;
+
+   nbt = 0;
+   maxBursts = 0;
+   nhits = 0;
+   bPosN = 0;
+   bPosE = 0;
+   bPosD = 0;
+   bVelN = 0;
+   bVelE = 0;
+   bVelD = 0;
+   bPrevN = 0;
+   bPrevE = 0;
+   bPrevD = 0;
+   bTof = 0;
+   bNum = 0;
+   bRate = 0;
+   bEvent = 0;
+   bStatus = 0;
+   ngc = 0;
+   gcFirst = 0;
+   gcCenter = 0;
+
+   allocateBursts(DEFAULT_MAX_BURSTS);
 }
 
 //------------------------------------------------------------------------------
 // copyData(), deleteData() -- copy (delete) member data
 //------------------------------------------------------------------------------
-void Bullet::copyData(const Bullet& org, const bool)
+void Bullet::copyData(const Bullet& org, const bool cc)
 {
-
    BaseClass::copyData(org);
+   if (cc) initData();
 
+   muzzleVel = org.muzzleVel;
+   hitRadius = org.hitRadius;
+   drag = org.drag;
+
+   // Copy the burst budget, but not the bursts
+   allocateBursts(org.maxBursts);
    nbt = 0;
+   nhits = 0;
    hitPlayer = 0;
-
-   for (int i = 0; i < MBT; i++) {
-      bursts[i].bPos = org.bursts[i].bPos;
-      bursts[i].bVel = org.bursts[i].bVel;
-      bursts[i].bTof = org.bursts[i].bTof;
-      bursts[i].bNum = org.bursts[i].bNum;
-      bursts[i].bRate = org.bursts[i].bRate;
-      bursts[i].bEvent = org.bursts[i].bEvent;
-   }
 }
 
 void Bullet::deleteData()
 {
    setHitPlayer(0);
+   freeBursts();
+}
+
+//------------------------------------------------------------------------------
+// allocateBursts() -- allocates the burst arrays for 'n' bursts; the current
+// bursts are removed.
+//------------------------------------------------------------------------------
+bool Bullet::allocateBursts(const int n)
+{
+   if (n <= 0) return false;
+
+   if (n != maxBursts) {
+      freeBursts();
+      bPosN = new LCreal[n];
+      bPosE = new LCreal[n];
+      bPosD = new LCreal[n];
+      bVelN = new LCreal[n];
+      bVelE = new LCreal[n];
+      bVelD = new LCreal[n];
+      bPrevN = new LCreal[n];
+      bPrevE = new LCreal[n];
+      bPrevD = new LCreal[n];
+      bTof = new LCreal[n];
+      bNum = new int[n];
+      bRate = new int[n];
+      bEvent = new int[n];
+      bStatus = new BurstStatus[n];
+      gcFirst = new int[n + 1];
+      gcCenter = new osg::Vec3[n];
+      maxBursts = n;
+   }
+   nbt = 0;
+   ngc = 0;
+   return true;
+}
+
+void Bullet::freeBursts()
+{
+   if (bPosN != 0)   { delete[] bPosN;   bPosN = 0; }
+   if (bPosE != 0)   { delete[] bPosE;   bPosE = 0; }
+   if (bPosD != 0)   { delete[] bPosD;   bPosD = 0; }
+   if (bVelN != 0)   { delete[] bVelN;   bVelN = 0; }
+   if (bVelE != 0)   { delete[] bVelE;   bVelE = 0; }
+   if (bVelD != 0)   { delete[] bVelD;   bVelD = 0; }
+   if (bPrevN != 0)  { delete[] bPrevN;  bPrevN = 0; }
+   if (bPrevE != 0)  { delete[] bPrevE;  bPrevE = 0; }
+   if (bPrevD != 0)  { delete[] bPrevD;  bPrevD = 0; }
+   if (bTof != 0)    { delete[] bTof;    bTof = 0; }
+   if (bNum != 0)    { delete[] bNum;    bNum = 0; }
+   if (bRate != 0)   { delete[] bRate;   bRate = 0; }
+   if (bEvent != 0)  { delete[] bEvent;  bEvent = 0; }
+   if (bStatus != 0) { delete[] bStatus; bStatus = 0; }
+   if (gcFirst != 0) { delete[] gcFirst; gcFirst = 0; }
+   if (gcCenter != 0) { delete[] gcCenter; gcCenter = 0; }
+   maxBursts = 0;
+   nbt = 0;
+   ngc = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -107,9 +209,9 @@ void Bullet::weaponDynamics(const LCreal dt)
       if (nbt > 0) {
 
          // We control the position and altitude!
-         setPosition( bursts[0].bPos[0], bursts[0].bPos[1], bursts[0].bPos[2], true );
+         setPosition( bPosN[0], bPosE[0], bPosD[0], true );
 
-         setVelocity( bursts[0].bVel );
+         setVelocity( bVelN[0], bVelE[0], bVelD[0] );
 
          setAcceleration( 0, 0, 0 );
 
@@ -117,7 +219,8 @@ void Bullet::weaponDynamics(const LCreal dt)
 
          setAngularVelocities( 0, 0, 0 );
 
-         setVelocityBody ( bursts[0].bVel.length(), 0, 0 );
+         const osg::Vec3 vel(bVelN[0], bVelE[0], bVelD[0]);
+         setVelocityBody ( vel.length(), 0, 0 );
       }
    }
 }
@@ -130,33 +233,31 @@ void Bullet::updateTOF(const LCreal)
    // As long as we're active ...
    if (isMode(ACTIVE)) {
 
-      // count the number of active bursts and remove aged bullet bursts.
-      int n = 0;
-      int nhits = 0;
+      // set the missed status of the aged bullet bursts
+      const LCreal maxTof = getMaxTOF();
       for (int i = 0; i < nbt; i++) {
-         if (bursts[i].bStatus == Burst::ACTIVE) {
-            n++;
-            if ( bursts[i].bTof >= getMaxTOF() ) {
-               bursts[i].bStatus = Burst::MISS;
-            }
-         }
-         else if (bursts[i].bStatus == Burst::HIT) {
-            nhits++;
+         if (bStatus[i] == BURST_ACTIVE && bTof[i] >= maxTof) {
+            bStatus[i] = BURST_MISS;
          }
       }
 
+      // final time of flight (slave to the oldest burst)
+      const LCreal tof0 = (nbt > 0 ? bTof[0] : 0);
+
+      // remove the bursts that are no longer active
+      removeBursts();
+
       // If we have no active bursts .. we've detonated (so to speak)
-      if (n == 0) {
+      if (nbt == 0) {
          setMode(DETONATED);
-         // final detonation results (hit or miss) are located with each burst ...
+         // final detonation results (hit or miss)
          if (nhits > 0) {
             setDetonationResults( DETONATE_ENTITY_IMPACT );
          }
          else {
             setDetonationResults( DETONATE_NONE );
          }
-         // final time of flight (slave to the first burst)
-         setTOF( bursts[0].bTof );
+         setTOF( tof0 );
       }
    }
 }
@@ -167,6 +268,39 @@ void Bullet::updateTOF(const LCreal)
 void Bullet::resetBurstTrajectories()
 {
    nbt = 0;
+   nhits = 0;
+   ngc = 0;
+}
+
+//------------------------------------------------------------------------------
+// removeBursts() -- removes the bursts that are no longer active (i.e., that
+// have hit a player or missed), while keeping the active bursts in order.
+//------------------------------------------------------------------------------
+void Bullet::removeBursts()
+{
+   int n = 0;
+   for (int i = 0; i < nbt; i++) {
+      if (bStatus[i] == BURST_ACTIVE) {
+         if (n != i) {
+            bPosN[n] = bPosN[i];
+            bPosE[n] = bPosE[i];
+            bPosD[n] = bPosD[i];
+            bVelN[n] = bVelN[i];
+            bVelE[n] = bVelE[i];
+            bVelD[n] = bVelD[i];
+            bPrevN[n] = bPrevN[i];
+            bPrevE[n] = bPrevE[i];
+            bPrevD[n] = bPrevD[i];
+            bTof[n] = bTof[i];
+            bNum[n] = bNum[i];
+            bRate[n] = bRate[i];
+            bEvent[n] = bEvent[i];
+            bStatus[n] = bStatus[i];
+         }
+         n++;
+      }
+   }
+   nbt = n;
 }
 
 //------------------------------------------------------------------------------
@@ -174,14 +308,22 @@ void Bullet::resetBurstTrajectories()
 //------------------------------------------------------------------------------
 bool Bullet::burstOfBullets(const osg::Vec3* const pos, const osg::Vec3* const vel, const int num, const int rate, const int e)
 {
-   if (nbt < MBT && pos != 0 && vel != 0) {
-      bursts[nbt].bPos = *pos;  // Burst positions -- world  (m)
-      bursts[nbt].bVel = *vel;  // Burst velocities -- world (m)
-      bursts[nbt].bTof = 0;    // Burst time of flight      (sec)
-      bursts[nbt].bNum = num;  // Number of rounds in burst
-      bursts[nbt].bRate = rate;// Round rate for this burst (rds per sec)
-      bursts[nbt].bEvent = e;  // Release event number for burst
-      bursts[nbt].bStatus = Burst::ACTIVE;
+   // (the burst is dropped if we've used up our burst budget)
+   if (nbt < maxBursts && pos != 0 && vel != 0) {
+      bPosN[nbt] = (*pos)[0];   // Burst positions -- world  (m)
+      bPosE[nbt] = (*pos)[1];
+      bPosD[nbt] = (*pos)[2];
+      bVelN[nbt] = (*vel)[0];   // Burst velocities -- world (m)
+      bVelE[nbt] = (*vel)[1];
+      bVelD[nbt] = (*vel)[2];
+      bPrevN[nbt] = bPosN[nbt];
+      bPrevE[nbt] = bPosE[nbt];
+      bPrevD[nbt] = bPosD[nbt];
+      bTof[nbt] = 0;            // Burst time of flight      (sec)
+      bNum[nbt] = num;          // Number of rounds in burst
+      bRate[nbt] = rate;        // Round rate for this burst (rds per sec)
+      bEvent[nbt] = e;          // Release event number for burst
+      bStatus[nbt] = BURST_ACTIVE;
       nbt++;
    }
    return true;
@@ -194,88 +336,189 @@ void Bullet::updateBurstTrajectories(const LCreal dt)
 {
    static const LCreal g = ETHG * Basic::Distance::FT2M;      // Acceleration of Gravity (m/s/s)
 
-   // For all active bursts
-   for (int i = 0; i < nbt; i++) {
-      if (bursts[i].bStatus == Burst::ACTIVE) {
-         bursts[i].bVel[Player::IDOWN] = bursts[i].bVel[Player::IDOWN] + (g*dt);  // falling bullets
+   // The bursts that have hit a player are removed before the next frame, so
+   // all of the bursts are updated, without testing their status, using simple
+   // loops over the arrays that the compiler can vectorize.
+   const int n = nbt;
 
-         bursts[i].bPos = bursts[i].bPos + (bursts[i].bVel * dt);
-         bursts[i].bTof += dt;
+   // Save the start of the frame positions for the swept hit tests
+   for (int i = 0; i < n; i++) {
+      bPrevN[i] = bPosN[i];
+      bPrevE[i] = bPosE[i];
+      bPrevD[i] = bPosD[i];
+   }
+
+   // Drag
+   if (drag > 0) {
+      const LCreal kdt = drag * dt;
+      for (int i = 0; i < n; i++) {
+         const LCreal v = lcSqrt(bVelN[i]*bVelN[i] + bVelE[i]*bVelE[i] + bVelD[i]*bVelD[i]);
+         const LCreal s = 1.0f / (1.0f + kdt * v);     // (implicit; stable for large k*v*dt)
+         bVelN[i] *= s;
+         bVelE[i] *= s;
+         bVelD[i] *= s;
       }
    }
+
+   // Gravity (falling bullets) and the new positions
+   const LCreal gdt = g * dt;
+   for (int i = 0; i < n; i++) {
+      bVelD[i] += gdt;
+      bPosN[i] += bVelN[i] * dt;
+      bPosE[i] += bVelE[i] * dt;
+      bPosD[i] += bVelD[i] * dt;
+      bTof[i] += dt;
+   }
 }
 
 //------------------------------------------------------------------------------
-// checkForTargetHit() -- check to see if we hit anything
+// checkForTargetHit() -- check to see if we hit anything; the paths of the active
+// bursts are checked against the nearby players, and our target, by the
+// simulation's detonation effects processing (see detonationEffect())
+//
+// The bursts are split into hit check groups of consecutive bursts (which were
+// fired one after the other, so they're close together), and a check is queued
+// for each group.  A group's check covers the bounding sphere of its bursts'
+// paths plus the hit radius, which is kept within MAX_CHECK_RADIUS (unless a
+// single burst's path is longer), so that a long stream of bursts doesn't
+// inflate the simulation's detonation grid cells.
 //------------------------------------------------------------------------------
 bool Bullet::checkForTargetHit()
 {
-   Player* ownship = getLaunchVehicle();
-   Player* tgt = getTargetPlayer();
-   if (ownship != 0 && tgt != 0) {
-      osg::Vec3 osPos = tgt->getPosition();
-
-      // For all active bursts ...
-      for (int i = 0; i < nbt; i++) {
-         if (bursts[i].bStatus == Burst::ACTIVE) {
-
-            // Check if we're within range of the target
-            osg::Vec3 rPos = bursts[i].bPos - osPos;
-            LCreal rng = rPos.length();
-            if (rng < 10.0f) {
-               // Yes -- it's a hit!
-               bursts[i].bStatus = Burst::HIT;
-               setHitPlayer(tgt);
-               setLocationOfDetonation();
-               tgt->processDetonation(rng,this);
+   ngc = 0;
+   Simulation* sim = getSimulation();
+   if (sim != 0 && nbt > 0) {
+      LCreal radius = hitRadius;
+      if (LIFE_FORM_HIT_RADIUS > radius) radius = LIFE_FORM_HIT_RADIUS;
+
+      int i = 0;
+      while (i < nbt) {
+
+         // Start a group with burst 'i'
+         LCreal minN = (bPrevN[i] < bPosN[i] ? bPrevN[i] : bPosN[i]);
+         LCreal maxN = (bPrevN[i] < bPosN[i] ? bPosN[i] : bPrevN[i]);
+         LCreal minE = (bPrevE[i] < bPosE[i] ? bPrevE[i] : bPosE[i]);
+         LCreal maxE = (bPrevE[i] < bPosE[i] ? bPosE[i] : bPrevE[i]);
+         LCreal minD = (bPrevD[i] < bPosD[i] ? bPrevD[i] : bPosD[i]);
+         LCreal maxD = (bPrevD[i] < bPosD[i] ? bPosD[i] : bPrevD[i]);
+         int j = i + 1;
+
+         // Add the following bursts while the group's check stays within range
+         bool full = false;
+         while (j < nbt && !full) {
+            const LCreal minN1 = lcMin(minN, lcMin(bPrevN[j], bPosN[j]));
+            const LCreal maxN1 = lcMax(maxN, lcMax(bPrevN[j], bPosN[j]));
+            const LCreal minE1 = lcMin(minE, lcMin(bPrevE[j], bPosE[j]));
+            const LCreal maxE1 = lcMax(maxE, lcMax(bPrevE[j], bPosE[j]));
+            const LCreal minD1 = lcMin(minD, lcMin(bPrevD[j], bPosD[j]));
+            const LCreal maxD1 = lcMax(maxD, lcMax(bPrevD[j], bPosD[j]));
+            const osg::Vec3 halfSize( (maxN1 - minN1) / 2.0f, (maxE1 - minE1) / 2.0f, (maxD1 - minD1) / 2.0f );
+            if ( (halfSize.length() + radius) <= MAX_CHECK_RADIUS ) {
+               minN = minN1;
+               maxN = maxN1;
+               minE = minE1;
+               maxE = maxE1;
+               minD = minD1;
+               maxD = maxD1;
+               j++;
+            }
+            else {
+               full = true;
             }
-
          }
+
+         // Queue a check of the players within the group's bounding sphere
+         // (plus hit radius); our target is always checked.
+         const osg::Vec3 center( (minN + maxN) / 2.0f, (minE + maxE) / 2.0f, (minD + maxD) / 2.0f );
+         const osg::Vec3 halfSize( (maxN - minN) / 2.0f, (maxE - minE) / 2.0f, (maxD - minD) / 2.0f );
+         gcFirst[ngc] = i;
+         gcCenter[ngc] = center;
+         ngc++;
+         sim->queueDetonation(this, center, halfSize.length() + radius, getTargetPlayer(), true);
+
+         i = j;
       }
+      gcFirst[ngc] = nbt;
+   }
+   return false;
+}
+
+//------------------------------------------------------------------------------
+// sweptHit() -- returns true if burst 'i' passed within 'radius' of 'pos' during
+// the last frame (i.e., segment vs sphere test), and its closest range, 'rng'.
+// If 'horizontal' is true then only the horizontal range is tested.
+//------------------------------------------------------------------------------
+bool Bullet::sweptHit(const int i, const osg::Vec3& pos, const LCreal radius, const bool horizontal, LCreal* const rng) const
+{
+   // Segment from the previous position, p0, to the current position, p0 + d
+   osg::Vec3 d( bPosN[i] - bPrevN[i], bPosE[i] - bPrevE[i], bPosD[i] - bPrevD[i] );
+   osg::Vec3 w( pos[0] - bPrevN[i], pos[1] - bPrevE[i], pos[2] - bPrevD[i] );
+   if (horizontal) {
+      d[2] = 0;
+      w[2] = 0;
    }
-   // if we are just flying along, check our range to the nearest player and tell him we killed it
-   else {
-        //osg::Vec3 old = getEulerAngles();
-        osg::Vec3 myPos = getPosition();
-        osg::Vec3 tgtPos;
-        osg::Vec3 vecPos;
-        //LCreal az = 0;
-        //LCreal el = 0;
-        LCreal range = 0;
-        //LCreal diffAz = 0;
-        //LCreal diffEl = 0;
-        LCreal maxRange = 1; // close range of detonation
-        Simulation* sim = getSimulation();
-        if (sim != 0) {
-            Basic::PairStream* players = sim->getPlayers();
-            if (players != 0) {
-                Basic::List::Item* item = players->getFirstItem();
-                while (item != 0) {
-                    Basic::Pair* pair = static_cast<Basic::Pair*>(item->getValue());
-                    if (pair != 0) {
-                        Player* player = dynamic_cast<Player*>(pair->object());
-                        if (player != 0 && player != ownship && player->isMajorType(LIFE_FORM) && !player->isDestroyed()) {
-                            // ok, calculate our position from this guy
-                            tgtPos = player->getPosition();
-                            vecPos = tgtPos - myPos;
-                            //az = lcAtan2(vecPos.y(), vecPos.x());
-                            range = (vecPos.x() * vecPos.x() + vecPos.y() * vecPos.y());
-                            range = sqrt(range);
-                            if (range < maxRange) {
-                                // tell this target we hit it
-                                player->processDetonation(range, this);
-                            }
-                        }
-                    }
-                    item = item->getNext();
-                }
-                players->unref();
-                players = 0;
-            }
-        }
 
+   // Closest point on the segment to 'pos'
+   LCreal t = 0;
+   const LCreal dd = d * d;
+   if (dd > 0) {
+      t = (w * d) / dd;
+      if (t < 0) t = 0;
+      else if (t > 1.0f) t = 1.0f;
    }
-   return false;
+   const osg::Vec3 c = w - (d * t);
+   const LCreal r2 = c * c;
+
+   bool hit = (r2 <= (radius * radius));
+   if (hit && rng != 0) *rng = lcSqrt(r2);
+   return hit;
+}
+
+//------------------------------------------------------------------------------
+// detonationEffect() -- check the paths of the active bursts of the hit check
+// group at 'detPos' against player 'player'; called by the simulation's
+// detonation effects processing for each player that's near the group (see
+// checkForTargetHit()).  Each burst that passed within the player's hit sphere
+// is a hit.  Life forms have a one meter (horizontal) hit radius.  We don't hit
+// our launch vehicle or destroyed players.
+//------------------------------------------------------------------------------
+bool Bullet::detonationEffect(Player* const player, const osg::Vec3& detPos, const LCreal, const Player* const)
+{
+   bool hit = false;
+   if (player != 0 && player != getLaunchVehicle() && !player->isDestroyed()) {
+      const osg::Vec3 pos = player->getPosition();
+      const bool lifeForm = player->isMajorType(LIFE_FORM);
+      const LCreal radius = (lifeForm ? LIFE_FORM_HIT_RADIUS : hitRadius);
+
+      // The group's bursts (the check's position is the group's center; all
+      // of the bursts if it's not one of our groups)
+      int i0 = 0;
+      int i1 = nbt;
+      bool found = false;
+      for (int g = 0; g < ngc && !found; g++) {
+         if (gcCenter[g] == detPos) {
+            i0 = gcFirst[g];
+            i1 = gcFirst[g+1];
+            found = true;
+         }
+      }
+      if (i1 > nbt) i1 = nbt;
+
+      // For each of the group's active bursts ...
+      for (int i = i0; i < i1; i++) {
+         LCreal rng = 0;
+         if (bStatus[i] == BURST_ACTIVE && sweptHit(i, pos, radius, lifeForm, &rng)) {
+            // Yes -- it's a hit!
+            bStatus[i] = BURST_HIT;
+            nhits++;
+            setHitPlayer(player);
+            if (player == getTargetPlayer()) setLocationOfDetonation();
+            player->processDetonation(rng, this);
+            hit = true;
+         }
+      }
+   }
+   return hit;
 }
 
 //------------------------------------------------------------------------------
@@ -286,6 +529,101 @@ void Bullet::setHitPlayer(Player* p)
    hitPlayer = p;
 }
 
+//------------------------------------------------------------------------------
+// Set functions
+//------------------------------------------------------------------------------
+
+// Sets the burst budget; removes the current bursts
+bool Bullet::setMaxBursts(const int n)
+{
+   return allocateBursts(n);
+}
+
+// Sets the hit sphere radius (meters)
+bool Bullet::setHitRadius(const LCreal r)
+{
+   bool ok = false;
+   if (r > 0) {
+      hitRadius = r;
+      ok = true;
+   }
+   return ok;
+}
+
+// Sets the drag coefficient (1/meters)
+bool Bullet::setDrag(const LCreal k)
+{
+   bool ok = false;
+   if (k >= 0) {
+      drag = k;
+      ok = true;
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// Slot functions
+//------------------------------------------------------------------------------
+
+// Burst budget
+bool Bullet::setSlotMaxBursts(const Basic::Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      ok = setMaxBursts( msg->getInt() );
+      if (!ok && isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "Bullet::setSlotMaxBursts: invalid burst budget, must be greater than zero" << std::endl;
+      }
+   }
+   return ok;
+}
+
+// Hit sphere radius
+bool Bullet::setSlotHitRadius(const Basic::Distance* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      ok = setHitRadius( Basic::Meters::convertStatic(*msg) );
+      if (!ok && isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "Bullet::setSlotHitRadius: invalid hit radius, must be greater than zero" << std::endl;
+      }
+   }
+   return ok;
+}
+
+bool Bullet::setSlotHitRadius(const Basic::Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      ok = setHitRadius( msg->getReal() );
+      if (!ok && isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "Bullet::setSlotHitRadius: invalid hit radius, must be greater than zero" << std::endl;
+      }
+   }
+   return ok;
+}
+
+// Drag coefficient
+bool Bullet::setSlotDrag(const Basic::Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      ok = setDrag( msg->getReal() );
+      if (!ok && isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "Bullet::setSlotDrag: invalid drag coefficient, must be zero or greater" << std::endl;
+      }
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// getSlotByIndex()
+//------------------------------------------------------------------------------
+Basic::Object* Bullet::getSlotByIndex(const int si)
+{
+    return BaseClass::getSlotByIndex(si);
+}
+
 
 //==============================================================================
 // Class: Gun
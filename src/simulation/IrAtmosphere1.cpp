@@ -15,6 +15,8 @@
 #include "openeaagles/basic/Nav.h"
 #include "openeaagles/basic/units/Distances.h"
 
+#include <cmath>
+
 namespace Eaagles {
 namespace Simulation {
 
@@ -26,6 +28,8 @@ BEGIN_SLOTTABLE(IrAtmosphere1)
    "solarRadiationTable",      // The tables containing solar radiation tables
    "backgroundRadiationTable", // The background radiation table
    "transmissivityTable",      // The tables containing transmissivity data
+   "altitudeResolution",       // Lookup cache altitude resolution
+   "rangeResolution",          // Lookup cache range resolution
 END_SLOTTABLE(IrAtmosphere1)
 
 // slot map
@@ -33,6 +37,10 @@ BEGIN_SLOT_MAP(IrAtmosphere1)
    ON_SLOT(1,setSlotSolarRadiationTable,Basic::Table2)
    ON_SLOT(2,setSlotBackgroundRadiationTable,Basic::Table3)
    ON_SLOT(3,setSlotTransmissivityTable,Basic::Table4)
+   ON_SLOT(4,setSlotAltitudeResolution,Basic::Distance)
+   ON_SLOT(4,setSlotAltitudeResolution,Basic::Number)
+   ON_SLOT(5,setSlotRangeResolution,Basic::Distance)
+   ON_SLOT(5,setSlotRangeResolution,Basic::Number)
 END_SLOT_MAP()
 
 //------------------------------------------------------------------------------
@@ -45,14 +53,56 @@ IrAtmosphere1::IrAtmosphere1()
    solarRadiationTable = 0;
    backgroundRadiationTable = 0;
    transmissivityTable = 0;
+
+   initData();
+}
+
+void IrAtmosphere1::initData()
+{
+   nBands = 0;
+   bandCenter = 0;
+   bandLower = 0;
+   bandUpper = 0;
+   bandFraction = 0;
+
+   for (unsigned int i = 0; i < MAX_SEEKER_BANDS; i++) {
+      seekerLower[i] = 0;
+      seekerUpper[i] = 0;
+   }
+   seekerOverlap = 0;
+   nSeekers = 0;
+
+   altRes = 0;
+   rngRes = 0;
+   for (unsigned int i = 0; i < LOOKUP_CACHE_SIZE; i++) {
+      cacheKey[i][0] = 0;
+      cacheKey[i][1] = 0;
+      cacheKey[i][2] = 0;
+      cacheValid[i] = false;
+   }
+   cacheData = 0;
+
+   cacheLock = 0;
 }
 
 //------------------------------------------------------------------------------
 // copyData() -- copy this object's data
 //------------------------------------------------------------------------------
-void IrAtmosphere1::copyData(const IrAtmosphere1& org, const bool)
+void IrAtmosphere1::copyData(const IrAtmosphere1& org, const bool cc)
 {
    BaseClass::copyData(org);
+   if (cc) {
+      solarRadiationTable = 0;
+      backgroundRadiationTable = 0;
+      transmissivityTable = 0;
+      initData();
+   }
+
+   // The precomputed data and cache are rebuilt on demand
+   clearBands();
+
+   altRes = org.altRes;
+   rngRes = org.rngRes;
 }
 
 //------------------------------------------------------------------------------
@@ -74,6 +124,8 @@ void IrAtmosphere1::deleteData()
       transmissivityTable->unref();
       transmissivityTable = 0;
    }
+
+   clearBands();
 }
 
 //------------------------------------------------------------------------------
@@ -117,98 +169,329 @@ bool IrAtmosphere1::setSlotTransmissivityTable(const Basic::Table4* const tbl)
    return ok;
 }
 
+bool IrAtmosphere1::setSlotAltitudeResolution(const Basic::Distance* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      ok = setAltitudeResolution( Basic::Meters::convertStatic(*msg) );
+   }
+   return ok;
+}
+
+bool IrAtmosphere1::setSlotAltitudeResolution(const Basic::Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      ok = setAltitudeResolution( msg->getReal() );
+   }
+   return ok;
+}
+
+bool IrAtmosphere1::setSlotRangeResolution(const Basic::Distance* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      ok = setRangeResolution( Basic::Meters::convertStatic(*msg) );
+   }
+   return ok;
+}
+
+bool IrAtmosphere1::setSlotRangeResolution(const Basic::Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      ok = setRangeResolution( msg->getReal() );
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// Set functions
+//------------------------------------------------------------------------------
+
+bool IrAtmosphere1::setAltitudeResolution(const LCreal meters)
+{
+   bool ok = false;
+   if (meters >= 0) {
+      lcLock(cacheLock);
+      altRes = meters;
+      clearLookupCache();
+      lcUnlock(cacheLock);
+      ok = true;
+   }
+   else {
+      std::cerr << "IrAtmosphere1::setAltitudeResolution(): invalid resolution: " << meters << std::endl;
+   }
+   return ok;
+}
+
+bool IrAtmosphere1::setRangeResolution(const LCreal meters)
+{
+   bool ok = false;
+   if (meters >= 0) {
+      lcLock(cacheLock);
+      rngRes = meters;
+      clearLookupCache();
+      lcUnlock(cacheLock);
+      ok = true;
+   }
+   else {
+      std::cerr << "IrAtmosphere1::setRangeResolution(): invalid resolution: " << meters << std::endl;
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// prepareBands() -- computes (once) the band bounds, centers and fractions of
+// the total waveband, and allocates the seeker overlap and lookup cache data.
+// Returns false if there are no wave bands.
+//------------------------------------------------------------------------------
+bool IrAtmosphere1::prepareBands()
+{
+   const unsigned int n = getNumWaveBands();
+   if (nBands == n) return (n > 0);
+
+   lcLock(cacheLock);
+   if (nBands != n) {
+      clearBands();
+      if (n > 0) {
+         const LCreal* centerWavelengths = getWaveBandCenters();
+         const LCreal* widths = getWaveBandWidths();
+
+         LCreal* p = new LCreal[4 * n];
+         bandCenter = p;
+         bandLower = p + n;
+         bandUpper = p + 2 * n;
+         bandFraction = p + 3 * n;
+
+         // Total waveband covered by the atmosphere
+         const LCreal total = ((centerWavelengths[n - 1] + (widths[n - 1] / 2.0f))-(centerWavelengths[0] - (widths[0] / 2.0f)));
+
+         for (unsigned int i = 0; i < n; i++) {
+            bandLower[i] = centerWavelengths[i] - (widths[i] / 2.0f);
+            bandUpper[i] = bandLower[i] + widths[i];
+            bandCenter[i] = (bandUpper[i] + bandLower[i]) / 2;
+            bandFraction[i] = (bandUpper[i] - bandLower[i]) / total;
+         }
+
+         seekerOverlap = new LCreal[MAX_SEEKER_BANDS * n];
+         cacheData = new LCreal[LOOKUP_CACHE_SIZE * 3 * n];
+         nBands = n;
+      }
+   }
+   lcUnlock(cacheLock);
+
+   return (nBands > 0);
+}
+
+//------------------------------------------------------------------------------
+// clearBands() -- frees the precomputed band data and clears the caches
+//------------------------------------------------------------------------------
+void IrAtmosphere1::clearBands()
+{
+   nBands = 0;
+   if (bandCenter != 0) delete[] bandCenter;
+   bandCenter = 0;
+   bandLower = 0;
+   bandUpper = 0;
+   bandFraction = 0;
+
+   if (seekerOverlap != 0) delete[] seekerOverlap;
+   seekerOverlap = 0;
+   nSeekers = 0;
+
+   if (cacheData != 0) delete[] cacheData;
+   cacheData = 0;
+   clearLookupCache();
+}
+
+void IrAtmosphere1::clearLookupCache()
+{
+   for (unsigned int i = 0; i < LOOKUP_CACHE_SIZE; i++) {
+      cacheValid[i] = false;
+   }
+}
+
+//------------------------------------------------------------------------------
+// getSeekerOverlaps() -- returns the band-to-sensor overlap ratios for the
+// seeker's waveband; computed once per seeker waveband, or into 'scratch'
+// when our table of seeker wavebands is full.
+//------------------------------------------------------------------------------
+const LCreal* IrAtmosphere1::getSeekerOverlaps(const LCreal lowerSensorBound, const LCreal upperSensorBound, LCreal* const scratch)
+{
+   const LCreal* ovl = 0;
+
+   lcLock(cacheLock);
+   for (unsigned int j = 0; j < nSeekers && ovl == 0; j++) {
+      if (seekerLower[j] == lowerSensorBound && seekerUpper[j] == upperSensorBound) {
+         ovl = &seekerOverlap[j * nBands];
+      }
+   }
+
+   if (ovl == 0) {
+      LCreal* p = scratch;
+      if (nSeekers < MAX_SEEKER_BANDS) {
+         p = &seekerOverlap[nSeekers * nBands];
+         seekerLower[nSeekers] = lowerSensorBound;
+         seekerUpper[nSeekers] = upperSensorBound;
+      }
+
+      // Determine how much of each wave band overlaps the sensor limits
+      for (unsigned int i = 0; i < nBands; i++) {
+         const LCreal lowerOverlap = getLowerEndOfWavelengthOverlap(bandLower[i], lowerSensorBound);
+         LCreal upperOverlap = getUpperEndOfWavelengthOverlap(bandUpper[i], upperSensorBound);
+         if (upperOverlap < lowerOverlap) upperOverlap = lowerOverlap;
+         p[i] = (upperOverlap - lowerOverlap) / (bandUpper[i] - bandLower[i]);
+      }
+
+      if (p != scratch) nSeekers++;
+      ovl = p;
+   }
+   lcUnlock(cacheLock);
+
+   return ovl;
+}
+
+//------------------------------------------------------------------------------
+// lookupBands() -- table lookups, by band, of the background radiation, the
+// solar radiation and the transmissivity
+//------------------------------------------------------------------------------
+void IrAtmosphere1::lookupBands(
+         const LCreal seekerAltitude,
+         const LCreal targetAltitude,
+         const LCreal range,
+         const LCreal viewAngle,
+         LCreal* const bg,
+         LCreal* const solar,
+         LCreal* const trans
+      ) const
+{
+   const LCreal* centerWavelengths = getWaveBandCenters();
+   for (unsigned int i = 0; i < nBands; i++) {
+      bg[i] = getBackgroundRadiation(bandCenter[i], seekerAltitude, viewAngle);
+      solar[i] = getSolarRadiation(centerWavelengths[i], targetAltitude);
+      trans[i] = getTransmissivity(bandCenter[i], seekerAltitude, targetAltitude, range);
+   }
+}
+
 
 bool IrAtmosphere1::calculateAtmosphereContribution(IrQueryMsg* const msg, LCreal* totalSignal, LCreal* totalBackground)
 {
    // Sum the total signal that reaches the seeker of the target represented by the message
    // and the background noise observed by the seeker
 
-   const LCreal* centerWavelengths = getWaveBandCenters();
-   const LCreal* widths = getWaveBandWidths();
+   *totalSignal = 0.0;
+   *totalBackground = 0.0;
+
+   if (!prepareBands()) return true;
+   const unsigned int n = nBands;
+
    const LCreal* sigArray = msg->getSignatureByWaveband();
    Player* ownship = msg->getOwnship();
    Player* target = msg->getTarget();
-   
-   // FAB - this should be angle of gimbal, not angle to target. (see base class)
-   // Determine the angle above the horizon to be used for background radiation lookup
+
+   LCreal seekerAlt = static_cast<LCreal>(ownship->getAltitudeM());
+   LCreal targetAlt = static_cast<LCreal>(target->getAltitudeM());
    LCreal range2D = msg->getRange();
-   LCreal tanPhi = static_cast<LCreal>( (target->getAltitudeM() - ownship->getAltitudeM())/ range2D );
-   LCreal tanPhiPrime = tanPhi - ( range2D / 12756776.0f ); // Twice earth radius
-   
-   // appears that negative angles are down in this calculation
-   LCreal viewingAngle = lcAtan(tanPhiPrime);
-   
-   // table limits are 0 to pi; this correction assumes that 0 in the table is straight down, PI is straight up
-   viewingAngle += PI/2.0;
-   
-   *totalSignal = 0.0;
-   *totalBackground = 0.0;
 
-   for (unsigned int i=0; i<getNumWaveBands(); i++) {
-      LCreal radiantIntensityInBin;
-      LCreal lowerBandBound = centerWavelengths[i] - (widths[i] / 2.0f);
-      LCreal upperBandBound = lowerBandBound + widths[i];
-      
-      // determine ratio of this band's coverage to entire atmosphere waveband
-      LCreal fractionOfBandToTotal = (upperBandBound - lowerBandBound) / ((centerWavelengths[getNumWaveBands() - 1] + (widths[getNumWaveBands() - 1] / 2.0f))-(centerWavelengths[0] - (widths[0] / 2.0f)));
-      
-      // Find the limits of the sensor
-      LCreal lowerSensorBound = msg->getLowerWavelength();
-      LCreal upperSensorBound = msg->getUpperWavelength();
-      
-      // Determine how much of this wave band overlaps the sensor limits
-      LCreal lowerOverlap = getLowerEndOfWavelengthOverlap(
-                                                   lowerBandBound,
-                                                   lowerSensorBound);
-      LCreal upperOverlap = getUpperEndOfWavelengthOverlap(
-                                                   upperBandBound,
-                                                   upperSensorBound);
-      
-      if (upperOverlap < lowerOverlap) upperOverlap = lowerOverlap;
-      
-      LCreal overlapRatio = (upperOverlap - lowerOverlap) / (upperBandBound - lowerBandBound);
-      
-      // Get the background radiation given the sensor altitude and the viewing angle
-      LCreal backgroundRadianceInBand = overlapRatio * getBackgroundRadiation(
-                                                lowerBandBound,   
-                                                upperBandBound,
-                                                static_cast<LCreal>(ownship->getAltitudeM()),
-                                                viewingAngle);
-      if (sigArray == 0) {
-         // signature is a simple number
-         // distribute simple signature evenly across atmosphere bins
-         // need to apply overlapRatio to simple signature - already applied for complex signature in IrSignature...
-         radiantIntensityInBin = msg->getSignatureAtRange() * fractionOfBandToTotal * overlapRatio;
+   // Quantize the cache key (and our lookups) to the cache's resolutions
+   const bool useCache = (altRes > 0 && rngRes > 0);
+   int key[3] = { 0, 0, 0 };
+   if (useCache) {
+      key[0] = static_cast<int>(std::floor(seekerAlt / altRes + 0.5f));
+      key[1] = static_cast<int>(std::floor(targetAlt / altRes + 0.5f));
+      key[2] = static_cast<int>(std::floor(range2D / rngRes + 0.5f));
+      seekerAlt = key[0] * altRes;
+      targetAlt = key[1] * altRes;
+      if (key[2] > 0) range2D = key[2] * rngRes;
+   }
+
+   // Scratch: overlaps, background, solar and transmissivity by band
+   static const unsigned int MAX_STACK_BANDS = 64;
+   LCreal stackBuff[4 * MAX_STACK_BANDS];
+   LCreal* buff = stackBuff;
+   if (n > MAX_STACK_BANDS) buff = new LCreal[4 * n];
+   LCreal* const bg = buff + n;
+   LCreal* const solar = buff + 2 * n;
+   LCreal* const trans = buff + 3 * n;
+
+   // Band-to-sensor overlap ratios (fixed for each seeker waveband)
+   const LCreal* const ovl = getSeekerOverlaps(msg->getLowerWavelength(), msg->getUpperWavelength(), buff);
+
+   // Lookup cache
+   const unsigned int slot = ( (static_cast<unsigned int>(key[0]) * 73856093u) ^
+                               (static_cast<unsigned int>(key[1]) * 19349663u) ^
+                               (static_cast<unsigned int>(key[2]) * 83492791u) ) & (LOOKUP_CACHE_SIZE - 1);
+   bool hit = false;
+   if (useCache) {
+      lcLock(cacheLock);
+      if (cacheValid[slot] && cacheKey[slot][0] == key[0] && cacheKey[slot][1] == key[1] && cacheKey[slot][2] == key[2]) {
+         const LCreal* p = &cacheData[slot * 3 * n];
+         for (unsigned int i = 0; i < 3 * n; i++) {
+            bg[i] = p[i];
+         }
+         hit = true;
       }
-      else {
-         // Find the limits of the bin
-         //lowerBandBound = sigArray [i*3];
-         //upperBandBound = sigArray [i*3 + 1] ;
-         // assuming that signature bands match atmosphere bands
-         radiantIntensityInBin = sigArray[i*3 + 2];
+      lcUnlock(cacheLock);
+   }
+
+   if (!hit) {
+      // FAB - this should be angle of gimbal, not angle to target. (see base class)
+      // Determine the angle above the horizon to be used for background radiation lookup
+      LCreal tanPhi = static_cast<LCreal>( (targetAlt - seekerAlt)/ range2D );
+      LCreal tanPhiPrime = tanPhi - ( range2D / 12756776.0f ); // Twice earth radius
+
+      // appears that negative angles are down in this calculation
+      LCreal viewingAngle = lcAtan(tanPhiPrime);
+
+      // table limits are 0 to pi; this correction assumes that 0 in the table is straight down, PI is straight up
+      viewingAngle += PI/2.0;
+
+      lookupBands(seekerAlt, targetAlt, range2D, viewingAngle, bg, solar, trans);
+
+      if (useCache) {
+         lcLock(cacheLock);
+         LCreal* p = &cacheData[slot * 3 * n];
+         for (unsigned int i = 0; i < 3 * n; i++) {
+            p[i] = bg[i];
+         }
+         cacheKey[slot][0] = key[0];
+         cacheKey[slot][1] = key[1];
+         cacheKey[slot][2] = key[2];
+         cacheValid[slot] = true;
+         lcUnlock(cacheLock);
       }
-      
-      // add in reflected solar radiation
-      LCreal solarRadiationInBin = ((1.0f - msg->getEmissivity()) * getSolarRadiation(centerWavelengths[i],
-                                    static_cast<LCreal>(target->getAltitudeM())));
-      radiantIntensityInBin += (solarRadiationInBin * overlapRatio);
-      
-      // Lookup the transmissivity in the wave band given the altitudes of sensor
-      // and target and the ground range between the two
-      LCreal transmissivity = getTransmissivity(
-                                                lowerBandBound,
-                                                upperBandBound,
-                                                static_cast<LCreal>(ownship->getAltitudeM()),
-                                                static_cast<LCreal>(target->getAltitudeM()),
-                                                range2D);
-
-      *totalSignal += radiantIntensityInBin * transmissivity;
-      
-      // Add the background radiance from the this waveband within the sensor limits
-      // to the total background radiance received by the sensor, watts/sr-m^2
-      *totalBackground += backgroundRadianceInBand * transmissivity;
    }
 
+   // Sum the signal and background over the bands
+   const LCreal reflectivity = (1.0f - msg->getEmissivity());
+   LCreal signal = 0.0;
+   LCreal background = 0.0;
+   if (sigArray == 0) {
+      // signature is a simple number
+      // distribute simple signature evenly across atmosphere bins
+      // need to apply overlapRatio to simple signature - already applied for complex signature in IrSignature...
+      const LCreal sigAtRange = msg->getSignatureAtRange();
+      for (unsigned int i = 0; i < n; i++) {
+         signal += (sigAtRange * bandFraction[i] * ovl[i] + (reflectivity * solar[i]) * ovl[i]) * trans[i];
+      }
+   }
+   else {
+      // assuming that signature bands match atmosphere bands
+      for (unsigned int i = 0; i < n; i++) {
+         signal += (sigArray[i*3 + 2] + (reflectivity * solar[i]) * ovl[i]) * trans[i];
+      }
+   }
+   for (unsigned int i = 0; i < n; i++) {
+      // Background radiance from this waveband within the sensor limits, watts/sr-m^2
+      background += (ovl[i] * bg[i]) * trans[i];
+   }
+
+   *totalSignal = signal;
+   *totalBackground = background;
+
+   if (buff != stackBuff) delete[] buff;
+
    return true;
 }
 
@@ -21,6 +21,11 @@ IrQueryMsg::IrQueryMsg()
 {
     STANDARD_CONSTRUCTOR()
 
+    initData();
+}
+
+void IrQueryMsg::initData()
+{
    lowerWavelength = 0.0f;
    upperWavelength = 0.0f;
    instantaneousFieldOfView = 0.0f;
@@ -127,7 +132,7 @@ void IrQueryMsg::setSendingSensor(IrSensor* const newSensor)
 }
 
 //------------------------------------------------------------------------------
-// Sets the range to the target
+// clear() -- clears out the message (i.e., returns it to its constructed state)
 //------------------------------------------------------------------------------
 void IrQueryMsg::clear()
 {
@@ -135,6 +140,7 @@ void IrQueryMsg::clear()
    setSendingSensor(0);
 
    BaseClass::clear();
+   initData();
 }
 
 } // End Simulation namespace
@@ -46,16 +46,12 @@ END_EVENT_HANDLER()
 //------------------------------------------------------------------------------
 // Constructor(s)
 //------------------------------------------------------------------------------
-IrSeeker::IrSeeker() : 
-               freeQueryStack(MAX_QUERIES), freeQueryLock(0),
-               inUseQueryQueue(MAX_QUERIES), inUseQueryLock(0)
+IrSeeker::IrSeeker() : queryPool(MAX_QUERIES)
 {
    STANDARD_CONSTRUCTOR()
 }
 
-IrSeeker::IrSeeker(const IrSeeker& org) : 
-               freeQueryStack(MAX_QUERIES), freeQueryLock(0),
-               inUseQueryQueue(MAX_QUERIES), inUseQueryLock(0)
+IrSeeker::IrSeeker(const IrSeeker& org) : queryPool(MAX_QUERIES)
 { 
    STANDARD_CONSTRUCTOR()
    copyData(org,true);
@@ -131,55 +127,18 @@ void IrSeeker::process(const LCreal dt)
    BaseClass::process(dt);
 
    // ---
-   // Update IR query queues: from 'in-use' to 'free' 
+   // Update IR query pool: from 'in-use' to 'free' 
    // ---
-   lcLock(inUseQueryLock);
-   int n = inUseQueryQueue.entries();
-   for (int i = 0; i < n; i++) {
-      IrQueryMsg* query = inUseQueryQueue.get();
-      if (query != 0) {
-         if (query->getRefCount() <= 1) {
-            // No one else is referencing the query, push on free stack
-            query->clear();
-            lcLock(freeQueryLock);
-            if (freeQueryStack.isNotFull()) {
-               freeQueryStack.push(query);
-            }
-            else {
-               query->unref();
-            }
-            lcUnlock(freeQueryLock);
-         }
-         else {
-            // Others are still referencing the query, put back on in-use queue
-            inUseQueryQueue.put(query);
-         }
-      }
-   }
-   lcUnlock(inUseQueryLock);
+   queryPool.recycle();
 }
 
 
 //------------------------------------------------------------------------------
-// clearQueues() -- clear out all queues
+// clearQueues() -- clear out all queues (and the query pool)
 //------------------------------------------------------------------------------
 void IrSeeker::clearQueues()
 {
-   lcLock(freeQueryLock);
-   IrQueryMsg* query = freeQueryStack.pop();
-   while (query != 0) {
-      query->unref();
-      query = freeQueryStack.pop();
-   }
-   lcUnlock(freeQueryLock);
-
-   lcLock(inUseQueryLock);
-   query = inUseQueryQueue.get();
-   while (query != 0) {
-      query->unref();
-      query = inUseQueryQueue.get();
-   }
-   lcUnlock(inUseQueryLock);
+   queryPool.clear();
 }
 
 //------------------------------------------------------------------------------
@@ -235,21 +194,9 @@ void IrSeeker::irRequestSignature(IrQueryMsg* const irQuery)
             continue;
 
          // Get a free query packet
-         lcLock(freeQueryLock);
-         IrQueryMsg* query = freeQueryStack.pop();
-         lcUnlock(freeQueryLock);
-
+         IrQueryMsg* query = queryPool.get();
          if (query == 0) { 
             query = new IrQueryMsg();
-            //if (ownship->getID() != 1) {
-            //    static tcnt = 0;
-            //    tcnt++;
-
-            //if (isMessageEnabled(MSG_INFO)) {
-            //    std::cout << "new IrQueryMsg(" << this << "): " << tcnt << ", inused: " << inUseEmQueue.entries() << ", em = " << em << std::endl;
-            //}
-
-            //}
          }
 
          // Send the IR query message to the other player
@@ -275,31 +222,8 @@ void IrSeeker::irRequestSignature(IrQueryMsg* const irQuery)
             // c) Send the query to the target
             targets[i]->event(IR_QUERY, query);
 
-            // d) Dispose of the query
-            if (query->getRefCount() <= 1) {
-               // Recycle the query packet
-               query->clear();
-               lcLock(freeQueryLock);
-               if (freeQueryStack.isNotFull()) {
-                  freeQueryStack.push(query);
-               }
-               else {
-                  query->unref();
-               }
-               lcUnlock(freeQueryLock);
-            }
-            else {
-               // Store for future reference
-               lcLock(inUseQueryLock);
-               if (inUseQueryQueue.isNotFull()) {
-                  inUseQueryQueue.put(query);
-               }
-               else {
-                  // Just forget it
-                  query->unref();
-               }
-               lcUnlock(inUseQueryLock);
-            }
+            // d) Recycle the query packet (the pool takes our reference)
+            queryPool.release(query);
          }
          else {
             // When we couldn't get a free query packet
@@ -66,7 +66,8 @@ END_SLOT_MAP()
 //------------------------------------------------------------------------------
 // Constructors, destructor, copy operator and clone()
 //------------------------------------------------------------------------------
-IrSensor::IrSensor() : storedMessagesQueue(MAX_EMISSIONS), storedMessagesLock(0), tmName(0), trackManager(0)
+IrSensor::IrSensor() : storedMessagesQueue(MAX_EMISSIONS), storedMessagesLock(0), queryPool(MAX_EMISSIONS),
+                       tmName(0), trackManager(0)
 {
    STANDARD_CONSTRUCTOR()
 
@@ -90,7 +91,8 @@ IrSensor::~IrSensor()
    STANDARD_DESTRUCTOR()
 }
 
-IrSensor::IrSensor(const IrSensor& org) : storedMessagesQueue(MAX_EMISSIONS), storedMessagesLock(0)
+IrSensor::IrSensor(const IrSensor& org) : storedMessagesQueue(MAX_EMISSIONS), storedMessagesLock(0),
+                                          queryPool(MAX_EMISSIONS)
 {
     STANDARD_CONSTRUCTOR()
     copyData(org,true);
@@ -233,7 +235,8 @@ void IrSensor::transmit(const LCreal dt)
    IrSeeker* seeker = dynamic_cast<IrSeeker*>( getSeeker() );
    if (seeker != 0 && isQuerying()) {
       // Send the emission to the other player
-      IrQueryMsg* irQuery = new IrQueryMsg();
+      IrQueryMsg* irQuery = queryPool.get();
+      if (irQuery == 0) irQuery = new IrQueryMsg();
       if (irQuery != 0) {
          irQuery->setLowerWavelength(getLowerWavelength());
          irQuery->setUpperWavelength(getUpperWavelength());
@@ -242,7 +245,7 @@ void IrSensor::transmit(const LCreal dt)
          irQuery->setNEI(getNEI());
          irQuery->setMaxRangeNM(getMaximumRange()* Basic::Distance::M2NM);
          seeker->irRequestSignature(irQuery);
-         irQuery->unref();
+         queryPool.release(irQuery);
       } // If irQuery not null
       else {
             if (isMessageEnabled(MSG_ERROR)) {
@@ -341,7 +344,12 @@ bool IrSensor::calculateIrQueryReturn(IrQueryMsg* const msg)
 
       // allow all signals to be returned; threshold test will be applied in process()
       {
-         IrQueryMsg* outMsg = new IrQueryMsg(); 
+         // (the stored messages queue and our query pool each hold a reference)
+         IrQueryMsg* outMsg = queryPool.get();
+         if (outMsg == 0) outMsg = new IrQueryMsg();
+         outMsg->ref();
+         queryPool.release(outMsg);
+
          outMsg->setTarget(msg->getTarget()); 
          outMsg->setGimbalAzimuth( LCreal(msg->getGimbal()->getAzimuth()) );
          outMsg->setGimbalElevation( LCreal(msg->getGimbal()->getElevation()) );
@@ -429,6 +437,9 @@ void IrSensor::process(const LCreal dt)
          lcUnlock(storedMessagesLock);
       }
    }
+
+   // Recycle the IR query messages that are no longer referenced
+   queryPool.recycle();
 }
 
 
@@ -833,6 +844,8 @@ void IrSensor::clearTracksAndQueues()
       msg->unref();
    }
    lcUnlock(storedMessagesLock);
+
+   queryPool.clear();
 }
 
 }
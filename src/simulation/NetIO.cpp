@@ -138,6 +138,11 @@ NetIO::NetIO()
 
    inputNtmTree = 0;
    outputNtmTree = 0;
+
+   outputNtmTable = 0;
+   outputNtmTableSize = 0;
+   nOutputNtmTable = 0;
+   outputNtmLock = 0;
 }
 
 
@@ -165,6 +170,10 @@ void NetIO::copyData(const NetIO& org, const bool cc)
       }
       nOutputEntityTypes = 0;
 
+      outputNtmTable = 0;
+      outputNtmTableSize = 0;
+      nOutputNtmTable = 0;
+      outputNtmLock = 0;
    }
 
    station = 0;
@@ -606,6 +615,24 @@ void NetIO::updateOutputList()
 //------------------------------------------------------------------------------
 void NetIO::processOutputList()
 {
+   // ---
+   // Dead reckon the local players' NIBs, as one batch, to the DR times
+   // of their DR error checks (see Nib::isPlayerStateUpdateRequired())
+   // ---
+   outDrBatch.clear();
+   for (unsigned int idx = 0; idx < getOutputListSize(); idx++) {
+      Nib* nib = getOutputNib(idx);
+      const Player* player = nib->getPlayer();
+      if (nib->isEntityTypeValid() && player != 0 && player->isLocalPlayer() && nib->isNotFrozen()) {
+         SynchronizedState playerState = player->getSynchronizedState();
+         LCreal drTime = static_cast<LCreal>(playerState.getTimeExec()) - nib->getTimeExec();
+         outDrBatch.add(nib, drTime);
+      }
+   }
+   outDrBatch.sort();
+   outDrBatch.compute();
+   outDrBatch.clear();
+
    // ---
    // Send player states
    // ---
@@ -986,11 +1013,116 @@ const Ntm* NetIO::findNetworkTypeMapper(const Player* const p) const
 {
    const Ntm* result = 0;
    if (outputNtmTree != 0 && p != 0) {
-      result = outputNtmTree->findNetworkTypeMapper(p);
+      const Basic::String* const pType = p->getType();
+      if (pType != 0) {
+         // The tree's result depends only on the player's class and type
+         // string, so check the quick lookup table first ...
+         const std::type_info* const cls = &typeid(*p);
+         const char* type = pType->getString();
+         if (type == 0) type = "";
+         const unsigned int h = hashNtmKey(cls, type);
+
+         bool found = false;
+         lcLock(outputNtmLock);
+         const NtmOutputEntry* const entry = lookupOutputNtmTable(cls, type, h);
+         if (entry != 0) {
+            result = entry->ntm;
+            found = true;
+         }
+         lcUnlock(outputNtmLock);
+
+         // ... and on a miss, search the tree and add its result to the table
+         if (!found) {
+            result = outputNtmTree->findNetworkTypeMapper(p);
+            lcLock(outputNtmLock);
+            insertOutputNtmTable(cls, type, h, result);
+            lcUnlock(outputNtmLock);
+         }
+      }
+      else {
+         result = outputNtmTree->findNetworkTypeMapper(p);
+      }
    }
    return result;
 }
 
+// Hash of an output NTM quick lookup table key
+unsigned int NetIO::hashNtmKey(const std::type_info* const cls, const char* const type)
+{
+   const size_t c = reinterpret_cast<size_t>(cls);
+   return ( lcStrhash(type) ^ static_cast<unsigned int>(c ^ (c >> 16)) );
+}
+
+// Finds the output NTM quick lookup table entry (table is locked)
+const NetIO::NtmOutputEntry* NetIO::lookupOutputNtmTable(const std::type_info* const cls, const char* const type, const unsigned int h) const
+{
+   if (outputNtmTable == 0) return 0;
+
+   unsigned int k = (h & (outputNtmTableSize - 1));
+   while (outputNtmTable[k].cls != 0) {
+      const NtmOutputEntry& e = outputNtmTable[k];
+      if (e.hash == h && e.cls == cls && strcmp(e.type, type) == 0) return &e;
+      k = ((k + 1) & (outputNtmTableSize - 1));
+   }
+   return 0;
+}
+
+// Adds the tree's result to the output NTM quick lookup table (table is locked)
+void NetIO::insertOutputNtmTable(const std::type_info* const cls, const char* const type, const unsigned int h, const Ntm* const ntm) const
+{
+   // Already added by another thread, or the table is full (the tree is still used)
+   if (lookupOutputNtmTable(cls, type, h) != 0 || nOutputNtmTable >= MAX_NTM_TABLE_ENTRIES) return;
+
+   // Grow the table to keep it less than half full
+   if ( (nOutputNtmTable + 1) * 2 > outputNtmTableSize ) {
+      const unsigned int newSize = (outputNtmTableSize > 0 ? outputNtmTableSize * 2 : 64);
+      NtmOutputEntry* newTable = new NtmOutputEntry[newSize];
+      for (unsigned int i = 0; i < newSize; i++) {
+         newTable[i].cls = 0;
+         newTable[i].type = 0;
+         newTable[i].hash = 0;
+         newTable[i].ntm = 0;
+      }
+      for (unsigned int i = 0; i < outputNtmTableSize; i++) {
+         if (outputNtmTable[i].cls != 0) {
+            unsigned int k = (outputNtmTable[i].hash & (newSize - 1));
+            while (newTable[k].cls != 0) k = ((k + 1) & (newSize - 1));
+            newTable[k] = outputNtmTable[i];
+         }
+      }
+      if (outputNtmTable != 0) delete[] outputNtmTable;
+      outputNtmTable = newTable;
+      outputNtmTableSize = newSize;
+   }
+
+   unsigned int k = (h & (outputNtmTableSize - 1));
+   while (outputNtmTable[k].cls != 0) k = ((k + 1) & (outputNtmTableSize - 1));
+
+   const size_t len = strlen(type) + 1;
+   outputNtmTable[k].type = new char[len];
+   lcStrcpy(outputNtmTable[k].type, len, type);
+   outputNtmTable[k].cls = cls;
+   outputNtmTable[k].hash = h;
+   outputNtmTable[k].ntm = ntm;
+   nOutputNtmTable++;
+}
+
+// Clears the output NTM quick lookup table
+void NetIO::clearOutputNtmTable()
+{
+   lcLock(outputNtmLock);
+   if (outputNtmTable != 0) {
+      for (unsigned int i = 0; i < outputNtmTableSize; i++) {
+         if (outputNtmTable[i].type != 0) delete[] outputNtmTable[i].type;
+      }
+      delete[] outputNtmTable;
+      outputNtmTable = 0;
+   }
+   outputNtmTableSize = 0;
+   nOutputNtmTable = 0;
+   lcUnlock(outputNtmLock);
+}
+
 // Adds an item to the input entity type table
 bool NetIO::addInputEntityType(Ntm* const ntm)
 {
@@ -1025,6 +1157,9 @@ bool NetIO::addOutputEntityType(Ntm* const ntm)
       outputEntityTypes[nOutputEntityTypes] = ntm;
       nOutputEntityTypes++;
 
+      // The tree's results may change
+      clearOutputNtmTable();
+
       // Make sure we have a root node ...
       if (outputNtmTree == 0) {
          outputNtmTree = rootNtmOutputNodeFactory();
@@ -1061,11 +1196,12 @@ bool NetIO::clearInputEntityTypes()
 // Clears the output entity type table
 bool NetIO::clearOutputEntityTypes()
 {
-   // Unref() the root node of the quick look tree
+   // Unref() the root node of the quick look tree, and clear its table
    if (outputNtmTree != 0) {
       outputNtmTree->unref();
       outputNtmTree = 0 ;
    }
+   clearOutputNtmTable();
 
    // Clear our old output entity type table --
    while (nOutputEntityTypes > 0) {
@@ -1114,15 +1250,17 @@ unsigned int NetIO::getNumOutputEntityTypes() const
 }
 
 // Test rig: quick lookup of incoming entity types
-void NetIO::testInputEntityTypes(const unsigned int)
+unsigned int NetIO::testInputEntityTypes(const unsigned int)
 {
    // Handled by derived classes
+   return 0;
 }
 
 // Test rig: quick lookup of outgoing entity types
-void NetIO::testOutputEntityTypes(const unsigned int)
+unsigned int NetIO::testOutputEntityTypes(const unsigned int)
 {
    // Handled by derived classes
+   return 0;
 }
 
 //------------------------------------------------------------------------------
@@ -72,6 +72,13 @@ void Nib::initData()
    smoothVel.set(0,0,0);
    smoothTime = 0;
 
+   drResetCnt = 0;
+   drBatchPos.set(0,0,0);
+   drBatchAngles.set(0,0,0);
+   drBatchTime = 0;
+   drBatchResetCnt = 0;
+   drBatchValid = false;
+
    apartWingSweepCnt = 0;
    apartGearPosCnt = 0;
    apartBayDoorCnt = 0;
@@ -140,6 +147,10 @@ void Nib::copyData(const Nib& org, const bool cc)
    smoothVel = org.smoothVel;
    smoothTime = org.smoothTime;
 
+   // The batched DR results are not copied
+   drResetCnt = org.drResetCnt;
+   drBatchValid = false;
+
    apartWingSweepCnt = org.apartWingSweepCnt;
    apartGearPosCnt = org.apartGearPosCnt;
    apartBayDoorCnt = org.apartBayDoorCnt;
@@ -467,7 +478,9 @@ bool Nib::isPlayerStateUpdateRequired(const LCreal curExecTime)
          // based on our last packet sent.
          osg::Vec3d drPos;
          osg::Vec3d drAngles;
-         mainDeadReckoning(drTime, &drPos, &drAngles);
+         if (!getBatchDeadReckoning(drTime, &drPos, &drAngles)) {
+            mainDeadReckoning(drTime, &drPos, &drAngles);
+         }
 
          // 3-d-1) Position error
          if (!player->isPositionFrozen() && !player->isAltitudeFrozen()) {
@@ -758,8 +771,10 @@ bool Nib::updateDeadReckoning(
    if (ok) {
       double time = updateDrTime(dt);
 
-      // Main Dead Reckoning Function
-      mainDeadReckoning( time, &drPos, &drAngles );
+      // Main Dead Reckoning Function (unless our DR was computed by a batch)
+      if (!getBatchDeadReckoning( time, &drPos, &drAngles )) {
+         mainDeadReckoning( time, &drPos, &drAngles );
+      }
       //std::cout << "updateDeadReckoning(): geoc pos(";
       //std::cout << drPos[0] << ", ";
       //std::cout << drPos[1] << ", ";
@@ -836,6 +851,9 @@ bool Nib::resetDeadReckoning(
    drNum = dr;
    drTime = time;
 
+   // Any batched DR results are now out of date
+   drResetCnt++;
+
    //if (ioType == NetIO::INPUT_NIB) {
       //std::cout << "resetDeadReckoning(): drTime = " << drTimeN1 << std::endl;
       //std::cout << "drPos(";
@@ -863,6 +881,24 @@ bool Nib::resetDeadReckoning(
    return true;
 }
 
+//------------------------------------------------------------------------------
+// getBatchDeadReckoning() -- gets (and uses up) the batched DR results
+//------------------------------------------------------------------------------
+bool Nib::getBatchDeadReckoning(
+      const double dT,           // DR time (seconds)
+      osg::Vec3d* const pNewP0,  // DR Position vector @ time = 'dT' (meters) (ECEF)
+      osg::Vec3d* const pNewRPY  // DR Euler angles @ time = 'dT' (rad) [ phi theta psi ] (Body/ECEF)
+   )
+{
+   bool ok = drBatchValid && (drBatchTime == dT) && (drBatchResetCnt == drResetCnt);
+   if (ok) {
+      *pNewP0 = drBatchPos;
+      *pNewRPY = drBatchAngles;
+   }
+   drBatchValid = false;
+   return ok;
+}
+
 //------------------------------------------------------------------------------
 // Main Dead Reckoning Function
 //------------------------------------------------------------------------------
@@ -883,10 +919,7 @@ bool Nib::mainDeadReckoning(
 
       // World, 1st order rotation, 1st order linear
       case RPW_DRM: {
-         osg::Matrixd DR;
-         drComputeMatrixDR(dT, drAV0, drWwT, drOmega, &DR);
-         osg::Matrixd Rwb = DR * drR0;
-         Basic::Nav::computeEulerAngles(Rwb, pNewRPY);
+         drComputeWorldAngles(dT, pNewRPY);
 
          *pNewP0 = drP0 + drV0*dT;
       }
@@ -894,10 +927,7 @@ bool Nib::mainDeadReckoning(
 
       // World, 1st order rotation, 2nd order linear
       case RVW_DRM: {
-         osg::Matrixd DR;
-         drComputeMatrixDR(dT, drAV0, drWwT, drOmega, &DR);
-         osg::Matrixd Rwb = DR * drR0;
-         Basic::Nav::computeEulerAngles(Rwb, pNewRPY);
+         drComputeWorldAngles(dT, pNewRPY);
 
          *pNewP0 = drP0 + drV0*dT + drA0*(0.5*dT*dT);
       }
@@ -988,6 +1018,21 @@ bool Nib::mainDeadReckoning(
    return true;
 }
 
+//------------------------------------------------------------------------------
+// drComputeWorldAngles() -- DR Euler angles of the world, 1st order rotation,
+// algorithms (RPW and RVW)
+//------------------------------------------------------------------------------
+void Nib::drComputeWorldAngles(
+      const double dT,           // DR time (seconds)
+      osg::Vec3d* const pNewRPY  // DR Euler angles @ time = 'dT' (rad) [ phi theta psi ] (Body/ECEF)
+   ) const
+{
+   osg::Matrixd DR;
+   drComputeMatrixDR(dT, drAV0, drWwT, drOmega, &DR);
+   osg::Matrixd Rwb = DR * drR0;
+   Basic::Nav::computeEulerAngles(Rwb, pNewRPY);
+}
+
 //------------------------------------------------------------------------------
 // drComputeMatrixR0
 //------------------------------------------------------------------------------
@@ -6,6 +6,7 @@
 #include "openeaagles/simulation/Weapon.h"
 
 #include "openeaagles/basic/Identifier.h"
+#include "openeaagles/basic/List.h"
 #include "openeaagles/basic/Pair.h"
 #include "openeaagles/basic/PairStream.h"
 #include "openeaagles/basic/Number.h"
@@ -13,6 +14,7 @@
 #include "openeaagles/basic/osg/Vec3"
 #include "openeaagles/basic/units/Distances.h"
 #include <cstring>
+#include <algorithm>
 
 namespace Eaagles {
 namespace Simulation {
@@ -30,6 +32,8 @@ BEGIN_SLOTTABLE(Otw)
     "latitude",         // 4: Visual reference latitude (deg)
     "longitude",        // 5: Visual reference longitude (deg)
     "otwModelTypes",    // 6: OTW system's model type IDs (PairStream of Otm objects)
+    "modelHysteresis",  // 7: Model add/drop hysteresis ratio [ 0 .. 1 ]
+    "lodRanges",        // 8: List of LOD tier ranges (meters)
 END_SLOTTABLE(Otw)
 
 // Map slot table to handles
@@ -41,6 +45,8 @@ BEGIN_SLOT_MAP(Otw)
     ON_SLOT(4, setSlotRefLatitude,   Basic::Number)
     ON_SLOT(5, setSlotRefLongitude,  Basic::Number)
     ON_SLOT(6, setSlotOtwModelTypes, Basic::PairStream)
+    ON_SLOT(7, setSlotModelHysteresis, Basic::Number)
+    ON_SLOT(8, setSlotLodRanges,     Basic::List)
 END_SLOT_MAP()
 
 //------------------------------------------------------------------------------
@@ -63,11 +69,22 @@ Otw::Otw()
     maxModels = 0;               // Default: no models
     maxElevations = 0;           // Default: no elevation requests
 
+    modelHyst = 0.1f;            // Default: 10% add/drop hysteresis
+    for (unsigned int i = 0; i < MAX_LOD_RANGES; i++) {
+        lodRanges[i] = 0;
+    }
+    nLodRanges = 0;
+
     // Clear the tables
     for (unsigned int i = 0; i < MAX_MODELS; i++) {
         modelTbl[i] = 0;
     }
     nModels = 0;
+    nModelsAdded = 0;
+    nModelsEvicted = 0;
+
+    candidates = 0;
+    maxCandidates = 0;
 
     for (unsigned int i = 0; i < MAX_MODELS; i++) {
         hotTbl[i] = 0;
@@ -104,6 +121,8 @@ void Otw::copyData(const Otw& org, const bool cc)
          otwModelTypes[i] = 0;
       }
       nOtwModelTypes = 0;
+      candidates = 0;
+      maxCandidates = 0;
    }
 
     resetTables();
@@ -118,6 +137,10 @@ void Otw::copyData(const Otw& org, const bool cc)
     maxRange = org.maxRange;
     maxModels = org.maxModels;
     maxElevations = org.maxElevations;
+    modelHyst = org.modelHyst;
+    setLodRanges(org.lodRanges, org.nLodRanges);
+    nModelsAdded = 0;
+    nModelsEvicted = 0;
     rstFlg = org.rstFlg;
     rstReq = org.rstReq;
 
@@ -140,6 +163,10 @@ void Otw::deleteData()
    setPlayerList(0);
    resetTables();
    clearOtwModelTypes();
+
+   if (candidates != 0) delete[] candidates;
+   candidates = 0;
+   maxCandidates = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -240,9 +267,16 @@ void Otw::processesElevations()
 //  Note: this routines will set model entries to DEAD and OUT_OF_RANGE, but the
 //  derived class should handle the visual system unique termination sequences and
 //  clear the model entry.
+//
+//  Active, in-range players are first collected as model candidates and only
+//  the closest 'maxModels' candidates are given (or keep) a model slot.  Models
+//  that lose their slot to closer players are evicted (set OUT_OF_RANGE).
 //------------------------------------------------------------------------------
 void Otw::mapPlayerList2ModelTable()
 {
+   nModelsAdded = 0;
+   nModelsEvicted = 0;
+
    // ---
    // Check for reset
    // ---
@@ -272,17 +306,21 @@ void Otw::mapPlayerList2ModelTable()
       modelTbl[i]->setCheckedFlag(false);
    }
 
-   if (playerList != 0) {
+   if (playerList != 0 && reserveCandidates(playerList->entries())) {
       // We must have a player list ...
 
+      // Players with models are dropped beyond this range
+      const LCreal dropRange = maxRange * (1.0f + modelHyst);
+
       // ---
       // Find players that are alive and within range of the visual system ...
       // ---
+      unsigned int nc = 0;
       Basic::List::Item* item = playerList->getFirstItem();
       while (item != 0) {
 
          // Get a pointer to the player, 'p'
-         Basic::Pair* pair = dynamic_cast<Basic::Pair*>(item->getValue());
+         Basic::Pair* pair = static_cast<Basic::Pair*>(item->getValue());
          Player* p = static_cast<Player*>(pair->object());
 
          bool dummy = false;
@@ -294,20 +332,20 @@ void Otw::mapPlayerList2ModelTable()
             // Find the player's model entry (if any)
             OtwModel* model = findModel(p, MODEL_TABLE);
 
-            // Check if in-range
-            bool inRange = computeRangeToPlayer(p) <= maxRange;
+            // Check if in-range (with hysteresis for players that already have a model)
+            const LCreal rng = computeRangeToPlayer(p);
+            bool inRange = (rng <= maxRange) || (model != 0 && rng <= dropRange);
 
             // Check if this player is alive and within range.
             if (p->isActive() && inRange) {
-               // When alive and in range ...
-               if (model != 0) {
-                  // a) and it already has a model entry: make sure it's active ...
-                  model->setState( OtwModel::ACTIVE );
-               }
-               else {
-                  // b) and it doesn't have a model entry (new, in-range player) ...
-                  model = newModelEntry(p);
-               }
+               // When alive and in range, it's a model candidate; players
+               // that already have a model get a closer, priority range.
+               ModelCandidate* c = &candidates[nc++];
+               c->player = p;
+               c->model = model;
+               c->range = rng;
+               c->priority = rng;
+               if (model != 0) c->priority = rng * (1.0f - modelHyst);
             }
             else if (p->isDead() && inRange) {
                // When player isn't alive and it had a model entry
@@ -330,6 +368,10 @@ void Otw::mapPlayerList2ModelTable()
          item = item->getNext(); // Next player
       }
 
+      // ---
+      // Give the model slots to the closest candidates
+      // ---
+      selectModels(nc);
    }
 
    // ---
@@ -346,6 +388,81 @@ void Otw::mapPlayerList2ModelTable()
 
 }
 
+//------------------------------------------------------------------------------
+// selectModels() -- Selects the closest 'n' model candidates
+//------------------------------------------------------------------------------
+void Otw::selectModels(const unsigned int n)
+{
+   // Partial sort, so that the first 'maxModels' candidates are the closest
+   unsigned int k = n;
+   if (k > maxModels) {
+      k = maxModels;
+      std::nth_element(candidates, candidates + k, candidates + n, compareCandidates);
+   }
+
+   // The selected candidates
+   for (unsigned int i = 0; i < k; i++) {
+      OtwModel* model = candidates[i].model;
+      if (model != 0) {
+         // a) and it already has a model entry: make sure it's active ...
+         model->setState( OtwModel::ACTIVE );
+      }
+      else {
+         // b) and it doesn't have a model entry (new, in-range player) ...
+         //    (note: there might not be room until evicted models are cleared)
+         model = newModelEntry(candidates[i].player);
+         if (model != 0) nModelsAdded++;
+      }
+      if (model != 0) {
+         model->setRange( candidates[i].range );
+         model->setLodTier( computeLodTier(candidates[i].range) );
+         model->setCheckedFlag(true);
+      }
+   }
+
+   // Candidates that didn't make the cut lose their models
+   for (unsigned int i = k; i < n; i++) {
+      OtwModel* model = candidates[i].model;
+      if (model != 0) {
+         if (!model->isState(OtwModel::OUT_OF_RANGE)) nModelsEvicted++;
+         model->setState( OtwModel::OUT_OF_RANGE );
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// reserveCandidates() -- Makes sure the candidate table can hold 'n' entries
+//------------------------------------------------------------------------------
+bool Otw::reserveCandidates(const unsigned int n)
+{
+   if (n > maxCandidates) {
+      // Grow in large steps to keep from reallocating as players are added
+      unsigned int size = maxCandidates * 2;
+      if (size < n) size = n;
+      if (size < MAX_MODELS) size = MAX_MODELS;
+
+      ModelCandidate* tbl = new ModelCandidate[size];
+      if (tbl != 0) {
+         if (candidates != 0) delete[] candidates;
+         candidates = tbl;
+         maxCandidates = size;
+      }
+   }
+   return (n <= maxCandidates);
+}
+
+//------------------------------------------------------------------------------
+// computeLodTier() -- Returns the LOD tier for a player at range 'rng'
+//------------------------------------------------------------------------------
+unsigned int Otw::computeLodTier(const LCreal rng) const
+{
+   unsigned int tier = 0;
+   while (tier < nLodRanges && rng > lodRanges[tier]) {
+      tier++;
+   }
+   return tier;
+}
+
 //------------------------------------------------------------------------------
 // mapPlayers2ElevTable() - Map the player list to the model table
 //------------------------------------------------------------------------------
@@ -538,6 +655,36 @@ bool Otw::setMaxElevations(const unsigned int n)
     return true;
 }
 
+//------------------------------------------------------------------------------
+// setModelHysteresis() -- sets the model add/drop hysteresis ratio
+//------------------------------------------------------------------------------
+bool Otw::setModelHysteresis(const LCreal h)
+{
+    bool ok = (h >= 0.0f && h <= 1.0f);
+    if (ok) modelHyst = h;
+    return ok;
+}
+
+//------------------------------------------------------------------------------
+// setLodRanges() -- sets the LOD tier ranges (meters)
+//------------------------------------------------------------------------------
+bool Otw::setLodRanges(const LCreal* const rngs, const unsigned int n)
+{
+    // The ranges must be increasing
+    bool ok = (n <= MAX_LOD_RANGES) && (n == 0 || rngs != 0);
+    for (unsigned int i = 1; i < n && ok; i++) {
+        ok = (rngs[i] > rngs[i-1]);
+    }
+
+    if (ok) {
+        for (unsigned int i = 0; i < n; i++) {
+            lodRanges[i] = rngs[i];
+        }
+        nLodRanges = n;
+    }
+    return ok;
+}
+
 //------------------------------------------------------------------------------
 // addModelToList() -- adds a model to the quick access table
 //------------------------------------------------------------------------------
@@ -706,6 +853,14 @@ OtwModel* Otw::findModel(const Player* const player, const TableType type)
    return found;
 }
 
+//------------------------------------------------------------------------------
+// nth_element callback: model candidate priority compare function
+//------------------------------------------------------------------------------
+bool Otw::compareCandidates(const ModelCandidate& a, const ModelCandidate& b)
+{
+   return (a.priority < b.priority);
+}
+
 //------------------------------------------------------------------------------
 // bsearch callbacks: object name compare function --
 //   True types are (const OtwModelKey* key, const OtwModel** model)
@@ -727,8 +882,14 @@ int Otw::compareKey2Model(const void* key, const void* model)
    if (pKey->playerID < pModel->getPlayerID()) result = -1;
    else if (pKey->playerID > pModel->getPlayerID()) result = +1;
 
+   // Compare federate name keys
    if (result == 0) {
-      // If they're the same playr IDs, compare the federate names
+      if (pKey->fKey < pModel->getFederateKey()) result = -1;
+      else if (pKey->fKey > pModel->getFederateKey()) result = +1;
+   }
+
+   if (result == 0 && pKey->fKey != 0) {
+      // If they're the same keys, make sure that the federate names match
       const Basic::String* pKeyFedName = pKey->fName;
       const Basic::String* pModelFedName = pModel->getFederateName();
 
@@ -886,6 +1047,34 @@ bool Otw::setSlotOtwModelTypes(const Basic::PairStream* const msg)
     return ok;
 }
 
+// modelHysteresis: Model add/drop hysteresis ratio
+bool Otw::setSlotModelHysteresis(const Basic::Number* const msg)
+{
+    bool ok = false;
+    if (msg != 0) {
+        ok = setModelHysteresis(msg->getReal());
+        if (!ok) {
+            std::cerr << "Otw::setSlotModelHysteresis: hysteresis ratio must be between 0 and 1" << std::endl;
+        }
+    }
+    return ok;
+}
+
+// lodRanges: LOD tier ranges (meters)
+bool Otw::setSlotLodRanges(const Basic::List* const msg)
+{
+    bool ok = false;
+    if (msg != 0) {
+        LCreal rngs[MAX_LOD_RANGES];
+        const unsigned int n = msg->getNumberList(rngs, MAX_LOD_RANGES);
+        ok = (n == msg->entries()) && setLodRanges(rngs, n);
+        if (!ok) {
+            std::cerr << "Otw::setSlotLodRanges: invalid list of LOD ranges; must be increasing and limited to Otw::MAX_LOD_RANGES" << std::endl;
+        }
+    }
+    return ok;
+}
+
 //------------------------------------------------------------------------------
 // getSlotByIndex()
 //------------------------------------------------------------------------------
@@ -900,6 +1089,7 @@ Basic::Object* Otw::getSlotByIndex(const int si)
 Otw::OtwModelKey::OtwModelKey(const unsigned short pid, const Basic::String* const federateName)
 {
    playerID = pid;
+   fKey = OtwModel::federateNameKey(federateName);
    fName = federateName;
 }
 
@@ -913,7 +1103,7 @@ EMPTY_SERIALIZER(OtwModel)
 // ---
 // constructor
 // ---
-OtwModel::OtwModel() : player(0), federateName(0)
+OtwModel::OtwModel() : player(0), federateName(0), federateKey(0)
 {
    STANDARD_CONSTRUCTOR()
 
@@ -938,11 +1128,14 @@ void OtwModel::copyData(const OtwModel& org, const bool cc)
     typeMapper = org.typeMapper;
     rcount = org.rcount;
     hotActive = org.hotActive;
+    range = org.range;
+    lodTier = org.lodTier;
 
     playerID = org.playerID;
 
     const Basic::String* pp = org.federateName;
     federateName = pp;
+    federateKey = org.federateKey;
 }
 
 // ---
@@ -962,6 +1155,7 @@ void OtwModel::setPlayer(Player* const p)
       player->unref();
       playerID = 0;
       federateName = 0;
+      federateKey = 0;
    }
 
    player = p;
@@ -976,6 +1170,7 @@ void OtwModel::setPlayer(Player* const p)
       else {
          federateName = 0;
       }
+      federateKey = federateNameKey(federateName);
    }
 }
 
@@ -1019,8 +1214,30 @@ void OtwModel::clear()
    typeMapper = 0;
    rcount = 0;
    hotActive = false;
+   range = 0;
+   lodTier = 0;
    playerID = 0;
    federateName = 0;
+   federateKey = 0;
+}
+
+// ---
+// federateNameKey() -- returns the integer key (FNV-1a hash) for a federate
+// name; zero is reserved for players that don't have a federate name.
+// ---
+unsigned int OtwModel::federateNameKey(const Basic::String* const federateName)
+{
+   unsigned int key = 0;
+   if (federateName != 0) {
+      const char* p = federateName->getString();
+      key = 2166136261u;
+      while (p != 0 && *p != '\0') {
+         key ^= static_cast<unsigned char>(*p++);
+         key *= 16777619u;
+      }
+      if (key == 0) key = 1;
+   }
+   return key;
 }
 
 
@@ -29,6 +29,7 @@
 
 #include "openeaagles/basic/Boolean.h"
 #include "openeaagles/basic/List.h"
+#include "openeaagles/basic/Logger.h"
 #include "openeaagles/basic/Terrain.h"
 #include "openeaagles/basic/LatLon.h"
 #include "openeaagles/basic/Nav.h"
@@ -676,6 +677,12 @@ void Player::updateTC(const LCreal dt0)
 
    if (mode == ACTIVE || mode == PRE_RELEASE) {
 
+      // Profiling?
+      Simulation* const sim = getSimulation();
+      const bool timing = (sim != 0 && sim->isPhaseTimingEnabled());
+      double t0 = 0;
+      if (timing) t0 = getComputerTime();
+
       // ---
       // Time-out requests for reflections of RF emissions hitting us
       // ---
@@ -720,7 +727,7 @@ void Player::updateTC(const LCreal dt0)
 
                   // TabLogger is deprecated
                   if (getAnyEventLogger() != 0) {
-                     TabLogger::TabLogEvent* evt = new TabLogger::LogPlayerData(2, this); // type 2: update
+                     TabLogger::TabLogEvent* evt = TabLogger::LogPlayerData::create(2, this); // type 2: update
                      getAnyEventLogger()->log(evt);
                      evt->unref();
                   }
@@ -757,6 +764,7 @@ void Player::updateTC(const LCreal dt0)
       //  b) We're calling BaseClass::updateTC() class because we want to update
       //     our player dynamics, etc before our subsystems.
       // ---
+      if (timing) sim->addSubsystemTime(true, Simulation::SUBSYS_PLAYER, getComputerTime() - t0);
       BaseClass::updateTC(dt);
 
    }
@@ -769,6 +777,12 @@ void Player::updateData(const LCreal dt)
 {
    if (mode == ACTIVE || mode == PRE_RELEASE) {
 
+      // Profiling?
+      Simulation* const sim = getSimulation();
+      const bool timing = (sim != 0 && sim->isPhaseTimingEnabled());
+      double t0 = 0;
+      if (timing) t0 = getComputerTime();
+
       // Update signatures
       if (signature != 0) signature->updateData(dt);
       if (irSignature != 0) irSignature->updateData(dt);
@@ -782,6 +796,7 @@ void Player::updateData(const LCreal dt)
       // Note: our subsystems in the components list (e.g., pilot, nav, sms and obc) are updated
       // by our call to BaseClass:updateData()
       // ---
+      if (timing) sim->addSubsystemTime(false, Simulation::SUBSYS_PLAYER, getComputerTime() - t0);
       BaseClass::updateData(dt);
    }
 }
@@ -2617,7 +2632,7 @@ void Player::processDetonation(const LCreal detRange, Weapon* const wpn)
    END_RECORD_DATA_SAMPLE()
 
    if (getAnyEventLogger() != 0) {  // EventLogger Deprecated
-      TabLogger::TabLogEvent* evt = new TabLogger::LogPlayerData(4, this, wpn); // type 4: damage state
+      TabLogger::TabLogEvent* evt = TabLogger::LogPlayerData::create(4, this, wpn); // type 4: damage state
       getAnyEventLogger()->log(evt);
       evt->unref();
    }
@@ -2669,7 +2684,7 @@ bool Player::killedNotification(Player* const p)
 
    // TabLogger is deprecated
    if (getAnyEventLogger() != 0) {  // EventLogger Deprecated
-      TabLogger::TabLogEvent* evt = new TabLogger::LogPlayerData(7, this, p); // type 7: kill
+      TabLogger::TabLogEvent* evt = TabLogger::LogPlayerData::create(7, this, p); // type 7: kill
       getAnyEventLogger()->log(evt);
       evt->unref();
    }
@@ -2714,7 +2729,7 @@ bool Player::collisionNotification(Player* const p)
 
    // TabLogger is deprecated
    if (getAnyEventLogger() != 0) {  // EventLogger Deprecated
-      TabLogger::TabLogEvent* evt = new TabLogger::LogPlayerData(5, this, p); // type 5: collision
+      TabLogger::TabLogEvent* evt = TabLogger::LogPlayerData::create(5, this, p); // type 5: collision
       getAnyEventLogger()->log(evt);
       evt->unref();
    }
@@ -2759,7 +2774,7 @@ bool Player::crashNotification()
 
    // TabLogger is deprecated
    if (getAnyEventLogger() != 0) {  // EventLogger Deprecated
-      TabLogger::TabLogEvent* evt = new TabLogger::LogPlayerData(6, this); // type 6: crash
+      TabLogger::TabLogEvent* evt = TabLogger::LogPlayerData::create(6, this); // type 6: crash
       getAnyEventLogger()->log(evt);
       evt->unref();
    }
@@ -3447,6 +3462,56 @@ void Player::updateSystemPointers()
    setStoresMgr( findByType(typeid(StoresMgr)) );
 }
 
+//------------------------------------------------------------------------------
+// subsystemType() -- Simulation::Subsystem type of one of our components
+//------------------------------------------------------------------------------
+static unsigned int subsystemType(const Basic::Component* const p)
+{
+   unsigned int s = Simulation::SUBSYS_OTHER;
+   if (dynamic_cast<const DynamicsModel*>(p) != 0) s = Simulation::SUBSYS_DYNAMICS_MODEL;
+   else if (dynamic_cast<const Datalink*>(p) != 0) s = Simulation::SUBSYS_DATALINK;
+   else if (dynamic_cast<const Gimbal*>(p) != 0) s = Simulation::SUBSYS_GIMBAL;
+   else if (dynamic_cast<const IrSystem*>(p) != 0) s = Simulation::SUBSYS_IR_SYSTEM;
+   else if (dynamic_cast<const Navigation*>(p) != 0) s = Simulation::SUBSYS_NAVIGATION;
+   else if (dynamic_cast<const OnboardComputer*>(p) != 0) s = Simulation::SUBSYS_OBC;
+   else if (dynamic_cast<const Pilot*>(p) != 0) s = Simulation::SUBSYS_PILOT;
+   else if (dynamic_cast<const Radio*>(p) != 0) s = Simulation::SUBSYS_RADIO;
+   else if (dynamic_cast<const RfSensor*>(p) != 0) s = Simulation::SUBSYS_SENSOR;
+   else if (dynamic_cast<const StoresMgr*>(p) != 0) s = Simulation::SUBSYS_STORES_MGR;
+   return s;
+}
+
+//------------------------------------------------------------------------------
+// updateChildTC() and updateChildData() -- update one of our subsystems (or
+// our slot event logger); while the simulation's phase timing is enabled, the
+// time spent in each one is added to the simulation's subsystem times.
+//------------------------------------------------------------------------------
+void Player::updateChildTC(Basic::Component* const child, const LCreal dt)
+{
+   Simulation* const s = getSimulation();
+   if (s != 0 && s->isPhaseTimingEnabled()) {
+      const double t0 = getComputerTime();
+      BaseClass::updateChildTC(child, dt);
+      s->addSubsystemTime(true, subsystemType(child), getComputerTime() - t0);
+   }
+   else {
+      BaseClass::updateChildTC(child, dt);
+   }
+}
+
+void Player::updateChildData(Basic::Component* const child, const LCreal dt)
+{
+   Simulation* const s = getSimulation();
+   if (s != 0 && s->isPhaseTimingEnabled()) {
+      const double t0 = getComputerTime();
+      BaseClass::updateChildData(child, dt);
+      s->addSubsystemTime(false, subsystemType(child), getComputerTime() - t0);
+   }
+   else {
+      BaseClass::updateChildData(child, dt);
+   }
+}
+
 //------------------------------------------------------------------------------
 // processComponents() -- process our components; make sure the are all of
 // type Steerpoint (or derived); tell them that we are their container
@@ -0,0 +1,262 @@
+//------------------------------------------------------------------------------
+// Class: PlayerGrid
+//------------------------------------------------------------------------------
+
+#include "openeaagles/simulation/PlayerGrid.h"
+#include "openeaagles/simulation/Player.h"
+#include "openeaagles/basic/PairStream.h"
+#include "openeaagles/basic/Pair.h"
+
+#include <cmath>
+
+namespace Eaagles {
+namespace Simulation {
+
+//------------------------------------------------------------------------------
+// Constructor & destructor
+//------------------------------------------------------------------------------
+PlayerGrid::PlayerGrid()
+{
+   players = 0;
+   entries = 0;
+   cells = 0;
+   order = 0;
+   start = 0;
+   listed = 0;
+   np = 0;
+   nPlaced = 0;
+   maxNp = 0;
+   nBuckets = 0;
+   cellSize = 1.0;
+   maxSpeed = 0;
+   valid = false;
+}
+
+PlayerGrid::~PlayerGrid()
+{
+   clear();
+   resize(0);
+}
+
+//------------------------------------------------------------------------------
+// bucket() -- bucket of grid cell [ cn, ce ]
+//------------------------------------------------------------------------------
+unsigned int PlayerGrid::bucket(const int cn, const int ce) const
+{
+   return ( (static_cast<unsigned int>(cn) * 73856093u) ^ (static_cast<unsigned int>(ce) * 19349663u) ) & (nBuckets - 1);
+}
+
+//------------------------------------------------------------------------------
+// resize() -- resize the arrays for 'n' players (zero to free the arrays); the
+// number of buckets is a power of two that's at least the number of players.
+//------------------------------------------------------------------------------
+bool PlayerGrid::resize(const unsigned int n)
+{
+   if (entries != 0) { delete[] entries; entries = 0; }
+   if (cells != 0)   { delete[] cells;   cells = 0; }
+   if (order != 0)   { delete[] order;   order = 0; }
+   if (start != 0)   { delete[] start;   start = 0; }
+   if (listed != 0)  { delete[] listed;  listed = 0; }
+   maxNp = 0;
+   nBuckets = 0;
+
+   if (n > 0) {
+      unsigned int size = 64;
+      while (size < n) size *= 2;
+      entries = new Player*[size];
+      cells = new int[size*2];
+      order = new unsigned int[size];
+      start = new unsigned int[size+1];
+      listed = new Player*[size];
+      maxNp = size;
+      nBuckets = size;
+   }
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// build() -- sorts the players of 'plist' into the grid
+//------------------------------------------------------------------------------
+void PlayerGrid::build(Basic::PairStream* const plist, const double size)
+{
+   clear();
+   if (plist == 0 || size <= 0) return;
+
+   const unsigned int n = plist->entries();
+   if (n > maxNp || start == 0) resize(n);
+
+   players = plist;
+   players->ref();
+   cellSize = size;
+
+   // ---
+   // List the players (in player list order) and count the
+   // players in each bucket (using start[b+1])
+   // ---
+   for (unsigned int b = 0; b <= nBuckets; b++) {
+      start[b] = 0;
+   }
+   Basic::List::Item* item = plist->getFirstItem();
+   while (item != 0 && np < n) {
+      Basic::Pair* pair = static_cast<Basic::Pair*>(item->getValue());
+      Player* p = static_cast<Player*>(pair->object());
+      listed[np++] = p;
+      if (p->isPositionVectorValid()) {
+         const osg::Vec3 pos = p->getPosition();
+         start[ bucket( static_cast<int>(std::floor(pos.x() / cellSize)), static_cast<int>(std::floor(pos.y() / cellSize)) ) + 1 ]++;
+         const double gs = p->getGroundSpeed();
+         if (gs > maxSpeed) maxSpeed = gs;
+      }
+      item = item->getNext();
+   }
+
+   // Bucket start indexes
+   for (unsigned int b = 0; b < nBuckets; b++) {
+      start[b+1] += start[b];
+   }
+   nPlaced = start[nBuckets];
+
+   // ---
+   // Sort the players by bucket; stable, so each bucket (and the unplaced
+   // players at the end) is in player list order.
+   // ---
+   unsigned int nUnplaced = 0;
+   for (unsigned int i = 0; i < np; i++) {
+      Player* p = listed[i];
+      unsigned int k = 0;
+      int cn = 0;
+      int ce = 0;
+      if (p->isPositionVectorValid()) {
+         const osg::Vec3 pos = p->getPosition();
+         cn = static_cast<int>( std::floor(pos.x() / cellSize) );
+         ce = static_cast<int>( std::floor(pos.y() / cellSize) );
+         // (use the start index as the bucket's fill index; restored below)
+         k = start[bucket(cn, ce)]++;
+      }
+      else {
+         k = nPlaced + nUnplaced++;
+      }
+      entries[k] = p;
+      cells[k*2] = cn;
+      cells[k*2+1] = ce;
+      order[k] = i;
+   }
+
+   // Restore the start indexes (each was advanced to the next bucket's start)
+   for (unsigned int b = nBuckets; b > 0; b--) {
+      start[b] = start[b-1];
+   }
+   start[0] = 0;
+
+   valid = true;
+}
+
+//------------------------------------------------------------------------------
+// clear() -- clears the grid and releases the player list
+//------------------------------------------------------------------------------
+void PlayerGrid::clear()
+{
+   valid = false;
+   np = 0;
+   nPlaced = 0;
+   maxSpeed = 0;
+   if (players != 0) {
+      players->unref();
+      players = 0;
+   }
+}
+
+//------------------------------------------------------------------------------
+// query() -- finds the players in the grid cells within 'rng' of 'pos'
+//------------------------------------------------------------------------------
+unsigned int PlayerGrid::query(const osg::Vec3& pos, const double rng, Player* list[], const unsigned int max) const
+{
+   if (!valid) return 0;
+
+   // Range of cells
+   const double n0 = std::floor((pos.x() - rng) / cellSize);
+   const double n1 = std::floor((pos.x() + rng) / cellSize);
+   const double e0 = std::floor((pos.y() - rng) / cellSize);
+   const double e1 = std::floor((pos.y() + rng) / cellSize);
+   const double ncells = (n1 - n0 + 1.0) * (e1 - e0 + 1.0);
+
+   // Too many cells (or an invalid position) -- all players
+   if ( !(ncells <= MAX_CELLS) ) {
+      for (unsigned int i = 0; i < np && i < max; i++) {
+         list[i] = listed[i];
+      }
+      return np;
+   }
+
+   const int cn0 = static_cast<int>(n0);
+   const int cn1 = static_cast<int>(n1);
+   const int ce0 = static_cast<int>(e0);
+   const int ce1 = static_cast<int>(e1);
+
+   // ---
+   // Runs of entries to merge: the (unique) buckets of the cells, and the
+   // unplaced players.
+   // ---
+   unsigned int next[MAX_CELLS+1];
+   unsigned int end[MAX_CELLS+1];
+   unsigned int nruns = 0;
+   for (int cn = cn0; cn <= cn1; cn++) {
+      for (int ce = ce0; ce <= ce1; ce++) {
+         const unsigned int b = bucket(cn, ce);
+         bool dup = false;
+         for (unsigned int r = 0; r < nruns && !dup; r++) {
+            dup = (next[r] == start[b]);
+         }
+         if (!dup && start[b] < start[b+1]) {
+            next[nruns] = start[b];
+            end[nruns] = start[b+1];
+            nruns++;
+         }
+      }
+   }
+   if (nPlaced < np) {
+      next[nruns] = nPlaced;
+      end[nruns] = np;
+      nruns++;
+   }
+
+   // ---
+   // Merge the runs, which are each in player list order, skipping
+   // the entries from other cells that share the buckets.
+   // ---
+   unsigned int n = 0;
+   for (;;) {
+      unsigned int best = nruns;
+      for (unsigned int r = 0; r < nruns; r++) {
+         // Skip the entries that aren't in our cells
+         while (next[r] < end[r] && next[r] < nPlaced) {
+            const unsigned int k = next[r];
+            if (cells[k*2] >= cn0 && cells[k*2] <= cn1 && cells[k*2+1] >= ce0 && cells[k*2+1] <= ce1) break;
+            next[r]++;
+         }
+         if (next[r] < end[r] && (best == nruns || order[next[r]] < order[next[best]])) best = r;
+      }
+      if (best == nruns) break;
+
+      if (n < max) list[n] = entries[next[best]];
+      n++;
+      next[best]++;
+   }
+
+   return n;
+}
+
+//------------------------------------------------------------------------------
+// contains() -- true if player 'p' is in the grid
+//------------------------------------------------------------------------------
+bool PlayerGrid::contains(const Player* const p) const
+{
+   bool found = false;
+   for (unsigned int i = 0; i < np && !found; i++) {
+      found = (listed[i] == p);
+   }
+   return found;
+}
+
+} // End Simulation namespace
+} // End Eaagles namespace
@@ -22,12 +22,16 @@ IMPLEMENT_PARTIAL_SUBCLASS(Radar,"Radar")
 
 // Slot table
 BEGIN_SLOTTABLE(Radar)
-   "igain",    //  1: RF: Integrator gain (dB or no units; def: 1.0)
+   "igain",          //  1: RF: Integrator gain (dB or no units; def: 1.0)
+   "numSweeps",      //  2: Number of sweeps in the real-beam display
+   "ptrsPerSweep",   //  3: Number of points per sweep in the real-beam display
 END_SLOTTABLE(Radar)
 
 //  Map slot table
 BEGIN_SLOT_MAP(Radar)
-    ON_SLOT(1,  setSlotIGain, Basic::Number)
+    ON_SLOT(1,  setSlotIGain,        Basic::Number)
+    ON_SLOT(2,  setSlotNumSweeps,    Basic::Number)
+    ON_SLOT(3,  setSlotPtrsPerSweep, Basic::Number)
 END_SLOT_MAP()
 
 //------------------------------------------------------------------------------
@@ -78,7 +82,15 @@ void Radar::initData()
 
    endOfScanFlg = false;
 
-   for (unsigned int i = 0; i < NUM_SWEEPS; i++) clearSweep(i);
+   sweepMem = 0;
+   sweeps = 0;
+   vclos = 0;
+   sweepAgedFrame = 0;
+   agingFrame = 0;
+   nSweeps = 0;
+   nPtrs = 0;
+   sweepStride = 0;
+   allocateSweeps(NUM_SWEEPS, PTRS_PER_SWEEP);
    csweep = 0;
 
    currentJamSignal = 0.0;
@@ -102,7 +114,7 @@ void Radar::copyData(const Radar& org, const bool cc)
    clearTracksAndQueues();
    endOfScanFlg = false;
 
-   for (unsigned int i = 0; i < NUM_SWEEPS; i++) clearSweep(i);
+   allocateSweeps(org.nSweeps, org.nPtrs);
    csweep = 0;
 
    currentJamSignal = org.currentJamSignal;
@@ -117,6 +129,7 @@ void Radar::copyData(const Radar& org, const bool cc)
 void Radar::deleteData()
 {
    clearTracksAndQueues();
+   freeSweeps();
 }
 
 //------------------------------------------------------------------------------
@@ -309,6 +322,7 @@ void Radar::receive(const LCreal dt)
             // Is S/N above receiver threshold and within 125% of max range?
             // CGB, if "signal <= 0.0", then "signalToInterferenceRatioDbl" is probably invalid
             // we should probably do something smart with "signalToInterferenceRatioDbl" above as well.
+            bool detected = false;
             lcLock(myLock);
             if (signalToInterferenceRatioDbl >= getRfThreshold() && em->getRange() <= (maxRng*1.25) && rptQueue.isNotFull()) {
 
@@ -316,19 +330,19 @@ void Radar::receive(const LCreal dt)
                em->ref();
                rptQueue.put(em);
                rptSnQueue.put(signalToInterferenceRatioDbl);
+               detected = true;
 
                //std::cout << " (" << em->getRange() << ", " << signalToInterferenceRatioDbl << ", " << signalToInterferenceRatio << ", " << signalToInterferenceRatioDbl << ")";
 
-               // Save signal for real-beam display
-               int iaz = csweep;
-               int irng = computeRangeIndex( em->getRange() );
-               sweeps[iaz][irng] += (signalToInterferenceRatioDbl/100.0f);
-               vclos[iaz][irng] = em->getRangeRate();
-
             } else if (signalToInterferenceRatioDbl < getRfThreshold() && signalToNoiseRatioDbl >= getRfThreshold()) {
                countNumJammedEm++;
             }
             lcUnlock(myLock);
+
+            // Save signal for real-beam display
+            if (detected) {
+               addToSweep(csweep, computeRangeIndex( em->getRange() ), (signalToInterferenceRatioDbl/100.0f), em->getRangeRate());
+            }
          }
       }
 
@@ -502,46 +516,184 @@ bool Radar::onEndScanEvent(const Basic::Integer* const bar)
 }
 
 //------------------------------------------------------------------------------
-// clearSweep -- Computer power at angle off center of beam
+// getSweep() -- Returns the n'th sweep's power, after applying its pending aging
+//------------------------------------------------------------------------------
+const LCreal* Radar::getSweep(const unsigned int n) const
+{
+   const LCreal* p = 0;
+   lcLock(myLock);
+   if (n < nSweeps) {
+      ageSweep(n);
+      p = &sweeps[n*sweepStride];
+   }
+   lcUnlock(myLock);
+   return p;
+}
+
+//------------------------------------------------------------------------------
+// getSweep() -- Copies up to 'max' points of the n'th sweep's power, with its
+// pending aging applied to the copy (the sweep itself isn't changed), to
+// 'power'.  Returns the number of points copied.
+//------------------------------------------------------------------------------
+unsigned int Radar::getSweep(const unsigned int n, LCreal* const power, const unsigned int max) const
+{
+   unsigned int cnt = 0;
+   if (power != 0) {
+      lcLock(myLock);
+      if (n < nSweeps) {
+         cnt = (max < nPtrs ? max : nPtrs);
+         const LCreal aging = 0.002f * static_cast<LCreal>(agingFrame - sweepAgedFrame[n]);
+         const LCreal* const p = &sweeps[n*sweepStride];
+         for (unsigned int i = 0; i < cnt; i++) {
+            const LCreal p0 = p[i];
+            const LCreal p1 = (p0 > aging ? p0 - aging : 0.0f);
+            power[i] = (p0 > 0.0f ? p1 : p0);
+         }
+      }
+      lcUnlock(myLock);
+   }
+   return cnt;
+}
+
+//------------------------------------------------------------------------------
+// clearSweep -- Clears the n'th sweep's power and closure
 //------------------------------------------------------------------------------
 void Radar::clearSweep(const unsigned int n)
 {
-   if (n < NUM_SWEEPS) {
-      for (unsigned int i = 0; i < PTRS_PER_SWEEP; i++) {
-         sweeps[n][i] = 0.0f;
-         vclos[n][i] = 0.0;
+   lcLock(myLock);
+   if (n < nSweeps) {
+      LCreal* const p = &sweeps[n*sweepStride];
+      LCreal* const v = &vclos[n*sweepStride];
+      for (unsigned int i = 0; i < sweepStride; i++) {
+         p[i] = 0.0f;
+         v[i] = 0.0f;
       }
+      sweepAgedFrame[n] = agingFrame;
+   }
+   lcUnlock(myLock);
+}
+
+//------------------------------------------------------------------------------
+// addToSweep -- Adds 'power' to point 'irng' of the n'th sweep, after
+// applying the sweep's pending aging, and sets the point's closure
+//------------------------------------------------------------------------------
+void Radar::addToSweep(const unsigned int n, const unsigned int irng, const LCreal power, const LCreal closure)
+{
+   lcLock(myLock);
+   if (n < nSweeps && irng < nPtrs) {
+      ageSweep(n);
+      sweeps[n*sweepStride + irng] += power;
+      vclos[n*sweepStride + irng] = closure;
    }
+   lcUnlock(myLock);
 }
 
 //------------------------------------------------------------------------------
 // ageSweeps -- age the power in the sweeps
+//
+// The sweeps are aged lazily; we only count the aging frames here, and
+// ageSweep() applies the pending aging when a sweep is written or read.
 //------------------------------------------------------------------------------
 void Radar::ageSweeps()
 {
-   const LCreal aging = 0.002f;
-   for (unsigned int i = 0; i < NUM_SWEEPS; i++) {
-      for (unsigned int j = 0; j < PTRS_PER_SWEEP; j++) {
-         LCreal p = sweeps[i][j];
-         if (p > 0) {
-            p -= aging;
-            if (p < 0) p = 0;
-            sweeps[i][j] = p;
-         }
+   lcLock(myLock);
+   agingFrame++;
+   lcUnlock(myLock);
+}
+
+//------------------------------------------------------------------------------
+// ageSweep -- apply the pending aging to the n'th sweep ('myLock' is locked)
+//
+// Positive sweep powers are reduced by 'aging' each aging frame, and are
+// limited to zero.  Applying all of the pending frames at once gives the
+// same result, so the row is updated with a single, branch free loop that
+// the compiler can vectorize.
+//------------------------------------------------------------------------------
+void Radar::ageSweep(const unsigned int n) const
+{
+   const unsigned int frames = (agingFrame - sweepAgedFrame[n]);
+   if (frames > 0) {
+      const LCreal aging = 0.002f * static_cast<LCreal>(frames);
+      LCreal* const p = &sweeps[n*sweepStride];
+      for (unsigned int i = 0; i < sweepStride; i++) {
+         const LCreal p0 = p[i];
+         const LCreal p1 = (p0 > aging ? p0 - aging : 0.0f);
+         p[i] = (p0 > 0.0f ? p1 : p0);
       }
+      sweepAgedFrame[n] = agingFrame;
    }
 }
 
+//------------------------------------------------------------------------------
+// allocateSweeps -- allocate and clear the sweep buffers
+//------------------------------------------------------------------------------
+bool Radar::allocateSweeps(const unsigned int numSweeps, const unsigned int ptrsPerSweep)
+{
+   if (numSweeps == 0 || ptrsPerSweep == 0) return false;
+
+   // Same size? just clear them.
+   if (sweepMem == 0 || numSweeps != nSweeps || ptrsPerSweep != nPtrs) {
+      freeSweeps();
+
+      // Round each sweep up to the alignment, and allocate the power and
+      // closure buffers as one block (plus room to align the block)
+      const unsigned int stride = ((ptrsPerSweep + SWEEP_ALIGN - 1) / SWEEP_ALIGN) * SWEEP_ALIGN;
+      sweepMem = new LCreal[2 * numSweeps * stride + SWEEP_ALIGN];
+      const size_t align = SWEEP_ALIGN * sizeof(LCreal);
+      const size_t addr = reinterpret_cast<size_t>(sweepMem);
+      sweeps = reinterpret_cast<LCreal*>( (addr + align - 1) & ~(align - 1) );
+      vclos = sweeps + (numSweeps * stride);
+      sweepAgedFrame = new unsigned int[numSweeps];
+
+      nSweeps = numSweeps;
+      nPtrs = ptrsPerSweep;
+      sweepStride = stride;
+   }
+
+   // Clear all sweeps
+   for (unsigned int i = 0; i < (2 * nSweeps * sweepStride); i++) sweeps[i] = 0.0f;
+   for (unsigned int i = 0; i < nSweeps; i++) sweepAgedFrame[i] = agingFrame;
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// freeSweeps -- free the sweep buffers
+//------------------------------------------------------------------------------
+void Radar::freeSweeps()
+{
+   if (sweepMem != 0) delete[] sweepMem;
+   if (sweepAgedFrame != 0) delete[] sweepAgedFrame;
+   sweepMem = 0;
+   sweeps = 0;
+   vclos = 0;
+   sweepAgedFrame = 0;
+   nSweeps = 0;
+   nPtrs = 0;
+   sweepStride = 0;
+}
+
+//------------------------------------------------------------------------------
+// setSweepResolution -- Sets the real-beam display's resolution
+//------------------------------------------------------------------------------
+bool Radar::setSweepResolution(const unsigned int numSweeps, const unsigned int ptrsPerSweep)
+{
+   lcLock(myLock);
+   bool ok = allocateSweeps(numSweeps, ptrsPerSweep);
+   csweep = 0;
+   lcUnlock(myLock);
+   return ok;
+}
+
 //------------------------------------------------------------------------------
 // computeSweepIndex -- compute the sweep index
 //------------------------------------------------------------------------------
 unsigned int Radar::computeSweepIndex(const LCreal az)
 {
-   LCreal s = LCreal(NUM_SWEEPS-1)/60.0;      // sweeps per display scaling
+   LCreal s = LCreal(nSweeps-1)/60.0;      // sweeps per display scaling
 
    LCreal az1 = az + 30.0f;        // Offset from left side (sweep 0)
    int n = int(az1*s + 0.5);       // Compute index
-   if (n >= NUM_SWEEPS) n = NUM_SWEEPS - 1;
+   if (n >= static_cast<int>(nSweeps)) n = nSweeps - 1;
    if (n < 0) n = 0;
    return static_cast<unsigned int>(n);
 }
@@ -557,8 +709,8 @@ unsigned int Radar::computeRangeIndex(const LCreal rng)
    //LCreal maxRng = 40000.0;
    LCreal maxRng = getRange() * Basic::Distance::NM2M;
    LCreal rng1 = (rng/ maxRng );
-   unsigned int n = static_cast<unsigned int>(rng1 * LCreal(PTRS_PER_SWEEP) + 0.5);
-   if (n >= PTRS_PER_SWEEP) n = PTRS_PER_SWEEP - 1;
+   unsigned int n = static_cast<unsigned int>(rng1 * LCreal(nPtrs) + 0.5);
+   if (n >= nPtrs) n = nPtrs - 1;
    return n;
 }
 
@@ -582,6 +734,38 @@ bool Radar::setSlotIGain(Basic::Number* const v)
    return ok;
 }
 
+// numSweeps: Number of sweeps in the real-beam display
+bool Radar::setSlotNumSweeps(const Basic::Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      const int n = msg->getInt();
+      if (n > 1) {
+         ok = setSweepResolution(static_cast<unsigned int>(n), nPtrs);
+      }
+      else {
+         std::cerr << "Radar::setSlotNumSweeps: number of sweeps must be greater than one" << std::endl;
+      }
+   }
+   return ok;
+}
+
+// ptrsPerSweep: Number of points per sweep in the real-beam display
+bool Radar::setSlotPtrsPerSweep(const Basic::Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      const int n = msg->getInt();
+      if (n > 0) {
+         ok = setSweepResolution(nSweeps, static_cast<unsigned int>(n));
+      }
+      else {
+         std::cerr << "Radar::setSlotPtrsPerSweep: number of points per sweep must be greater than zero" << std::endl;
+      }
+   }
+   return ok;
+}
+
 //------------------------------------------------------------------------------
 // getSlotByIndex()
 //------------------------------------------------------------------------------
@@ -607,6 +791,12 @@ std::ostream& Radar::serialize(std::ostream& sout, const int i, const bool slots
       sout << "igain: " << rfIGain << std::endl;
    }
 
+   indent(sout,i+j);
+   sout << "numSweeps: " << nSweeps << std::endl;
+
+   indent(sout,i+j);
+   sout << "ptrsPerSweep: " << nPtrs << std::endl;
+
    // DPG #### Need to print slots!!!
    BaseClass::serialize(sout,i+j,true);
 
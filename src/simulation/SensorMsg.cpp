@@ -92,7 +92,7 @@ void SensorMsg::deleteData()
 
 
 //------------------------------------------------------------------------------
-// clear() -- clears out the emissions
+// clear() -- clears out the message (i.e., returns it to its constructed state)
 //------------------------------------------------------------------------------
 void SensorMsg::clear()
 {
@@ -100,6 +100,7 @@ void SensorMsg::clear()
    setGimbal(0);
    setTarget(0);
    setDataMessage(0);
+   initData();
 }
 //------------------------------------------------------------------------------
 // Sets the range to the target
@@ -44,6 +44,24 @@ void RfSignature::deleteData()
 {
 }
 
+//------------------------------------------------------------------------------
+// getRCSN() -- Get the RCS of 'n' emissions
+//------------------------------------------------------------------------------
+void RfSignature::getRCSN(const Emission* const ems[], LCreal rcs[], const unsigned int n)
+{
+    for (unsigned int i = 0; i < n; i++) {
+        rcs[i] = getRCS(ems[i]);
+    }
+}
+
+//------------------------------------------------------------------------------
+// getCostClass() -- Relative cost of computing the RCS
+//------------------------------------------------------------------------------
+RfSignature::CostClass RfSignature::getCostClass() const
+{
+    return COMPOSITE_COST;
+}
+
 
 //==============================================================================
 // Class: SigConstant
@@ -109,6 +127,11 @@ LCreal SigConstant::getRCS(const Emission* const)
     return rcs;
 }
 
+RfSignature::CostClass SigConstant::getCostClass() const
+{
+    return CONSTANT_COST;
+}
+
 //------------------------------------------------------------------------------
 // setRCS() -- Set the RCS 
 //------------------------------------------------------------------------------
@@ -198,6 +221,11 @@ LCreal SigSphere::getRCS(const Emission* const)
     return rcs;
 }
 
+RfSignature::CostClass SigSphere::getCostClass() const
+{
+    return CONSTANT_COST;
+}
+
 //------------------------------------------------------------------------------
 // setRadiusFromSlot() -- Set the radius from Slot table
 //------------------------------------------------------------------------------
@@ -301,6 +329,11 @@ LCreal SigPlate::getRCS(const Emission* const em)
     return static_cast<LCreal>(rcs);
 }
 
+RfSignature::CostClass SigPlate::getCostClass() const
+{
+    return CLOSED_FORM_COST;
+}
+
 //------------------------------------------------------------------------------
 // setA() -- Set the length
 //------------------------------------------------------------------------------
@@ -493,11 +526,11 @@ void SigSwitch::deleteData()
 
 
 //------------------------------------------------------------------------------
-// getRCS() -- Get the RCS
+// getCurrentSignature() -- Returns the signature of our ownship's camouflage type
 //------------------------------------------------------------------------------
-LCreal SigSwitch::getRCS(const Emission* const em)
+RfSignature* SigSwitch::getCurrentSignature()
 {
-   LCreal rcs = 0.0;
+   RfSignature* sig = 0;
 
    // Find our ownship player ...
    const Player* ownship = static_cast<const Player*>(findContainerByType(typeid(Player)));
@@ -510,21 +543,54 @@ LCreal SigSwitch::getRCS(const Emission* const em)
       // find a RfSignature with this index
       Basic::Pair* pair = findByIndex(camouflage);
       if (pair != 0) {
-         RfSignature* sig = dynamic_cast<RfSignature*>( pair->object() );
-         if (sig != 0) {
+         sig = dynamic_cast<RfSignature*>( pair->object() );
+      }
 
-            // OK -- we've found the correct RfSignature subcomponent
-            // now let it do all of the work
-            rcs = sig->getRCS(em);
+   }
 
-         }
-      }
+   return sig;
+}
+
+//------------------------------------------------------------------------------
+// getRCS() -- Get the RCS
+//------------------------------------------------------------------------------
+LCreal SigSwitch::getRCS(const Emission* const em)
+{
+   LCreal rcs = 0.0;
+
+   RfSignature* sig = getCurrentSignature();
+   if (sig != 0) {
+
+      // OK -- we've found the correct RfSignature subcomponent
+      // now let it do all of the work
+      rcs = sig->getRCS(em);
 
    }
 
    return rcs;
 }
 
+//------------------------------------------------------------------------------
+// getRCSN() -- Get the RCS of 'n' emissions
+//------------------------------------------------------------------------------
+void SigSwitch::getRCSN(const Emission* const ems[], LCreal rcs[], const unsigned int n)
+{
+   RfSignature* sig = getCurrentSignature();
+   if (sig != 0) {
+      sig->getRCSN(ems, rcs, n);
+   }
+   else {
+      for (unsigned int i = 0; i < n; i++) {
+         rcs[i] = 0.0;
+      }
+   }
+}
+
+RfSignature::CostClass SigSwitch::getCostClass() const
+{
+   return COMPOSITE_COST;
+}
+
 
 //==============================================================================
 // Class: SigAzEl
@@ -543,6 +609,8 @@ BEGIN_SLOTTABLE(SigAzEl)
                         //    el are in degrees instead of the default radians
     "inDecibel",        // 4: True if the dependent data is in decibel meters
                         //    squared instead of the default meters squared
+    "gridTolerance",    // 5: Max relative RCS error of the lookup grid, or zero
+                        //    to always use the table
 END_SLOTTABLE(SigAzEl)
 
 // Map slot table to handles 
@@ -551,6 +619,7 @@ BEGIN_SLOT_MAP(SigAzEl)
     ON_SLOT(2, setSlotSwapOrder,    Basic::Number)
     ON_SLOT(3, setSlotInDegrees,    Basic::Number)
     ON_SLOT(4, setSlotDecibel,      Basic::Number)
+    ON_SLOT(5, setSlotGridTolerance,Basic::Number)
 END_SLOT_MAP()
 
 //------------------------------------------------------------------------------
@@ -564,6 +633,15 @@ SigAzEl::SigAzEl()
    swapOrderFlg = false;
    degFlg = false;
    dbFlg = false;
+
+   gridTol = 0;
+   grid = 0;
+   gridNumAz = 0;
+   gridNumEl = 0;
+   gridAz0 = 0;
+   gridEl0 = 0;
+   gridAzScale = 0;
+   gridElScale = 0;
 }
 
 SigAzEl::SigAzEl(const Basic::Table2* const tbl0)
@@ -577,6 +655,15 @@ SigAzEl::SigAzEl(const Basic::Table2* const tbl0)
    swapOrderFlg = false;
    degFlg = false;
    dbFlg = false;
+
+   gridTol = 0;
+   grid = 0;
+   gridNumAz = 0;
+   gridNumEl = 0;
+   gridAz0 = 0;
+   gridEl0 = 0;
+   gridAzScale = 0;
+   gridElScale = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -587,6 +674,7 @@ void SigAzEl::copyData(const SigAzEl& org, const bool cc)
    BaseClass::copyData(org);
    if (cc) {
       tbl = 0;
+      grid = 0;
    }
 
    if (tbl != 0) { tbl->unref(); tbl = 0; }
@@ -597,6 +685,23 @@ void SigAzEl::copyData(const SigAzEl& org, const bool cc)
    swapOrderFlg = org.swapOrderFlg;
    degFlg = org.degFlg;
    dbFlg = org.dbFlg;
+
+   // Copy the grid (it's already been checked)
+   clearGrid();
+   gridTol = org.gridTol;
+   if (org.grid != 0) {
+      const unsigned int n = org.gridNumAz * org.gridNumEl;
+      grid = new LCreal[n];
+      for (unsigned int i = 0; i < n; i++) {
+         grid[i] = org.grid[i];
+      }
+      gridNumAz = org.gridNumAz;
+      gridNumEl = org.gridNumEl;
+      gridAz0 = org.gridAz0;
+      gridEl0 = org.gridEl0;
+      gridAzScale = org.gridAzScale;
+      gridElScale = org.gridElScale;
+   }
 }
 
 //------------------------------------------------------------------------------
@@ -605,6 +710,7 @@ void SigAzEl::copyData(const SigAzEl& org, const bool cc)
 void SigAzEl::deleteData()
 {
     if (tbl != 0) { tbl->unref(); tbl = 0; }
+    clearGrid();
 }
 
 //------------------------------------------------------------------------------
@@ -614,31 +720,263 @@ LCreal SigAzEl::getRCS(const Emission* const em)
 {
    LCreal rcs = 0.0;
    if (em != 0 && tbl != 0) {
-
       // angle of arrival (radians)
-      LCreal iv1 = em->getAzimuthAoi();
-      LCreal iv2 = em->getElevationAoi();
+      if (grid != 0) rcs = computeGridRCS(em->getAzimuthAoi(), em->getElevationAoi());
+      else rcs = computeTableRCS(em->getAzimuthAoi(), em->getElevationAoi());
+   }
+   return rcs;
+}
 
-      // If the table's independent variable's order is swapped: (El, Az)
-      if (isOrderSwapped()) {
-         iv1 = em->getElevationAoi();
-         iv2 = em->getAzimuthAoi();
+//------------------------------------------------------------------------------
+// getRCSN() -- Get the RCS of 'n' emissions
+//------------------------------------------------------------------------------
+void SigAzEl::getRCSN(const Emission* const ems[], LCreal rcs[], const unsigned int n)
+{
+   if (tbl == 0) {
+      for (unsigned int i = 0; i < n; i++) {
+         rcs[i] = 0.0;
+      }
+   }
+   else if (grid != 0) {
+      for (unsigned int i = 0; i < n; i++) {
+         if (ems[i] != 0) rcs[i] = computeGridRCS(ems[i]->getAzimuthAoi(), ems[i]->getElevationAoi());
+         else rcs[i] = 0.0;
+      }
+   }
+   else {
+      for (unsigned int i = 0; i < n; i++) {
+         if (ems[i] != 0) rcs[i] = computeTableRCS(ems[i]->getAzimuthAoi(), ems[i]->getElevationAoi());
+         else rcs[i] = 0.0;
       }
+   }
+}
 
-      // If the table's independent variables are in degrees ..
-      if (isInDegrees()) {
-         iv1 *= static_cast<LCreal>(Basic::Angle::R2DCC);
-         iv2 *= static_cast<LCreal>(Basic::Angle::R2DCC);
+RfSignature::CostClass SigAzEl::getCostClass() const
+{
+   CostClass cost = CONSTANT_COST;
+   if (grid != 0) cost = GRID_COST;
+   else if (tbl != 0) cost = TABLE_COST;
+   return cost;
+}
+
+//------------------------------------------------------------------------------
+// computeTableRCS() -- RCS (meters squared) from the table by the angles of
+// incidence (radians)
+//------------------------------------------------------------------------------
+LCreal SigAzEl::computeTableRCS(const LCreal az, const LCreal el) const
+{
+   LCreal rcs = computeTableValue(az, el);
+
+   // If the dependent data is in decibels ...
+   if (isDecibel()) {
+      rcs = lcPow(LCreal(10.0f), LCreal(rcs/10.0f));
+   }
+   return rcs;
+}
+
+//------------------------------------------------------------------------------
+// computeTableValue() -- the table's dependent value (meters squared or decibels)
+// by the angles of incidence (radians)
+//------------------------------------------------------------------------------
+LCreal SigAzEl::computeTableValue(const LCreal az, const LCreal el) const
+{
+   // angle of arrival (radians)
+   LCreal iv1 = az;
+   LCreal iv2 = el;
+
+   // If the table's independent variable's order is swapped: (El, Az)
+   if (isOrderSwapped()) {
+      iv1 = el;
+      iv2 = az;
+   }
+
+   // If the table's independent variables are in degrees ..
+   if (isInDegrees()) {
+      iv1 *= static_cast<LCreal>(Basic::Angle::R2DCC);
+      iv2 *= static_cast<LCreal>(Basic::Angle::R2DCC);
+   }
+
+   return tbl->lfi(iv1,iv2);
+}
+
+//------------------------------------------------------------------------------
+// computeGridRCS() -- RCS (meters squared) from the grid by the angles of
+// incidence (radians); angles beyond the grid are clamped, as the table does.
+//------------------------------------------------------------------------------
+LCreal SigAzEl::computeGridRCS(const LCreal az, const LCreal el) const
+{
+   // Fractional grid indexes (the negated compares also catch NaNs)
+   LCreal fa = (az - gridAz0) * gridAzScale;
+   if ( !(fa > 0) ) fa = 0;
+   else if (fa > LCreal(gridNumAz - 1)) fa = LCreal(gridNumAz - 1);
+
+   LCreal fe = (el - gridEl0) * gridElScale;
+   if ( !(fe > 0) ) fe = 0;
+   else if (fe > LCreal(gridNumEl - 1)) fe = LCreal(gridNumEl - 1);
+
+   unsigned int ia = static_cast<unsigned int>(fa);
+   if (ia > gridNumAz - 2) ia = gridNumAz - 2;
+   unsigned int ie = static_cast<unsigned int>(fe);
+   if (ie > gridNumEl - 2) ie = gridNumEl - 2;
+   const LCreal ta = fa - LCreal(ia);
+   const LCreal te = fe - LCreal(ie);
+
+   // Bilinear interpolation
+   const LCreal* p0 = &grid[ia * gridNumEl + ie];
+   const LCreal* p1 = p0 + gridNumEl;
+   const LCreal r0 = p0[0] + (p0[1] - p0[0]) * te;
+   const LCreal r1 = p1[0] + (p1[1] - p1[0]) * te;
+   LCreal rcs = r0 + (r1 - r0) * ta;
+
+   // If the dependent data is in decibels ...
+   if (isDecibel()) {
+      rcs = lcPow(LCreal(10.0f), LCreal(rcs/10.0f));
+   }
+   return rcs;
+}
+
+//------------------------------------------------------------------------------
+// buildGrid() -- resamples the table into the RCS grid, which is refined
+// until it's within the grid tolerance of the table (see note 5)
+//------------------------------------------------------------------------------
+void SigAzEl::buildGrid()
+{
+   clearGrid();
+   if (gridTol <= 0 || tbl == 0 || !tbl->isValid() || tbl->isExtrapolationEnabled()) return;
+
+   // Az and el breakpoints
+   const LCreal* azData = tbl->getXData();
+   unsigned int nAzData = tbl->getNumXPoints();
+   const LCreal* elData = tbl->getYData();
+   unsigned int nElData = tbl->getNumYPoints();
+   if (isOrderSwapped()) {
+      azData = tbl->getYData();
+      nAzData = tbl->getNumYPoints();
+      elData = tbl->getXData();
+      nElData = tbl->getNumXPoints();
+   }
+   if (nAzData < 2 || nElData < 2) return;
+   const LCreal cc = (isInDegrees() ? static_cast<LCreal>(Basic::Angle::D2RCC) : 1.0);
+
+   // Grid limits (radians) and the smallest breakpoint spacing
+   const LCreal az0 = azData[0] * cc;
+   const LCreal azRange = (azData[nAzData-1] - azData[0]) * cc;
+   LCreal dAz = azRange;
+   for (unsigned int i = 1; i < nAzData; i++) {
+      const LCreal d = (azData[i] - azData[i-1]) * cc;
+      if (d > 0 && d < dAz) dAz = d;
+   }
+   const LCreal el0 = elData[0] * cc;
+   const LCreal elRange = (elData[nElData-1] - elData[0]) * cc;
+   LCreal dEl = elRange;
+   for (unsigned int i = 1; i < nElData; i++) {
+      const LCreal d = (elData[i] - elData[i-1]) * cc;
+      if (d > 0 && d < dEl) dEl = d;
+   }
+   if (azRange <= 0 || elRange <= 0) return;
+
+   // Number of grid points, starting at the smallest breakpoint spacing
+   // (rounded to the nearest whole number of cells, so a uniform table's
+   // breakpoints are on the grid)
+   unsigned int nAz = static_cast<unsigned int>(azRange / dAz + 0.5) + 1;
+   unsigned int nEl = static_cast<unsigned int>(elRange / dEl + 0.5) + 1;
+   if (nAz < 2) nAz = 2;
+   if (nEl < 2) nEl = 2;
+
+   // Build and check the grid; halve the grid spacing until it's within tolerance
+   bool ok = false;
+   while (!ok && nAz <= (MAX_GRID_POINTS / nEl)) {
+      grid = new LCreal[nAz * nEl];
+      gridNumAz = nAz;
+      gridNumEl = nEl;
+      gridAz0 = az0;
+      gridEl0 = el0;
+      gridAzScale = LCreal(nAz - 1) / azRange;
+      gridElScale = LCreal(nEl - 1) / elRange;
+      for (unsigned int ia = 0; ia < nAz; ia++) {
+         const LCreal az = az0 + azRange * LCreal(ia) / LCreal(nAz - 1);
+         for (unsigned int ie = 0; ie < nEl; ie++) {
+            const LCreal el = el0 + elRange * LCreal(ie) / LCreal(nEl - 1);
+            grid[ia * nEl + ie] = computeTableValue(az, el);
+         }
       }
 
-      rcs = tbl->lfi(iv1,iv2);
+      ok = checkGrid();
+      if (!ok) {
+         clearGrid();
+         nAz = 2 * nAz - 1;
+         nEl = 2 * nEl - 1;
+      }
+   }
+
+   if (!ok && isMessageEnabled(MSG_WARNING)) {
+      std::cerr << "SigAzEl::buildGrid(): grid tolerance not met with " << MAX_GRID_POINTS;
+      std::cerr << " points; using the table" << std::endl;
+   }
+}
 
-      // If the dependent data is in decibels ...
-      if (isDecibel()) {
-         rcs = lcPow(LCreal(10.0f), LCreal(rcs/10.0f));
+//------------------------------------------------------------------------------
+// checkGrid() -- True if the grid is within tolerance of the table at the
+// grid's cell centers and at the table's breakpoints and their midpoints.
+//------------------------------------------------------------------------------
+bool SigAzEl::checkGrid() const
+{
+   // Error floor for small values
+   LCreal maxRcs = 0;
+   for (unsigned int ia = 0; ia < gridNumAz; ia++) {
+      const LCreal az = gridAz0 + LCreal(ia) / gridAzScale;
+      for (unsigned int ie = 0; ie < gridNumEl; ie++) {
+         const LCreal r = lcAbs(computeGridRCS(az, gridEl0 + LCreal(ie) / gridElScale));
+         if (r > maxRcs) maxRcs = r;
       }
    }
-   return rcs;
+   const LCreal floor = 0.001 * maxRcs;
+
+   bool ok = true;
+
+   // Cell centers
+   for (unsigned int ia = 0; ok && ia < (gridNumAz - 1); ia++) {
+      const LCreal az = gridAz0 + (LCreal(ia) + 0.5) / gridAzScale;
+      for (unsigned int ie = 0; ok && ie < (gridNumEl - 1); ie++) {
+         const LCreal el = gridEl0 + (LCreal(ie) + 0.5) / gridElScale;
+         const LCreal r = computeTableRCS(az, el);
+         const LCreal lim = gridTol * (lcAbs(r) > floor ? lcAbs(r) : floor);
+         ok = (lcAbs(computeGridRCS(az, el) - r) <= lim);
+      }
+   }
+
+   // Table breakpoints and their midpoints
+   const LCreal* azData = (isOrderSwapped() ? tbl->getYData() : tbl->getXData());
+   const unsigned int nAzData = (isOrderSwapped() ? tbl->getNumYPoints() : tbl->getNumXPoints());
+   const LCreal* elData = (isOrderSwapped() ? tbl->getXData() : tbl->getYData());
+   const unsigned int nElData = (isOrderSwapped() ? tbl->getNumXPoints() : tbl->getNumYPoints());
+   const LCreal cc = (isInDegrees() ? static_cast<LCreal>(Basic::Angle::D2RCC) : 1.0);
+   for (unsigned int i = 0; ok && i < (2 * nAzData - 1); i++) {
+      const unsigned int ia = i / 2;
+      const LCreal az = ((i % 2) == 0 ? azData[ia] : 0.5 * (azData[ia] + azData[ia+1])) * cc;
+      for (unsigned int j = 0; ok && j < (2 * nElData - 1); j++) {
+         const unsigned int ie = j / 2;
+         const LCreal el = ((j % 2) == 0 ? elData[ie] : 0.5 * (elData[ie] + elData[ie+1])) * cc;
+         const LCreal r = computeTableRCS(az, el);
+         const LCreal lim = gridTol * (lcAbs(r) > floor ? lcAbs(r) : floor);
+         ok = (lcAbs(computeGridRCS(az, el) - r) <= lim);
+      }
+   }
+
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// clearGrid() -- free the grid (use the table)
+//------------------------------------------------------------------------------
+void SigAzEl::clearGrid()
+{
+   if (grid != 0) {
+      delete[] grid;
+      grid = 0;
+   }
+   gridNumAz = 0;
+   gridNumEl = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -659,22 +997,42 @@ bool SigAzEl::isTableValid() const
 
 bool SigAzEl::setSwapOrder(const bool flg)
 {
-   swapOrderFlg = flg;
+   if (flg != swapOrderFlg) {
+      swapOrderFlg = flg;
+      buildGrid();
+   }
    return true;
 }
 
 bool SigAzEl::setInDegrees(const bool flg)
 {
-   degFlg = flg;
+   if (flg != degFlg) {
+      degFlg = flg;
+      buildGrid();
+   }
    return true;
 }
 
 bool SigAzEl::setDecibel(const bool flg)
 {
-   dbFlg = flg;
+   if (flg != dbFlg) {
+      dbFlg = flg;
+      buildGrid();
+   }
    return true;
 }
 
+bool SigAzEl::setGridTolerance(const LCreal tol)
+{
+   bool ok = false;
+   if (tol >= 0) {
+      gridTol = tol;
+      buildGrid();
+      ok = true;
+   }
+   return ok;
+}
+
 //------------------------------------------------------------------------------
 // Slot functions
 //------------------------------------------------------------------------------
@@ -687,6 +1045,7 @@ bool SigAzEl::setSlotTable(const Basic::Table2* const msg)
       if (tbl != 0) tbl->unref();
       msg->ref();
       tbl = msg;
+      buildGrid();
       ok = true;
    }
    return ok;
@@ -719,6 +1078,18 @@ bool SigAzEl::setSlotDecibel(const Basic::Number* const msg)
    return ok;
 }
 
+bool SigAzEl::setSlotGridTolerance(const Basic::Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      ok = setGridTolerance( msg->getReal() );
+      if (!ok) {
+         std::cerr << "SigAzEl::setSlotGridTolerance: invalid tolerance; must be greater than or equal to zero!" << std::endl;
+      }
+   }
+   return ok;
+}
+
 //------------------------------------------------------------------------------
 // getSlotByIndex()
 //------------------------------------------------------------------------------
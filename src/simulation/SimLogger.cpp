@@ -182,14 +182,17 @@ void SimLogger::updateData(const LCreal dt)
 {
     BaseClass::updateData(dt);
 
-    // Log the simulation events
-    SimLogEvent* event = seQueue.get();
-    while (event != 0) {
-        const char* const p = event->getDescription();
-        Basic::Logger::log(p);
-        event->unref();
-
-        event = seQueue.get();
+    // Log the simulation events, a batch at a time
+    static const unsigned int BATCH_SIZE = 64;
+    SimLogEvent* events[BATCH_SIZE];
+    unsigned int n = seQueue.getN(events, BATCH_SIZE);
+    while (n > 0) {
+        for (unsigned int i = 0; i < n; i++) {
+            const char* const p = events[i]->getDescription();
+            Basic::Logger::log(p);
+            events[i]->unref();
+        }
+        n = seQueue.getN(events, BATCH_SIZE);
     }
 }
 
@@ -211,7 +214,8 @@ void SimLogger::log(LogEvent* const event)
         simEvent->setPrintSimTime(includeSimTime);
         simEvent->captureData();
 
-        seQueue.put(simEvent);
+        // Dropped if the queue is full
+        if (!seQueue.put(simEvent)) simEvent->unref();
     }
     else {
         Basic::Logger::log(event);
@@ -363,6 +367,11 @@ SimLogger::SimLogEvent::SimLogEvent()
 {
     STANDARD_CONSTRUCTOR()
 
+    initData();
+}
+
+void SimLogger::SimLogEvent::initData()
+{
     time = 0;
     simTime = 0;
     execTime = 0;
@@ -431,6 +440,15 @@ void SimLogger::SimLogEvent::deleteData()
     msg = 0;
 }
 
+//------------------------------------------------------------------------------
+// clear() -- clears the event (i.e., returns it to its constructed state)
+//------------------------------------------------------------------------------
+void SimLogger::SimLogEvent::clear()
+{
+    if (msg != 0) delete[] msg;
+    initData();
+}
+
 //------------------------------------------------------------------------------
 // makeTimeMsg() -- make the time string
 //------------------------------------------------------------------------------
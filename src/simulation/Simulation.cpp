@@ -4,12 +4,14 @@
 #include "openeaagles/simulation/Simulation.h"
 
 #include "openeaagles/simulation/DataRecorder.h"
+#include "openeaagles/simulation/Datalink.h"
 #include "openeaagles/simulation/IrAtmosphere.h"
 #include "openeaagles/simulation/NetIO.h"
 #include "openeaagles/simulation/Nib.h"
 #include "openeaagles/simulation/Player.h"
 #include "openeaagles/simulation/Station.h"
 #include "openeaagles/simulation/TabLogger.h"
+#include "openeaagles/simulation/Weapon.h"
 
 #include "openeaagles/dafif/AirportLoader.h"
 #include "openeaagles/dafif/NavaidLoader.h"
@@ -29,11 +31,15 @@
 #include "openeaagles/basic/osg/Vec4"
 #include "openeaagles/basic/Statistic.h"
 #include "openeaagles/basic/Terrain.h"
+#include <cmath>
 #include <cstring>
 
 namespace Eaagles {
 namespace Simulation {
 
+// Default broad phase grid cell size (meters)
+static const LCreal DEFAULT_BP_CELL_SIZE = 1852.0f;
+
 //=============================================================================
 // Declare the threads
 //=============================================================================
@@ -51,6 +57,13 @@ public:
       const unsigned int n0
    );
 
+   // Parent thread signals start to this child thread to compute
+   // part of the dead reckoning batch
+   void startDeadReckoning(
+      const unsigned int idx0,
+      const unsigned int n0
+   );
+
 private:
    // ThreadSyncTask class function -- our userFunc()
    virtual unsigned long userFunc();
@@ -60,6 +73,7 @@ private:
    LCreal dt0;
    unsigned int idx0;
    unsigned int n0;
+   bool drFlg;             // Compute the dead reckoning batch
 };
 
 class SimBgThread : public Basic::ThreadSyncTask {
@@ -225,6 +239,16 @@ void Simulation::initData()
    simTvUSec = 0;
    simTimeSlaved = true;
 
+   for (unsigned int i = 0; i < 4; i++) {
+      phaseTimes[i] = 0;
+   }
+   phaseTimingFlg = false;
+   for (unsigned int i = 0; i < NUM_SUBSYSTEMS; i++) {
+      tcSubsysTimes[i] = 0;
+      bgSubsysTimes[i] = 0;
+   }
+   subsysTimesLock = 0;
+
    simTime0 = -1;
    simDay0 = 0;
    simMonth0 = 0;
@@ -249,6 +273,28 @@ void Simulation::initData()
       bgThreads[i] = 0;
    }
    bgThreadsFailed = false;
+
+   detQueue = 0;
+   nDetQueue = 0;
+   maxDetQueue = 0;
+   detBatch = 0;
+   maxDetBatch = 0;
+   detLock = 0;
+
+   detPlayers = 0;
+   maxDetPlayers = 0;
+
+   dlQueue = 0;
+   nDlQueue = 0;
+   maxDlQueue = 0;
+   dlBatch = 0;
+   maxDlBatch = 0;
+   dlLock = 0;
+
+   bpMargin = 0;
+   bpCellSize = DEFAULT_BP_CELL_SIZE;
+   bpMaxRng = 0;
+   bpLock = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -263,6 +309,8 @@ void Simulation::copyData(const Simulation& org, const bool cc)
    station = 0;
 
    // Unref our old stuff (if any)
+   clearDetonations();
+   clearDatalinkMessages();
 
    // Copy original players -- DPG need proper method to copy original player list
    if (origPlayers != 0) { origPlayers = 0; }
@@ -331,6 +379,7 @@ void Simulation::copyData(const Simulation& org, const bool cc)
    simTvSec = org.simTvSec;
    simTvUSec = org.simTvUSec;
    simTimeSlaved = org.simTimeSlaved;
+   phaseTimingFlg = org.phaseTimingFlg;
 
    simTime0 = org.simTime0; 
    simDay0 = org.simDay0;
@@ -401,6 +450,31 @@ void Simulation::deleteData()
    numBgThreads = 0;
    bgThreadsFailed = false;
 
+   clearDetonations();
+   if (detQueue != 0) delete[] detQueue;
+   detQueue = 0;
+   maxDetQueue = 0;
+   if (detBatch != 0) delete[] detBatch;
+   detBatch = 0;
+   maxDetBatch = 0;
+
+   detGrid.clear();
+   if (detPlayers != 0) delete[] detPlayers;
+   detPlayers = 0;
+   maxDetPlayers = 0;
+
+   drBatch.clear();
+
+   clearDatalinkMessages();
+   if (dlQueue != 0) delete[] dlQueue;
+   dlQueue = 0;
+   maxDlQueue = 0;
+   if (dlBatch != 0) delete[] dlBatch;
+   dlBatch = 0;
+   maxDlBatch = 0;
+
+   bpGrid.clear();
+
    station = 0;
 }
 
@@ -409,6 +483,12 @@ void Simulation::deleteData()
 //------------------------------------------------------------------------------
 void Simulation::reset()
 {
+   // ---
+   // Clear any queued detonations and datalink messages
+   // ---
+   clearDetonations();
+   clearDatalinkMessages();
+
    // ---
    // Something old and something new ...
    // ... We're going to create a new player list.
@@ -485,17 +565,17 @@ void Simulation::reset()
    if ( !loggedHeadings ) {  // EventLogger Deprecated
       if (getAnyEventLogger() != 0) {
          {
-            TabLogger::TabLogEvent* evt = new TabLogger::LogPlayerData(0, 0); // code 0 for "header" msg
+            TabLogger::TabLogEvent* evt = TabLogger::LogPlayerData::create(0, 0); // code 0 for "header" msg
             getAnyEventLogger()->log(evt);
             evt->unref();
          }
          {
-            TabLogger::TabLogEvent* evt = new TabLogger::LogActiveTrack(0, 0, 0); // code 0 for "header" msg
+            TabLogger::TabLogEvent* evt = TabLogger::LogActiveTrack::create(0, 0, 0); // code 0 for "header" msg
             getAnyEventLogger()->log(evt);
             evt->unref();
          }
          {
-            TabLogger::TabLogEvent* evt = new TabLogger::LogPassiveTrack(0, 0, 0); // code 0 for "header" msg
+            TabLogger::TabLogEvent* evt = TabLogger::LogPassiveTrack::create(0, 0, 0); // code 0 for "header" msg
             getAnyEventLogger()->log(evt);
             evt->unref();
          }
@@ -824,11 +904,24 @@ void Simulation::updateTC(const LCreal dt)
       // This locks the current player list for this time-critical frame
       SPtr<Basic::PairStream> currentPlayerList = players;
 
+      // The players sum their subsystem times over the frame's phases
+      if (phaseTimingFlg) {
+         for (unsigned int i = 0; i < NUM_SUBSYSTEMS; i++) {
+            tcSubsysTimes[i] = 0;
+         }
+      }
+
       for (unsigned int f = 0; f < 4; f++) {
 
          // Set the current phase
          setPhase(f);
 
+         double phaseStart = 0;
+         if (phaseTimingFlg) phaseStart = getComputerTime();
+
+         // Dead reckon the networked players before their phase 0 dynamics
+         if (f == 0) deadReckonNetworkPlayers(currentPlayerList, (dt0/4.0f));
+
          if (reqTcThreads == 1) {
             // Our single TC thread
             updateTcPlayerList(currentPlayerList, (dt0/4.0f), 1, 1);
@@ -856,6 +949,14 @@ void Simulation::updateTC(const LCreal dt)
             std::cerr << "; numTcThreads = " << numTcThreads;
             std::cerr << std::endl;
          }
+
+         // Process the effects of this phase's detonations
+         processDetonations();
+
+         // Deliver this phase's datalink messages
+         processDatalinkMessages();
+
+         if (phaseTimingFlg) phaseTimes[f] = getComputerTime() - phaseStart;
       }
    }
 
@@ -869,6 +970,407 @@ void Simulation::updateTC(const LCreal dt)
    setPhase(0);
 }
 
+//------------------------------------------------------------------------------
+// queueDetonation() -- queues a detonation; its effects are processed, with the
+// other detonations of this phase, by processDetonations() at the end of the
+// phase.  Weapons can queue detonations from multiple T/C threads and from the
+// network threads.
+//------------------------------------------------------------------------------
+bool Simulation::queueDetonation(
+      Weapon* const wpn,
+      const osg::Vec3& pos,
+      const LCreal maxRng,
+      Player* const tgt,
+      const bool all
+   )
+{
+   if (wpn == 0) return false;
+
+   lcLock(detLock);
+
+   // Grow the queue, as needed
+   if (nDetQueue >= maxDetQueue) {
+      const unsigned int newMax = (maxDetQueue > 0 ? maxDetQueue * 2 : 32);
+      QueuedDetonation* newQueue = new QueuedDetonation[newMax];
+      for (unsigned int i = 0; i < nDetQueue; i++) {
+         newQueue[i] = detQueue[i];
+      }
+      if (detQueue != 0) delete[] detQueue;
+      detQueue = newQueue;
+      maxDetQueue = newMax;
+   }
+
+   QueuedDetonation* p = &detQueue[nDetQueue++];
+   wpn->ref();
+   p->wpn = wpn;
+   p->pos = pos;
+   p->maxRng = maxRng;
+   if (tgt != 0) tgt->ref();
+   p->tgt = tgt;
+   p->all = all;
+
+   lcUnlock(detLock);
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// processDetonations() -- process the effects of the queued detonations
+//------------------------------------------------------------------------------
+void Simulation::processDetonations()
+{
+   // Processing a batch can queue more detonations (e.g., a weapon that's
+   // destroyed by a detonation), so process the queue until it's empty, but
+   // limit the number of batches.
+   static const unsigned int MAX_BATCHES = 8;
+
+   for (unsigned int batch = 0; batch < MAX_BATCHES; batch++) {
+
+      // ---
+      // Swap the queue with our batch array
+      // ---
+      lcLock(detLock);
+      const unsigned int n = nDetQueue;
+      QueuedDetonation* const tmp = detBatch;
+      const unsigned int tmpMax = maxDetBatch;
+      detBatch = detQueue;
+      maxDetBatch = maxDetQueue;
+      detQueue = tmp;
+      maxDetQueue = tmpMax;
+      nDetQueue = 0;
+      lcUnlock(detLock);
+
+      if (n == 0) break;
+
+      // ---
+      // Sort the players into the grid; the cells are as large as the largest
+      // range, so each detonation checks at most 3 x 3 cells.
+      // ---
+      LCreal cellSize = 1.0f;
+      for (unsigned int i = 0; i < n; i++) {
+         if (detBatch[i].maxRng > cellSize) cellSize = detBatch[i].maxRng;
+      }
+      Basic::PairStream* plist = getPlayers();
+      detGrid.build(plist, cellSize);
+      if (plist != 0) plist->unref();   // (the grid holds its own reference)
+      plist = 0;
+
+      // ---
+      // Process each detonation
+      // ---
+      for (unsigned int i = 0; i < n; i++) {
+         QueuedDetonation* const det = &detBatch[i];
+         Weapon* const wpn = det->wpn;
+         bool tgtChecked = false;
+
+         // Players near the detonation (grow the array as needed)
+         unsigned int np = detGrid.query(det->pos, det->maxRng, detPlayers, maxDetPlayers);
+         if (np > maxDetPlayers) {
+            if (detPlayers != 0) delete[] detPlayers;
+            maxDetPlayers = detGrid.getNumPlayers();
+            detPlayers = new Player*[maxDetPlayers];
+            np = detGrid.query(det->pos, det->maxRng, detPlayers, maxDetPlayers);
+         }
+
+         for (unsigned int k = 0; k < np; k++) {
+            Player* const p = detPlayers[k];
+            if (p == det->tgt) tgtChecked = true;
+            if (p != wpn && (det->all || !p->isNetworkedPlayer())) {
+               wpn->detonationEffect(p, det->pos, det->maxRng, det->tgt);
+            }
+         }
+
+         // The target is checked even if it's outside of the detonation's range,
+         // but only if it's still on the player list.
+         if (det->tgt != 0 && !tgtChecked && det->tgt != wpn && (det->all || !det->tgt->isNetworkedPlayer())) {
+            if (detGrid.contains(det->tgt)) {
+               wpn->detonationEffect(det->tgt, det->pos, det->maxRng, det->tgt);
+            }
+         }
+
+         // We're done with this detonation
+         wpn->unref();
+         det->wpn = 0;
+         if (det->tgt != 0) det->tgt->unref();
+         det->tgt = 0;
+      }
+
+      // cleanup
+      detGrid.clear();
+   }
+}
+
+//------------------------------------------------------------------------------
+// findNearbyPlayers() -- broad phase: finds the players that could be within
+// range of a position.  Called by the players' background processing, which
+// can be multi-threaded.
+//------------------------------------------------------------------------------
+int Simulation::findNearbyPlayers(const osg::Vec3& pos, const LCreal rng, Player* list[], const unsigned int max)
+{
+   if (!bpGrid.isValid()) return -1;
+
+   // Keep track of the largest range for the next frame's cell size
+   lcLock(bpLock);
+   if (rng > bpMaxRng) bpMaxRng = rng;
+   lcUnlock(bpLock);
+
+   // Pad the range for the players' motion during the frame and for the
+   // differences between the gaming area (NED) and world (ECEF) ranges.
+   const LCreal rng1 = rng + bpMargin + rng * 0.01f;
+
+   return static_cast<int>( bpGrid.query(pos, rng1, list, max) );
+}
+
+//------------------------------------------------------------------------------
+// queueDatalinkMessage() -- queues a datalink message; it's delivered, with the
+// other messages of this phase, by processDatalinkMessages() at the end of the
+// phase.  Datalinks can queue messages from multiple T/C threads and from the
+// background threads.
+//------------------------------------------------------------------------------
+bool Simulation::queueDatalinkMessage(Datalink* const src, Basic::Object* const msg, const LCreal maxRng)
+{
+   if (src == 0 || msg == 0) return false;
+
+   Player* const own = src->getOwnship();
+   if (own == 0) return false;
+
+   lcLock(dlLock);
+
+   // Grow the queue, as needed
+   if (nDlQueue >= maxDlQueue) {
+      const unsigned int newMax = (maxDlQueue > 0 ? maxDlQueue * 2 : 64);
+      QueuedDatalinkMsg* newQueue = new QueuedDatalinkMsg[newMax];
+      for (unsigned int i = 0; i < nDlQueue; i++) {
+         newQueue[i] = dlQueue[i];
+      }
+      if (dlQueue != 0) delete[] dlQueue;
+      dlQueue = newQueue;
+      maxDlQueue = newMax;
+   }
+
+   QueuedDatalinkMsg* p = &dlQueue[nDlQueue++];
+   src->ref();
+   p->src = src;
+   own->ref();
+   p->ownship = own;
+   msg->ref();
+   p->msg = msg;
+   p->posValid = own->isPositionVectorValid();
+   if (p->posValid) {
+      const osg::Vec3d& pos = own->getPosition();
+      p->pos.set( static_cast<LCreal>(pos.x()), static_cast<LCreal>(pos.y()), static_cast<LCreal>(pos.z()) );
+   }
+   else {
+      p->pos.set(0,0,0);
+   }
+   p->maxRng = maxRng;
+
+   lcUnlock(dlLock);
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// processDatalinkMessages() -- deliver the queued datalink messages
+//------------------------------------------------------------------------------
+void Simulation::processDatalinkMessages()
+{
+   // Receiving a message can send more messages (e.g., a relay), so process the
+   // queue until it's empty, but limit the number of batches.
+   static const unsigned int MAX_BATCHES = 4;
+
+   for (unsigned int batch = 0; batch < MAX_BATCHES; batch++) {
+
+      // ---
+      // Swap the queue with our batch array
+      // ---
+      lcLock(dlLock);
+      const unsigned int n = nDlQueue;
+      QueuedDatalinkMsg* const tmp = dlBatch;
+      const unsigned int tmpMax = maxDlBatch;
+      dlBatch = dlQueue;
+      maxDlBatch = maxDlQueue;
+      dlQueue = tmp;
+      maxDlQueue = tmpMax;
+      nDlQueue = 0;
+      lcUnlock(dlLock);
+
+      if (n == 0) break;
+
+      // ---
+      // Sort the players into the grid; the cells are as large as the largest
+      // range, so each message checks at most 3 x 3 cells.
+      // ---
+      LCreal cellSize = 1.0f;
+      for (unsigned int i = 0; i < n; i++) {
+         if (dlBatch[i].maxRng > cellSize) cellSize = dlBatch[i].maxRng;
+      }
+      Basic::PairStream* plist = getPlayers();
+      detGrid.build(plist, cellSize);
+
+      // Make sure the players array can hold the whole player list
+      if (maxDetPlayers < detGrid.getNumPlayers()) {
+         if (detPlayers != 0) delete[] detPlayers;
+         maxDetPlayers = detGrid.getNumPlayers();
+         detPlayers = new Player*[maxDetPlayers];
+      }
+
+      // ---
+      // Deliver each message
+      // ---
+      for (unsigned int i = 0; i < n; i++) {
+         QueuedDatalinkMsg* const dl = &dlBatch[i];
+
+         // Candidate players: the players near the sender, or all of the
+         // players if the sender's position isn't valid.
+         unsigned int np = 0;
+         if (dl->posValid) {
+            np = detGrid.query(dl->pos, dl->maxRng, detPlayers, maxDetPlayers);
+         }
+         else if (plist != 0) {
+            Basic::List::Item* item = plist->getFirstItem();
+            while (item != 0 && np < maxDetPlayers) {
+               Basic::Pair* pair = static_cast<Basic::Pair*>(item->getValue());
+               detPlayers[np++] = static_cast<Player*>(pair->object());
+               item = item->getNext();
+            }
+         }
+
+         const unsigned int side = static_cast<unsigned int>(dl->ownship->getSide());
+         const unsigned int network = dl->src->getNetworkId();
+         const double maxRng2 = static_cast<double>(dl->maxRng) * static_cast<double>(dl->maxRng);
+
+         for (unsigned int k = 0; k < np; k++) {
+            Player* const p = detPlayers[k];
+
+            // Networked players are at the end of the list, so we can stop now.
+            if (!p->isLocalPlayer()) break;
+
+            // Send to active, local players only (and not to ourself)
+            if (p == dl->ownship || !(p->isActive() || p->isMode(Player::PRE_RELEASE))) continue;
+
+            // Only to datalinks that are on our network and subscribed to our side
+            const Datalink* const rdl = p->getDatalink();
+            if (rdl == 0) continue;
+            if (network != 0 && rdl->getNetworkId() != 0 && rdl->getNetworkId() != network) continue;
+            if ((rdl->getSideMask() & side) == 0) continue;
+
+            // and within range
+            if (dl->posValid && p->isPositionVectorValid()) {
+               const osg::Vec3d& pos = p->getPosition();
+               const double dn = pos.x() - dl->pos.x();
+               const double de = pos.y() - dl->pos.y();
+               const double dd = pos.z() - dl->pos.z();
+               if ( (dn*dn + de*de + dd*dd) > maxRng2 ) continue;
+            }
+
+            p->event(DATALINK_MESSAGE, dl->msg);
+         }
+
+         // We're done with this message
+         dl->msg->unref();
+         dl->msg = 0;
+         dl->ownship->unref();
+         dl->ownship = 0;
+         dl->src->unref();
+         dl->src = 0;
+      }
+
+      // cleanup
+      detGrid.clear();
+      if (plist != 0) plist->unref();
+      plist = 0;
+   }
+}
+
+//------------------------------------------------------------------------------
+// clearDatalinkMessages() -- clears the datalink message queue
+//------------------------------------------------------------------------------
+void Simulation::clearDatalinkMessages()
+{
+   lcLock(dlLock);
+   for (unsigned int i = 0; i < nDlQueue; i++) {
+      if (dlQueue[i].msg != 0) dlQueue[i].msg->unref();
+      if (dlQueue[i].ownship != 0) dlQueue[i].ownship->unref();
+      if (dlQueue[i].src != 0) dlQueue[i].src->unref();
+   }
+   nDlQueue = 0;
+   lcUnlock(dlLock);
+}
+
+//------------------------------------------------------------------------------
+// clearDetonations() -- clears the detonation queue
+//------------------------------------------------------------------------------
+void Simulation::clearDetonations()
+{
+   lcLock(detLock);
+   for (unsigned int i = 0; i < nDetQueue; i++) {
+      if (detQueue[i].wpn != 0) detQueue[i].wpn->unref();
+      if (detQueue[i].tgt != 0) detQueue[i].tgt->unref();
+   }
+   nDetQueue = 0;
+   lcUnlock(detLock);
+}
+
+//------------------------------------------------------------------------------
+// deadReckonNetworkPlayers() -- dead reckons the NIBs of the networked players,
+// as one batch, to the DR time of their next dynamics(); 'dt' is the phase's
+// delta time.
+//------------------------------------------------------------------------------
+void Simulation::deadReckonNetworkPlayers(Basic::PairStream* const playerList, const LCreal dt)
+{
+   drBatch.clear();
+   if (playerList == 0) return;
+
+   // ---
+   // Collect the NIBs of the active networked players
+   // ---
+   Basic::List::Item* item = playerList->getFirstItem();
+   while (item != 0) {
+      Basic::Pair* pair = static_cast<Basic::Pair*>(item->getValue());
+      Player* ip = static_cast<Player*>(pair->object());
+      if (ip->isNetworkedPlayer() && (ip->isMode(Player::ACTIVE) || ip->isMode(Player::PRE_RELEASE))) {
+         Nib* nib = ip->getNib();
+         if (nib != 0 && nib->getIoType() == NetIO::INPUT_NIB) {
+            // Same delta time as Player::updateTC() passes to dynamics()
+            LCreal dt1 = dt;
+            if (ip->isFrozen()) dt1 = 0.0;
+            LCreal dt4 = dt1 * 4.0f;
+            drBatch.add(nib, nib->getDrTime() + dt4);
+         }
+      }
+      item = item->getNext();
+   }
+   if (drBatch.getNumNibs() == 0) return;
+
+   // ---
+   // Dead reckon the batch, split across the T/C threads if there are enough NIBs
+   // ---
+   drBatch.sort();
+   if (numTcThreads > 0 && drBatch.getNumNibs() >= (MIN_DR_NIBS_PER_THREAD * reqTcThreads)) {
+      for (unsigned short i = 0; i < numTcThreads; i++) {
+         tcThreads[i]->startDeadReckoning((i+1), reqTcThreads);
+      }
+
+      // we're the last thread
+      computeDeadReckoningBatch(reqTcThreads, reqTcThreads);
+
+      // Now wait for the other thread(s) to complete
+      Basic::ThreadSyncTask** pp = reinterpret_cast<Basic::ThreadSyncTask**>(&tcThreads[0]);
+      Basic::ThreadSyncTask::waitForAllCompleted(pp, numTcThreads);
+   }
+   else {
+      computeDeadReckoningBatch(1, 1);
+   }
+}
+
+//------------------------------------------------------------------------------
+// computeDeadReckoningBatch() -- dead reckons the idx'th part of 'n' parts of
+// the networked players' DR batch
+//------------------------------------------------------------------------------
+void Simulation::computeDeadReckoningBatch(const unsigned int idx, const unsigned int n)
+{
+   drBatch.compute(idx, n);
+}
+
 //------------------------------------------------------------------------------
 // Time critical thread processing for every n'th player starting
 // with the idx'th player
@@ -916,6 +1418,20 @@ void Simulation::updateData(const LCreal dt)
     if (players != 0) {
         SPtr<Basic::PairStream> currentPlayerList = players;
 
+        // Broad phase: sort the players into the grid; the players (ours and the
+        // others) can move as much as twice the max speed times the frame time.
+        if (bpMaxRng > 0) bpCellSize = bpMaxRng;
+        bpMaxRng = 0;
+        bpGrid.build(currentPlayerList, bpCellSize);
+        bpMargin = static_cast<LCreal>(bpGrid.getMaxSpeed() * dt0 * 2.0);
+
+        // The players sum their subsystem times
+        if (phaseTimingFlg) {
+           for (unsigned int i = 0; i < NUM_SUBSYSTEMS; i++) {
+              bgSubsysTimes[i] = 0;
+           }
+        }
+
          if (reqBgThreads == 1) {
             // Our single thread
             updateBgPlayerList(currentPlayerList, dt0, 1, 1);
@@ -943,6 +1459,9 @@ void Simulation::updateData(const LCreal dt)
             std::cerr << "; numBgThreads = " << numBgThreads;
             std::cerr << std::endl;
         }
+
+        // The broad phase is only valid during the players' background processing
+        bpGrid.clear();
     }
 
     // --- 
@@ -1122,6 +1641,48 @@ void Simulation::getSimTimeValues(
    if (simUSec != 0) *simUSec = simTvUSec;
 }
 
+// Is phase timing enabled?
+bool Simulation::isPhaseTimingEnabled() const
+{
+   return phaseTimingFlg;
+}
+
+// Wall-clock time (sec) of phase 'p' during the last frame
+double Simulation::getPhaseTime(const unsigned int p) const
+{
+   double t = 0;
+   if (p < 4) t = phaseTimes[p];
+   return t;
+}
+
+// T/C frame time (sec) of subsystem type 's' during the last frame
+double Simulation::getTcSubsystemTime(const unsigned int s) const
+{
+   double t = 0;
+   if (s < NUM_SUBSYSTEMS) t = tcSubsysTimes[s];
+   return t;
+}
+
+// Background frame time (sec) of subsystem type 's' during the last frame
+double Simulation::getBgSubsystemTime(const unsigned int s) const
+{
+   double t = 0;
+   if (s < NUM_SUBSYSTEMS) t = bgSubsysTimes[s];
+   return t;
+}
+
+// Name of subsystem type 's'
+const char* Simulation::getSubsystemName(const unsigned int s)
+{
+   static const char* const names[NUM_SUBSYSTEMS] = {
+      "player", "dynamicsModel", "datalink", "gimbal", "irSystem", "navigation",
+      "onboardComputer", "pilot", "radio", "sensor", "storesMgr", "other"
+   };
+   const char* p = 0;
+   if (s < NUM_SUBSYSTEMS) p = names[s];
+   return p;
+}
+
 // Generates an unique major simulation event ID [1 .. 65535]
 unsigned short Simulation::getNewEventID()
 {
@@ -1440,7 +2001,7 @@ void Simulation::updatePlayerList()
 
                 // TabLogger is deprecated
                 if (getAnyEventLogger() != 0) {  // EventLogger Deprecated
-                     TabLogger::TabLogEvent* evt = new TabLogger::LogPlayerData(3, p); // code 3 for "remove" msg
+                     TabLogger::TabLogEvent* evt = TabLogger::LogPlayerData::create(3, p); // code 3 for "remove" msg
                      getAnyEventLogger()->log(evt);
                      evt->unref();
                 }
@@ -1461,7 +2022,7 @@ void Simulation::updatePlayerList()
 
             // TabLogger is deprecated
             if (getAnyEventLogger() != 0) {  // EventLogger Deprecated
-                TabLogger::TabLogEvent* evt = new TabLogger::LogPlayerData(1, ip); // code 1 for "new" msg
+                TabLogger::TabLogEvent* evt = TabLogger::LogPlayerData::create(1, ip); // code 1 for "new" msg
                 getAnyEventLogger()->log(evt);
                 evt->unref();
             }
@@ -1496,9 +2057,10 @@ bool Simulation::addNewPlayer(Basic::Pair* const player)
     if (player == 0) return false;
     player->ref();
 
-    newPlayerQueue.put(player);
+    bool ok = newPlayerQueue.put(player);
+    if (!ok) player->unref();   // queue is full
 
-    return true;
+    return ok;
 }
 
 //------------------------------------------------------------------------------
@@ -1732,6 +2294,32 @@ bool Simulation::setInitialSimulationTime(const long time)
    return true;
 }
 
+// Enables/disables phase (and subsystem) timing
+bool Simulation::setPhaseTimingEnabled(const bool enb)
+{
+   phaseTimingFlg = enb;
+   for (unsigned int i = 0; i < 4; i++) {
+      phaseTimes[i] = 0;
+   }
+   for (unsigned int i = 0; i < NUM_SUBSYSTEMS; i++) {
+      tcSubsysTimes[i] = 0;
+      bgSubsysTimes[i] = 0;
+   }
+   return true;
+}
+
+// Adds time 't' (sec) to subsystem type 's' of the current T/C ('tc' is true)
+// or background frame; the players call this from the T/C and background threads.
+void Simulation::addSubsystemTime(const bool tc, const unsigned int s, const double t)
+{
+   if (phaseTimingFlg && s < NUM_SUBSYSTEMS) {
+      lcLock(subsysTimesLock);
+      if (tc) tcSubsysTimes[s] += t;
+      else bgSubsysTimes[s] += t;
+      lcUnlock(subsysTimesLock);
+   }
+}
+
 // Increment the cycle counter
 void Simulation::incCycle()
 {
@@ -2080,6 +2668,7 @@ SimTcThread::SimTcThread(Basic::Component* const parent, const LCreal priority)
    dt0 = 0 ;
    idx0 = 0;
    n0 = 0;
+   drFlg = false;
 }
 
 void SimTcThread::start(
@@ -2093,14 +2682,37 @@ void SimTcThread::start(
    dt0 = dt1;
    idx0 = idx1;
    n0 = n1;
+   drFlg = false;
+
+   signalStart();
+}
+
+void SimTcThread::startDeadReckoning(
+         const unsigned int idx1,
+         const unsigned int n1
+      )
+{
+   pl0 = 0;
+   dt0 = 0;
+   idx0 = idx1;
+   n0 = n1;
+   drFlg = true;
 
    signalStart();
 }
 
 unsigned long SimTcThread::userFunc()
 {
+   // Dead reckoning batch?
+   if (drFlg) {
+      if (idx0 > 0 && idx0 <= n0) {
+         Simulation* sim = static_cast<Simulation*>(getParent());
+         sim->computeDeadReckoningBatch(idx0, n0);
+      }
+   }
+
    // Make sure we've a player list and our index is valid ...
-   if (pl0 != 0 && idx0 > 0 && idx0 <= n0) {
+   else if (pl0 != 0 && idx0 > 0 && idx0 <= n0) {
       // then call the Simulation class' update TC player list functions
       Simulation* sim = static_cast<Simulation*>(getParent());
       sim->updateTcPlayerList(pl0, dt0, idx0, n0);
@@ -90,6 +90,9 @@ BEGIN_SLOTTABLE(Station)
    "startupResetTimer", // 16: Startup (initial) RESET event timer value (Basic::Time) (default: no reset event)
    "enableUpdateTimers",// 17: Enable calling Basic::Timers::updateTimers() from updateTC() (default: false)
    "dataRecorder",      // 18) Our Data Recorder
+   "fastTime",          // 19: Fast-time mode (default: false)
+   "fastTimeBgRatio",   // 20: Fast-time: number of T/C frames per background frame (default: 1)
+   "fastTimeNetworks",  // 21: Fast-time: process the networks (default: false)
 END_SLOTTABLE(Station)
 
 //------------------------------------------------------------------------------
@@ -125,6 +128,10 @@ BEGIN_SLOT_MAP(Station)
    ON_SLOT(17,  setSlotEnableUpdateTimers,    Basic::Number)
 
    ON_SLOT(18, setDataRecorder,            DataRecorder)
+
+   ON_SLOT(19,  setSlotFastTime,              Basic::Number)
+   ON_SLOT(20,  setSlotFastTimeBgRatio,       Basic::Number)
+   ON_SLOT(21,  setSlotFastTimeNetworks,      Basic::Number)
 END_SLOT_MAP()
 
 //------------------------------------------------------------------------------
@@ -169,6 +176,11 @@ void Station::initData()
 
    tmrUpdateEnbl = false;
 
+   ftEnbl = false;
+   ftBgRatio = 1;
+   ftNetEnbl = false;
+   ftFrameCnt = 0;
+
    startupResetTimer0 = 0;
    startupResetTimer = -1.0f;
 }
@@ -248,6 +260,11 @@ void Station::copyData(const Station& org, const bool cc)
 
    tmrUpdateEnbl = org.tmrUpdateEnbl;
 
+   ftEnbl = org.ftEnbl;
+   ftBgRatio = org.ftBgRatio;
+   ftNetEnbl = org.ftNetEnbl;
+   ftFrameCnt = 0;
+
    if (org.startupResetTimer0!= 0) {
       Basic::Time* copy = org.startupResetTimer0->clone();
       setSlotStartupResetTime( copy );
@@ -354,6 +371,8 @@ void Station::reset()
    // ---
    if (dataRecorder != 0) dataRecorder->event(RESET_EVENT);
 
+   ftFrameCnt = 0;
+
    BaseClass::reset();
 }
 
@@ -433,31 +452,35 @@ void Station::updateTC(const LCreal dt)
 //------------------------------------------------------------------------------
 void Station::updateData(const LCreal dt)
 {
-   // Create a background thread (if needed)
-   if (getBackgroundRate() > 0 && !doWeHaveTheBgThread()) {
-      createBackgroundProcess();
-   }
+   // In fast-time mode, runFastTime() handles all of this
+   if (!isFastTimeEnabled()) {
 
-   // Our simulation model and OTW interfaces (if no separate thread)
-   if (getBackgroundRate() == 0 && !doWeHaveTheBgThread()) {
-      processBackgroundTasks(dt);
-   }
+      // Create a background thread (if needed)
+      if (getBackgroundRate() > 0 && !doWeHaveTheBgThread()) {
+         createBackgroundProcess();
+      }
 
-   // Create a network thread (if needed)
-   if (getNetworkRate() > 0 && networks != 0 && !doWeHaveTheNetThread()) {
-      createNetworkProcess();
-   }
+      // Our simulation model and OTW interfaces (if no separate thread)
+      if (getBackgroundRate() == 0 && !doWeHaveTheBgThread()) {
+         processBackgroundTasks(dt);
+      }
 
-   // Our interoperability networks (if no separate thread)
-   if (getNetworkRate() == 0 && networks != 0 && !doWeHaveTheNetThread()) {
-      processNetworkInputTasks(dt);
-      processNetworkOutputTasks(dt);
-   }
+      // Create a network thread (if needed)
+      if (getNetworkRate() > 0 && networks != 0 && !doWeHaveTheNetThread()) {
+         createNetworkProcess();
+      }
 
-   // ---
-   // Background processing of the data recorders
-   // ---
-   if (dataRecorder != 0) dataRecorder->processRecords();
+      // Our interoperability networks (if no separate thread)
+      if (getNetworkRate() == 0 && networks != 0 && !doWeHaveTheNetThread()) {
+         processNetworkInputTasks(dt);
+         processNetworkOutputTasks(dt);
+      }
+
+      // ---
+      // Background processing of the data recorders
+      // ---
+      if (dataRecorder != 0) dataRecorder->processRecords();
+   }
 
    // Update base class data
    BaseClass::updateData(dt);
@@ -572,7 +595,13 @@ void Station::outputDevices(const LCreal dt)
 //------------------------------------------------------------------------------
 void Station::createTimeCriticalProcess()
 {
-   if ( tcThread == 0 ) {
+   if ( isFastTimeEnabled() ) {
+      // Fast-time mode is driven by runFastTime()
+      if (isMessageEnabled(MSG_WARNING)) {
+         std::cerr << "Station::createTimeCriticalProcess(): fast-time mode; use runFastTime()" << std::endl;
+      }
+   }
+   else if ( tcThread == 0 ) {
       tcThread = new TcThread(this, getTimeCriticalPriority(), getTimeCriticalRate());
       tcThread->unref(); // 'tcThread' is a SPtr<>
 
@@ -640,6 +669,47 @@ void Station::processTimeCriticalTasks(const LCreal dt)
    }
 }
 
+//------------------------------------------------------------------------------
+// runFastTime() -- Fast-time mode: runs 'duration' seconds of simulated time
+// in a tight loop using a fixed time step, with the background tasks (and,
+// optionally, the networks) interleaved every 'ftBgRatio' T/C frames.
+//------------------------------------------------------------------------------
+unsigned int Station::runFastTime(const double duration)
+{
+   if (!isFastTimeEnabled() || getTimeCriticalRate() <= 0) {
+      if (isMessageEnabled(MSG_ERROR)) {
+         std::cerr << "Station::runFastTime(): ERROR, requires fast-time mode and a T/C rate" << std::endl;
+      }
+      return 0;
+   }
+
+   const LCreal dt = 1.0f / getTimeCriticalRate();
+   const LCreal bgDt = dt * static_cast<LCreal>(ftBgRatio);
+
+   // The number of frames is computed up front, so the simulated time
+   // isn't subject to the round-off of accumulating 'dt'
+   unsigned int n = 0;
+   if (duration > 0) n = static_cast<unsigned int>(duration * getTimeCriticalRate() + 0.5);
+
+   unsigned int f = 0;
+   while (f < n && !isShutdown()) {
+
+      tcFrame( dt );
+      ftFrameCnt++;
+
+      if ( (ftFrameCnt % ftBgRatio) == 0 ) {
+         const bool net = (ftNetEnbl && networks != 0);
+         if (net) processNetworkInputTasks(bgDt);
+         processBackgroundTasks(bgDt);
+         if (net) processNetworkOutputTasks(bgDt);
+         if (dataRecorder != 0) dataRecorder->processRecords();
+      }
+
+      f++;
+   }
+   return f;
+}
+
 //------------------------------------------------------------------------------
 // processBackgroundTasks() -- Process the background models and interfaces
 //------------------------------------------------------------------------------
@@ -1424,6 +1494,46 @@ bool Station::setFastForwardRate(const unsigned int r)
    return true;
 }
 
+//------------------------------------------------------------------------------
+// Fast-time mode get and set functions
+//------------------------------------------------------------------------------
+bool Station::isFastTimeEnabled() const
+{
+   return ftEnbl;
+}
+
+unsigned int Station::getFastTimeBgRatio() const
+{
+   return ftBgRatio;
+}
+
+bool Station::isFastTimeNetworksEnabled() const
+{
+   return ftNetEnbl;
+}
+
+bool Station::setFastTimeEnabled(const bool enb)
+{
+   ftEnbl = enb;
+   return true;
+}
+
+bool Station::setFastTimeBgRatio(const unsigned int r)
+{
+   bool ok = false;
+   if (r > 0) {
+      ftBgRatio = r;
+      ok = true;
+   }
+   return ok;
+}
+
+bool Station::setFastTimeNetworksEnabled(const bool enb)
+{
+   ftNetEnbl = enb;
+   return true;
+}
+
 //------------------------------------------------------------------------------
 // Sets the fast forward rate
 //------------------------------------------------------------------------------
@@ -1451,6 +1561,42 @@ bool Station::setSlotEnableUpdateTimers(const Basic::Number* const msg)
    return ok;
 }
 
+//------------------------------------------------------------------------------
+// Fast-time mode slot functions
+//------------------------------------------------------------------------------
+bool Station::setSlotFastTime(const Basic::Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      ok = setFastTimeEnabled( msg->getBoolean() );
+   }
+   return ok;
+}
+
+bool Station::setSlotFastTimeBgRatio(const Basic::Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      int ii = msg->getInt();
+      if (ii > 0) {
+         ok = setFastTimeBgRatio( ii );
+      }
+      else {
+         std::cerr << "Station::setSlotFastTimeBgRatio(): invalid ratio: " << ii << "; use one or more" << std::endl;
+      }
+   }
+   return ok;
+}
+
+bool Station::setSlotFastTimeNetworks(const Basic::Number* const msg)
+{
+   bool ok = false;
+   if (msg != 0) {
+      ok = setFastTimeNetworksEnabled( msg->getBoolean() );
+   }
+   return ok;
+}
+
 //------------------------------------------------------------------------------
 // getSlotByIndex()
 //------------------------------------------------------------------------------
@@ -1529,6 +1675,18 @@ std::ostream& Station::serialize(std::ostream& sout, const int i, const bool slo
       sout << "fastForwardRate: " << fastForwardRate << std::endl;
     }
 
+    // fast-time mode
+    if (ftEnbl) {
+      indent(sout,i+j);
+      sout << "fastTime: " << (ftEnbl ? "true" : "false") << std::endl;
+
+      indent(sout,i+j);
+      sout << "fastTimeBgRatio: " << ftBgRatio << std::endl;
+
+      indent(sout,i+j);
+      sout << "fastTimeNetworks: " << (ftNetEnbl ? "true" : "false") << std::endl;
+    }
+
     // startupResetTime: Startup (initial) RESET pulse timer value (Basic::Time)
     if (startupResetTimer0 != 0) {
         indent(sout,i+j);
@@ -20,6 +20,7 @@
 #include "openeaagles/simulation/TrackManager.h"
 #include "openeaagles/simulation/Weapon.h"
 
+#include "openeaagles/basic/Number.h"
 #include "openeaagles/basic/units/Angles.h"
 #include "openeaagles/basic/units/Times.h"
 #include <string>
@@ -55,13 +56,24 @@
 namespace Eaagles {
 namespace Simulation {
 
+static const unsigned int EVENT_POOL_SIZE = 1000;    // Max size of the event pools
+
 //==============================================================================
 // Class: TabLogger
 //==============================================================================
 IMPLEMENT_PARTIAL_SUBCLASS(TabLogger,"TabLogger")
 
-EMPTY_SLOTTABLE(TabLogger)
-EMPTY_DELETEDATA(TabLogger)
+//------------------------------------------------------------------------------
+// Slot table
+//------------------------------------------------------------------------------
+BEGIN_SLOTTABLE(TabLogger)
+    "eventPoolSize",        // 1: Max number of recycled events held by each event pool (Basic::Number)
+END_SLOTTABLE(TabLogger)
+
+// Map slot table to handles 
+BEGIN_SLOT_MAP(TabLogger)
+    ON_SLOT(1,  setSlotEventPoolSize,   Basic::Number)
+END_SLOT_MAP()
 
 // Constructor: 
 TabLogger::TabLogger()
@@ -101,6 +113,13 @@ void TabLogger::copyData(const TabLogger& org, const bool)
     BaseClass::copyData(org);
 }
 
+// deleteData() -- delete member data
+void TabLogger::deleteData()
+{
+    // Release the player, track and emission references of the logged events
+    recycleEvents();
+}
+
 //------------------------------------------------------------------------------
 // updateTC() -- Update the simulation log time
 //------------------------------------------------------------------------------
@@ -116,6 +135,75 @@ void TabLogger::updateTC(const LCreal dt)
 void TabLogger::updateData(const LCreal dt)
 {
     BaseClass::updateData(dt);
+
+    // The events have been written, so recycle them
+    recycleEvents();
+}
+
+//------------------------------------------------------------------------------
+// shutdownNotification() -- we're done logging, so free the pooled events
+//------------------------------------------------------------------------------
+bool TabLogger::shutdownNotification()
+{
+    clearEventPools();
+    return BaseClass::shutdownNotification();
+}
+
+//------------------------------------------------------------------------------
+// recycleEvents() -- recycles the pooled events that are no longer referenced
+//------------------------------------------------------------------------------
+void TabLogger::recycleEvents()
+{
+    LogPlayerData::getPool().recycle();
+    LogActiveTrack::getPool().recycle();
+    LogPassiveTrack::getPool().recycle();
+}
+
+//------------------------------------------------------------------------------
+// clearEventPools() -- frees the pooled events (the events that are still being
+// logged are freed when they're no longer referenced)
+//------------------------------------------------------------------------------
+void TabLogger::clearEventPools()
+{
+    LogPlayerData::getPool().clear();
+    LogActiveTrack::getPool().clear();
+    LogPassiveTrack::getPool().clear();
+}
+
+//------------------------------------------------------------------------------
+// Event pool size
+//------------------------------------------------------------------------------
+unsigned int TabLogger::getEventPoolSize()
+{
+    return LogPlayerData::getPool().getSize();
+}
+
+void TabLogger::setEventPoolSize(const unsigned int n)
+{
+    LogPlayerData::getPool().setSize(n);
+    LogActiveTrack::getPool().setSize(n);
+    LogPassiveTrack::getPool().setSize(n);
+}
+
+//------------------------------------------------------------------------------
+// Slot functions
+//------------------------------------------------------------------------------
+bool TabLogger::setSlotEventPoolSize(const Basic::Number* const num)
+{
+    bool ok = false;
+    if (num != 0 && num->getInt() >= 0) {
+        setEventPoolSize(static_cast<unsigned int>(num->getInt()));
+        ok = true;
+    }
+    return ok;
+}
+
+//------------------------------------------------------------------------------
+// getSlotByIndex()
+//------------------------------------------------------------------------------
+Basic::Object* TabLogger::getSlotByIndex(const int si)
+{
+    return BaseClass::getSlotByIndex(si);
 }
 
 //------------------------------------------------------------------------------
@@ -130,6 +218,9 @@ std::ostream& TabLogger::serialize(std::ostream& sout, const int i, const bool s
         j = 4;
     }
 
+    indent(sout,i+j);
+    sout << "eventPoolSize: " << getEventPoolSize() << std::endl;
+
     BaseClass::serialize(sout,i+j,true);
 
     if ( !slotsOnly ) {
@@ -532,39 +623,71 @@ std::ostream& TabLogger::TabLogEvent::makeEmissionDataMsg(std::ostream& sout, co
 TABLOGEVENT_B(LogPlayerData,"TabLogger::LogPlayerData")
 EMPTY_SERIALIZER(TabLogger::LogPlayerData)
 
+// Event pool
+Basic::Object::QPool<TabLogger::LogPlayerData> TabLogger::LogPlayerData::pool(EVENT_POOL_SIZE);
+
 // Constructor
 TabLogger::LogPlayerData::LogPlayerData(int t, const Player* const p)
 {
     STANDARD_CONSTRUCTOR()
-    theSource = 0;
-    thePlayer = p;
-    theType = t;
-    pos.set(0,0,0);
-    vel.set(0,0,0);
-    angles.set(0,0,0);
-    alpha = 0;
-    beta = 0;
-    ias = 0;
-    mach = 0.0;
-    pLoading = 0.0;
+    initData(t, p, 0);
 }
 
 TabLogger::LogPlayerData::LogPlayerData(int t, const Player* const p, const Player* const w)
 {
     STANDARD_CONSTRUCTOR()
-    theSource = w;  // source of damage, usually a weapon, always a player
+    initData(t, p, w);  // source of damage, usually a weapon, always a player
+    mach = -1.0;
+}
+
+void TabLogger::LogPlayerData::initData(int t, const Player* const p, const Player* const w)
+{
+    theSource = w;
     thePlayer = p;
     theType = t;
     pos.set(0,0,0);
     vel.set(0,0,0);
     angles.set(0,0,0);
+    latitude = 0;
+    longitude = 0;
     alpha = 0;
     beta = 0;
     ias = 0;
-    mach = -1.0;
+    mach = 0.0;
     pLoading = 0.0;
 }
 
+// Create functions: reuse a recycled event (the pool keeps a reference)
+TabLogger::LogPlayerData* TabLogger::LogPlayerData::create(int t, const Player* const p)
+{
+    LogPlayerData* evt = pool.get();
+    if (evt != 0) evt->initData(t, p, 0);
+    else evt = new LogPlayerData(t, p);
+    evt->ref();
+    pool.release(evt);
+    return evt;
+}
+
+TabLogger::LogPlayerData* TabLogger::LogPlayerData::create(int t, const Player* const p, const Player* const w)
+{
+    LogPlayerData* evt = pool.get();
+    if (evt != 0) {
+        evt->initData(t, p, w);
+        evt->mach = -1.0;
+    }
+    else evt = new LogPlayerData(t, p, w);
+    evt->ref();
+    pool.release(evt);
+    return evt;
+}
+
+// Clear the event
+void TabLogger::LogPlayerData::clear()
+{
+    BaseClass::clear();
+    initData(0, 0, 0);
+}
+
 
 // Copy data function
 void TabLogger::LogPlayerData::copyData(const LogPlayerData& org, const bool)
@@ -914,10 +1037,18 @@ void TabLogger::LogWeaponActivity::captureData()
 TABLOGEVENT_B(LogActiveTrack,"TabLogger::LogActiveTrack")
 EMPTY_SERIALIZER(TabLogger::LogActiveTrack)
 
+// Event pool
+Basic::Object::QPool<TabLogger::LogActiveTrack> TabLogger::LogActiveTrack::pool(EVENT_POOL_SIZE);
+
 // Constructor
 TabLogger::LogActiveTrack::LogActiveTrack(int t, const TrackManager* const mgr, const Track* const trk)
 {
     STANDARD_CONSTRUCTOR()
+    initData(t, mgr, trk);
+}
+
+void TabLogger::LogActiveTrack::initData(int t, const TrackManager* const mgr, const Track* const trk)
+{
     thePlayer = 0;
     theEmission = 0;
     theType = t;
@@ -941,6 +1072,24 @@ TabLogger::LogActiveTrack::LogActiveTrack(int t, const TrackManager* const mgr,
     sn = 0;
 }
 
+// Create function: reuses a recycled event (the pool keeps a reference)
+TabLogger::LogActiveTrack* TabLogger::LogActiveTrack::create(int t, const TrackManager* const mgr, const Track* const trk)
+{
+    LogActiveTrack* evt = pool.get();
+    if (evt != 0) evt->initData(t, mgr, trk);
+    else evt = new LogActiveTrack(t, mgr, trk);
+    evt->ref();
+    pool.release(evt);
+    return evt;
+}
+
+// Clear the event
+void TabLogger::LogActiveTrack::clear()
+{
+    BaseClass::clear();
+    initData(0, 0, 0);
+}
+
 // Copy data function
 void TabLogger::LogActiveTrack::copyData(const LogActiveTrack& org, const bool)
 {
@@ -1051,10 +1200,18 @@ void TabLogger::LogActiveTrack::captureData()
 TABLOGEVENT_B(LogPassiveTrack,"TabLogger::LogPassiveTrack")
 EMPTY_SERIALIZER(TabLogger::LogPassiveTrack)
 
+// Event pool
+Basic::Object::QPool<TabLogger::LogPassiveTrack> TabLogger::LogPassiveTrack::pool(EVENT_POOL_SIZE);
+
 // Constructor
 TabLogger::LogPassiveTrack::LogPassiveTrack(int t, const TrackManager* const mgr, const Track* const trk)
 {
     STANDARD_CONSTRUCTOR()
+    initData(t, mgr, trk);
+}
+
+void TabLogger::LogPassiveTrack::initData(int t, const TrackManager* const mgr, const Track* const trk)
+{
     thePlayer = 0;
     theEmission = 0;
     theType = t;
@@ -1078,6 +1235,24 @@ TabLogger::LogPassiveTrack::LogPassiveTrack(int t, const TrackManager* const mgr
     sn = 0;
 }
 
+// Create function: reuses a recycled event (the pool keeps a reference)
+TabLogger::LogPassiveTrack* TabLogger::LogPassiveTrack::create(int t, const TrackManager* const mgr, const Track* const trk)
+{
+    LogPassiveTrack* evt = pool.get();
+    if (evt != 0) evt->initData(t, mgr, trk);
+    else evt = new LogPassiveTrack(t, mgr, trk);
+    evt->ref();
+    pool.release(evt);
+    return evt;
+}
+
+// Clear the event
+void TabLogger::LogPassiveTrack::clear()
+{
+    BaseClass::clear();
+    initData(0, 0, 0);
+}
+
 // Copy data function
 void TabLogger::LogPassiveTrack::copyData(const LogPassiveTrack& org, const bool)
 {
@@ -19,9 +19,19 @@
 #include "openeaagles/simulation/DataRecorder.h"
 #include "openeaagles/simulation/Simulation.h"
 
+#include <cmath>
+
 namespace Eaagles {
 namespace Simulation {
 
+// Hash of a report association grid cell
+static inline unsigned int hashCell(const int ix, const int iy, const int iz)
+{
+   return (static_cast<unsigned int>(ix) * 73856093u) ^
+          (static_cast<unsigned int>(iy) * 19349663u) ^
+          (static_cast<unsigned int>(iz) * 83492791u);
+}
+
 //==============================================================================
 // Class: TrackManager
 //==============================================================================
@@ -111,7 +121,18 @@ void TrackManager::initData()
    beta = 0.0;
    gamma = 0.0;
 
+   // Default association gates
+   posGate = 2.0f * Basic::Distance::NM2M;
+   rngGate = 500.0f;
+   velGate = 10.0f;
+
    logTrackUpdates = true;
+
+   for (unsigned int i = 0; i < MAX_REPORTS; i++) report2Track[i] = -1;
+   for (unsigned int i = 0; i < MAX_TRKS; i++) {
+      track2Report[i] = -1;
+      nGated[i] = 0;
+   }
 }
 
 //------------------------------------------------------------------------------
@@ -142,6 +163,11 @@ void TrackManager::copyData(const TrackManager& org, const bool cc)
    alpha   = org.alpha;
    beta    = org.beta;
    gamma   = org.gamma;
+
+   // Association gates
+   posGate = org.posGate;
+   rngGate = org.rngGate;
+   velGate = org.velGate;
 }
 
 //------------------------------------------------------------------------------
@@ -427,6 +453,259 @@ void TrackManager::makeMatrixA(LCreal dt)
    haveMatrixA = true;
 }
 
+//------------------------------------------------------------------------------
+// associateReports() -- Kinematic report-to-track association
+//
+//  1) The reports are binned into a uniform grid (hashed) of position gate
+//     sized cells, so each track only needs to check the reports in its own
+//     and the neighboring cells.
+//  2) Reports that are inside the track's position, range and range-rate
+//     gates are the track's gated reports (the best MAX_GATED_PER_TRK).
+//  3) The gated pairs are assigned one-to-one using auctionAssignment().
+//------------------------------------------------------------------------------
+unsigned int TrackManager::associateReports(
+         const osg::Vec3 rptPos[],
+         const LCreal rptRdot[],
+         const unsigned int nReports,
+         const LCreal pGate,
+         const LCreal rGate,
+         const LCreal vGate
+      )
+{
+   static const unsigned int HASH_SIZE = 1024;                 // Grid hash table size (power of two)
+   static const unsigned int HASH_MASK = (HASH_SIZE - 1);
+
+   for (unsigned int ir = 0; ir < nReports; ir++) report2Track[ir] = -1;
+   for (unsigned int it = 0; it < nTrks; it++) {
+      track2Report[it] = -1;
+      nGated[it] = 0;
+   }
+   if (nReports == 0 || nTrks == 0 || pGate <= 0) return 0;
+
+   // ---
+   // Bin the reports into the grid
+   // ---
+   int head[HASH_SIZE];
+   int next[MAX_REPORTS];
+   int cell[MAX_REPORTS][3];
+   for (unsigned int i = 0; i < HASH_SIZE; i++) head[i] = -1;
+
+   const LCreal cellSize = pGate;
+   for (unsigned int ir = 0; ir < nReports; ir++) {
+      cell[ir][0] = static_cast<int>( std::floor(rptPos[ir].x() / cellSize) );
+      cell[ir][1] = static_cast<int>( std::floor(rptPos[ir].y() / cellSize) );
+      cell[ir][2] = static_cast<int>( std::floor(rptPos[ir].z() / cellSize) );
+      const unsigned int h = hashCell(cell[ir][0], cell[ir][1], cell[ir][2]) & HASH_MASK;
+      next[ir] = head[h];
+      head[h] = static_cast<int>(ir);
+   }
+
+   // ---
+   // Gate the reports in the neighboring cells of each track's predicted position
+   // ---
+   const LCreal pGate2 = pGate * pGate;
+   lcLock(trkListLock);
+   for (unsigned int it = 0; it < nTrks; it++) {
+      const osg::Vec3& tpos = tracks[it]->getPosition();
+      const LCreal trdot = tracks[it]->getRangeRate();
+      const LCreal trng = tpos.length();     // predicted range (tpos has already been predicted)
+
+      const int cx = static_cast<int>( std::floor(tpos.x() / cellSize) );
+      const int cy = static_cast<int>( std::floor(tpos.y() / cellSize) );
+      const int cz = static_cast<int>( std::floor(tpos.z() / cellSize) );
+
+      for (int ix = cx-1; ix <= cx+1; ix++) {
+         for (int iy = cy-1; iy <= cy+1; iy++) {
+            for (int iz = cz-1; iz <= cz+1; iz++) {
+               const unsigned int h = hashCell(ix, iy, iz) & HASH_MASK;
+               for (int ir = head[h]; ir >= 0; ir = next[ir]) {
+
+                  // Hash collisions: only the reports that are in this cell
+                  if (cell[ir][0] != ix || cell[ir][1] != iy || cell[ir][2] != iz) continue;
+
+                  // Position gate
+                  const LCreal d2 = (rptPos[ir] - tpos).length2();
+                  if (d2 > pGate2) continue;
+
+                  // Range and range rate gates
+                  if (lcAbs(rptPos[ir].length() - trng) > rGate) continue;
+                  if (lcAbs(rptRdot[ir] - trdot) > vGate) continue;
+
+                  // Keep the best gated reports (sorted by benefit)
+                  const LCreal benefit = 1.0f - (d2 / pGate2);
+                  unsigned int n = nGated[it];
+                  if (n < MAX_GATED_PER_TRK || benefit > gated[it][n-1].benefit) {
+                     if (n == MAX_GATED_PER_TRK) n--;
+                     while (n > 0 && gated[it][n-1].benefit < benefit) {
+                        gated[it][n] = gated[it][n-1];
+                        n--;
+                     }
+                     gated[it][n].report = ir;
+                     gated[it][n].benefit = benefit;
+                     if (nGated[it] < MAX_GATED_PER_TRK) nGated[it]++;
+                  }
+               }
+            }
+         }
+      }
+   }
+   lcUnlock(trkListLock);
+
+   // ---
+   // Assign the gated pairs
+   // ---
+   auctionAssignment(nReports);
+
+   unsigned int nAssigned = 0;
+   for (unsigned int it = 0; it < nTrks; it++) {
+      if (track2Report[it] >= 0) nAssigned++;
+   }
+   return nAssigned;
+}
+
+//------------------------------------------------------------------------------
+// auctionAssignment() -- Auction algorithm (Bertsekas) for the one-to-one
+// assignment of the gated reports to the tracks.
+//
+//  The tracks bid for their best report, raising the report's price by
+//  the difference between their best and second best values (plus epsilon).
+//  Each track also has a private 'no report' choice with a value of zero,
+//  so tracks that are priced out of all of their gated reports are left
+//  unassigned.  The result is within nTrks*epsilon of the optimal assignment.
+//------------------------------------------------------------------------------
+void TrackManager::auctionAssignment(const unsigned int nReports)
+{
+   LCreal price[MAX_REPORTS];
+   for (unsigned int ir = 0; ir < nReports; ir++) price[ir] = 0;
+
+   // All tracks with gated reports start unassigned
+   int unassigned[MAX_TRKS];
+   unsigned int nUnassigned = 0;
+   for (unsigned int it = 0; it < nTrks; it++) {
+      if (nGated[it] > 0) unassigned[nUnassigned++] = static_cast<int>(it);
+   }
+
+   const LCreal eps = 1.0f / static_cast<LCreal>(10 * (nTrks + 1));
+
+   while (nUnassigned > 0) {
+      const int it = unassigned[--nUnassigned];
+
+      // Find the best and second best values ('no report' has a value of zero)
+      int bestRpt = -1;
+      LCreal best = 0;
+      LCreal second = 0;
+      for (unsigned int k = 0; k < nGated[it]; k++) {
+         const int ir = gated[it][k].report;
+         const LCreal value = gated[it][k].benefit - price[ir];
+         if (value > best) {
+            second = best;
+            best = value;
+            bestRpt = ir;
+         }
+         else if (value > second) {
+            second = value;
+         }
+      }
+
+      if (bestRpt >= 0) {
+         // Bid for the report, and bump its previous owner (if any)
+         price[bestRpt] += (best - second) + eps;
+         const int prev = report2Track[bestRpt];
+         if (prev >= 0) {
+            track2Report[prev] = -1;
+            unassigned[nUnassigned++] = prev;
+         }
+         report2Track[bestRpt] = it;
+         track2Report[it] = bestRpt;
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// smoothAndPredictTracks() -- Smooth and predict position for the next frame
+//
+//    X(k+1) = A*X(k) + B*U(k)
+//    where:
+//      X(k) is the state vector [ pos vel accel ]
+//      U(k) is the difference between the observed & predicted positions
+//
+//  The track states are gathered into component arrays, filtered as a batch
+//  and then scattered back to the tracks.
+//------------------------------------------------------------------------------
+void TrackManager::smoothAndPredictTracks(const osg::Vec3 u[], const LCreal age[], const bool haveU[], const LCreal pGate)
+{
+   const unsigned int n = nTrks;
+   if (n == 0) return;
+
+   // State and input component arrays -- [x y z][track]
+   LCreal px[3][MAX_TRKS];
+   LCreal vx[3][MAX_TRKS];
+   LCreal ax[3][MAX_TRKS];
+   LCreal ux[3][MAX_TRKS];
+   LCreal b0[MAX_TRKS];
+   LCreal b1[MAX_TRKS];
+   LCreal b2[MAX_TRKS];
+
+   // ---
+   // Gather the track states and compute the B matrix for each track
+   // ---
+   const LCreal d2 = pGate * pGate;    // position gate squared
+   for (unsigned int i = 0; i < n; i++) {
+      const osg::Vec3& tpos = tracks[i]->getPosition();
+      const osg::Vec3& tvel = tracks[i]->getVelocity();
+      const osg::Vec3& tacc = tracks[i]->getAcceleration();
+      for (unsigned int k = 0; k < 3; k++) {
+         px[k][i] = tpos[k];
+         vx[k][i] = tvel[k];
+         ax[k][i] = tacc[k];
+         ux[k][i] = 0;
+      }
+
+      b0[i] = 0.0;
+      b1[i] = 0.0;
+      b2[i] = 0.0;
+      if (haveU[i]) {
+         // Have Input vector U, use B ...
+         for (unsigned int k = 0; k < 3; k++) ux[k][i] = u[i][k];
+         b0[i] = alpha;
+         if (age[i] != 0) b1[i] = beta / age[i];
+         //b2[i] = gamma * 2.0f / (age[i]*age[i]);
+         if (pGate > 0 && u[i].length2() > d2) {
+            // Large position change: just set position
+            b0[i] = 1.0;
+            b1[i] = 0.0;
+         }
+      }
+   }
+
+   // ---
+   // X(k+1) = A*X(k) + B*U(k)  (B is zero for tracks without an input vector)
+   // ---
+   for (unsigned int k = 0; k < 3; k++) {
+      LCreal* const p = px[k];
+      LCreal* const v = vx[k];
+      LCreal* const a = ax[k];
+      const LCreal* const uu = ux[k];
+      for (unsigned int i = 0; i < n; i++) {
+         const LCreal p0 = p[i];
+         const LCreal v0 = v[i];
+         const LCreal a0 = a[i];
+         p[i] = (p0*A[0][0] + v0*A[0][1] + a0*A[0][2]) + (uu[i]*b0[i]);
+         v[i] = (p0*A[1][0] + v0*A[1][1] + a0*A[1][2]) + (uu[i]*b1[i]);
+         a[i] = (p0*A[2][0] + v0*A[2][1] + a0*A[2][2]) + (uu[i]*b2[i]);
+      }
+   }
+
+   // ---
+   // Scatter the new states back to the tracks
+   // ---
+   for (unsigned int i = 0; i < n; i++) {
+      tracks[i]->setPosition(     osg::Vec3(px[0][i], px[1][i], px[2][i]) );
+      tracks[i]->setVelocity(     osg::Vec3(vx[0][i], vx[1][i], vx[2][i]) );
+      tracks[i]->setAcceleration( osg::Vec3(ax[0][i], ax[1][i], ax[2][i]) );
+   }
+}
+
 //------------------------------------------------------------------------------
 // setMaxTracks() -- Sets the maximum number of active tracks
 //------------------------------------------------------------------------------
@@ -555,6 +834,87 @@ bool TrackManager::setLogTrackUpdates (const bool b)
    return true;
 }
 
+//------------------------------------------------------------------------------
+// setPositionGate() -- Sets the size of the position gate
+//------------------------------------------------------------------------------
+bool TrackManager::setPositionGate(const Basic::Number* const num)
+{
+   LCreal value = 0.0;
+   const Basic::Distance* p = dynamic_cast<const Basic::Distance*>(num);
+   if (p != 0) {
+      // We have a distance and we want it in meters ...
+      Basic::Meters meters;
+      value = meters.convert(*p);
+   }
+   else if (num != 0) {
+      // We have only a number, assume it's in meters ...
+      value = num->getReal();
+   }
+
+   // Set the value if it's valid
+   bool ok = true;
+   if (value > 0.0) {
+      posGate = value;
+   }
+   else {
+      std::cerr << "TrackManager::setPositionGate: invalid gate, must be greater than zero." << std::endl;
+      ok = false;
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// setRangeGate() -- Sets the size of the range gate
+//------------------------------------------------------------------------------
+bool TrackManager::setRangeGate(const Basic::Number* const num)
+{
+   LCreal value = 0.0;
+   const Basic::Distance* p = dynamic_cast<const Basic::Distance*>(num);
+   if (p != 0) {
+      // We have a distance and we want it in meters ...
+      Basic::Meters meters;
+      value = meters.convert(*p);
+   }
+   else if (num != 0) {
+      // We have only a number, assume it's in meters ...
+      value = num->getReal();
+   }
+
+   // Set the value if it's valid
+   bool ok = true;
+   if (value > 0.0) {
+      rngGate = value;
+   }
+   else {
+      std::cerr << "TrackManager::setRangeGate: invalid gate, must be greater than zero." << std::endl;
+      ok = false;
+   }
+   return ok;
+}
+
+//------------------------------------------------------------------------------
+// setVelocityGate() -- Sets the size of the velocity gate
+//------------------------------------------------------------------------------
+bool TrackManager::setVelocityGate(const Basic::Number* const num)
+{
+   LCreal value = 0.0;
+   if (num != 0) {
+      // We have only a number, assume it's in meters ...
+      value = num->getReal();
+   }
+
+   // Set the value if it's valid
+   bool ok = true;
+   if (value > 0.0) {
+      velGate = value;
+   }
+   else {
+      std::cerr << "TrackManager::setVelocityGate: invalid gate, must be greater than zero." << std::endl;
+      ok = false;
+   }
+   return ok;
+}
+
 //------------------------------------------------------------------------------
 // getSlotByIndex()
 //------------------------------------------------------------------------------
@@ -652,24 +1012,6 @@ AirTrkMgr::AirTrkMgr()
 void AirTrkMgr::initData()
 {
    setType( Track::ONBOARD_SENSOR_BIT | Track::AIR_TRACK_BIT );
-
-   posGate =  2.0f * Basic::Distance::NM2M;
-   rngGate =  500.0f;
-   velGate =   10.0f;
-
-   reportNumMatches = new unsigned int[MAX_REPORTS];
-   trackNumMatches = new unsigned int[MAX_TRKS];
-   report2TrackMatch = new bool*[MAX_REPORTS];
-   for (unsigned int i = 0; i < MAX_REPORTS; i++) {
-      reportNumMatches[i] = 0;
-      report2TrackMatch[i] = new bool[MAX_TRKS];
-      for (unsigned int j = 0; j < MAX_TRKS; j++) {
-         report2TrackMatch[i][j] = false;
-      }
-   }
-   for (unsigned int i = 0; i < MAX_TRKS; i++) {
-      trackNumMatches[i] = 0;
-   }
 }
 
 //------------------------------------------------------------------------------
@@ -679,20 +1021,6 @@ void AirTrkMgr::copyData(const AirTrkMgr& org, const bool cc)
 {
    BaseClass::copyData(org);
    if (cc) initData();
-
-   posGate = org.posGate;
-   rngGate = org.rngGate;
-   velGate = org.velGate;
-
-   for (unsigned int i = 0; i < MAX_REPORTS; i++) {
-      reportNumMatches[i] = org.reportNumMatches[i];
-      for (unsigned int j = 0; j < MAX_TRKS; j++) {
-         report2TrackMatch[i][j] = org.report2TrackMatch[i][j];
-      }
-   }
-   for (unsigned int i = 0; i < MAX_TRKS; i++) {
-      trackNumMatches[i] = org.trackNumMatches[i];
-   }
 }
 
 //------------------------------------------------------------------------------
@@ -700,26 +1028,6 @@ void AirTrkMgr::copyData(const AirTrkMgr& org, const bool cc)
 //------------------------------------------------------------------------------
 void AirTrkMgr::deleteData()
 {
-   if (report2TrackMatch != 0) {
-      for (unsigned int i = 0; i < MAX_REPORTS; i++) {
-         if (report2TrackMatch[i] != 0) {
-            delete[] report2TrackMatch[i];
-            report2TrackMatch[i] = 0;
-         }
-      }
-      delete[] report2TrackMatch;
-      report2TrackMatch = 0;
-   }
-
-   if (reportNumMatches != 0) {
-      delete[] reportNumMatches;
-      reportNumMatches = 0;
-   }
-
-   if (trackNumMatches != 0) {
-      delete[] trackNumMatches;
-      trackNumMatches = 0;
-   }
 }
 
 //------------------------------------------------------------------------------
@@ -782,7 +1090,6 @@ void AirTrkMgr::processTrackList(const LCreal dt)
             emissions[nReports] = em;
             newSignal[nReports] = tmp;
             newRdot[nReports] = emissions[nReports]->getRangeRate();
-            reportNumMatches[nReports] = 0;
             tgtPos[nReports] = tgt->getPosition() - ownship->getPosition();
             nReports++;
       }
@@ -798,30 +1105,10 @@ void AirTrkMgr::processTrackList(const LCreal dt)
    }
 
    // ---
-   // 3) Match current tracks to new reports (observations)
-   // ---
-   lcLock(trkListLock);
-   for (unsigned int it = 0; it < nTrks; it++) {
-      trackNumMatches[it] = 0;
-      const RfTrack* const trk = static_cast<const RfTrack*>(tracks[it]);  // we produce only RfTracks
-      const Player* const tgt = trk->getLastEmission()->getTarget();
-      for (unsigned int ir = 0; ir < nReports; ir++) {
-         if (emissions[ir]->getTarget() == tgt) {
-            // We have a new report for the same target as this track ...
-            report2TrackMatch[ir][it] = true;
-            trackNumMatches[it]++;
-            reportNumMatches[ir]++;
-         }
-         else report2TrackMatch[ir][it] = false;
-      }
-   }
-   lcUnlock(trkListLock);
-
-   // ---
-   // 4) Apply rules to associate the proper report to track.
+   // 3) Gate the new reports (observations) with the current, predicted tracks
+   // 4) and associate (one-to-one) the reports with the tracks.
    // ---
-
-   // No Rules -- Just Right
+   associateReports(tgtPos, newRdot, nReports, posGate, rngGate, velGate);
 
    // ---
    // 5) Create inputs for current tracks
@@ -834,25 +1121,21 @@ void AirTrkMgr::processTrackList(const LCreal dt)
    for (unsigned int it = 0; it < nTrks; it++) {
       u[it].set(0,0,0);
       haveU[it] = false;
-      if (trackNumMatches[it] > 0) {
-         for (unsigned int ir = 0; ir < nReports; ir++) {
-            if (report2TrackMatch[ir][it]) {
-               RfTrack* const trk = static_cast<RfTrack*>(tracks[it]);  // we produce only RfTracks
+      const int ir = track2Report[it];
+      if (ir >= 0) {
+         RfTrack* const trk = static_cast<RfTrack*>(tracks[it]);  // we produce only RfTracks
 
-               // Update the track's signal
-               trk->setSignal(newSignal[ir],emissions[ir]);
+         // Update the track's signal and range rate
+         trk->setSignal(newSignal[ir],emissions[ir]);
+         trk->setRangeRate(newRdot[ir]);
 
-               // Create a track input vector
-               u[it] = (tgtPos[ir] - trk->getPosition());
+         // Create a track input vector
+         u[it] = (tgtPos[ir] - trk->getPosition());
 
-               // Track age and flags
-               if (!haveU[it]) {
-                  age[it] = trk->getTrackAge();
-                  tracks[it]->resetTrackAge();
-                  haveU[it] = true;
-               }
-            }
-         }
+         // Track age and flags
+         age[it] = trk->getTrackAge();
+         tracks[it]->resetTrackAge();
+         haveU[it] = true;
       }
    }
    lcUnlock(trkListLock);
@@ -865,33 +1148,10 @@ void AirTrkMgr::processTrackList(const LCreal dt)
    //      X(k) is the state vector [ pos vel accel ]
    //      U(k) is the difference between the observed & predicted positions
    // ---
-   LCreal d2 = posGate * posGate;    // position gate squared
    lcLock(trkListLock);
+   smoothAndPredictTracks(u, age, haveU, posGate);
    for (unsigned int i = 0; i < nTrks; i++) {
-      // Save X(k)
-      osg::Vec3 tpos = tracks[i]->getPosition();
-      osg::Vec3 tvel = tracks[i]->getVelocity();
-      osg::Vec3 tacc = tracks[i]->getAcceleration();
-
       if (haveU[i]) {
-         // Have Input vector U, use ...
-         // where B is ...
-         LCreal b0 = alpha;
-         LCreal b1 = 0.0;
-         if (age[i] != 0) b1 = beta / age[i];
-         LCreal b2 = 0.0;
-         //LCreal b2 = gamma * 2.0f / (age[i]*age[i]);
-         if (u[i].length2() > d2) {
-            // Large position change: just set position
-            b0 = 1.0;
-            b1 = 0.0;
-         }
-
-         // X(k+1) = A*X(k) + B*U(k)
-         tracks[i]->setPosition(     (tpos*A[0][0] + tvel*A[0][1] + tacc*A[0][2]) + (u[i]*b0) );
-         tracks[i]->setVelocity(     (tpos*A[1][0] + tvel*A[1][1] + tacc*A[1][2]) + (u[i]*b1) );
-         tracks[i]->setAcceleration( (tpos*A[2][0] + tvel*A[2][1] + tacc*A[2][2]) + (u[i]*b2) );
-
          // Object 1: player, Object 2: Track Data
          if (getLogTrackUpdates()) {
             BEGIN_RECORD_DATA_SAMPLE( getSimulation()->getDataRecorder(), REID_TRACK_DATA )
@@ -901,18 +1161,11 @@ void AirTrkMgr::processTrackList(const LCreal dt)
 
          // TabLogger is deprecated
          if (getLogTrackUpdates()  &&  (getAnyEventLogger() != 0)) {
-            TabLogger::TabLogEvent* evt = new TabLogger::LogActiveTrack(2, this,tracks[i]); // type 2 for "update"
+            TabLogger::TabLogEvent* evt = TabLogger::LogActiveTrack::create(2, this,tracks[i]); // type 2 for "update"
             getAnyEventLogger()->log(evt);
             evt->unref();
          }
       }
-      else {
-         // Do not have Input vector U, use ...
-         // X(k+1) = A*X(k)
-         tracks[i]->setPosition(     (tpos*A[0][0] + tvel*A[0][1] + tacc*A[0][2]));
-         tracks[i]->setVelocity(     (tpos*A[1][0] + tvel*A[1][1] + tacc*A[1][2]));
-         tracks[i]->setAcceleration( (tpos*A[2][0] + tvel*A[2][1] + tacc*A[2][2]));
-      }
    }
    lcUnlock(trkListLock);
 
@@ -932,7 +1185,7 @@ void AirTrkMgr::processTrackList(const LCreal dt)
 
          if (getAnyEventLogger() != 0) {
             // TabLogger is deprecated
-            TabLogger::TabLogEvent* evt = new TabLogger::LogActiveTrack(3, this,trk); // type 3 for "remove"
+            TabLogger::TabLogEvent* evt = TabLogger::LogActiveTrack::create(3, this,trk); // type 3 for "remove"
             getAnyEventLogger()->log(evt);
             evt->unref();
          }
@@ -962,7 +1215,7 @@ void AirTrkMgr::processTrackList(const LCreal dt)
    // ---
    lcLock(trkListLock);
    for (unsigned int i = 0; i < nReports; i++) {
-      if ((reportNumMatches[i] == 0) && (nTrks < maxTrks)) {
+      if ((report2Track[i] < 0) && (nTrks < maxTrks)) {
          // This is a new report, so create a new track for it
          RfTrack* newTrk = new RfTrack();
          newTrk->setTrackID( getNewTrackID() );
@@ -983,7 +1236,7 @@ void AirTrkMgr::processTrackList(const LCreal dt)
 
          if (getAnyEventLogger() != 0) {
             // TabLogger is deprecated
-            TabLogger::TabLogEvent* evt = new TabLogger::LogActiveTrack(1, this,newTrk); // type 1 for "new"
+            TabLogger::TabLogEvent* evt = TabLogger::LogActiveTrack::create(1, this,newTrk); // type 1 for "new"
             getAnyEventLogger()->log(evt);
             evt->unref();
          }
@@ -995,87 +1248,6 @@ void AirTrkMgr::processTrackList(const LCreal dt)
    lcUnlock(trkListLock);
 }
 
-//------------------------------------------------------------------------------
-// setPositionGate() -- Sets the size of the position gate
-//------------------------------------------------------------------------------
-bool AirTrkMgr::setPositionGate(const Basic::Number* const num)
-{
-   LCreal value = 0.0;
-   const Basic::Distance* p = dynamic_cast<const Basic::Distance*>(num);
-   if (p != 0) {
-      // We have a distance and we want it in meters ...
-      Basic::Meters meters;
-      value = meters.convert(*p);
-   }
-   else if (num != 0) {
-      // We have only a number, assume it's in meters ...
-      value = num->getReal();
-   }
-
-   // Set the value if it's valid
-   bool ok = true;
-   if (value > 0.0) {
-      posGate = value;
-   }
-   else {
-      std::cerr << "TrackManager::setPositionGate: invalid gate, must be greater than zero." << std::endl;
-      ok = true;
-   }
-   return ok;
-}
-
-//------------------------------------------------------------------------------
-// setRangeGate() -- Sets the size of the range gate
-//------------------------------------------------------------------------------
-bool AirTrkMgr::setRangeGate(const Basic::Number* const num)
-{
-   LCreal value = 0.0;
-   const Basic::Distance* p = dynamic_cast<const Basic::Distance*>(num);
-   if (p != 0) {
-      // We have a distance and we want it in meters ...
-      Basic::Meters meters;
-      value = meters.convert(*p);
-   }
-   else if (num != 0) {
-      // We have only a number, assume it's in meters ...
-      value = num->getReal();
-   }
-
-   // Set the value if it's valid
-   bool ok = true;
-   if (value > 0.0) {
-      rngGate = value;
-   }
-   else {
-      std::cerr << "TrackManager::setRangeGate: invalid gate, must be greater than zero." << std::endl;
-      ok = true;
-   }
-   return ok;
-}
-
-//------------------------------------------------------------------------------
-// setVelocityGate() -- Sets the size of the velocity gate
-//------------------------------------------------------------------------------
-bool AirTrkMgr::setVelocityGate(const Basic::Number* const num)
-{
-   LCreal value = 0.0;
-   if (num != 0) {
-      // We have only a number, assume it's in meters ...
-      value = num->getReal();
-   }
-
-   // Set the value if it's valid
-   bool ok = true;
-   if (value > 0.0) {
-      velGate = value;
-   }
-   else {
-      std::cerr << "TrackManager::setVelocityGate: invalid gate, must be greater than zero." << std::endl;
-      ok = true;
-   }
-   return ok;
-}
-
 //------------------------------------------------------------------------------
 // getSlotByIndex()
 //------------------------------------------------------------------------------
@@ -1120,8 +1292,20 @@ std::ostream& AirTrkMgr::serialize(std::ostream& sout, const int i, const bool s
 // Class: GmtiTrkMgr
 //==============================================================================
 IMPLEMENT_SUBCLASS(GmtiTrkMgr,"GmtiTrkMgr")
-EMPTY_SLOTTABLE(GmtiTrkMgr)
-EMPTY_SERIALIZER(GmtiTrkMgr)
+
+// Slot table
+BEGIN_SLOTTABLE(GmtiTrkMgr)
+   "positionGate",     // 1: Position Gate (meters)
+   "rangeGate",        // 2: Range Gate (meters)
+   "velocityGate",     // 3: Velocity Gate (m/s)
+END_SLOTTABLE(GmtiTrkMgr)
+
+//  Map slot table
+BEGIN_SLOT_MAP(GmtiTrkMgr)
+   ON_SLOT(1, setPositionGate, Basic::Number)
+   ON_SLOT(2, setRangeGate, Basic::Number)
+   ON_SLOT(3, setVelocityGate, Basic::Number)
+END_SLOT_MAP()
 
 //------------------------------------------------------------------------------
 // Constructor(s)
@@ -1136,19 +1320,7 @@ void GmtiTrkMgr::initData()
 {
    setType( Track::ONBOARD_SENSOR_BIT | Track::GND_TRACK_BIT );
 
-   reportNumMatches = new unsigned int[MAX_REPORTS];
-   trackNumMatches = new unsigned int[MAX_TRKS];
-   report2TrackMatch = new bool*[MAX_REPORTS];
-   for (unsigned int i = 0; i < MAX_REPORTS; i++) {
-      reportNumMatches[i] = 0;
-      report2TrackMatch[i] = new bool[MAX_TRKS];
-      for (unsigned int j = 0; j < MAX_TRKS; j++) {
-         report2TrackMatch[i][j] = false;
-      }
-   }
-   for (unsigned int i = 0; i < MAX_TRKS; i++) {
-      trackNumMatches[i] = 0;
-   }
+   posGate = 1000.0f;
 }
 
 //------------------------------------------------------------------------------
@@ -1158,16 +1330,6 @@ void GmtiTrkMgr::copyData(const GmtiTrkMgr& org, const bool cc)
 {
    BaseClass::copyData(org);
    if (cc) initData();
-
-   for (unsigned int i = 0; i < MAX_REPORTS; i++) {
-      reportNumMatches[i] = org.reportNumMatches[i];
-      for (unsigned int j = 0; j < MAX_TRKS; j++) {
-         report2TrackMatch[i][j] = org.report2TrackMatch[i][j];
-      }
-   }
-   for (unsigned int i = 0; i < MAX_TRKS; i++) {
-      trackNumMatches[i] = org.trackNumMatches[i];
-   }
 }
 
 //------------------------------------------------------------------------------
@@ -1175,26 +1337,6 @@ void GmtiTrkMgr::copyData(const GmtiTrkMgr& org, const bool cc)
 //------------------------------------------------------------------------------
 void GmtiTrkMgr::deleteData()
 {
-   if (report2TrackMatch != 0) {
-      for (unsigned int i = 0; i < MAX_REPORTS; i++) {
-         if (report2TrackMatch[i] != 0) {
-            delete[] report2TrackMatch[i];
-            report2TrackMatch[i] = 0;
-         }
-      }
-      delete[] report2TrackMatch;
-      report2TrackMatch = 0;
-   }
-
-   if (reportNumMatches != 0) {
-      delete[] reportNumMatches;
-      reportNumMatches = 0;
-   }
-
-   if (trackNumMatches != 0) {
-      delete[] trackNumMatches;
-      trackNumMatches = 0;
-   }
 }
 
 //------------------------------------------------------------------------------
@@ -1242,7 +1384,6 @@ void GmtiTrkMgr::processTrackList(const LCreal dt)
          emissions[nReports] = em;
          newSignal[nReports] = tmp;
          newRdot[nReports] = emissions[nReports]->getRangeRate();
-         reportNumMatches[nReports] = 0;
          tgtPos[nReports] = tgt->getPosition() - ownship->getPosition();
          nReports++;
       }
@@ -1258,30 +1399,10 @@ void GmtiTrkMgr::processTrackList(const LCreal dt)
    }
 
    // ---
-   // 3) Match current tracks to new reports (observations)
+   // 3) Gate the new reports (observations) with the current, predicted tracks
+   // 4) and associate (one-to-one) the reports with the tracks.
    // ---
-   lcLock(trkListLock);
-   for (unsigned int it = 0; it < nTrks; it++) {
-      trackNumMatches[it] = 0;
-      const RfTrack* const trk = static_cast<const RfTrack*>(tracks[it]);  // we produce only RfTracks
-      const Player* const tgt = trk->getLastEmission()->getTarget();
-      for (unsigned int ir = 0; ir < nReports; ir++) {
-         if (emissions[ir]->getTarget() == tgt) {
-            // We have a new report for the same target as this track ...
-            report2TrackMatch[ir][it] = true;
-            trackNumMatches[it]++;
-            reportNumMatches[ir]++;
-         }
-         else report2TrackMatch[ir][it] = false;
-      }
-   }
-   lcUnlock(trkListLock);
-
-   // ---
-   // 4) Apply rules to associate the proper report to track.
-   // ---
-
-   // No Rules -- Just Right
+   associateReports(tgtPos, newRdot, nReports, posGate, rngGate, velGate);
 
    // ---
    // 5) Create inputs for current tracks
@@ -1289,30 +1410,26 @@ void GmtiTrkMgr::processTrackList(const LCreal dt)
    osg::Vec3 u[MAX_TRKS];
    LCreal age[MAX_TRKS];
    bool haveU[MAX_TRKS];
+
    lcLock(trkListLock);
    for (unsigned int it = 0; it < nTrks; it++) {
       u[it].set(0,0,0);
       haveU[it] = false;
-      if (trackNumMatches[it] > 0) {
-         for (unsigned int ir = 0; ir < nReports; ir++) {
-            if (report2TrackMatch[ir][it]) {
+      const int ir = track2Report[it];
+      if (ir >= 0) {
+         RfTrack* const trk = static_cast<RfTrack*>(tracks[it]);  // we produce only RfTracks
 
-               RfTrack* const trk = static_cast<RfTrack*>(tracks[it]);  // we produce only RfTracks
+         // Update the track's signal and range rate
+         trk->setSignal(newSignal[ir],emissions[ir]);
+         trk->setRangeRate(newRdot[ir]);
 
-               // Update the track's signal
-               trk->setSignal(newSignal[ir],emissions[ir]);
+         // Create a track input vector
+         u[it] = (tgtPos[ir] - trk->getPosition());
 
-               // Create a track input vector
-               u[it] = (tgtPos[ir] - trk->getPosition());
-
-               // Track age and flags
-               if (!haveU[it]) {
-                  age[it] = trk->getTrackAge();
-                  tracks[it]->resetTrackAge();
-                  haveU[it] = true;
-               }
-            }
-         }
+         // Track age and flags
+         age[it] = trk->getTrackAge();
+         tracks[it]->resetTrackAge();
+         haveU[it] = true;
       }
    }
    lcUnlock(trkListLock);
@@ -1326,25 +1443,9 @@ void GmtiTrkMgr::processTrackList(const LCreal dt)
    //      U(k) is the difference between the observed & predicted positions
    // ---
    lcLock(trkListLock);
+   smoothAndPredictTracks(u, age, haveU, 0);
    for (unsigned int i = 0; i < nTrks; i++) {
-      // Save X(k)
-      osg::Vec3 tpos = tracks[i]->getPosition();
-      osg::Vec3 tvel = tracks[i]->getVelocity();
-      osg::Vec3 tacc = tracks[i]->getAcceleration();
-
       if (haveU[i]) {
-         // Have Input vector U, use ...
-         // X(k+1) = A*X(k) + B*U(k)
-         // where B is ...
-         LCreal b0 = alpha;
-         LCreal b1 = 0.0;
-         if (age[i] != 0) b1 = beta / age[i];
-         LCreal b2 = 0.0;
-         //LCreal b2 = gamma * 2.0 / (age[i]*age[i]);
-         tracks[i]->setPosition(     (tpos*A[0][0] + tvel*A[0][1] + tacc*A[0][2]) + (u[i]*b0) );
-         tracks[i]->setVelocity(     (tpos*A[1][0] + tvel*A[1][1] + tacc*A[1][2]) + (u[i]*b1) );
-         tracks[i]->setAcceleration( (tpos*A[2][0] + tvel*A[2][1] + tacc*A[2][2]) + (u[i]*b2) );
-
          if (getLogTrackUpdates()) {
             // Object 1: player, Object 2: Track Data
             BEGIN_RECORD_DATA_SAMPLE( getSimulation()->getDataRecorder(), REID_TRACK_DATA )
@@ -1354,18 +1455,11 @@ void GmtiTrkMgr::processTrackList(const LCreal dt)
 
          // TabLogger is deprecated
          if (getLogTrackUpdates()  &&  (getAnyEventLogger() != 0)) {
-            TabLogger::TabLogEvent* evt = new TabLogger::LogActiveTrack(2, this,tracks[i]); // type 2 for "update"
+            TabLogger::TabLogEvent* evt = TabLogger::LogActiveTrack::create(2, this,tracks[i]); // type 2 for "update"
             getAnyEventLogger()->log(evt);
             evt->unref();
          }
       }
-      else {
-         // Do not have Input vector U, use ...
-         // X(k+1) = A*X(k)
-         tracks[i]->setPosition(     (tpos*A[0][0] + tvel*A[0][1] + tacc*A[0][2]));
-         tracks[i]->setVelocity(     (tpos*A[1][0] + tvel*A[1][1] + tacc*A[1][2]));
-         tracks[i]->setAcceleration( (tpos*A[2][0] + tvel*A[2][1] + tacc*A[2][2]));
-      }
    }
    lcUnlock(trkListLock);
 
@@ -1387,7 +1481,7 @@ void GmtiTrkMgr::processTrackList(const LCreal dt)
 
          // TabLogger is deprecated
          if (getAnyEventLogger() != 0) {
-            TabLogger::TabLogEvent* evt = new TabLogger::LogActiveTrack(3, this,tracks[it]); // type 3 for "remove"
+            TabLogger::TabLogEvent* evt = TabLogger::LogActiveTrack::create(3, this,tracks[it]); // type 3 for "remove"
             getAnyEventLogger()->log(evt);
             evt->unref();
          }
@@ -1411,7 +1505,7 @@ void GmtiTrkMgr::processTrackList(const LCreal dt)
    // ---
    lcLock(trkListLock);
    for (unsigned int i = 0; i < nReports; i++) {
-      if ((reportNumMatches[i] == 0) && (nTrks < maxTrks)) {
+      if ((report2Track[i] < 0) && (nTrks < maxTrks)) {
          // This is a new report, so create a new track for it
          RfTrack* newTrk = new RfTrack();
          newTrk->setTrackID( getNewTrackID() );
@@ -1433,7 +1527,7 @@ void GmtiTrkMgr::processTrackList(const LCreal dt)
 
          // TabLogger is deprecated
          if (getAnyEventLogger() != 0) {
-            TabLogger::TabLogEvent* evt = new TabLogger::LogActiveTrack(1, this,newTrk); // type 1 for "new"
+            TabLogger::TabLogEvent* evt = TabLogger::LogActiveTrack::create(1, this,newTrk); // type 1 for "new"
             getAnyEventLogger()->log(evt);
             evt->unref();
          }
@@ -1445,6 +1539,45 @@ void GmtiTrkMgr::processTrackList(const LCreal dt)
    lcUnlock(trkListLock);
 }
 
+//------------------------------------------------------------------------------
+// getSlotByIndex()
+//------------------------------------------------------------------------------
+Basic::Object* GmtiTrkMgr::getSlotByIndex(const int si)
+{
+   return BaseClass::getSlotByIndex(si);
+}
+
+//------------------------------------------------------------------------------
+// serialize
+//------------------------------------------------------------------------------
+std::ostream& GmtiTrkMgr::serialize(std::ostream& sout, const int i, const bool slotsOnly) const
+{
+   int j = 0;
+   if ( !slotsOnly ) {
+      indent(sout,i);
+      sout << "( " << getFactoryName() << std::endl;
+      j = 4;
+   }
+
+   indent(sout,i+j);
+   sout << "positionGate: " << posGate << std::endl;
+
+   indent(sout,i+j);
+   sout << "rangeGate: " << rngGate << std::endl;
+
+   indent(sout,i+j);
+   sout << "velocityGate: " << velGate << std::endl;
+
+   BaseClass::serialize(sout,i+j,true);
+
+   if ( !slotsOnly ) {
+      indent(sout,i);
+      sout << ")" << std::endl;
+   }
+
+   return sout;
+}
+
 
 //==============================================================================
 // Class: RwrTrkMgr
@@ -1677,7 +1810,7 @@ void RwrTrkMgr::processTrackList(const LCreal dt)
 
          // TabLogger is deprecated
          if (getLogTrackUpdates()  &&  (getAnyEventLogger() != 0)) {
-            TabLogger::TabLogEvent* evt = new TabLogger::LogPassiveTrack(2, this,tracks[i]); // type 2 for "update"
+            TabLogger::TabLogEvent* evt = TabLogger::LogPassiveTrack::create(2, this,tracks[i]); // type 2 for "update"
             getAnyEventLogger()->log(evt);
             evt->unref();
          }
@@ -1709,7 +1842,7 @@ void RwrTrkMgr::processTrackList(const LCreal dt)
 
          // TabLogger is deprecated
          if (getAnyEventLogger() != 0) {
-            TabLogger::TabLogEvent* evt = new TabLogger::LogPassiveTrack(3, this, tracks[it]); // type 3 for "removed"
+            TabLogger::TabLogEvent* evt = TabLogger::LogPassiveTrack::create(3, this, tracks[it]); // type 3 for "removed"
             getAnyEventLogger()->log(evt);
             evt->unref();
          }
@@ -1754,7 +1887,7 @@ void RwrTrkMgr::processTrackList(const LCreal dt)
 
          // TabLogger is deprecated
          if (getAnyEventLogger() != 0) {
-            TabLogger::TabLogEvent* evt = new TabLogger::LogPassiveTrack(1,this,newTrk); // type 1 for "new"
+            TabLogger::TabLogEvent* evt = TabLogger::LogPassiveTrack::create(1,this,newTrk); // type 1 for "new"
             getAnyEventLogger()->log(evt);
             evt->unref();
          }
@@ -437,6 +437,9 @@ bool Weapon::onJettisonEvent()
 
 //------------------------------------------------------------------------------
 // Check local players for the effects of the detonation -- did we hit anyone?
+// The detonation is queued with the simulation, which checks the local players
+// within 10X max burst range, and our target, at the end of the phase (see
+// Simulation::processDetonations() and detonationEffect()).
 //------------------------------------------------------------------------------
 void Weapon::checkDetonationEffect()
 {
@@ -446,36 +449,33 @@ void Weapon::checkDetonationEffect()
       LCreal maxRng = 10.0f * getMaxBurstRng();
 
       // Find our target (if any)
-      const Player* tgt = getTargetPlayer();
+      Player* tgt = getTargetPlayer();
       if (tgt == 0) {
-         const Track* trk = getTargetTrack();
+         Track* trk = getTargetTrack();
          if (trk != 0) tgt = trk->getTarget();
       }
 
-      Basic::PairStream* plist = s->getPlayers();
-      if (plist != 0) {
-      Basic::List::Item* item = plist->getFirstItem();
-
-      // Process the detonation for all local, in-range players
-      bool finished = false;
-      while (item != 0 && !finished) {
-         Basic::Pair* pair = static_cast<Basic::Pair*>(item->getValue());
-         Player* p = static_cast<Player*>(pair->object()); 
-         finished = p->isNetworkedPlayer();  // local only
-         if (!finished && (p != this) ) {
-            osg::Vec3 dpos = p->getPosition() - getPosition();
-            LCreal rng = dpos.length();
-            if ( (rng <= maxRng) || (p == tgt) ) p->processDetonation(rng, this);
-         }
-         item = item->getNext();
-      }
+      s->queueDetonation(this, getPosition(), maxRng, tgt);
+   }
+}
 
-         // cleanup
-         plist->unref();
-         plist = 0;
+//------------------------------------------------------------------------------
+// detonationEffect() -- process the effect of our detonation, at 'detPos',
+// on player 'p' if it's within 'maxRng' or if it's our target, 'tgt'.
+// Returns true if the player's processDetonation() was called.
+//------------------------------------------------------------------------------
+bool Weapon::detonationEffect(Player* const p, const osg::Vec3& detPos, const LCreal maxRng, const Player* const tgt)
+{
+   bool affected = false;
+   if (p != 0 && p != this) {
+      osg::Vec3 dpos = p->getPosition() - detPos;
+      LCreal rng = dpos.length();
+      if ( (rng <= maxRng) || (p == tgt) ) {
+         p->processDetonation(rng, this);
+         affected = true;
       }
-
    }
+   return affected;
 }
 
 //------------------------------------------------------------------------------
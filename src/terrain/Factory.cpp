@@ -4,38 +4,35 @@
 #include "openeaagles/terrain/Factory.h"
 
 #include "openeaagles/basic/Object.h"
+#include "openeaagles/basic/FactoryTable.h"
 
 #include "openeaagles/terrain/QuadMap.h"
 #include "openeaagles/terrain/ded/DedFile.h"
 #include "openeaagles/terrain/dted/DtedFile.h"
 #include "openeaagles/terrain/srtm/SrtmHgtFile.h"
 
-#include <cstring>
-
 namespace Eaagles {
 namespace Terrain {
 
+//------------------------------------------------------------------------------
+// addClasses() -- adds our classes to the factory table
+//------------------------------------------------------------------------------
+static void addClasses(Basic::FactoryTable& table)
+{
+    table.add<QuadMap>();
+    table.add<DedFile>();
+    table.add<DtedFile>();
+    table.add<SrtmHgtFile>();
+}
+
+static Basic::FactoryTable factoryTable(addClasses);
+
 Factory::Factory()
 {}
 
 Basic::Object* Factory::createObj(const char* name)
 {
-    Basic::Object* obj = 0;
-
-    if ( std::strcmp(name, QuadMap::getFactoryName()) == 0 ) {
-        obj = new QuadMap();
-    }
-    else if ( std::strcmp(name, DedFile::getFactoryName()) == 0 ) {
-        obj = new DedFile();
-    }
-    else if ( std::strcmp(name, DtedFile::getFactoryName()) == 0 ) {
-        obj = new DtedFile();
-    }
-    else if ( std::strcmp(name, SrtmHgtFile::getFactoryName()) == 0 ) {
-        obj = new SrtmHgtFile();
-    }
-
-    return obj;
+    return factoryTable.createObj(name);
 }
 
 }  // end namespace Terrain
@@ -0,0 +1,71 @@
+//------------------------------------------------------------------------------
+// Shared scenario setup of the simulation benchmarks and tests
+//
+//    add()           -- adds an object to a component (or template) list
+//    newStation()    -- station with a new simulation, ready to be reset
+//    newBenchmark()  -- Benchmark component of a station and its templates
+//------------------------------------------------------------------------------
+#ifndef __Eaagles_Test_BenchScenario_H__
+#define __Eaagles_Test_BenchScenario_H__
+
+#include "openeaagles/simulation/Benchmark.h"
+#include "openeaagles/simulation/Simulation.h"
+#include "openeaagles/simulation/Station.h"
+
+#include "openeaagles/basic/Integer.h"
+#include "openeaagles/basic/Pair.h"
+#include "openeaagles/basic/PairStream.h"
+
+namespace Eaagles {
+namespace Test {
+
+// Adds 'obj' to the list 'list' as 'name'; 'obj' is unref()'d
+inline void add(Basic::PairStream* const list, const char* const name, Basic::Object* const obj)
+{
+   Basic::Pair* pair = new Basic::Pair(name, obj);
+   list->put(pair);
+   pair->unref();
+   obj->unref();
+}
+
+// Returns a new station (ref()'d) with simulation 'sim', or a new simulation,
+// that uses 'numTcThreads' T/C threads, and a T/C rate of 'rate' Hz
+inline Simulation::Station* newStation(const int numTcThreads = 1, const int rate = 50, Simulation::Simulation* sim = 0)
+{
+   if (sim != 0) sim->ref();
+   else sim = new Simulation::Simulation();
+   {
+      Basic::Integer n(numTcThreads);
+      sim->setSlotByName("numTcThreads", &n);
+   }
+   Simulation::Station* station = new Simulation::Station();
+   station->setSlotSimulation(sim);
+   {
+      Basic::Integer r(rate);
+      station->setSlotTimeCriticalRate(&r);
+   }
+   sim->unref();
+   return station;
+}
+
+// Returns a new benchmark (ref()'d) of 'station' that runs 'numPlayers' clones
+// of the players in 'templates' for 'numFrames' frames
+inline Simulation::Benchmark* newBenchmark(
+      Simulation::Station* const station,
+      Basic::PairStream* const templates,
+      const int numPlayers,
+      const int numFrames
+   )
+{
+   Simulation::Benchmark* bm = new Simulation::Benchmark();
+   bm->setStation(station);
+   bm->setSlotByName("templates", templates);
+   bm->setNumPlayers(numPlayers);
+   bm->setNumFrames(numFrames);
+   return bm;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+#endif
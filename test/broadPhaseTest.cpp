@@ -0,0 +1,432 @@
+//------------------------------------------------------------------------------
+// Test: broad phase player grids (Simulation::findNearbyPlayers() and
+// Simulation::processDetonations())
+//
+// The simulation's player grids must only prune players that a full scan of
+// the player list would have rejected, so the results are the same:
+//
+//    1) Collision detection: a simulation of 1150 players, many of them with a
+//       CollisionDetect, is run for 10 background frames.  Some of the players
+//       are on a lattice whose spacing is the grid's cell size and the max range
+//       (i.e., on the cell edges and at exactly the max range from each other);
+//       a few networked players follow the local players on the player list
+//       (for the 'localOnly' detectors); and a few are outside of the gaming
+//       area, next to detectors that are inside of it.  The players move during
+//       the frame, after the grid was built, as far as the motion padding allows.
+//       Each detector's players of interest, in order, from the broad phase must
+//       be the same as from a scan of the whole player list.
+//
+//    2) Detonations: a batch of detonations, with a mix of ranges, targets and
+//       local-only detonations, some on the lattice, is processed.  The players
+//       that each detonation affects must be the same as those of the original
+//       (brute force) scan of the player list, and each only once.
+//
+// Exits with a non-zero status on any mismatch.
+//------------------------------------------------------------------------------
+
+#include "benchScenario.h"
+
+#include "openeaagles/simulation/AirVehicle.h"
+#include "openeaagles/simulation/Bomb.h"
+#include "openeaagles/simulation/CollisionDetect.h"
+#include "openeaagles/simulation/Nib.h"
+
+#include "openeaagles/basic/Rng.h"
+#include "openeaagles/basic/String.h"
+
+#include <cmath>
+#include <cstdio>
+
+namespace Eaagles {
+namespace Test {
+
+static const double CELL = 1852.0;                 // Lattice spacing, grid cell size and max range (meters)
+static const int LATTICE = 3;                      // Lattice: -LATTICE .. LATTICE cells north and east
+static const unsigned int NUM_LOCAL = 800;         // Random local players
+static const unsigned int NUM_NETWORKED = 200;     // Random networked players
+static const unsigned int NUM_FAR = 3;             // Players outside of the gaming area
+static const double AREA = 20000.0;                // Random players' area (+/- meters)
+static const double GAMING_AREA = 40000.0;         // Gaming area range (meters)
+static const double MAX_SPEED = 300.0;             // Max player speed (m/s)
+static const double FRAME_DT = 1.0;                // Background frame time (sec)
+static const unsigned int NUM_FRAMES = 10;         // Background frames
+static const unsigned int NUM_DETONATIONS = 60;    // Detonations
+
+static unsigned int nErrors = 0;
+
+//------------------------------------------------------------------------------
+// Simulation that counts its broad phase queries (with a limited gaming area)
+//------------------------------------------------------------------------------
+class TestSimulation : public Simulation::Simulation
+{
+public:
+   TestSimulation() : nQueries(0), nCandidates(0)  { setMaxRefRange(GAMING_AREA); }
+
+   void processDetonationsNow()  { processDetonations(); }
+
+   virtual int findNearbyPlayers(const osg::Vec3& pos, const LCreal rng, Eaagles::Simulation::Player* list[], const unsigned int max) {
+      const int n = Simulation::Simulation::findNearbyPlayers(pos, rng, list, max);
+      if (n >= 0) {
+         nQueries++;
+         nCandidates += static_cast<unsigned int>(n);
+      }
+      return n;
+   }
+
+   unsigned int nQueries;        // Broad phase queries
+   unsigned int nCandidates;     // Candidates returned
+};
+
+//------------------------------------------------------------------------------
+// Player that records its detonations; the first player on the list moves all
+// of the players, after the grid is built, before the background processing
+//------------------------------------------------------------------------------
+class TestPlayer : public Simulation::AirVehicle
+{
+public:
+   TestPlayer() : idx(0), mover(false), hits(0) {}
+
+   virtual void updateData(const LCreal dt);
+   virtual void processDetonation(const LCreal, Simulation::Weapon* const wpn);
+
+   unsigned int idx;             // Our index
+   bool mover;                   // We move the players
+   unsigned char* hits;          // Hits by detonation
+};
+
+//------------------------------------------------------------------------------
+// Bomb with its detonation's index
+//------------------------------------------------------------------------------
+class TestBomb : public Simulation::Bomb
+{
+public:
+   TestBomb() : idx(0) {}
+   unsigned int idx;
+};
+
+//------------------------------------------------------------------------------
+// Input NIB
+//------------------------------------------------------------------------------
+class TestNib : public Simulation::Nib
+{
+public:
+   TestNib() : Simulation::Nib(Simulation::NetIO::INPUT_NIB) {}
+};
+
+//------------------------------------------------------------------------------
+// Collision detector that records the players passed to updatePoiList(), from
+// the broad phase's candidates or from the player list
+//------------------------------------------------------------------------------
+class TestCollisionDetect : public Simulation::CollisionDetect
+{
+public:
+   TestCollisionDetect() : fullScan(false), max(0), nBroad(0), nFull(0), broad(0), full(0) {}
+   ~TestCollisionDetect()  { delete[] broad; delete[] full; }
+
+   void setMax(const unsigned int n) {
+      max = n;
+      broad = new Simulation::Player*[n];
+      full = new Simulation::Player*[n];
+   }
+
+   virtual void updatePoiList(Simulation::Player* const target) {
+      if (fullScan) {
+         if (nFull < max) full[nFull] = target;
+         nFull++;
+      }
+      else {
+         if (nBroad < max) broad[nBroad] = target;
+         nBroad++;
+      }
+      Simulation::CollisionDetect::updatePoiList(target);
+   }
+
+   bool fullScan;
+   unsigned int max;
+   unsigned int nBroad;
+   unsigned int nFull;
+   Simulation::Player** broad;
+   Simulation::Player** full;
+};
+
+static TestPlayer** players = 0;
+static unsigned int numPlayers = 0;
+
+void TestPlayer::updateData(const LCreal dt)
+{
+   if (mover && dt > 0) {
+      for (unsigned int i = 0; i < numPlayers; i++) {
+         TestPlayer* const p = players[i];
+         const osg::Vec3d pos = p->getPosition() + p->getVelocity() * dt;
+         p->setPosition(pos[0], pos[1], pos[2]);
+      }
+   }
+   Simulation::AirVehicle::updateData(dt);
+}
+
+void TestPlayer::processDetonation(const LCreal, Simulation::Weapon* const wpn)
+{
+   const TestBomb* const b = dynamic_cast<const TestBomb*>(wpn);
+   if (b != 0 && hits != 0) hits[b->idx * numPlayers + idx]++;
+}
+
+// Random number [ lo .. hi )
+static double draw(Basic::Rng& rng, const double lo, const double hi)
+{
+   return lo + (hi - lo) * rng.drawHalfOpen();
+}
+
+// Adds a collision detector to player 'p'
+static TestCollisionDetect* addDetector(TestPlayer* const p, const unsigned int k)
+{
+   TestCollisionDetect* cd = new TestCollisionDetect();
+   cd->setMax(numPlayers);
+   cd->setMaxPlayers(50);
+   cd->setMaxRange2Players((k % 4) == 2 ? 500.0 : CELL);
+   cd->setLocalOnly((k % 2) == 1);
+   cd->setUseWorld((k % 4) >= 2);
+   if ((k % 5) == 4) cd->setMaxAngle2Players(60.0 * Basic::Angle::D2RCC);
+
+   Basic::PairStream* comps = new Basic::PairStream();
+   Basic::Pair* pair = new Basic::Pair("cd", cd);
+   cd->unref();   // (the player keeps it)
+   comps->put(pair);
+   pair->unref();
+   p->setSlotComponent(comps);
+   comps->unref();
+   return cd;
+}
+
+//------------------------------------------------------------------------------
+// 1) Collision detection
+//------------------------------------------------------------------------------
+static void testCollisionDetect(TestSimulation* const sim, TestCollisionDetect** const cds, const unsigned int ncd)
+{
+   unsigned int nPois = 0;
+   for (unsigned int f = 0; f < NUM_FRAMES; f++) {
+
+      // Players of interest from the broad phase (background frame)
+      for (unsigned int k = 0; k < ncd; k++) {
+         cds[k]->fullScan = false;
+         cds[k]->nBroad = 0;
+      }
+      sim->updateData(static_cast<LCreal>(FRAME_DT));
+
+      // ... and from the player list (there's no broad phase outside of the
+      // background frame), with the players where they are now
+      for (unsigned int k = 0; k < ncd; k++) {
+         cds[k]->fullScan = true;
+         cds[k]->nFull = 0;
+         cds[k]->updateData(static_cast<LCreal>(FRAME_DT));
+      }
+
+      for (unsigned int k = 0; k < ncd; k++) {
+         const TestCollisionDetect* const cd = cds[k];
+         bool same = (cd->nBroad == cd->nFull);
+         for (unsigned int i = 0; same && i < cd->nFull && i < cd->max; i++) {
+            same = (cd->broad[i] == cd->full[i]);
+         }
+         if (!same) {
+            if (nErrors < 10) {
+               std::printf("broadPhaseTest: collisions: frame %u, detector %u (range %g, localOnly %d): %u players of interest, %u from the player list\n",
+                  f, k, cd->getMaxRange2Players(), cd->isLocalOnly(), cd->nBroad, cd->nFull);
+            }
+            nErrors++;
+         }
+         nPois += cd->nFull;
+      }
+   }
+
+   // (the broad phase was used, and it pruned the player list)
+   if (sim->nQueries == 0 || nPois == 0 || sim->nCandidates >= sim->nQueries * numPlayers / 4) {
+      std::printf("broadPhaseTest: collisions: %u queries, %u candidates, %u players of interest\n", sim->nQueries, sim->nCandidates, nPois);
+      nErrors++;
+   }
+   std::printf("broadPhaseTest: collisions: %u players, %u detectors, %u frames, %u queries, %u candidates, %u players of interest\n",
+      numPlayers, ncd, NUM_FRAMES, sim->nQueries, sim->nCandidates, nPois);
+}
+
+//------------------------------------------------------------------------------
+// 2) Detonations
+//------------------------------------------------------------------------------
+static void testDetonations(TestSimulation* const sim, Basic::Rng& rng)
+{
+   static const LCreal ranges[] = { 100.0f, 500.0f, static_cast<LCreal>(CELL), 3000.0f };
+
+   unsigned char* hits = new unsigned char[NUM_DETONATIONS * numPlayers];
+   unsigned char* expected = new unsigned char[NUM_DETONATIONS * numPlayers];
+   for (unsigned int i = 0; i < NUM_DETONATIONS * numPlayers; i++) {
+      hits[i] = 0;
+      expected[i] = 0;
+   }
+   for (unsigned int i = 0; i < numPlayers; i++) players[i]->hits = hits;
+
+   TestBomb* bombs[NUM_DETONATIONS];
+   Basic::PairStream* plist = sim->getPlayers();
+   for (unsigned int d = 0; d < NUM_DETONATIONS; d++) {
+      bombs[d] = new TestBomb();
+      bombs[d]->idx = d;
+
+      // Position: on the lattice or random
+      osg::Vec3 pos;
+      if ((d % 2) == 0) {
+         const int n = static_cast<int>(draw(rng, -LATTICE, LATTICE + 1));
+         const int e = static_cast<int>(draw(rng, -LATTICE, LATTICE + 1));
+         pos.set(static_cast<LCreal>(n * CELL), static_cast<LCreal>(e * CELL), static_cast<LCreal>(draw(rng, -200.0, 0.0)));
+      }
+      else {
+         pos.set(static_cast<LCreal>(draw(rng, -AREA, AREA)), static_cast<LCreal>(draw(rng, -AREA, AREA)), -1000.0f);
+      }
+      const LCreal maxRng = ranges[d % 4];
+      const bool all = ((d % 3) == 0);
+
+      // Target: none, a random player (maybe networked) or a far player
+      Simulation::Player* tgt = 0;
+      if ((d % 5) == 1) tgt = players[static_cast<unsigned int>(draw(rng, 0, numPlayers))];
+      else if ((d % 5) == 3) tgt = players[numPlayers - 1];
+
+      sim->queueDetonation(bombs[d], pos, maxRng, tgt, all);
+
+      // The original scan of the player list (local players first)
+      Basic::List::Item* item = plist->getFirstItem();
+      bool finished = false;
+      while (item != 0 && !finished) {
+         Basic::Pair* pair = static_cast<Basic::Pair*>(item->getValue());
+         TestPlayer* p = static_cast<TestPlayer*>(pair->object());
+         finished = !all && p->isNetworkedPlayer();
+         if (!finished) {
+            osg::Vec3 dpos = p->getPosition() - pos;
+            LCreal rng1 = dpos.length();
+            if ( (rng1 <= maxRng) || (p == tgt) ) expected[d * numPlayers + p->idx]++;
+         }
+         item = item->getNext();
+      }
+   }
+   plist->unref();
+
+   sim->processDetonationsNow();
+
+   unsigned int nHits = 0;
+   for (unsigned int d = 0; d < NUM_DETONATIONS; d++) {
+      for (unsigned int i = 0; i < numPlayers; i++) {
+         const unsigned int h = hits[d * numPlayers + i];
+         const unsigned int x = expected[d * numPlayers + i];
+         if (h != x) {
+            if (nErrors < 10) {
+               std::printf("broadPhaseTest: detonations: detonation %u (range %g), player %u: %u hits, expected %u\n",
+                  d, ranges[d % 4], i, h, x);
+            }
+            nErrors++;
+         }
+         nHits += h;
+      }
+      bombs[d]->unref();
+   }
+   if (nHits == 0) {
+      std::printf("broadPhaseTest: detonations: no hits\n");
+      nErrors++;
+   }
+   std::printf("broadPhaseTest: detonations: %u detonations, %u hits\n", NUM_DETONATIONS, nHits);
+
+   for (unsigned int i = 0; i < numPlayers; i++) players[i]->hits = 0;
+   delete[] hits;
+   delete[] expected;
+}
+
+static int run()
+{
+   Basic::Rng rng(3701);
+
+   TestSimulation* sim = new TestSimulation();
+   Simulation::Station* station = newStation(1, 50, sim);
+   station->event(Basic::Component::RESET_EVENT);
+
+   // Players: the lattice, the random local and networked players, and the far
+   // players (last) with a detector next to each of them
+   const unsigned int nl = (2 * LATTICE + 1) * (2 * LATTICE + 1) * 3;
+   numPlayers = nl + NUM_LOCAL + NUM_NETWORKED + 2 * NUM_FAR;
+   players = new TestPlayer*[numPlayers];
+   TestCollisionDetect** cds = new TestCollisionDetect*[numPlayers];
+   unsigned int ncd = 0;
+   const Basic::String federate("bptest");
+   for (unsigned int i = 0; i < numPlayers; i++) {
+      TestPlayer* p = new TestPlayer();
+      p->idx = i;
+      p->mover = (i == 0);
+      p->setID(static_cast<unsigned short>(i + 1));
+      players[i] = p;
+
+      const bool networked = (i >= nl + NUM_LOCAL && i < nl + NUM_LOCAL + NUM_NETWORKED);
+      if (networked) {
+         TestNib* nib = new TestNib();
+         nib->setFederateName(&federate);
+         nib->setPlayerID(static_cast<unsigned short>(i + 1));
+         p->setNib(nib);
+         nib->unref();
+      }
+      else if (i < nl || (i % 2) == 0 || (i >= nl + NUM_LOCAL + NUM_NETWORKED && (i % 2) == 1)) {
+         cds[ncd] = addDetector(p, ncd);
+         ncd++;
+      }
+
+      char name[32];
+      std::sprintf(name, "p%05u", (i + 1));
+      sim->addNewPlayer(name, p);
+      if (((i + 1) % Simulation::Simulation::MAX_NEW_PLAYERS) == 0) sim->updateData(0);
+   }
+   sim->updateData(0);
+
+   // Positions and velocities
+   for (unsigned int i = 0; i < numPlayers; i++) {
+      TestPlayer* const p = players[i];
+      if (i < nl) {
+         // Lattice: on the cell corners, and just on either side of them (stationary)
+         const int k = static_cast<int>(i / 3);
+         const int n = (k / (2 * LATTICE + 1)) - LATTICE;
+         const int e = (k % (2 * LATTICE + 1)) - LATTICE;
+         const double offset = (static_cast<int>(i % 3) - 1) * 0.01;
+         p->setPosition(n * CELL + offset, e * CELL + offset, -1000.0);
+         p->setVelocity(0, 0, 0);
+      }
+      else if (i < nl + NUM_LOCAL + NUM_NETWORKED) {
+         p->setPosition(draw(rng, -AREA, AREA), draw(rng, -AREA, AREA), draw(rng, -3000.0, -500.0));
+         const double hdg = draw(rng, -PI, PI);
+         const double spd = draw(rng, 0, MAX_SPEED);
+         p->setVelocity(static_cast<LCreal>(spd * std::cos(hdg)), static_cast<LCreal>(spd * std::sin(hdg)), 0);
+         p->setEulerAngles(0, 0, static_cast<LCreal>(draw(rng, -PI, PI)));
+      }
+      else {
+         // Pairs of players: outside of the gaming area, and a detector
+         // inside of it, 1 km apart
+         const unsigned int j = (i - (nl + NUM_LOCAL + NUM_NETWORKED)) / 2;
+         const double e = ((i % 2) == 0 ? GAMING_AREA + 500.0 : GAMING_AREA - 500.0);
+         p->setPosition(1000.0 * j, e, -1000.0);
+         p->setVelocity(0, 0, 0);
+      }
+   }
+
+   testCollisionDetect(sim, cds, ncd);
+   testDetonations(sim, rng);
+
+   for (unsigned int i = 0; i < numPlayers; i++) players[i]->unref();
+   delete[] players;
+   delete[] cds;
+   station->event(Basic::Component::SHUTDOWN_EVENT);
+   station->unref();
+   sim->unref();
+
+   if (nErrors > 0) {
+      std::printf("broadPhaseTest: FAILED, %u errors\n", nErrors);
+      return 1;
+   }
+   std::printf("broadPhaseTest: passed\n");
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int, char**)
+{
+   return Eaagles::Test::run();
+}
@@ -0,0 +1,249 @@
+//------------------------------------------------------------------------------
+// Benchmark: component tree traversal (Basic::Component::updateTC())
+//
+// Times the update of a 341 component tree (four children per component, five
+// levels) by updateTC(), which uses the components' cached child arrays, and
+// by a walk of the component lists (getComponents(), the list items and
+// Pair::object()), which is how updateTC() used to update the children.
+//
+// Then, in each frame, one of the components replaces one of its container's
+// components during the traversal, and the frame time is measured again.  The
+// replaced components must be freed by the end of the frame, once the
+// container's traversal is done with its old child array.
+//
+// Usage: componentBench [ numFrames ]
+//
+// Exits with a non-zero status if a component isn't updated once per frame or
+// if a replaced component isn't freed by the end of its frame.
+//------------------------------------------------------------------------------
+
+#include "openeaagles/basic/Component.h"
+#include "openeaagles/basic/Pair.h"
+#include "openeaagles/basic/PairStream.h"
+#include "openeaagles/basic/support.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace Eaagles {
+namespace Test {
+
+static const unsigned int FAN_OUT = 4;      // Children per component
+static const unsigned int NUM_LEVELS = 5;   // Levels of the tree
+
+static bool listWalk = false;              // Update the children by walking the lists
+static unsigned int numCreated = 0;         // Number of Node objects created
+static unsigned int numDeleted = 0;         // Number of Node objects deleted
+
+//------------------------------------------------------------------------------
+// Component that counts its updates
+//------------------------------------------------------------------------------
+class Node : public Basic::Component
+{
+   DECLARE_SUBCLASS(Node,Basic::Component)
+public:
+   Node()  { STANDARD_CONSTRUCTOR() count = 0; numCreated++; }
+
+   unsigned int getCount() const   { return count; }
+   void setCount(const unsigned int n)   { count = n; }
+
+   // Adds component 'c' as 'name'
+   void add(const char* const name, Basic::Component* const c) {
+      Basic::Pair* pair = new Basic::Pair(name, c);
+      addComponent(pair);
+      pair->unref();
+   }
+
+   // Removes component 'c'
+   void remove(Basic::Component* const c) {
+      Basic::PairStream* list = getComponents();
+      processComponents(list, typeid(Basic::Component), 0, c);
+      if (list != 0) list->unref();
+   }
+
+   virtual void updateTC(const LCreal dt = 0.0f) {
+      count++;
+      if (listWalk) {
+         // How Component::updateTC() used to update the children
+         Basic::PairStream* list = getComponents();
+         if (list != 0) {
+            for (Basic::List::Item* item = list->getFirstItem(); item != 0; item = item->getNext()) {
+               Basic::Pair* pair = static_cast<Basic::Pair*>(item->getValue());
+               static_cast<Basic::Component*>(pair->object())->tcFrame(dt);
+            }
+            list->unref();
+         }
+      }
+      else {
+         BaseClass::updateTC(dt);
+      }
+   }
+
+private:
+   unsigned int count;     // Number of updates
+};
+
+IMPLEMENT_SUBCLASS(Node,"BenchNode")
+EMPTY_SLOTTABLE(Node)
+EMPTY_SERIALIZER(Node)
+
+void Node::copyData(const Node& org, const bool cc)
+{
+   BaseClass::copyData(org);
+   if (cc) numCreated++;
+   count = org.count;
+}
+
+void Node::deleteData()
+{
+   numDeleted++;
+}
+
+//------------------------------------------------------------------------------
+// Component that replaces one of its container's components, 'victim', with a
+// new component, during each update
+//------------------------------------------------------------------------------
+class Replacer : public Node
+{
+   DECLARE_SUBCLASS(Replacer,Node)
+public:
+   Replacer()  { STANDARD_CONSTRUCTOR() victim = 0; }
+
+   void setVictim(Node* const p)  { victim = p; }
+
+   virtual void updateTC(const LCreal dt = 0.0f) {
+      BaseClass::updateTC(dt);
+      Node* const parent = static_cast<Node*>(container());
+      if (parent != 0 && victim != 0) {
+         // (the old one is still updated this frame, by our container's traversal)
+         Node* const p = new Node();
+         p->setCount(victim->getCount() + 1);
+         parent->remove(victim);
+         parent->add("new", p);
+         victim = p;
+         p->unref();
+      }
+   }
+
+private:
+   Node* victim;     // Component to replace (not ref()'d; it's in our container's list)
+};
+
+IMPLEMENT_SUBCLASS(Replacer,"BenchReplacer")
+EMPTY_SLOTTABLE(Replacer)
+EMPTY_SERIALIZER(Replacer)
+EMPTY_COPYDATA(Replacer)
+EMPTY_DELETEDATA(Replacer)
+
+// Builds a tree of 'levels' levels under 'parent'
+static void build(Node* const parent, const unsigned int levels)
+{
+   if (levels == 0) return;
+   for (unsigned int i = 0; i < FAN_OUT; i++) {
+      Node* p = new Node();
+      build(p, levels - 1);
+      char name[16];
+      std::sprintf(name, "n%u", i);
+      parent->add(name, p);
+      p->unref();
+   }
+}
+
+static unsigned int nErrors = 0;
+
+// Checks that each component of the tree was updated 'n' times
+static unsigned int check(const Basic::Component* const c, const unsigned int n)
+{
+   unsigned int nc = 1;
+   if (static_cast<const Node*>(c)->getCount() != n) nErrors++;
+   const Basic::PairStream* list = c->getComponents();
+   if (list != 0) {
+      for (const Basic::List::Item* item = list->getFirstItem(); item != 0; item = item->getNext()) {
+         const Basic::Pair* pair = static_cast<const Basic::Pair*>(item->getValue());
+         nc += check(static_cast<const Basic::Component*>(pair->object()), n);
+      }
+      list->unref();
+   }
+   return nc;
+}
+
+static int run(const unsigned int numFrames)
+{
+   const LCreal dt = 1.0f / 50.0f;
+
+   Node* root = new Node();
+   build(root, NUM_LEVELS - 1);
+
+   // updateTC()
+   double t0 = getComputerTime();
+   for (unsigned int i = 0; i < numFrames; i++) root->updateTC(dt);
+   const double arrayTime = getComputerTime() - t0;
+   const unsigned int numNodes = check(root, numFrames);
+
+   // List walk
+   t0 = getComputerTime();
+   listWalk = true;
+   for (unsigned int i = 0; i < numFrames; i++) root->updateTC(dt);
+   listWalk = false;
+   const double walkTime = getComputerTime() - t0;
+   check(root, numFrames * 2);
+
+   // updateTC() with a replacement each frame: the last child of the root's
+   // first child is replaced by a Replacer and its first victim.
+   Basic::PairStream* list = root->getComponents();
+   Node* const parent = static_cast<Node*>(static_cast<Basic::Pair*>(list->getFirstItem()->getValue())->object());
+   list->unref();
+   list = parent->getComponents();
+   Node* const last = static_cast<Node*>(static_cast<Basic::Pair*>(list->getLastItem()->getValue())->object());
+   list->unref();
+   parent->remove(last);
+   Replacer* rp = new Replacer();
+   rp->setCount(numFrames * 2);
+   parent->add("replacer", rp);
+   Node* victim = new Node();
+   victim->setCount(numFrames * 2);
+   parent->add("new", victim);
+   rp->setVictim(victim);
+   rp->unref();
+   victim->unref();
+
+   const unsigned int numLive = numCreated - numDeleted;
+   unsigned int maxLive = 0;
+   t0 = getComputerTime();
+   for (unsigned int i = 0; i < numFrames; i++) {
+      root->updateTC(dt);
+      const unsigned int live = numCreated - numDeleted;
+      if (live > maxLive) maxLive = live;
+   }
+   const double replaceTime = getComputerTime() - t0;
+   check(root, numFrames * 3);
+
+   std::printf("componentBench: %u components, %u frames\n", numNodes, numFrames);
+   std::printf("   updateTC():             %10.3f nsec/component\n", (arrayTime * 1.0e9) / (numFrames * numNodes));
+   std::printf("   list walk:              %10.3f nsec/component\n", (walkTime * 1.0e9) / (numFrames * numNodes));
+   std::printf("   updateTC(), replacing:  %10.3f nsec/component\n", (replaceTime * 1.0e9) / (numFrames * numNodes));
+   std::printf("   live components:        %10u (max), %u expected\n", maxLive, numLive);
+
+   if (maxLive > numLive) {
+      std::printf("componentBench: replaced components weren't freed\n");
+      nErrors++;
+   }
+
+   root->unref();
+
+   if (nErrors > 0) {
+      std::printf("componentBench: FAILED, %u errors\n", nErrors);
+      return 1;
+   }
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int argc, char* argv[])
+{
+   unsigned int numFrames = 10000;
+   if (argc > 1) numFrames = static_cast<unsigned int>(std::atoi(argv[1]));
+   return Eaagles::Test::run(numFrames);
+}
@@ -0,0 +1,153 @@
+//------------------------------------------------------------------------------
+// Benchmark: datalink message delivery (Simulation::processDatalinkMessages())
+//
+// Runs the Benchmark component with 200 air vehicles, half blue and half red,
+// each with a datalink (no radio, 40 NM max range) that sends a message ten
+// times a second, for 500 unpaced T/C frames (10 seconds at 50 Hz).  The blue
+// datalinks only receive messages from blue players, and the red datalinks
+// from all sides.  The JSON results, including the per-phase and per-subsystem
+// breakdowns, are written to the standard output, followed by the number of
+// messages sent and received.  The messages are delivered at the end of each
+// phase.
+//
+// Usage: datalinkBench [ numPlayers [ numFrames ] ]
+//
+// Exits with a non-zero status if the benchmark can't be run or if no message
+// was received.
+//------------------------------------------------------------------------------
+
+#include "benchScenario.h"
+
+#include "openeaagles/simulation/AirVehicle.h"
+#include "openeaagles/simulation/Datalink.h"
+
+#include "openeaagles/basic/Integer.h"
+#include "openeaagles/basic/support.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace Eaagles {
+namespace Test {
+
+static const LCreal SEND_PERIOD = 0.1f;   // Time between messages (sec)
+
+static long countLock = 0;                // Message counts semaphore
+static unsigned int numSent = 0;          // Number of messages sent
+static unsigned int numReceived = 0;      // Number of messages received
+
+//------------------------------------------------------------------------------
+// Datalink that sends a message every SEND_PERIOD seconds, and queues, counts
+// and removes the messages that it receives
+//------------------------------------------------------------------------------
+class ChattyDatalink : public Simulation::Datalink
+{
+   DECLARE_SUBCLASS(ChattyDatalink,Simulation::Datalink)
+public:
+   ChattyDatalink()  { STANDARD_CONSTRUCTOR() timer = 0; }
+
+   virtual void reset() {
+      BaseClass::reset();
+      // Spread the players' messages over the period
+      timer = 0;
+      if (getOwnship() != 0) timer = SEND_PERIOD * static_cast<LCreal>(getOwnship()->getID() % 5) / 5.0f;
+   }
+
+   virtual bool onDatalinkMessageEvent(Basic::Object* const msg) {
+      queueIncomingMessage(msg);
+      return BaseClass::onDatalinkMessageEvent(msg);
+   }
+
+protected:
+   virtual void dynamics(const LCreal dt) {
+      BaseClass::dynamics(dt);
+
+      unsigned int nr = 0;
+      for (Basic::Object* msg = receiveMessage(); msg != 0; msg = receiveMessage()) {
+         msg->unref();
+         nr++;
+      }
+
+      unsigned int ns = 0;
+      timer -= dt;
+      if (timer <= 0 && getOwnship() != 0) {
+         timer += SEND_PERIOD;
+         Basic::Integer* msg = new Basic::Integer(getOwnship()->getID());
+         if (sendMessage(msg)) ns++;
+         msg->unref();
+      }
+
+      lcLock(countLock);
+      numSent += ns;
+      numReceived += nr;
+      lcUnlock(countLock);
+   }
+
+private:
+   LCreal timer;     // Time to our next message (sec)
+};
+
+IMPLEMENT_SUBCLASS(ChattyDatalink,"ChattyDatalink")
+EMPTY_SLOTTABLE(ChattyDatalink)
+EMPTY_SERIALIZER(ChattyDatalink)
+EMPTY_DELETEDATA(ChattyDatalink)
+
+void ChattyDatalink::copyData(const ChattyDatalink& org, const bool)
+{
+   BaseClass::copyData(org);
+   timer = org.timer;
+}
+
+// Air vehicle on side 'side' with a datalink that receives messages from the 'sideMask' sides
+static Simulation::AirVehicle* makeTemplate(const Simulation::Player::Side side, const unsigned int sideMask)
+{
+   Simulation::AirVehicle* av = new Simulation::AirVehicle();
+   av->setSide(side);
+   ChattyDatalink* dl = new ChattyDatalink();
+   dl->setMaxRange(40.0);
+   dl->setSideMask(sideMask);
+   dl->setNetworkQueueEnabled(false);
+   Basic::PairStream* systems = new Basic::PairStream();
+   add(systems, "datalink", dl);
+   av->setSlotComponent(systems);
+   systems->unref();
+   return av;
+}
+
+static int run(const int numPlayers, const int numFrames)
+{
+   Basic::PairStream* templates = new Basic::PairStream();
+   add(templates, "blue", makeTemplate(Simulation::Player::BLUE, Simulation::Player::BLUE));
+   add(templates, "red", makeTemplate(Simulation::Player::RED, 0xff));
+
+   // Station, simulation and the benchmark
+   Simulation::Station* station = newStation();
+   Simulation::Benchmark* bm = newBenchmark(station, templates, numPlayers, numFrames);
+   station->unref();
+   templates->unref();
+
+   const bool ok = bm->run();
+
+   bm->getStation()->event(Basic::Component::SHUTDOWN_EVENT);
+   bm->unref();
+
+   std::printf("datalinkBench: %u messages sent, %u received\n", numSent, numReceived);
+
+   if (!ok || numReceived == 0) {
+      std::printf("datalinkBench: FAILED\n");
+      return 1;
+   }
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int argc, char* argv[])
+{
+   int numPlayers = 200;
+   int numFrames = 500;
+   if (argc > 1) numPlayers = std::atoi(argv[1]);
+   if (argc > 2) numFrames = std::atoi(argv[2]);
+   return Eaagles::Test::run(numPlayers, numFrames);
+}
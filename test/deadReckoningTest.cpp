@@ -0,0 +1,424 @@
+//------------------------------------------------------------------------------
+// Test: batched dead reckoning (Simulation::DeadReckoningBatch)
+//
+// The batched dead reckoning of the networked players' NIBs must give results
+// identical to the NIB's own DR function, Nib::mainDeadReckoning().
+//
+//    1) Batch: 5000 NIBs, with all of the DR algorithms (and an unknown one),
+//       are dead reckoned by a DeadReckoningBatch for 50 frames.  The batch is
+//       split into 1 to 5 parts, which are computed in reverse order, and every
+//       other frame by a pool of threads, one part per thread.  Between the
+//       batch and the NIBs' use of its results, a few of the NIBs are reset
+//       (as a network thread would), some to the same DR time, and a few are
+//       batched for the wrong DR time.  Each NIB's batched position and angles
+//       must be bit-identical to its own DR, and the batched results of the
+//       reset NIBs and of the wrong DR times must be discarded.
+//
+//    2) Simulation: networked players, with the same mix of DR algorithms, are
+//       run by a simulation for 20 frames, with at least MIN_DR_NIBS_PER_THREAD
+//       NIBs per T/C thread, so the batch is split across the T/C threads when
+//       there's more than one (the number of T/C threads is limited by the
+//       number of processors).  A few NIBs are reset between frames.  Each
+//       player's position must be bit-identical to its NIB's own DR.
+//
+// Exits with a non-zero status on any mismatch.
+//------------------------------------------------------------------------------
+
+#include "benchScenario.h"
+
+#include "openeaagles/simulation/AirVehicle.h"
+#include "openeaagles/simulation/DeadReckoningBatch.h"
+#include "openeaagles/simulation/Nib.h"
+
+#include "openeaagles/basic/Component.h"
+#include "openeaagles/basic/Rng.h"
+#include "openeaagles/basic/String.h"
+#include "openeaagles/basic/Thread.h"
+#include "openeaagles/basic/ThreadPool.h"
+
+#include <cstdio>
+#include <iostream>
+
+namespace Eaagles {
+namespace Test {
+
+static const unsigned int NUM_BATCH_NIBS = 5000;   // NIBs (batch test)
+static const unsigned int NUM_BATCH_FRAMES = 50;   // Frames (batch test)
+static const unsigned int MAX_PARTS = 5;           // Max parts of the batch
+static const unsigned int NUM_SIM_FRAMES = 20;     // Frames (simulation test)
+static const unsigned int MAX_TC_THREADS = 4;      // Max T/C threads (simulation test)
+static const double FRAME_DT = 0.05;               // Frame time (sec)
+static const unsigned int RESET_PERCENT = 3;       // NIBs reset per frame (%)
+static const unsigned int SKEW_PERCENT = 2;        // NIBs batched for the wrong DR time (%)
+
+// DR algorithms of the NIBs: all of them, and an unknown one
+static const unsigned char algorithms[] = {
+   Simulation::Nib::OTHER_DRM, Simulation::Nib::STATIC_DRM,
+   Simulation::Nib::FPW_DRM, Simulation::Nib::RPW_DRM,
+   Simulation::Nib::RVW_DRM, Simulation::Nib::FVW_DRM,
+   Simulation::Nib::FPB_DRM, Simulation::Nib::RPB_DRM,
+   Simulation::Nib::RVB_DRM, Simulation::Nib::FVB_DRM,
+   12
+};
+static const unsigned int NUM_ALGS = sizeof(algorithms) / sizeof(algorithms[0]);
+
+static unsigned int nErrors = 0;
+
+//------------------------------------------------------------------------------
+// Input NIB with access to its DR functions
+//------------------------------------------------------------------------------
+class TestNib : public Simulation::Nib
+{
+   DECLARE_SUBCLASS(TestNib,Simulation::Nib)
+public:
+   TestNib();
+
+   // The NIB's own DR
+   void ownDr(const double dT, osg::Vec3d* const pos, osg::Vec3d* const rpy) const {
+      mainDeadReckoning(dT, pos, rpy);
+   }
+
+   // The batched DR (and uses it up)
+   bool batchDr(const double dT, osg::Vec3d* const pos, osg::Vec3d* const rpy) {
+      return getBatchDeadReckoning(dT, pos, rpy);
+   }
+
+   // Advances the DR time
+   double advance(const double dt)  { return updateDrTime(dt); }
+};
+
+IMPLEMENT_PARTIAL_SUBCLASS(TestNib,"TestNib")
+EMPTY_SLOTTABLE(TestNib)
+EMPTY_SERIALIZER(TestNib)
+EMPTY_COPYDATA(TestNib)
+EMPTY_DELETEDATA(TestNib)
+
+TestNib::TestNib() : Simulation::Nib(Simulation::NetIO::INPUT_NIB)
+{
+   STANDARD_CONSTRUCTOR()
+}
+
+TestNib::TestNib(const TestNib& org) : Simulation::Nib(org.getIoType())
+{
+   STANDARD_CONSTRUCTOR()
+   copyData(org,true);
+}
+
+TestNib::~TestNib()
+{
+   STANDARD_DESTRUCTOR()
+}
+
+TestNib& TestNib::operator=(const TestNib& org)
+{
+   if (this != &org) copyData(org,false);
+   return *this;
+}
+
+TestNib* TestNib::clone() const
+{
+   return new TestNib(*this);
+}
+
+// Random number [ lo .. hi )
+static double draw(Basic::Rng& rng, const double lo, const double hi)
+{
+   return lo + (hi - lo) * rng.drawHalfOpen();
+}
+
+static osg::Vec3d drawVec(Basic::Rng& rng, const double lim)
+{
+   return osg::Vec3d(draw(rng, -lim, lim), draw(rng, -lim, lim), draw(rng, -lim, lim));
+}
+
+// Resets the NIB's DR with a random state and DR algorithm 'dr' at DR time
+// 'time'; the position is more than 2 km from 'pos' (so there's no smoothing)
+static void resetNib(Basic::Rng& rng, TestNib* const nib, const unsigned char dr, const osg::Vec3d& pos, const double time)
+{
+   osg::Vec3d p = pos + osg::Vec3d(5000.0, 0, 0) + drawVec(rng, 1000.0);
+   nib->resetDeadReckoning(dr, p, drawVec(rng, 300.0), drawVec(rng, 10.0), drawVec(rng, 3.0), drawVec(rng, 0.5), time);
+}
+
+//------------------------------------------------------------------------------
+// Pool manager: computes a part of the batch
+//------------------------------------------------------------------------------
+class Part : public Basic::Object
+{
+   DECLARE_SUBCLASS(Part,Basic::Object)
+public:
+   Part()  { STANDARD_CONSTRUCTOR() batch = 0; idx = 0; n = 0; }
+   void set(Simulation::DeadReckoningBatch* const b, const unsigned int i, const unsigned int nn) { batch = b; idx = i; n = nn; }
+   void compute()  { batch->compute(idx, n); }
+private:
+   Simulation::DeadReckoningBatch* batch;
+   unsigned int idx;
+   unsigned int n;
+};
+
+IMPLEMENT_SUBCLASS(Part,"Part")
+EMPTY_SLOTTABLE(Part)
+EMPTY_COPYDATA(Part)
+EMPTY_DELETEDATA(Part)
+EMPTY_SERIALIZER(Part)
+
+class PartManager : public Basic::ThreadPoolManager
+{
+   DECLARE_SUBCLASS(PartManager,Basic::ThreadPoolManager)
+public:
+   PartManager()  { STANDARD_CONSTRUCTOR() }
+protected:
+   virtual void execute(Basic::Object* const, Basic::Object* cur) {
+      Part* p = static_cast<Part*>(cur);
+      if (p != 0) p->compute();
+   }
+};
+
+IMPLEMENT_SUBCLASS(PartManager,"PartManager")
+EMPTY_SLOTTABLE(PartManager)
+EMPTY_COPYDATA(PartManager)
+EMPTY_DELETEDATA(PartManager)
+EMPTY_SERIALIZER(PartManager)
+
+// Computes the 'n' parts of the batch using the pool's threads
+static void computeThreaded(Basic::ThreadPool* const pool, Simulation::DeadReckoningBatch* const batch, const unsigned int n)
+{
+   Part* parts[MAX_PARTS];
+   Basic::ThreadPoolTask* tasks[MAX_PARTS];
+   for (unsigned int i = 0; i < n; i++) {
+      parts[i] = new Part();
+      parts[i]->set(batch, (n - i), n);
+      tasks[i] = pool->submit(parts[i]);
+      if (tasks[i] == 0) parts[i]->compute();
+   }
+   for (unsigned int i = 0; i < n; i++) {
+      if (tasks[i] != 0) {
+         tasks[i]->waitForCompleted();
+         tasks[i]->unref();
+      }
+      parts[i]->unref();
+   }
+}
+
+//------------------------------------------------------------------------------
+// 1) Batch
+//------------------------------------------------------------------------------
+static void testBatch()
+{
+   Basic::Rng rng(4301);
+
+   TestNib** nibs = new TestNib*[NUM_BATCH_NIBS];
+   bool* reset = new bool[NUM_BATCH_NIBS];
+   bool* skewed = new bool[NUM_BATCH_NIBS];
+   for (unsigned int i = 0; i < NUM_BATCH_NIBS; i++) {
+      nibs[i] = new TestNib();
+      resetNib(rng, nibs[i], algorithms[i % NUM_ALGS], osg::Vec3d(6378137.0, 0, 0), 0);
+   }
+
+   // Pool of MAX_PARTS threads for the threaded frames
+   Basic::Component* parent = new Basic::Component();
+   PartManager* mgr = new PartManager();
+   Basic::ThreadPool* pool = new Basic::ThreadPool(mgr, static_cast<int>(MAX_PARTS), 0.5f, MAX_PARTS);
+   mgr->unref();
+   pool->initialize(parent);
+
+   unsigned int nBatched[NUM_ALGS] = { 0 };
+   unsigned int nReset = 0;
+   Simulation::DeadReckoningBatch batch;
+   for (unsigned int f = 0; f < NUM_BATCH_FRAMES; f++) {
+
+      // The batch
+      batch.clear();
+      for (unsigned int i = 0; i < NUM_BATCH_NIBS; i++) {
+         skewed[i] = (rng.drawHalfOpen() * 100.0 < SKEW_PERCENT);
+         const double dt = (skewed[i] ? 2.0 * FRAME_DT : FRAME_DT);
+         batch.add(nibs[i], nibs[i]->getDrTime() + dt);
+      }
+      batch.sort();
+      const unsigned int n = 1 + (f % MAX_PARTS);
+      if ((f % 2) == 1) {
+         computeThreaded(pool, &batch, n);
+      }
+      else {
+         for (unsigned int k = n; k > 0; k--) batch.compute(k, n);
+      }
+
+      // Reset a few NIBs after the batch (half to the same DR time, some
+      // with a new algorithm)
+      for (unsigned int i = 0; i < NUM_BATCH_NIBS; i++) {
+         reset[i] = (rng.drawHalfOpen() * 100.0 < RESET_PERCENT);
+         if (reset[i]) {
+            const double time = (rng.drawHalfOpen() < 0.5 ? nibs[i]->getDrTime() : 0.0);
+            const unsigned char dr = (rng.drawHalfOpen() < 0.5 ? nibs[i]->getDeadReckoning() : algorithms[i % NUM_ALGS]);
+            resetNib(rng, nibs[i], dr, nibs[i]->getDrPosition(), time);
+            nReset++;
+         }
+      }
+
+      // Use the batched results; they must be the same as the NIB's own DR
+      for (unsigned int i = 0; i < NUM_BATCH_NIBS; i++) {
+         const double t = nibs[i]->advance(FRAME_DT);
+         osg::Vec3d bPos, bRpy;
+         osg::Vec3d rPos, rRpy;
+         const bool batched = nibs[i]->batchDr(t, &bPos, &bRpy);
+         nibs[i]->ownDr(t, &rPos, &rRpy);
+
+         if (reset[i] && batched) {
+            if (nErrors < 10) std::printf("deadReckoningTest: batch: frame %u, NIB %u: batched results used after a reset\n", f, i);
+            nErrors++;
+         }
+         else if (skewed[i] && batched) {
+            if (nErrors < 10) std::printf("deadReckoningTest: batch: frame %u, NIB %u: batched results used for the wrong DR time\n", f, i);
+            nErrors++;
+         }
+         else if (!reset[i] && !skewed[i] && !batched) {
+            if (nErrors < 10) std::printf("deadReckoningTest: batch: frame %u, NIB %u: no batched results\n", f, i);
+            nErrors++;
+         }
+         else if (batched) {
+            if (bPos != rPos || bRpy != rRpy) {
+               if (nErrors < 10) {
+                  std::printf("deadReckoningTest: batch: frame %u, NIB %u (DR %d): batched (%.17g, %.17g, %.17g), own (%.17g, %.17g, %.17g)\n",
+                     f, i, nibs[i]->getDeadReckoning(), bPos[0], bPos[1], bPos[2], rPos[0], rPos[1], rPos[2]);
+               }
+               nErrors++;
+            }
+            nBatched[i % NUM_ALGS]++;
+
+            // (the results are used up)
+            if (nibs[i]->batchDr(t, &bPos, &bRpy)) {
+               if (nErrors < 10) std::printf("deadReckoningTest: batch: frame %u, NIB %u: batched results used twice\n", f, i);
+               nErrors++;
+            }
+         }
+      }
+   }
+
+   parent->event(Basic::Component::SHUTDOWN_EVENT);
+   pool->unref();
+   parent->unref();
+
+   for (unsigned int k = 0; k < NUM_ALGS; k++) {
+      if (nBatched[k] == 0) {
+         std::printf("deadReckoningTest: batch: DR algorithm %d was never batched\n", algorithms[k]);
+         nErrors++;
+      }
+   }
+   std::printf("deadReckoningTest: batch: %u NIBs, %u frames, %u resets\n", NUM_BATCH_NIBS, NUM_BATCH_FRAMES, nReset);
+
+   for (unsigned int i = 0; i < NUM_BATCH_NIBS; i++) nibs[i]->unref();
+   delete[] nibs;
+   delete[] reset;
+   delete[] skewed;
+}
+
+//------------------------------------------------------------------------------
+// 2) Simulation
+//------------------------------------------------------------------------------
+static void testSimulation()
+{
+   Basic::Rng rng(4302);
+
+   // T/C threads: as many as we can use (see Simulation::setSlotNumTcThreads())
+   const unsigned int np = Basic::Thread::getNumProcessors();
+   unsigned int nt = (np > 1 ? np - 1 : 1);
+   if (nt > MAX_TC_THREADS) nt = MAX_TC_THREADS;
+   const unsigned int numPlayers = Simulation::Simulation::MIN_DR_NIBS_PER_THREAD * nt + 100;
+
+   Simulation::Station* station = newStation(static_cast<int>(nt), static_cast<int>(1.0 / FRAME_DT + 0.5));
+   Simulation::Simulation* sim = station->getSimulation();
+   station->event(Basic::Component::RESET_EVENT);
+
+   // Networked players
+   Simulation::Player** players = new Simulation::Player*[numPlayers];
+   TestNib** nibs = new TestNib*[numPlayers];
+   const Basic::String federate("drtest");
+   for (unsigned int i = 0; i < numPlayers; i++) {
+      nibs[i] = new TestNib();
+      nibs[i]->setFederateName(&federate);
+      nibs[i]->setPlayerID(static_cast<unsigned short>(i + 1));
+      resetNib(rng, nibs[i], algorithms[i % NUM_ALGS], osg::Vec3d(6378137.0, 0, 0), 0);
+
+      players[i] = new Simulation::AirVehicle();
+      players[i]->setID(static_cast<unsigned short>(i + 1));
+      players[i]->setNib(nibs[i]);
+
+      char name[32];
+      std::sprintf(name, "ip%05u", (i + 1));
+      sim->addNewPlayer(name, players[i]);
+      if (((i + 1) % Simulation::Simulation::MAX_NEW_PLAYERS) == 0) sim->updateData(0);
+   }
+   sim->updateData(0);
+
+   unsigned int nChecked = 0;
+   for (unsigned int f = 0; f < NUM_SIM_FRAMES; f++) {
+
+      // Reset a few NIBs between frames
+      if (f > 0) {
+         for (unsigned int i = 0; i < numPlayers; i++) {
+            if (rng.drawHalfOpen() * 100.0 < RESET_PERCENT) {
+               resetNib(rng, nibs[i], algorithms[(i + f) % NUM_ALGS], nibs[i]->getDrPosition(), 0);
+            }
+         }
+      }
+
+      station->tcFrame(static_cast<LCreal>(FRAME_DT));
+
+      // Each player's position is its NIB's own DR
+      for (unsigned int i = 0; i < numPlayers; i++) {
+         if (!players[i]->isActive()) continue;
+         osg::Vec3d rPos, rRpy;
+         nibs[i]->ownDr(nibs[i]->getDrTime(), &rPos, &rRpy);
+         if (players[i]->getGeocPosition() != rPos) {
+            if (nErrors < 10) {
+               const osg::Vec3d& p = players[i]->getGeocPosition();
+               std::printf("deadReckoningTest: simulation: frame %u, player %u (DR %d): (%.17g, %.17g, %.17g), own DR (%.17g, %.17g, %.17g)\n",
+                  f, (i + 1), nibs[i]->getDeadReckoning(), p[0], p[1], p[2], rPos[0], rPos[1], rPos[2]);
+            }
+            nErrors++;
+         }
+         nChecked++;
+      }
+   }
+
+   if (nChecked == 0) {
+      std::printf("deadReckoningTest: simulation: no active players\n");
+      nErrors++;
+   }
+   std::printf("deadReckoningTest: simulation: %u players, %u T/C threads, %u frames\n", numPlayers, nt, NUM_SIM_FRAMES);
+
+   station->event(Basic::Component::SHUTDOWN_EVENT);
+   for (unsigned int i = 0; i < numPlayers; i++) {
+      players[i]->unref();
+      nibs[i]->unref();
+   }
+   delete[] players;
+   delete[] nibs;
+   station->unref();
+}
+
+static int run()
+{
+   // (the NIB's DR of the static and user defined algorithms prints a line)
+   std::streambuf* cout = std::cout.rdbuf(0);
+
+   testBatch();
+   testSimulation();
+
+   std::cout.rdbuf(cout);
+   std::cout.clear();
+
+   if (nErrors > 0) {
+      std::printf("deadReckoningTest: FAILED, %u errors\n", nErrors);
+      return 1;
+   }
+   std::printf("deadReckoningTest: passed\n");
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int, char**)
+{
+   return Eaagles::Test::run();
+}
@@ -0,0 +1,133 @@
+//------------------------------------------------------------------------------
+// Benchmark: guns and bullet bursts (Bullet, Simulation::processDetonations())
+//
+// Runs the Benchmark component with 50 air vehicles, placed within 200 m of each
+// other, each firing its gun (unlimited rounds) for 500 unpaced T/C frames.
+// The JSON results, including the per-phase and per-subsystem breakdowns, are
+// written to the standard output, followed by the number of players that were
+// hit (damaged or killed).  The bursts' hit checks are processed at the end of
+// the dynamics phase.
+//
+// Usage: gunBench [ numGuns [ numFrames ] ]
+//
+// Exits with a non-zero status if the benchmark can't be run or if no player
+// was hit.
+//------------------------------------------------------------------------------
+
+#include "benchScenario.h"
+
+#include "openeaagles/simulation/AirVehicle.h"
+#include "openeaagles/simulation/Guns.h"
+#include "openeaagles/simulation/StoresMgr.h"
+
+#include "openeaagles/basic/Float.h"
+#include "openeaagles/basic/Integer.h"
+#include "openeaagles/basic/Pair.h"
+#include "openeaagles/basic/PairStream.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace Eaagles {
+namespace Test {
+
+//------------------------------------------------------------------------------
+// Gun that starts firing when it's reset (i.e., once it's in the simulation)
+//------------------------------------------------------------------------------
+class FiringGun : public Simulation::Gun
+{
+   DECLARE_SUBCLASS(FiringGun,Simulation::Gun)
+public:
+   FiringGun()  { STANDARD_CONSTRUCTOR() }
+
+   virtual void reset() {
+      BaseClass::reset();
+      setGunArmed(true);
+      fireControl(true);
+   }
+};
+
+IMPLEMENT_SUBCLASS(FiringGun,"FiringGun")
+EMPTY_SLOTTABLE(FiringGun)
+EMPTY_SERIALIZER(FiringGun)
+EMPTY_COPYDATA(FiringGun)
+EMPTY_DELETEDATA(FiringGun)
+
+static int run(const int numGuns, const int numFrames)
+{
+   // Template player: an air vehicle with a firing gun
+   Simulation::AirVehicle* av = new Simulation::AirVehicle();
+   {
+      Simulation::Gun* gun = new FiringGun();
+      gun->setBulletType(new Simulation::Bullet());
+      gun->getBulletType()->unref();
+      gun->setUnlimited(true);
+
+      Basic::PairStream* stores = new Basic::PairStream();
+      add(stores, "1", gun);
+      Simulation::SimpleStoresMgr* sms = new Simulation::SimpleStoresMgr();
+      {
+         Basic::Integer ns(1);
+         sms->setSlotByName("numStations", &ns);
+      }
+      sms->setSlotByName("stores", stores);
+      sms->setGunSelected(true);
+      stores->unref();
+
+      Basic::PairStream* systems = new Basic::PairStream();
+      add(systems, "sms", sms);
+      av->setSlotComponent(systems);
+      systems->unref();
+   }
+   Basic::PairStream* templates = new Basic::PairStream();
+   add(templates, "shooter", av);
+
+   // Station, simulation and the benchmark
+   Simulation::Station* station = newStation();
+   Simulation::Simulation* sim = station->getSimulation();
+   Simulation::Benchmark* bm = newBenchmark(station, templates, numGuns, numFrames);
+   {
+      Basic::Float radius(200.0);
+      bm->setSlotByName("areaRadius", &radius);
+   }
+   station->unref();
+   templates->unref();
+
+   const bool ok = bm->run();
+
+   // Count the players that were hit
+   unsigned int nHit = 0;
+   Basic::PairStream* players = sim->getPlayers();
+   if (players != 0) {
+      for (const Basic::List::Item* item = players->getFirstItem(); item != 0; item = item->getNext()) {
+         const Basic::Pair* pair = static_cast<const Basic::Pair*>(item->getValue());
+         const Simulation::Player* p = static_cast<const Simulation::Player*>(pair->object());
+         if (p->isMajorType(Simulation::Player::AIR_VEHICLE) && (p->getDamage() > 0 || p->isKilled() || p->isDestroyed())) {
+            nHit++;
+         }
+      }
+      players->unref();
+   }
+   std::printf("gunBench: %d guns, %u players hit\n", numGuns, nHit);
+
+   bm->getStation()->event(Basic::Component::SHUTDOWN_EVENT);
+   bm->unref();
+
+   if (!ok || nHit == 0) {
+      std::printf("gunBench: FAILED\n");
+      return 1;
+   }
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int argc, char* argv[])
+{
+   int numGuns = 50;
+   int numFrames = 500;
+   if (argc > 1) numGuns = std::atoi(argv[1]);
+   if (argc > 2) numFrames = std::atoi(argv[2]);
+   return Eaagles::Test::run(numGuns, numFrames);
+}
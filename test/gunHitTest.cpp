@@ -0,0 +1,94 @@
+//------------------------------------------------------------------------------
+// Test: bullet burst hits (Bullet::detonationEffect())
+//
+// Fires five bursts past a player: three pass within the hit radius and two
+// don't.  Each of the three must be a separate hit on the player (i.e., a
+// separate call to the player's processDetonation()), and a second check of
+// the same frame must not hit the player again.
+//
+// Exits with a non-zero status on a failure.
+//------------------------------------------------------------------------------
+
+#include "openeaagles/simulation/AirVehicle.h"
+#include "openeaagles/simulation/Guns.h"
+#include "openeaagles/simulation/Simulation.h"
+
+#include <cstdio>
+
+namespace Eaagles {
+namespace Test {
+
+//------------------------------------------------------------------------------
+// Bullet with access to the burst trajectories
+//------------------------------------------------------------------------------
+class TestBullet : public Simulation::Bullet
+{
+public:
+   void update(const LCreal dt)  { updateBurstTrajectories(dt); }
+};
+
+//------------------------------------------------------------------------------
+// Player that counts its detonations
+//------------------------------------------------------------------------------
+class TestPlayer : public Simulation::AirVehicle
+{
+public:
+   TestPlayer() : count(0) {}
+   virtual void processDetonation(const LCreal, Simulation::Weapon* const)   { count++; }
+   unsigned int count;
+};
+
+static int run()
+{
+   unsigned int nErrors = 0;
+
+   Simulation::Simulation* sim = new Simulation::Simulation();
+   TestPlayer* tgt = new TestPlayer();
+   tgt->container(sim);
+   tgt->setPosition(500.0, 0.0, -1000.0);
+
+   // Five bursts fired north at 1000 m/s, past the player at 500 meters
+   TestBullet* bullet = new TestBullet();
+   const LCreal east[5] = { -3.0f, 0.0f, 3.0f, 40.0f, -60.0f };
+   for (int i = 0; i < 5; i++) {
+      const osg::Vec3 pos(0.0f, east[i], -1000.0f);
+      const osg::Vec3 vel(1000.0f, 0.0f, 0.0f);
+      bullet->burstOfBullets(&pos, &vel, 10, 6600, i + 1);
+   }
+
+   // One 0.75 second frame (the bursts pass through the player's hit sphere)
+   bullet->update(0.75f);
+
+   const bool hit = bullet->detonationEffect(tgt, tgt->getPosition(), 0, 0);
+   if (!hit || tgt->count != 3) {
+      std::printf("gunHitTest: %u hits, expected 3\n", tgt->count);
+      nErrors++;
+   }
+
+   // The bursts that hit aren't active any more
+   const unsigned int n = tgt->count;
+   bullet->detonationEffect(tgt, tgt->getPosition(), 0, 0);
+   if (tgt->count != n) {
+      std::printf("gunHitTest: %u hits after a second check, expected %u\n", tgt->count, n);
+      nErrors++;
+   }
+
+   bullet->unref();
+   tgt->unref();
+   sim->unref();
+
+   if (nErrors > 0) {
+      std::printf("gunHitTest: FAILED, %u errors\n", nErrors);
+      return 1;
+   }
+   std::printf("gunHitTest: passed\n");
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int, char**)
+{
+   return Eaagles::Test::run();
+}
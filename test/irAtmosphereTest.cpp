@@ -0,0 +1,350 @@
+//------------------------------------------------------------------------------
+// Test: IrAtmosphere1 cached band data and lookup cache
+//
+// IrAtmosphere1::calculateAtmosphereContribution() precomputes the band data
+// and the seeker overlap ratios, and can cache its table lookups by quantized
+// seeker altitude, target altitude and ground range.  This test compares its
+// results with the original, per-band calculation (reference() below, which
+// uses the same table lookup functions) for random seekers and targets:
+//
+//    1) Without the lookup cache, the results match the reference within
+//       the rounding of the summation (relative tolerance 1e-5).
+//
+//    2) With the lookup cache, the results match the reference computed at
+//       the quantized altitudes and range (relative tolerance 1e-5), both on
+//       cache misses and cache hits, and they match the reference computed at
+//       the actual altitudes and range within the tables' variation over one
+//       resolution step (relative tolerance 1e-2).
+//
+// The atmosphere tables are generated as smooth functions of their inputs and
+// loaded using the parser.  Exits with a non-zero status on a mismatch.
+//------------------------------------------------------------------------------
+
+#include "openeaagles/simulation/AirVehicle.h"
+#include "openeaagles/simulation/Factory.h"
+#include "openeaagles/simulation/IrAtmosphere1.h"
+#include "openeaagles/simulation/IrQueryMsg.h"
+#include "openeaagles/simulation/Simulation.h"
+
+#include "openeaagles/basic/Factory.h"
+#include "openeaagles/basic/Parser.h"
+#include "openeaagles/basic/Rng.h"
+#include "openeaagles/basic/support.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace Eaagles {
+namespace Test {
+
+static const char* const EDL_FILE = "irAtmosphereTest.tmp.edl";
+static const unsigned int NUM_QUERIES = 2000;
+static const LCreal ALT_RES = 10.0f;         // Lookup cache altitude resolution (meters)
+static const LCreal RNG_RES = 50.0f;         // Lookup cache range resolution (meters)
+
+// Wave bands (microns): centers and widths
+static const unsigned int NB = 6;
+static const double bandCenters[NB] = { 3.20, 3.60, 4.00, 4.40, 4.80, 5.20 };
+static const double bandWidths[NB]  = { 0.40, 0.40, 0.40, 0.40, 0.40, 0.40 };
+
+// Table breakpoints
+static const unsigned int NALT = 5;
+static const double alts[NALT] = { 0.0, 2000.0, 5000.0, 10000.0, 15000.0 };
+static const unsigned int NANG = 4;
+static const double angles[NANG] = { 0.0, 1.0, 2.0, 3.2 };
+static const unsigned int NRNG = 5;
+static const double rngs[NRNG] = { 0.0, 5000.0, 10000.0, 20000.0, 40000.0 };
+
+//------------------------------------------------------------------------------
+// Atmosphere with the original per-band calculation
+//------------------------------------------------------------------------------
+class TestAtmosphere : public Simulation::IrAtmosphere1
+{
+public:
+   void reference(Simulation::IrQueryMsg* const msg, const LCreal seekerAlt, const LCreal targetAlt, const LCreal range2D,
+                  LCreal* const totalSignal, LCreal* const totalBackground) const
+   {
+      const LCreal* centerWavelengths = getWaveBandCenters();
+      const LCreal* widths = getWaveBandWidths();
+      const LCreal* sigArray = msg->getSignatureByWaveband();
+      const unsigned int n = getNumWaveBands();
+
+      LCreal tanPhi = static_cast<LCreal>( (targetAlt - seekerAlt) / range2D );
+      LCreal tanPhiPrime = tanPhi - ( range2D / 12756776.0f );
+      LCreal viewingAngle = lcAtan(tanPhiPrime);
+      viewingAngle += PI/2.0;
+
+      *totalSignal = 0.0;
+      *totalBackground = 0.0;
+      for (unsigned int i = 0; i < n; i++) {
+         LCreal radiantIntensityInBin;
+         LCreal lowerBandBound = centerWavelengths[i] - (widths[i] / 2.0f);
+         LCreal upperBandBound = lowerBandBound + widths[i];
+         LCreal fractionOfBandToTotal = (upperBandBound - lowerBandBound) / ((centerWavelengths[n - 1] + (widths[n - 1] / 2.0f))-(centerWavelengths[0] - (widths[0] / 2.0f)));
+
+         LCreal lowerOverlap = getLowerEndOfWavelengthOverlap(lowerBandBound, msg->getLowerWavelength());
+         LCreal upperOverlap = getUpperEndOfWavelengthOverlap(upperBandBound, msg->getUpperWavelength());
+         if (upperOverlap < lowerOverlap) upperOverlap = lowerOverlap;
+         LCreal overlapRatio = (upperOverlap - lowerOverlap) / (upperBandBound - lowerBandBound);
+
+         LCreal backgroundRadianceInBand = overlapRatio * getBackgroundRadiation(lowerBandBound, upperBandBound, seekerAlt, viewingAngle);
+         if (sigArray == 0) {
+            radiantIntensityInBin = msg->getSignatureAtRange() * fractionOfBandToTotal * overlapRatio;
+         }
+         else {
+            radiantIntensityInBin = sigArray[i*3 + 2];
+         }
+
+         LCreal solarRadiationInBin = ((1.0f - msg->getEmissivity()) * getSolarRadiation(centerWavelengths[i], targetAlt));
+         radiantIntensityInBin += (solarRadiationInBin * overlapRatio);
+
+         LCreal transmissivity = getTransmissivity(lowerBandBound, upperBandBound, seekerAlt, targetAlt, range2D);
+
+         *totalSignal += radiantIntensityInBin * transmissivity;
+         *totalBackground += backgroundRadianceInBand * transmissivity;
+      }
+   }
+};
+
+//------------------------------------------------------------------------------
+// Writes the atmosphere's input file
+//------------------------------------------------------------------------------
+static void writeList(std::ofstream& fout, const double v[], const unsigned int n)
+{
+   fout << "[";
+   for (unsigned int i = 0; i < n; i++) fout << " " << v[i];
+   fout << " ]";
+}
+
+static bool writeInputFile()
+{
+   std::ofstream fout(EDL_FILE);
+   if (!fout.is_open()) return false;
+
+   fout << "( IrAtmosphere1" << std::endl;
+
+   fout << "  waveBands: ( Table1 x: ";
+   writeList(fout, bandCenters, NB);
+   fout << " data: ";
+   writeList(fout, bandWidths, NB);
+   fout << " )" << std::endl;
+
+   // Solar radiation: [ alt ][ band ]
+   fout << "  solarRadiationTable: ( Table2 x: ";
+   writeList(fout, bandCenters, NB);
+   fout << " y: ";
+   writeList(fout, alts, NALT);
+   fout << " data: {" << std::endl;
+   for (unsigned int j = 0; j < NALT; j++) {
+      fout << "    [";
+      for (unsigned int i = 0; i < NB; i++) fout << " " << (20.0 + 5.0 * i) * (1.0 + alts[j] / 20000.0);
+      fout << " ]" << std::endl;
+   }
+   fout << "  } )" << std::endl;
+
+   // Background radiation: [ angle ][ alt ][ band ]
+   fout << "  backgroundRadiationTable: ( Table3 x: ";
+   writeList(fout, bandCenters, NB);
+   fout << " y: ";
+   writeList(fout, alts, NALT);
+   fout << " z: ";
+   writeList(fout, angles, NANG);
+   fout << " data: {" << std::endl;
+   for (unsigned int k = 0; k < NANG; k++) {
+      fout << "   {" << std::endl;
+      for (unsigned int j = 0; j < NALT; j++) {
+         fout << "    [";
+         for (unsigned int i = 0; i < NB; i++) fout << " " << (2.0 + 0.3 * i) * (1.0 + angles[k]) * (1.0 - alts[j] / 40000.0);
+         fout << " ]" << std::endl;
+      }
+      fout << "   }" << std::endl;
+   }
+   fout << "  } )" << std::endl;
+
+   // Transmissivity: [ range ][ target alt ][ seeker alt ][ band ]
+   fout << "  transmissivityTable: ( Table4 x: ";
+   writeList(fout, bandCenters, NB);
+   fout << " y: ";
+   writeList(fout, alts, NALT);
+   fout << " z: ";
+   writeList(fout, alts, NALT);
+   fout << " w: ";
+   writeList(fout, rngs, NRNG);
+   fout << " data: {" << std::endl;
+   for (unsigned int m = 0; m < NRNG; m++) {
+      fout << "  {" << std::endl;
+      for (unsigned int k = 0; k < NALT; k++) {
+         fout << "   {" << std::endl;
+         for (unsigned int j = 0; j < NALT; j++) {
+            fout << "    [";
+            for (unsigned int i = 0; i < NB; i++) {
+               const double absorb = (0.02 + 0.01 * i) * (1.0 - (alts[j] + alts[k]) / 40000.0);
+               fout << " " << std::exp(-absorb * rngs[m] * 0.001);
+            }
+            fout << " ]" << std::endl;
+         }
+         fout << "   }" << std::endl;
+      }
+      fout << "  }" << std::endl;
+   }
+   fout << "  } )" << std::endl;
+
+   fout << ")" << std::endl;
+   return fout.good();
+}
+
+// Form function for the parser; our IrAtmosphere1 is a TestAtmosphere
+static Basic::Object* factory(const char* name)
+{
+   Basic::Object* obj = 0;
+   if (std::strcmp(name, "IrAtmosphere1") == 0) obj = new TestAtmosphere();
+   if (obj == 0) obj = Simulation::Factory::createObj(name);
+   if (obj == 0) obj = Basic::Factory::createObj(name);
+   return obj;
+}
+
+// Loads an atmosphere from the input file
+static TestAtmosphere* load()
+{
+   int errs = 0;
+   Basic::Object* obj = Basic::lcParser(EDL_FILE, factory, &errs);
+   TestAtmosphere* atmos = dynamic_cast<TestAtmosphere*>(obj);
+   if (atmos == 0 || errs != 0) {
+      std::printf("irAtmosphereTest: unable to load the atmosphere (%d errors)\n", errs);
+      if (obj != 0) obj->unref();
+      atmos = 0;
+   }
+   return atmos;
+}
+
+//------------------------------------------------------------------------------
+// Compares 'v' with the reference 'ref'
+//------------------------------------------------------------------------------
+static unsigned int nErrors = 0;
+
+static void check(const char* const what, const unsigned int q, const LCreal v, const LCreal ref, const double tol)
+{
+   const double err = std::fabs(v - ref);
+   if (err > tol * std::fabs(ref) && err > 1.0e-9) {
+      if (nErrors < 20) std::printf("irAtmosphereTest: query %u: %s: %g, reference %g\n", q, what, v, ref);
+      nErrors++;
+   }
+}
+
+static int run()
+{
+   if (!writeInputFile()) {
+      std::printf("irAtmosphereTest: FAILED, unable to write %s\n", EDL_FILE);
+      return 1;
+   }
+
+   // Uncached and cached atmospheres
+   TestAtmosphere* ref = load();
+   TestAtmosphere* cached = load();
+   std::remove(EDL_FILE);
+   if (ref == 0 || cached == 0 || ref->getNumWaveBands() != NB) {
+      std::printf("irAtmosphereTest: FAILED, invalid atmosphere\n");
+      return 1;
+   }
+   cached->setAltitudeResolution(ALT_RES);
+   cached->setRangeResolution(RNG_RES);
+
+   // Seeker and target, which need a simulation to set their positions
+   Simulation::Simulation* sim = new Simulation::Simulation();
+   Simulation::AirVehicle* seeker = new Simulation::AirVehicle();
+   Simulation::AirVehicle* target = new Simulation::AirVehicle();
+   seeker->container(sim);
+   target->container(sim);
+
+   Simulation::IrQueryMsg* msg = new Simulation::IrQueryMsg();
+   msg->setOwnship(seeker);
+   msg->setTarget(target);
+
+   LCreal sigArray[NB * 3];
+
+   Basic::Rng rng(20130);
+   for (unsigned int q = 0; q < NUM_QUERIES; q++) {
+
+      // A handful of seeker wavebands, a few partly outside the atmosphere's bands
+      const unsigned int sb = q % 5;
+      const LCreal lower = 2.8f + 0.35f * sb;
+      msg->setLowerWavelength(lower);
+      msg->setUpperWavelength(lower + 1.2f + 0.2f * sb);
+
+      // Positions
+      const LCreal seekerAlt = static_cast<LCreal>(100.0 + rng.drawHalfOpen() * 14000.0);
+      const LCreal targetAlt = static_cast<LCreal>(100.0 + rng.drawHalfOpen() * 14000.0);
+      const LCreal range = static_cast<LCreal>(1000.0 + rng.drawHalfOpen() * 35000.0);
+      seeker->setPositionLLA(0.0, 0.0, seekerAlt);
+      target->setPositionLLA(0.0, 0.0, targetAlt);
+      msg->setRange(range);
+
+      // Simple or by-waveband signatures
+      msg->setEmissivity(static_cast<LCreal>(0.5 + 0.5 * rng.drawHalfOpen()));
+      msg->setSignatureAtRange(static_cast<LCreal>(100.0 + 900.0 * rng.drawHalfOpen()));
+      if (q % 2 == 0) {
+         msg->setSignatureByWaveband(0);
+      }
+      else {
+         for (unsigned int i = 0; i < NB; i++) {
+            sigArray[i*3 + 0] = static_cast<LCreal>(bandCenters[i] - bandWidths[i] / 2.0);
+            sigArray[i*3 + 1] = static_cast<LCreal>(bandCenters[i] + bandWidths[i] / 2.0);
+            sigArray[i*3 + 2] = static_cast<LCreal>(10.0 + 90.0 * rng.drawHalfOpen());
+         }
+         msg->setSignatureByWaveband(sigArray);
+      }
+
+      // Reference at the actual and the quantized altitudes and range
+      const LCreal sAlt = static_cast<LCreal>( std::floor(seeker->getAltitudeM() / ALT_RES + 0.5) * ALT_RES );
+      const LCreal tAlt = static_cast<LCreal>( std::floor(target->getAltitudeM() / ALT_RES + 0.5) * ALT_RES );
+      const LCreal qRng = static_cast<LCreal>( std::floor(msg->getRange() / RNG_RES + 0.5) * RNG_RES );
+      LCreal refSig = 0, refBg = 0, refSigQ = 0, refBgQ = 0;
+      ref->reference(msg, static_cast<LCreal>(seeker->getAltitudeM()), static_cast<LCreal>(target->getAltitudeM()), msg->getRange(), &refSig, &refBg);
+      ref->reference(msg, sAlt, tAlt, qRng, &refSigQ, &refBgQ);
+
+      // The reference must see the tables
+      if (!(refSig > 0 && refBg > 0)) {
+         if (nErrors < 20) std::printf("irAtmosphereTest: query %u: no signal (%g) or background (%g)\n", q, refSig, refBg);
+         nErrors++;
+      }
+
+      // 1) No cache
+      LCreal sig = 0, bg = 0;
+      ref->calculateAtmosphereContribution(msg, &sig, &bg);
+      check("uncached signal", q, sig, refSig, 1.0e-5);
+      check("uncached background", q, bg, refBg, 1.0e-5);
+
+      // 2) Cached: miss (or an earlier entry), then a hit
+      for (unsigned int k = 0; k < 2; k++) {
+         cached->calculateAtmosphereContribution(msg, &sig, &bg);
+         check("cached signal (quantized)", q, sig, refSigQ, 1.0e-5);
+         check("cached background (quantized)", q, bg, refBgQ, 1.0e-5);
+         check("cached signal", q, sig, refSig, 1.0e-2);
+         check("cached background", q, bg, refBg, 1.0e-2);
+      }
+   }
+
+   msg->unref();
+   seeker->unref();
+   target->unref();
+   sim->unref();
+   ref->unref();
+   cached->unref();
+
+   if (nErrors > 0) {
+      std::printf("irAtmosphereTest: FAILED, %u errors\n", nErrors);
+      return 1;
+   }
+   std::printf("irAtmosphereTest: passed (%u queries, %u bands)\n", NUM_QUERIES, NB);
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int, char**)
+{
+   return Eaagles::Test::run();
+}
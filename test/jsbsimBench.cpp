@@ -0,0 +1,123 @@
+//------------------------------------------------------------------------------
+// Benchmark: JSBSim dynamics model load time and per-step cost
+//
+// Times, for a JSBSim model:
+//    1) reset() with an empty model cache (the model is loaded),
+//    2) reset() with a ready instance in the model cache ('preload' slot),
+//    3) the dynamics() step of a loaded model.
+//
+// Usage: jsbsimBench rootDir model [ numSteps ]
+//    (the root directory ends with a '/'; e.g., /usr/local/JSBSim/ f16)
+//
+// Needs the JSBSim library; build and run with 'make bench-jsbsim'.
+// Exits with a non-zero status if the model can't be loaded.
+//------------------------------------------------------------------------------
+
+#include "openeaagles/dynamics/JSBSimModel.h"
+
+#include "openeaagles/simulation/AirVehicle.h"
+
+#include "openeaagles/basic/Number.h"
+#include "openeaagles/basic/Pair.h"
+#include "openeaagles/basic/PairStream.h"
+#include "openeaagles/basic/String.h"
+#include "openeaagles/basic/support.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace Eaagles {
+namespace Test {
+
+static const LCreal DT = 1.0f / 50.0f;    // Step time (sec)
+
+// Creates an air vehicle with a JSBSim model
+static Simulation::AirVehicle* createPlayer(const char* const root, const char* const mdl, const unsigned int preload)
+{
+   Dynamics::JSBSimModel* dyn = new Dynamics::JSBSimModel();
+   {
+      Basic::String r(root);
+      Basic::String m(mdl);
+      dyn->setRootDir(&r);
+      dyn->setModel(&m);
+      dyn->setPreload(preload);
+   }
+
+   Simulation::AirVehicle* av = new Simulation::AirVehicle();
+   av->setInitLat(37.0);
+   av->setInitLon(-116.0);
+   av->setInitAltitude(3000.0);
+
+   Basic::PairStream* systems = new Basic::PairStream();
+   Basic::Pair* pair = new Basic::Pair("dynamics", dyn);
+   systems->put(pair);
+   pair->unref();
+   dyn->unref();
+   av->setSlotComponent(systems);
+   systems->unref();
+   return av;
+}
+
+static Dynamics::JSBSimModel* dynamicsOf(Simulation::AirVehicle* const av)
+{
+   return static_cast<Dynamics::JSBSimModel*>(av->getDynamicsModel());
+}
+
+static int run(const char* const root, const char* const mdl, const unsigned int numSteps)
+{
+   Dynamics::JSBSimModel::clearModelCache();
+
+   // 1) Reset with an empty cache: the model is loaded by reset()
+   Simulation::AirVehicle* av1 = createPlayer(root, mdl, 1);
+   double t0 = getComputerTime();
+   dynamicsOf(av1)->reset();
+   const double loadTime = getComputerTime() - t0;
+   if (dynamicsOf(av1)->getNumberOfEngines() <= 0 && dynamicsOf(av1)->getGrossWeight() <= 0) {
+      std::printf("jsbsimBench: unable to load model %s%s\n", root, mdl);
+      av1->unref();
+      return 1;
+   }
+
+   // 2) Reset with a ready instance (the 'preload' loader of the first player fills the cache)
+   double t1 = getComputerTime();
+   while (Dynamics::JSBSimModel::getNumCachedModels(root, mdl) < 1 && (getComputerTime() - t1) < 60.0) {
+      lcSleep(10);
+   }
+   Simulation::AirVehicle* av2 = createPlayer(root, mdl, 0);
+   t0 = getComputerTime();
+   dynamicsOf(av2)->reset();
+   const double attachTime = getComputerTime() - t0;
+
+   // 3) Per step
+   t0 = getComputerTime();
+   for (unsigned int i = 0; i < numSteps; i++) {
+      dynamicsOf(av1)->dynamics(DT);
+   }
+   const double stepTime = getComputerTime() - t0;
+
+   std::printf("jsbsimBench: model %s%s\n", root, mdl);
+   std::printf("   reset(), load:          %10.3f msec\n", loadTime * 1.0e3);
+   std::printf("   reset(), cached:        %10.3f msec\n", attachTime * 1.0e3);
+   std::printf("   dynamics():             %10.3f usec/step (%u steps)\n", (stepTime * 1.0e6) / numSteps, numSteps);
+
+   // Shutdown stops the loaders and frees the cache
+   av1->event(Basic::Component::SHUTDOWN_EVENT);
+   av2->event(Basic::Component::SHUTDOWN_EVENT);
+   av1->unref();
+   av2->unref();
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int argc, char* argv[])
+{
+   if (argc < 3) {
+      std::printf("usage: jsbsimBench rootDir model [ numSteps ]\n");
+      return 1;
+   }
+   unsigned int numSteps = 10000;
+   if (argc > 3) numSteps = static_cast<unsigned int>(std::atoi(argv[3]));
+   return Eaagles::Test::run(argv[1], argv[2], numSteps);
+}
@@ -0,0 +1,170 @@
+//------------------------------------------------------------------------------
+// Benchmark: List and PairStream build and lookup (Basic::List, Basic::PairStream)
+//
+// Builds a 10000 entry PairStream (with some duplicate names), then times
+// 10000 findByName() and 10000 getPosition() calls, which use the lists'
+// indexes, against walks of the list items (how the lookups used to be done),
+// and checks that they find the same pairs.  Also times the lookups when the
+// list is changed between every lookup, so no index is used, and building and
+// freeing the list.
+//
+// Usage: listBench [ numEntries [ numLookups ] ]
+//
+// Exits with a non-zero status if a lookup doesn't find the same pair as the
+// walk.
+//------------------------------------------------------------------------------
+
+#include "openeaagles/basic/Identifier.h"
+#include "openeaagles/basic/Integer.h"
+#include "openeaagles/basic/Pair.h"
+#include "openeaagles/basic/PairStream.h"
+#include "openeaagles/basic/Rng.h"
+#include "openeaagles/basic/support.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace Eaagles {
+namespace Test {
+
+static unsigned int nErrors = 0;
+
+// Name of entry 'i'; every 100th name is a duplicate of the one before it
+static void makeName(char* const name, const unsigned int i)
+{
+   const unsigned int k = (i % 100 == 99 ? i - 1 : i);
+   std::sprintf(name, "pair%05u", k);
+}
+
+// Builds a stream of 'n' pairs
+static Basic::PairStream* build(const unsigned int n)
+{
+   Basic::PairStream* list = new Basic::PairStream();
+   for (unsigned int i = 0; i < n; i++) {
+      char name[32];
+      makeName(name, i);
+      Basic::Integer* num = new Basic::Integer(static_cast<int>(i));
+      Basic::Pair* pair = new Basic::Pair(name, num);
+      list->put(pair);
+      pair->unref();
+      num->unref();
+   }
+   return list;
+}
+
+// Walks the list for the first pair named 'name'
+static const Basic::Pair* walkByName(const Basic::PairStream* const list, const char* const name)
+{
+   for (const Basic::List::Item* item = list->getFirstItem(); item != 0; item = item->getNext()) {
+      const Basic::Pair* pair = static_cast<const Basic::Pair*>(item->getValue());
+      if (*pair->slot() == name) return pair;
+   }
+   return 0;
+}
+
+// Walks the list for its n'th pair (starting at one)
+static const Basic::Pair* walkByPosition(const Basic::PairStream* const list, const unsigned int n)
+{
+   unsigned int i = 1;
+   for (const Basic::List::Item* item = list->getFirstItem(); item != 0; item = item->getNext(), i++) {
+      if (i == n) return static_cast<const Basic::Pair*>(item->getValue());
+   }
+   return 0;
+}
+
+static int run(const unsigned int numEntries, const unsigned int numLookups)
+{
+   // Build and free
+   double t0 = getComputerTime();
+   Basic::PairStream* list = build(numEntries);
+   const double buildTime = getComputerTime() - t0;
+   t0 = getComputerTime();
+   list->unref();
+   const double freeTime = getComputerTime() - t0;
+
+   list = build(numEntries);
+   const Basic::PairStream* clist = list;
+
+   // The lookups (including a few names that aren't in the list)
+   Basic::Rng rng(4357);
+   char (*names)[32] = new char[numLookups][32];
+   unsigned int* positions = new unsigned int[numLookups];
+   for (unsigned int i = 0; i < numLookups; i++) {
+      const unsigned int k = static_cast<unsigned int>(rng.drawHalfOpen() * (numEntries + numEntries / 100));
+      makeName(names[i], k);
+      positions[i] = 1 + static_cast<unsigned int>(rng.drawHalfOpen() * numEntries);
+   }
+   const Basic::Pair** found = new const Basic::Pair*[numLookups];
+
+   // findByName()
+   t0 = getComputerTime();
+   for (unsigned int i = 0; i < numLookups; i++) found[i] = clist->findByName(names[i]);
+   const double findTime = getComputerTime() - t0;
+
+   t0 = getComputerTime();
+   for (unsigned int i = 0; i < numLookups; i++) {
+      if (walkByName(clist, names[i]) != found[i]) nErrors++;
+   }
+   const double walkFindTime = getComputerTime() - t0;
+
+   // getPosition()
+   t0 = getComputerTime();
+   for (unsigned int i = 0; i < numLookups; i++) found[i] = clist->getPosition(positions[i]);
+   const double posTime = getComputerTime() - t0;
+
+   t0 = getComputerTime();
+   for (unsigned int i = 0; i < numLookups; i++) {
+      if (walkByPosition(clist, positions[i]) != found[i]) nErrors++;
+   }
+   const double walkPosTime = getComputerTime() - t0;
+
+   // Lookups with a change (an add and a remove at the end of the list)
+   // before each one; the indexes aren't rebuilt.
+   Basic::Integer* num = new Basic::Integer(0);
+   Basic::Pair* extra = new Basic::Pair("extra", num);
+   num->unref();
+   const unsigned int nChanged = (numLookups < 1000 ? numLookups : 1000);
+   t0 = getComputerTime();
+   for (unsigned int i = 0; i < nChanged; i++) {
+      list->put(extra);
+      list->remove(extra);
+      found[i] = clist->findByName(names[i]);
+   }
+   const double changedTime = getComputerTime() - t0;
+   for (unsigned int i = 0; i < nChanged; i++) {
+      if (walkByName(clist, names[i]) != found[i]) nErrors++;
+   }
+   extra->unref();
+
+   std::printf("listBench: %u entries, %u lookups\n", numEntries, numLookups);
+   std::printf("   build:                    %10.3f usec/entry\n", (buildTime * 1.0e6) / numEntries);
+   std::printf("   free:                     %10.3f usec/entry\n", (freeTime * 1.0e6) / numEntries);
+   std::printf("   findByName():             %10.3f usec/lookup\n", (findTime * 1.0e6) / numLookups);
+   std::printf("   findByName() walk:        %10.3f usec/lookup\n", (walkFindTime * 1.0e6) / numLookups);
+   std::printf("   getPosition():            %10.3f usec/lookup\n", (posTime * 1.0e6) / numLookups);
+   std::printf("   getPosition() walk:       %10.3f usec/lookup\n", (walkPosTime * 1.0e6) / numLookups);
+   std::printf("   put, remove, findByName(): %9.3f usec/lookup\n", (changedTime * 1.0e6) / nChanged);
+
+   delete[] names;
+   delete[] positions;
+   delete[] found;
+   list->unref();
+
+   if (nErrors > 0) {
+      std::printf("listBench: FAILED, %u errors\n", nErrors);
+      return 1;
+   }
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int argc, char* argv[])
+{
+   unsigned int numEntries = 10000;
+   unsigned int numLookups = 10000;
+   if (argc > 1) numEntries = static_cast<unsigned int>(std::atoi(argv[1]));
+   if (argc > 2) numLookups = static_cast<unsigned int>(std::atoi(argv[2]));
+   return Eaagles::Test::run(numEntries, numLookups);
+}
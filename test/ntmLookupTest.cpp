@@ -0,0 +1,263 @@
+//------------------------------------------------------------------------------
+// Test: DIS network type mapper (NTM) quick lookup tables
+//
+// The incoming and outgoing NTMs are found using hash tables instead of the
+// quick lookup trees (see Dis::NetIO note #7 and Simulation::NetIO).  This
+// test loads random sets of incoming and outgoing NTMs, with wild card codes,
+// duplicate types and substring type strings, and checks that the tables
+// find the same NTM as the trees:
+//    -- incoming: random entity type codes, and each loaded NTM in order
+//       (using the NetIO's testInputEntityTypes() rig);
+//    -- outgoing: random players of several classes and type strings, each
+//       looked up twice (the second lookup is from the table), and each
+//       loaded NTM's template player (testOutputEntityTypes() rig);
+//    -- a clone of the NetIO, and the outgoing table after an NTM is added.
+//
+// Exits with a non-zero status if a table and its tree differ.
+//------------------------------------------------------------------------------
+
+#include "openeaagles/dis/NetIO.h"
+#include "openeaagles/dis/Nib.h"
+#include "openeaagles/dis/Ntm.h"
+
+#include "openeaagles/simulation/AirVehicle.h"
+#include "openeaagles/simulation/GroundVehicle.h"
+#include "openeaagles/simulation/Ships.h"
+
+#include "openeaagles/basic/Rng.h"
+#include "openeaagles/basic/String.h"
+
+#include <cstdio>
+#include <iostream>
+
+namespace Eaagles {
+namespace Test {
+
+static const unsigned int NUM_INPUT_NTMS = 400;     // Incoming NTMs loaded
+static const unsigned int NUM_OUTPUT_NTMS = 60;     // Outgoing NTMs loaded
+static const unsigned int NUM_LOOKUPS = 100000;     // Random lookups per case
+
+static unsigned int nErrors = 0;
+
+//------------------------------------------------------------------------------
+// NetIO with access to the NTM lists, trees and test rigs
+//------------------------------------------------------------------------------
+class TestNetIO : public Network::Dis::NetIO
+{
+   DECLARE_SUBCLASS(TestNetIO, Network::Dis::NetIO)
+public:
+   TestNetIO();
+
+   void addInput(Simulation::Ntm* const ntm)     { addInputEntityType(ntm); }
+   void addOutput(Simulation::Ntm* const ntm)    { addOutputEntityType(ntm); }
+
+   unsigned int numInput() const                 { return getNumInputEntityTypes(); }
+   unsigned int numOutput() const                { return getNumOutputEntityTypes(); }
+
+   unsigned int testInput(const unsigned int n)  { return testInputEntityTypes(n); }
+   unsigned int testOutput(const unsigned int n) { return testOutputEntityTypes(n); }
+
+   // The quick lookup trees' NTMs
+   const Simulation::Ntm* inputTree(const Simulation::Nib* const nib) const {
+      const NtmInputNode* root = getRootNtmInputNode();
+      return (root != 0 ? root->findNetworkTypeMapper(nib) : 0);
+   }
+   const Simulation::Ntm* outputTree(const Simulation::Player* const p) const {
+      const NtmOutputNode* root = getRootNtmOutputNode();
+      return (root != 0 ? root->findNetworkTypeMapper(p) : 0);
+   }
+};
+
+IMPLEMENT_SUBCLASS(TestNetIO, "TestNetIO")
+EMPTY_SLOTTABLE(TestNetIO)
+EMPTY_CONSTRUCTOR(TestNetIO)
+EMPTY_COPYDATA(TestNetIO)
+EMPTY_DELETEDATA(TestNetIO)
+EMPTY_SERIALIZER(TestNetIO)
+
+// Random integer [ 0 .. n-1 ]
+static unsigned int draw(Basic::Rng& rng, const unsigned int n)
+{
+   return static_cast<unsigned int>(rng.drawHalfOpen() * n);
+}
+
+// Random entity type codes from a small set of values, so that there are
+// duplicates and wild card (zero) codes
+static void drawCodes(Basic::Rng& rng, unsigned char c[7])
+{
+   c[0] = static_cast<unsigned char>(1 + draw(rng, 2));     // kind
+   c[1] = static_cast<unsigned char>(1 + draw(rng, 3));     // domain
+   c[2] = static_cast<unsigned char>(draw(rng, 2) == 0 ? 222 : 225);   // country
+   c[3] = static_cast<unsigned char>(draw(rng, 4));         // category
+   c[4] = static_cast<unsigned char>(draw(rng, 4));         // subcategory
+   c[5] = static_cast<unsigned char>(draw(rng, 3));         // specific
+   c[6] = static_cast<unsigned char>(draw(rng, 3));         // extra
+}
+
+// Random player: one of several classes, with a type string from a set of
+// strings that are substrings of each other (or no type string)
+static Simulation::Player* newPlayer(Basic::Rng& rng)
+{
+   static const char* const types[8] = { "F-16", "F-16C", "F-16C1", "F-15", "T-72", "T-72B", "CVN", 0 };
+   Simulation::Player* p = 0;
+   switch (draw(rng, 6)) {
+      case 0 : p = new Simulation::AirVehicle(); break;
+      case 1 : p = new Simulation::Aircraft(); break;
+      case 2 : p = new Simulation::Helicopter(); break;
+      case 3 : p = new Simulation::GroundVehicle(); break;
+      case 4 : p = new Simulation::Tank(); break;
+      default : p = new Simulation::Ship(); break;
+   }
+   const char* const type = types[draw(rng, 8)];
+   if (type != 0) {
+      Basic::String* s = new Basic::String(type);
+      p->setType(s);
+      s->unref();
+   }
+   return p;
+}
+
+// Compares the incoming table and tree for random entity types
+static void checkInput(const char* const what, TestNetIO* const netIO, Basic::Rng& rng)
+{
+   Network::Dis::Nib* nib = new Network::Dis::Nib(Simulation::NetIO::INPUT_NIB);
+   unsigned int nFound = 0;
+   unsigned int nDiffs = 0;
+   for (unsigned int i = 0; i < NUM_LOOKUPS; i++) {
+      unsigned char c[7];
+      drawCodes(rng, c);
+      nib->setEntityType(c[0], c[1], c[2], c[3], c[4], c[5], c[6]);
+      const Simulation::Ntm* table = netIO->findNtmByTypeCodes(c[0], c[1], c[2], c[3], c[4], c[5], c[6]);
+      const Simulation::Ntm* tree = netIO->inputTree(nib);
+      if (table != tree || netIO->findNetworkTypeMapper(nib) != tree) {
+         if (nDiffs++ < 10) {
+            std::printf("ntmLookupTest: %s: type ( %d %d %d %d %d %d %d ): table %p, tree %p\n", what,
+               c[0], c[1], c[2], c[3], c[4], c[5], c[6], static_cast<const void*>(table), static_cast<const void*>(tree));
+         }
+      }
+      if (tree != 0) nFound++;
+   }
+   nib->unref();
+   if (nFound == 0) {
+      std::printf("ntmLookupTest: %s: no incoming entity types were found\n", what);
+      nErrors++;
+   }
+   nErrors += nDiffs;
+
+   // Each NTM, in order
+   nErrors += netIO->testInput(netIO->numInput());
+}
+
+// Compares the outgoing table and tree for random players
+static void checkOutput(const char* const what, TestNetIO* const netIO, Basic::Rng& rng)
+{
+   unsigned int nFound = 0;
+   unsigned int nDiffs = 0;
+   for (unsigned int i = 0; i < NUM_LOOKUPS / 10; i++) {
+      Simulation::Player* p = newPlayer(rng);
+      const Simulation::Ntm* tree = netIO->outputTree(p);
+      const Simulation::Ntm* table1 = netIO->findNetworkTypeMapper(p);
+      const Simulation::Ntm* table2 = netIO->findNetworkTypeMapper(p);
+      if (table1 != tree || table2 != tree) {
+         if (nDiffs++ < 10) {
+            const Basic::String* type = p->getType();
+            std::printf("ntmLookupTest: %s: player %s \"%s\": table %p %p, tree %p\n", what,
+               p->getFactoryName(), (type != 0 ? type->getString() : ""),
+               static_cast<const void*>(table1), static_cast<const void*>(table2), static_cast<const void*>(tree));
+         }
+      }
+      if (tree != 0) nFound++;
+      p->unref();
+   }
+   if (nFound == 0) {
+      std::printf("ntmLookupTest: %s: no outgoing entity types were found\n", what);
+      nErrors++;
+   }
+   nErrors += nDiffs;
+
+   // Each NTM's template player, in order
+   nErrors += netIO->testOutput(netIO->numOutput());
+}
+
+// New DIS NTM
+static Network::Dis::Ntm* newNtm(Simulation::Player* const tp, const unsigned char c[7])
+{
+   Network::Dis::Ntm* ntm = new Network::Dis::Ntm();
+   ntm->setSlotTemplatePlayer(tp);
+   ntm->setEntityType(c[0], c[1], c[2], c[3], c[4], c[5], c[6]);
+   return ntm;
+}
+
+static int run()
+{
+   Basic::Rng rng(20071);
+   TestNetIO* netIO = new TestNetIO();
+
+   // The duplicate NTM warnings (std::cerr) and the test rigs' lookups
+   // (std::cout) are discarded; the differences are printed by this test.
+   std::streambuf* const cout = std::cout.rdbuf(0);
+   std::streambuf* const cerr = std::cerr.rdbuf(0);
+
+   // Incoming NTMs
+   for (unsigned int i = 0; i < NUM_INPUT_NTMS; i++) {
+      unsigned char c[7];
+      drawCodes(rng, c);
+      Simulation::Player* tp = newPlayer(rng);
+      Network::Dis::Ntm* ntm = newNtm(tp, c);
+      netIO->addInput(ntm);
+      ntm->unref();
+      tp->unref();
+   }
+
+   // Outgoing NTMs
+   for (unsigned int i = 0; i < NUM_OUTPUT_NTMS; i++) {
+      unsigned char c[7];
+      drawCodes(rng, c);
+      Simulation::Player* tp = newPlayer(rng);
+      Network::Dis::Ntm* ntm = newNtm(tp, c);
+      netIO->addOutput(ntm);
+      ntm->unref();
+      tp->unref();
+   }
+
+   checkInput("incoming", netIO, rng);
+   checkOutput("outgoing", netIO, rng);
+
+   // A clone
+   TestNetIO* clone = netIO->clone();
+   checkInput("cloned incoming", clone, rng);
+   checkOutput("cloned outgoing", clone, rng);
+   clone->unref();
+
+   // Add an outgoing NTM, which clears the outgoing table
+   {
+      const unsigned char c[7] = { 1, 2, 225, 1, 0, 0, 0 };
+      Simulation::Player* tp = new Simulation::Aircraft();
+      Network::Dis::Ntm* ntm = newNtm(tp, c);
+      netIO->addOutput(ntm);
+      ntm->unref();
+      tp->unref();
+   }
+   checkOutput("added outgoing", netIO, rng);
+   std::cout.rdbuf(cout);
+   std::cout.clear();
+   std::cerr.rdbuf(cerr);
+   std::cerr.clear();
+
+   netIO->unref();
+
+   if (nErrors > 0) {
+      std::printf("ntmLookupTest: FAILED, %u errors\n", nErrors);
+      return 1;
+   }
+   std::printf("ntmLookupTest: passed (%u incoming and %u outgoing NTMs)\n", NUM_INPUT_NTMS, NUM_OUTPUT_NTMS);
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int, char**)
+{
+   return Eaagles::Test::run();
+}
@@ -0,0 +1,130 @@
+//------------------------------------------------------------------------------
+// Benchmark: description file startup time, parsed versus compiled
+//
+// Writes a preprocessed description file with a pair stream of 2000 Table1
+// forms (plus line markers for an #included file) and times:
+//    lcParser()         -- the lexical generator, the parser and setSlotByName()
+//    lcCompile()        -- writing the compiled file
+//    lcLoadCompiled()   -- loading the compiled file
+//    lcParserCached()   -- the up to date check (hashing the dependencies) and
+//                          loading the compiled file
+// The preprocessor's time, which the compiled files also save, isn't included.
+//
+// Usage: parserCacheBench [ numForms ]
+//
+// Exits with a non-zero status if the compiled objects don't match.
+//------------------------------------------------------------------------------
+
+#include "openeaagles/basic/Parser.h"
+#include "openeaagles/basic/Factory.h"
+#include "openeaagles/basic/Object.h"
+#include "openeaagles/basic/support.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace Eaagles {
+namespace Test {
+
+static const char* const SRC_FILE = "parserCacheBench.tmp.epp";     // Source file
+static const char* const INC_FILE = "parserCacheBench.tmp.inc";     // #included file
+static const char* const EDL_FILE = "parserCacheBench.tmp.edl";     // Preprocessed file
+static const char* const BIN_FILE = "parserCacheBench.tmp.oecf";    // Compiled file
+
+static const unsigned int NUM_RUNS = 5;      // Timed runs of each function (best of)
+
+static std::string serialized(const Basic::Object* const obj)
+{
+   std::ostringstream sout;
+   if (obj != 0) obj->serialize(sout);
+   return sout.str();
+}
+
+static int run(const unsigned int numForms)
+{
+   {
+      std::ofstream src(SRC_FILE);
+      src << "#include \"" << INC_FILE << "\"\n";
+      std::ofstream inc(INC_FILE);
+      inc << "// breakpoints\n";
+
+      std::ofstream fout(EDL_FILE);
+      fout << "# 1 \"" << SRC_FILE << "\"\n";
+      fout << "# 1 \"" << INC_FILE << "\" 1\n";
+      fout << "# 2 \"" << SRC_FILE << "\" 2\n";
+      fout << "{\n";
+      for (unsigned int i = 0; i < numForms; i++) {
+         fout << "   table" << i << ": ( Table1 x: [ 0 10 20 30 40 50 60 70 ] data: [";
+         for (unsigned int j = 0; j < 8; j++) fout << " " << (i + j * 0.5);
+         fout << " ] )\n";
+      }
+      fout << "}\n";
+   }
+   std::remove(BIN_FILE);
+
+   double tParse = 1.0e9;
+   double tCompile = 1.0e9;
+   double tLoad = 1.0e9;
+   double tCached = 1.0e9;
+   std::string expected;
+   bool match = true;
+
+   for (unsigned int k = 0; k < NUM_RUNS; k++) {
+      int errs = 0;
+      double t0 = getComputerTime();
+      Basic::Object* obj = Basic::lcParser(EDL_FILE, Basic::Factory::createObj, &errs);
+      double t = getComputerTime() - t0;
+      if (t < tParse) tParse = t;
+      if (k == 0) expected = serialized(obj);
+      if (obj != 0) obj->unref();
+
+      t0 = getComputerTime();
+      Basic::lcCompile(EDL_FILE, BIN_FILE, Basic::Factory::createObj);
+      t = getComputerTime() - t0;
+      if (t < tCompile) tCompile = t;
+
+      t0 = getComputerTime();
+      obj = Basic::lcLoadCompiled(BIN_FILE, Basic::Factory::createObj, &errs);
+      t = getComputerTime() - t0;
+      if (t < tLoad) tLoad = t;
+      match = match && (serialized(obj) == expected);
+      if (obj != 0) obj->unref();
+
+      t0 = getComputerTime();
+      obj = Basic::lcParserCached(EDL_FILE, BIN_FILE, Basic::Factory::createObj, &errs, SRC_FILE);
+      t = getComputerTime() - t0;
+      if (t < tCached) tCached = t;
+      match = match && (serialized(obj) == expected);
+      if (obj != 0) obj->unref();
+   }
+
+   std::printf("parserCacheBench: %u forms, best of %u runs\n", numForms, NUM_RUNS);
+   std::printf("   lcParser():        %10.3f msec\n", tParse * 1.0e3);
+   std::printf("   lcCompile():       %10.3f msec\n", tCompile * 1.0e3);
+   std::printf("   lcLoadCompiled():  %10.3f msec\n", tLoad * 1.0e3);
+   std::printf("   lcParserCached():  %10.3f msec\n", tCached * 1.0e3);
+
+   std::remove(SRC_FILE);
+   std::remove(INC_FILE);
+   std::remove(EDL_FILE);
+   std::remove(BIN_FILE);
+
+   if (!match || expected.empty()) {
+      std::printf("parserCacheBench: FAILED, compiled objects differ\n");
+      return 1;
+   }
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int argc, char* argv[])
+{
+   unsigned int numForms = 2000;
+   if (argc > 1) numForms = static_cast<unsigned int>(std::atoi(argv[1]));
+   return Eaagles::Test::run(numForms);
+}
@@ -0,0 +1,146 @@
+//------------------------------------------------------------------------------
+// Test: compiled description files (lcCompile(), lcParserCached())
+//
+// Writes a small preprocessed description file, with the preprocessor's line
+// markers for its source file and for two #included files (one of which only
+// defines macros, so it has no tokens), and checks that:
+//    1) lcParserCached() parses it and writes the compiled file,
+//    2) the compiled file is then current and loads the same objects,
+//    3) changing either #included file, without touching the source file or
+//       the preprocessed file, makes the compiled file out of date,
+//    4) a recompile makes it current again.
+//
+// Exits with a non-zero status on a failure.
+//------------------------------------------------------------------------------
+
+#include "openeaagles/basic/Parser.h"
+#include "openeaagles/basic/Factory.h"
+#include "openeaagles/basic/Object.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace Eaagles {
+namespace Test {
+
+static const char* const SRC_FILE = "parserCacheTest.tmp.epp";      // Source file
+static const char* const INC_FILE = "parserCacheTest.tmp.inc";      // #included file with forms
+static const char* const DEF_FILE = "parserCacheTest.tmp.def";      // #included file with only macros
+static const char* const EDL_FILE = "parserCacheTest.tmp.edl";      // Preprocessed file
+static const char* const BIN_FILE = "parserCacheTest.tmp.oecf";     // Compiled file
+
+static unsigned int nErrors = 0;
+
+static void writeFile(const char* const name, const std::string& text)
+{
+   std::ofstream fout(name, std::ios::out | std::ios::trunc);
+   fout << text;
+}
+
+static void check(const bool ok, const char* const msg)
+{
+   if (!ok) {
+      std::printf("parserCacheTest: %s\n", msg);
+      nErrors++;
+   }
+}
+
+// The serialized form of the object (or an empty string)
+static std::string serialized(const Basic::Object* const obj)
+{
+   std::ostringstream sout;
+   if (obj != 0) obj->serialize(sout);
+   return sout.str();
+}
+
+// Parses using lcParserCached(); returns the serialized objects
+static std::string load()
+{
+   int errs = 0;
+   Basic::Object* obj = Basic::lcParserCached(EDL_FILE, BIN_FILE, Basic::Factory::createObj, &errs, SRC_FILE);
+   check(obj != 0 && errs == 0, "lcParserCached() failed");
+   const std::string s = serialized(obj);
+   if (obj != 0) obj->unref();
+   return s;
+}
+
+static int run()
+{
+   // Source files (their contents only matter to the dependency hashes)
+   writeFile(SRC_FILE, "#include \"parserCacheTest.tmp.def\"\n( Table1\n#include \"parserCacheTest.tmp.inc\"\n)\n");
+   writeFile(INC_FILE, "x: [ 1 2 3 ]\ndata: [ DATA ]\n");
+   writeFile(DEF_FILE, "#define DATA 10 20 30\n");
+
+   // The preprocessor's output
+   writeFile(EDL_FILE,
+      "# 1 \"parserCacheTest.tmp.epp\"\n"
+      "# 1 \"<built-in>\"\n"
+      "# 1 \"<command-line>\"\n"
+      "# 1 \"parserCacheTest.tmp.epp\"\n"
+      "# 1 \"parserCacheTest.tmp.def\" 1\n"
+      "# 2 \"parserCacheTest.tmp.epp\" 2\n"
+      "( Table1\n"
+      "# 1 \"parserCacheTest.tmp.inc\" 1\n"
+      "x: [ 1 2 3 ]\n"
+      "data: [ 10 20 30 ]\n"
+      "# 4 \"parserCacheTest.tmp.epp\" 2\n"
+      ")\n");
+   std::remove(BIN_FILE);
+
+   // 1) Parse and compile
+   int errs = 0;
+   Basic::Object* obj = Basic::lcParser(EDL_FILE, Basic::Factory::createObj, &errs);
+   check(obj != 0 && errs == 0, "lcParser() failed");
+   const std::string expected = serialized(obj);
+   check(expected.find("Table1") != std::string::npos, "nothing was parsed");
+   if (obj != 0) obj->unref();
+
+   check(load() == expected, "parsed objects differ");
+   check(Basic::lcIsCompiledCurrent(BIN_FILE), "compiled file isn't current after compiling");
+
+   // 2) Load the compiled file
+   obj = Basic::lcLoadCompiled(BIN_FILE, Basic::Factory::createObj, &errs);
+   check(obj != 0 && errs == 0, "lcLoadCompiled() failed");
+   check(serialized(obj) == expected, "compiled objects differ");
+   if (obj != 0) obj->unref();
+   check(load() == expected, "cached objects differ");
+
+   // 3) Change the #included files
+   writeFile(INC_FILE, "x: [ 1 2 3 ]\ndata: [ DATA 0 ]\n");
+   check(!Basic::lcIsCompiledCurrent(BIN_FILE), "compiled file is current after changing an #included file");
+   check(load() == expected, "reparsed objects differ");
+   check(Basic::lcIsCompiledCurrent(BIN_FILE), "compiled file isn't current after recompiling");
+
+   writeFile(DEF_FILE, "#define DATA 10 20 31\n");
+   check(!Basic::lcIsCompiledCurrent(BIN_FILE), "compiled file is current after changing an #included macro file");
+
+   // 4) Recompile
+   check(Basic::lcCompile(EDL_FILE, BIN_FILE, Basic::Factory::createObj), "lcCompile() failed");
+   check(Basic::lcIsCompiledCurrent(BIN_FILE), "compiled file isn't current after lcCompile()");
+
+   // A missing dependency
+   std::remove(DEF_FILE);
+   check(!Basic::lcIsCompiledCurrent(BIN_FILE), "compiled file is current after removing an #included file");
+
+   std::remove(SRC_FILE);
+   std::remove(INC_FILE);
+   std::remove(EDL_FILE);
+   std::remove(BIN_FILE);
+
+   if (nErrors > 0) {
+      std::printf("parserCacheTest: FAILED, %u errors\n", nErrors);
+      return 1;
+   }
+   std::printf("parserCacheTest: passed\n");
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int, char**)
+{
+   return Eaagles::Test::run();
+}
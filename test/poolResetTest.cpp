@@ -0,0 +1,380 @@
+//------------------------------------------------------------------------------
+// Test: recycled (pooled) objects are fully reset
+//
+// Emission, SensorMsg and IrQueryMsg objects: each field is set, the object
+// is released to a QPool while it's still referenced (in-use), recycled once
+// it's no longer referenced, and taken from the pool again; it must then match
+// a newly constructed object, and must have released its references.
+//
+// TabLogger's LogPlayerData, LogActiveTrack and LogPassiveTrack events: each
+// event is created (using its create() function), logged by a TabLogger, which
+// sets its times and recycles it, and is created again from the pool; its
+// description must then match the description of a newly constructed event
+// with the same data.  Also checks the TabLogger's 'eventPoolSize' slot and
+// that the pools are freed when the TabLogger is shutdown.
+//
+// Exits with a non-zero status if a recycled object isn't fully reset.
+//------------------------------------------------------------------------------
+
+#include "openeaagles/simulation/AirVehicle.h"
+#include "openeaagles/simulation/Antenna.h"
+#include "openeaagles/simulation/Emission.h"
+#include "openeaagles/simulation/IrQueryMsg.h"
+#include "openeaagles/simulation/IrSensor.h"
+#include "openeaagles/simulation/Radar.h"
+#include "openeaagles/simulation/TabLogger.h"
+#include "openeaagles/simulation/Track.h"
+
+#include "openeaagles/basic/Integer.h"
+#include "openeaagles/basic/String.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace Eaagles {
+namespace Test {
+
+static unsigned int nErrors = 0;
+
+static void check(const char* const what, const char* const field, const bool ok)
+{
+   if (!ok) {
+      std::printf("poolResetTest: %s: %s wasn't reset\n", what, field);
+      nErrors++;
+   }
+}
+
+template <class V> static bool same(const V& a, const V& b)  { return (a == b); }
+
+// The objects that are referenced by the messages
+struct Refs {
+   Simulation::Player* ownship;
+   Simulation::Player* target;
+   Simulation::Radar* radar;
+   Simulation::Antenna* antenna;
+   Simulation::IrSensor* irSensor;
+   Basic::Object* data;
+};
+
+// Sets each of the SensorMsg fields
+static void setSensorMsg(Simulation::SensorMsg* const msg, const Refs& refs)
+{
+   msg->setLosVec(osg::Vec3d(1, 2, 3));
+   msg->setTgtLosVec(osg::Vec3d(-1, -2, -3));
+   msg->setGimbalAzimuth(0.1f);
+   msg->setGimbalElevation(0.2f);
+   msg->setRange(5000.0f);
+   msg->setMaxRangeNM(40.0f);
+   msg->setRangeRate(-250.0f);
+   msg->setAzimuthAoi(0.3f);
+   msg->setElevationAoi(0.4f);
+   msg->setAoiVector(osg::Vec3d(4, 5, 6));
+   msg->setLocalPlayersOnly(!msg->isLocalPlayersOnly());
+   msg->setReturnRequest(!msg->isReturnRequested());
+   msg->setOwnship(refs.ownship);
+   msg->setGimbal(refs.antenna);
+   msg->setTarget(refs.target);
+   msg->setDataMessage(refs.data);
+}
+
+// Compares the SensorMsg fields with a new message
+static void checkSensorMsg(const char* const what, const Simulation::SensorMsg* const msg, const Simulation::SensorMsg* const ref)
+{
+   check(what, "losVec", same(msg->getLosVec(), ref->getLosVec()));
+   check(what, "tgtLosVec", same(msg->getTgtLosVec(), ref->getTgtLosVec()));
+   check(what, "gimbalAzimuth", msg->getGimbalAzimuth() == ref->getGimbalAzimuth());
+   check(what, "gimbalElevation", msg->getGimbalElevation() == ref->getGimbalElevation());
+   check(what, "range", msg->getRange() == ref->getRange());
+   check(what, "maxRangeNM", msg->getMaxRangeNM() == ref->getMaxRangeNM());
+   check(what, "rangeRate", msg->getRangeRate() == ref->getRangeRate());
+   check(what, "azimuthAoi", msg->getAzimuthAoi() == ref->getAzimuthAoi());
+   check(what, "elevationAoi", msg->getElevationAoi() == ref->getElevationAoi());
+   check(what, "aoiVector", same(msg->getAoiVector(), ref->getAoiVector()));
+   check(what, "localPlayersOnly", msg->isLocalPlayersOnly() == ref->isLocalPlayersOnly());
+   check(what, "returnRequest", msg->isReturnRequested() == ref->isReturnRequested());
+   check(what, "ownship", msg->getOwnship() == ref->getOwnship());
+   check(what, "gimbal", msg->getGimbal() == ref->getGimbal());
+   check(what, "target", msg->getTarget() == ref->getTarget());
+   check(what, "dataMessage", msg->getDataMessage() == ref->getDataMessage());
+}
+
+// Releases 'msg' to the pool while it's still referenced, recycles it and
+// gets it back; returns zero if the pool doesn't return the same object.
+template <class T> static T* recycle(const char* const what, Basic::Object::QPool<T>& pool, T* const msg)
+{
+   msg->ref();              // (e.g., queued by a receiver)
+   pool.release(msg);
+   pool.recycle();
+   if (pool.getNumInUse() != 1) {
+      std::printf("poolResetTest: %s: a referenced object was recycled\n", what);
+      nErrors++;
+   }
+   msg->unref();            // (the receiver is done with it)
+   pool.recycle();
+   T* p = pool.get();
+   if (p != msg) {
+      std::printf("poolResetTest: %s: the pool didn't return the recycled object\n", what);
+      nErrors++;
+      if (p != 0) p->unref();
+      p = 0;
+   }
+   return p;
+}
+
+// Checks that the references held by the messages were released
+static void checkRefs(const char* const what, const Refs& refs, const unsigned int ownRefs, const unsigned int dataRefs, const unsigned int irRefs)
+{
+   check(what, "ownship reference", refs.ownship->getRefCount() == ownRefs);
+   check(what, "data message reference", refs.data->getRefCount() == dataRefs);
+   check(what, "IR sensor reference", refs.irSensor->getRefCount() == irRefs);
+}
+
+static void testMessages(const Refs& refs)
+{
+   const unsigned int ownRefs = refs.ownship->getRefCount();
+   const unsigned int dataRefs = refs.data->getRefCount();
+   const unsigned int irRefs = refs.irSensor->getRefCount();
+
+   // SensorMsg
+   {
+      Basic::Object::QPool<Simulation::SensorMsg> pool(4);
+      Simulation::SensorMsg* ref = new Simulation::SensorMsg();
+      Simulation::SensorMsg* msg = new Simulation::SensorMsg();
+      setSensorMsg(msg, refs);
+      msg = recycle("SensorMsg", pool, msg);
+      if (msg != 0) {
+         checkSensorMsg("SensorMsg", msg, ref);
+         msg->unref();
+      }
+      ref->unref();
+   }
+   checkRefs("SensorMsg", refs, ownRefs, dataRefs, irRefs);
+
+   // Emission
+   {
+      Basic::Object::QPool<Simulation::Emission> pool(4);
+      Simulation::Emission* ref = new Simulation::Emission();
+      Simulation::Emission* em = new Simulation::Emission();
+      setSensorMsg(em, refs);
+      em->setFrequency(9.0e9f);
+      em->setBandwidth(1.0e6f);
+      em->setPulseWidth(1.0e-6f);
+      em->setPRF(1000.0f);
+      em->setPulses(8);
+      em->setPower(1000.0f);
+      em->setPolarization(Simulation::Antenna::RHC);
+      em->setGain(100.0f);
+      em->setAtmosphericAttenuationLoss(2.0f);
+      em->setTransmitLoss(3.0f);
+      em->setRCS(5.0f);
+      em->setTransmitter(refs.radar);
+      em->setECM(Simulation::Emission::ECM_NOISE);
+      em = recycle("Emission", pool, em);
+      if (em != 0) {
+         const char* const what = "Emission";
+         checkSensorMsg(what, em, ref);
+         check(what, "frequency", em->getFrequency() == ref->getFrequency());
+         check(what, "wavelength", em->getWavelength() == ref->getWavelength());
+         check(what, "bandwidth", em->getBandwidth() == ref->getBandwidth());
+         check(what, "pulseWidth", em->getPulseWidth() == ref->getPulseWidth());
+         check(what, "PRF", em->getPRF() == ref->getPRF());
+         check(what, "pulses", em->getPulses() == ref->getPulses());
+         check(what, "power", em->getPower() == ref->getPower());
+         check(what, "rangeLoss", em->getRangeLoss() == ref->getRangeLoss());
+         check(what, "polarization", em->getPolarization() == ref->getPolarization());
+         check(what, "gain", em->getGain() == ref->getGain());
+         check(what, "atmosphericAttenuationLoss", em->getAtmosphericAttenuationLoss() == ref->getAtmosphericAttenuationLoss());
+         check(what, "transmitLoss", em->getTransmitLoss() == ref->getTransmitLoss());
+         check(what, "RCS", em->getRCS() == ref->getRCS());
+         check(what, "transmitter", em->getTransmitter() == ref->getTransmitter());
+         check(what, "ECM", em->isECM() == ref->isECM());
+         em->unref();
+      }
+      ref->unref();
+   }
+   checkRefs("Emission", refs, ownRefs, dataRefs, irRefs);
+
+   // IrQueryMsg
+   {
+      Basic::Object::QPool<Simulation::IrQueryMsg> pool(4);
+      LCreal sig[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+      Simulation::IrQueryMsg* ref = new Simulation::IrQueryMsg();
+      Simulation::IrQueryMsg* msg = new Simulation::IrQueryMsg();
+      setSensorMsg(msg, refs);
+      msg->setAngleOffBoresight(0.5f);
+      msg->setAngleAspect(0.6f);
+      msg->setRelativeAzimuth(0.7f);
+      msg->setRelativeElevation(0.8f);
+      msg->setPosVec(osg::Vec3(7, 8, 9));
+      msg->setVelocityVec(osg::Vec3(10, 11, 12));
+      msg->setAccelVec(osg::Vec3(13, 14, 15));
+      msg->setLowerWavelength(3.0f);
+      msg->setUpperWavelength(5.0f);
+      msg->setInstantaneousFieldOfView(0.01f);
+      msg->setNEI(1.0e-10f);
+      msg->setSignatureAtRange(20.0f);
+      msg->setSignatureByWaveband(sig);
+      msg->setEmissivity(0.9f);
+      msg->setProjectedArea(12.0f);
+      msg->setSignalToNoiseRatio(15.0f);
+      msg->setBackgroundNoiseRatio(0.1f);
+      msg->setSendingSensor(refs.irSensor);
+      msg->setQueryMergeStatus(Simulation::IrQueryMsg::MERGED);
+      msg = recycle("IrQueryMsg", pool, msg);
+      if (msg != 0) {
+         const char* const what = "IrQueryMsg";
+         checkSensorMsg(what, msg, ref);
+         check(what, "angleOffBoresight", msg->getAngleOffBoresight() == ref->getAngleOffBoresight());
+         check(what, "angleAspect", msg->getAngleAspect() == ref->getAngleAspect());
+         check(what, "relativeAzimuth", msg->getRelativeAzimuth() == ref->getRelativeAzimuth());
+         check(what, "relativeElevation", msg->getRelativeElevation() == ref->getRelativeElevation());
+         check(what, "posVec", same(msg->getPosVec(), ref->getPosVec()));
+         check(what, "velocityVec", same(msg->getVelocityVec(), ref->getVelocityVec()));
+         check(what, "accelVec", same(msg->getAccelVec(), ref->getAccelVec()));
+         check(what, "lowerWavelength", msg->getLowerWavelength() == ref->getLowerWavelength());
+         check(what, "upperWavelength", msg->getUpperWavelength() == ref->getUpperWavelength());
+         check(what, "instantaneousFieldOfView", msg->getInstantaneousFieldOfView() == ref->getInstantaneousFieldOfView());
+         check(what, "NEI", msg->getNEI() == ref->getNEI());
+         check(what, "signatureAtRange", msg->getSignatureAtRange() == ref->getSignatureAtRange());
+         check(what, "signatureByWaveband", msg->getSignatureByWaveband() == ref->getSignatureByWaveband());
+         check(what, "emissivity", msg->getEmissivity() == ref->getEmissivity());
+         check(what, "projectedArea", msg->getProjectedArea() == ref->getProjectedArea());
+         check(what, "signalToNoiseRatio", msg->getSignalToNoiseRatio() == ref->getSignalToNoiseRatio());
+         check(what, "backgroundNoiseRatio", msg->getBackgroundNoiseRatio() == ref->getBackgroundNoiseRatio());
+         check(what, "sendingSensor", msg->getSendingSensor() == ref->getSendingSensor());
+         check(what, "queryMergeStatus", msg->getQueryMergeStatus() == ref->getQueryMergeStatus());
+         msg->unref();
+      }
+      ref->unref();
+   }
+   checkRefs("IrQueryMsg", refs, ownRefs, dataRefs, irRefs);
+}
+
+// Logs 'evt' (and our reference) with the logger, which recycles it
+static void logEvent(Simulation::TabLogger* const logger, Simulation::TabLogger::TabLogEvent* const evt)
+{
+   logger->updateTC(1.5f);          // (the logger's time)
+   logger->log(evt);
+   evt->unref();
+   logger->updateData(0.0f);        // (writes and recycles the events)
+}
+
+// Compares the description of the recycled event 'evt', which was created
+// from the same data as the new event 'ref'.
+static void checkEvent(const char* const what, Simulation::TabLogger::TabLogEvent* const evt, Simulation::TabLogger::TabLogEvent* const ref, const Basic::Object* const old)
+{
+   if (evt != old) {
+      std::printf("poolResetTest: %s: the event wasn't recycled\n", what);
+      nErrors++;
+   }
+   evt->captureData();
+   ref->captureData();
+   const char* const d1 = evt->getDescription();
+   const char* const d2 = ref->getDescription();
+   if (std::strcmp(d1, d2) != 0) {
+      std::printf("poolResetTest: %s: recycled event:\n   %s\nnew event:\n   %s\n", what, d1, d2);
+      nErrors++;
+   }
+   evt->unref();
+   ref->unref();
+}
+
+static void testLogEvents(const Refs& refs)
+{
+   typedef Simulation::TabLogger TL;
+
+   Simulation::TabLogger* logger = new Simulation::TabLogger();
+   {
+      Basic::String file("/dev/null");
+      logger->setSlotByName("file", &file);
+   }
+   Simulation::TabLogger::clearEventPools();
+
+   const unsigned int tgtRefs = refs.target->getRefCount();
+
+   // LogPlayerData: logged with a damage source (and mach set to -1)
+   TL::TabLogEvent* evt = TL::LogPlayerData::create(4, refs.target, refs.ownship);
+   const Basic::Object* old = evt;
+   logEvent(logger, evt);
+   check("LogPlayerData", "target player reference", refs.target->getRefCount() == tgtRefs);
+   checkEvent("LogPlayerData", TL::LogPlayerData::create(2, refs.ownship), new TL::LogPlayerData(2, refs.ownship), old);
+
+   // LogActiveTrack and LogPassiveTrack: logged with a track
+   Simulation::RfTrack* trk = new Simulation::RfTrack();
+   trk->setTrackID(17);
+   trk->setTarget(refs.target);
+   const unsigned int trkRefs = trk->getRefCount();
+
+   evt = TL::LogActiveTrack::create(1, 0, trk);
+   old = evt;
+   logEvent(logger, evt);
+   check("LogActiveTrack", "track reference", trk->getRefCount() == trkRefs);
+   checkEvent("LogActiveTrack", TL::LogActiveTrack::create(2, 0, 0), new TL::LogActiveTrack(2, 0, 0), old);
+
+   evt = TL::LogPassiveTrack::create(1, 0, trk);
+   old = evt;
+   logEvent(logger, evt);
+   check("LogPassiveTrack", "track reference", trk->getRefCount() == trkRefs);
+   checkEvent("LogPassiveTrack", TL::LogPassiveTrack::create(2, 0, 0), new TL::LogPassiveTrack(2, 0, 0), old);
+   trk->unref();
+
+   // The pool size slot: the events that don't fit are freed
+   {
+      Basic::Integer n(2);
+      logger->setSlotByName("eventPoolSize", &n);
+   }
+   check("TabLogger", "eventPoolSize", TL::getEventPoolSize() == 2);
+   TL::TabLogEvent* events[5];
+   for (unsigned int i = 0; i < 5; i++) events[i] = TL::LogPlayerData::create(2, refs.ownship);
+   for (unsigned int i = 0; i < 5; i++) logger->log(events[i]);
+   for (unsigned int i = 0; i < 5; i++) events[i]->unref();
+   logger->updateData(0.0f);
+   check("TabLogger", "pool size limit", TL::LogPlayerData::getPool().getNumFree() == 2);
+
+   // Shutdown frees the pools
+   logger->event(Basic::Component::SHUTDOWN_EVENT);
+   check("TabLogger", "pools at shutdown", TL::LogPlayerData::getPool().getNumFree() == 0 &&
+         TL::LogActiveTrack::getPool().getNumFree() == 0 && TL::LogPassiveTrack::getPool().getNumFree() == 0);
+   check("TabLogger", "target player reference", refs.target->getRefCount() == tgtRefs);
+   logger->unref();
+
+   TL::setEventPoolSize(1000);
+}
+
+static int run()
+{
+   Refs refs;
+   refs.ownship = new Simulation::AirVehicle();
+   refs.ownship->setID(101);
+   refs.target = new Simulation::AirVehicle();
+   refs.target->setID(102);
+   refs.radar = new Simulation::Radar();
+   refs.antenna = new Simulation::Antenna();
+   refs.irSensor = new Simulation::IrSensor();
+   refs.data = new Basic::String("data");
+
+   testMessages(refs);
+   testLogEvents(refs);
+
+   refs.ownship->unref();
+   refs.target->unref();
+   refs.radar->unref();
+   refs.antenna->unref();
+   refs.irSensor->unref();
+   refs.data->unref();
+
+   if (nErrors > 0) {
+      std::printf("poolResetTest: FAILED, %u errors\n", nErrors);
+      return 1;
+   }
+   std::printf("poolResetTest: passed\n");
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int, char**)
+{
+   return Eaagles::Test::run();
+}
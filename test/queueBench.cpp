@@ -0,0 +1,180 @@
+//------------------------------------------------------------------------------
+// Benchmark: cross-thread queues (Basic::QQueue, QSpscQueue and QMpscQueue)
+//
+// Producer threads (e.g., the T/C threads) put 200000 items on a 1024 item
+// queue, one at a time or in batches of 16, while the consumer (e.g., the
+// background thread) gets them, and the throughput is printed for:
+//    1) one producer: the locked QQueue and the lock-free QSpscQueue, and
+//    2) four producers: the locked QQueue and the lock-free QMpscQueue.
+// The producers and the consumer yield when the queue is full or empty.
+//
+// Usage: queueBench [ numItems ]
+//
+// Exits with a non-zero status if an item is lost, duplicated or out of order
+// (the items of each producer must be received in the order that they were put).
+//------------------------------------------------------------------------------
+
+#include "openeaagles/basic/Component.h"
+#include "openeaagles/basic/Thread.h"
+#include "openeaagles/basic/support.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace Eaagles {
+namespace Test {
+
+// The queues (see Basic::Object)
+typedef Basic::Object::QQueue<long> Queue;
+typedef Basic::Object::QSpscQueue<long> SpscQueue;
+typedef Basic::Object::QMpscQueue<long> MpscQueue;
+
+static const unsigned int QUEUE_SIZE = 1024;    // Size of the queues
+static const unsigned int MAX_PRODUCERS = 4;    // Max number of producers
+static const unsigned int MAX_BATCH = 16;       // Max items per putN()/getN()
+
+//------------------------------------------------------------------------------
+// Queue under test
+//------------------------------------------------------------------------------
+class BenchQueue
+{
+public:
+   virtual ~BenchQueue() {}
+   virtual unsigned int putN(const long items[], const unsigned int num) =0;
+   virtual unsigned int getN(long items[], const unsigned int max) =0;
+};
+
+template <class Q> class BenchQueueT : public BenchQueue
+{
+public:
+   BenchQueueT() : q(QUEUE_SIZE) {}
+   virtual unsigned int putN(const long items[], const unsigned int num)  { return q.putN(items, num); }
+   virtual unsigned int getN(long items[], const unsigned int max)        { return q.getN(items, max); }
+private:
+   Q q;
+};
+
+//------------------------------------------------------------------------------
+// Producer thread: puts items id, id + MAX_PRODUCERS, id + 2*MAX_PRODUCERS, ...
+//------------------------------------------------------------------------------
+class Producer : public Basic::ThreadSingleTask
+{
+   DECLARE_SUBCLASS(Producer,Basic::ThreadSingleTask)
+public:
+   Producer(Basic::Component* const parent, BenchQueue* const q, const unsigned int id, const unsigned int n, const unsigned int batch);
+private:
+   virtual unsigned long userFunc();
+
+   BenchQueue* queue;      // Our queue
+   unsigned int pid;       // Producer ID
+   unsigned int numItems;  // Number of items to put
+   unsigned int batchSize; // Items per putN()
+};
+
+IMPLEMENT_SUBCLASS(Producer,"BenchProducer")
+EMPTY_SLOTTABLE(Producer)
+EMPTY_COPYDATA(Producer)
+EMPTY_DELETEDATA(Producer)
+EMPTY_SERIALIZER(Producer)
+
+Producer::Producer(Basic::Component* const parent, BenchQueue* const q, const unsigned int id, const unsigned int n, const unsigned int batch)
+: Basic::ThreadSingleTask(parent, 0.0f), queue(q), pid(id), numItems(n), batchSize(batch)
+{
+   STANDARD_CONSTRUCTOR()
+}
+
+unsigned long Producer::userFunc()
+{
+   long items[MAX_BATCH];
+   unsigned int sent = 0;
+   while (sent < numItems) {
+      unsigned int k = (numItems - sent < batchSize ? numItems - sent : batchSize);
+      for (unsigned int j = 0; j < k; j++) {
+         items[j] = static_cast<long>((sent + j) * MAX_PRODUCERS + pid);
+      }
+      k = queue->putN(items, k);
+      if (k == 0) lcSleep(0);
+      sent += k;
+   }
+   return 0;
+}
+
+static unsigned int nErrors = 0;
+
+// Runs 'np' producers against queue 'q'; returns the items per second
+static double run1(const char* const name, BenchQueue* const q, const unsigned int np, const unsigned int numItems, const unsigned int batch)
+{
+   Basic::Component* parent = new Basic::Component();
+   Producer* producers[MAX_PRODUCERS];
+   const unsigned int n = numItems / np;
+   const double t0 = getComputerTime();
+   for (unsigned int i = 0; i < np; i++) {
+      producers[i] = new Producer(parent, q, i, n, batch);
+      producers[i]->create();
+   }
+
+   // Consume, checking each producer's sequence
+   unsigned int next[MAX_PRODUCERS];
+   for (unsigned int i = 0; i < np; i++) next[i] = 0;
+   unsigned int total = 0;
+   long items[MAX_BATCH];
+   while (total < n * np) {
+      const unsigned int k = q->getN(items, batch);
+      if (k == 0) lcSleep(0);
+      for (unsigned int j = 0; j < k; j++) {
+         const unsigned int id = static_cast<unsigned int>(items[j] % MAX_PRODUCERS);
+         const unsigned int seq = static_cast<unsigned int>(items[j] / MAX_PRODUCERS);
+         if (id >= np || seq != next[id]) {
+            if (nErrors < 10) std::printf("queueBench: %s: item %ld, expected %u from producer %u\n", name, items[j], (id < np ? next[id] : 0), id);
+            nErrors++;
+            total = n * np;
+            break;
+         }
+         next[id]++;
+         total++;
+      }
+   }
+   const double dt = getComputerTime() - t0;
+
+   for (unsigned int i = 0; i < np; i++) {
+      while (!producers[i]->isTerminated()) lcSleep(1);
+      producers[i]->unref();
+   }
+   parent->unref();
+   delete q;
+
+   const double rate = (n * np) / dt;
+   std::printf("   %-40s %12.0f items/sec\n", name, rate);
+   return rate;
+}
+
+static int run(const unsigned int numItems)
+{
+   std::printf("queueBench: %u items, queue size %u\n", numItems, QUEUE_SIZE);
+
+   run1("1 producer, QQueue, put()", new BenchQueueT<Queue>(), 1, numItems, 1);
+   run1("1 producer, QSpscQueue, put()", new BenchQueueT<SpscQueue>(), 1, numItems, 1);
+   run1("1 producer, QQueue, putN(16)", new BenchQueueT<Queue>(), 1, numItems, MAX_BATCH);
+   run1("1 producer, QSpscQueue, putN(16)", new BenchQueueT<SpscQueue>(), 1, numItems, MAX_BATCH);
+
+   run1("4 producers, QQueue, put()", new BenchQueueT<Queue>(), MAX_PRODUCERS, numItems, 1);
+   run1("4 producers, QMpscQueue, put()", new BenchQueueT<MpscQueue>(), MAX_PRODUCERS, numItems, 1);
+   run1("4 producers, QQueue, putN(16)", new BenchQueueT<Queue>(), MAX_PRODUCERS, numItems, MAX_BATCH);
+   run1("4 producers, QMpscQueue, putN(16)", new BenchQueueT<MpscQueue>(), MAX_PRODUCERS, numItems, MAX_BATCH);
+
+   if (nErrors > 0) {
+      std::printf("queueBench: FAILED, %u errors\n", nErrors);
+      return 1;
+   }
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int argc, char* argv[])
+{
+   unsigned int numItems = 200000;
+   if (argc > 1) numItems = static_cast<unsigned int>(std::atoi(argv[1]));
+   return Eaagles::Test::run(numItems);
+}
@@ -0,0 +1,140 @@
+//------------------------------------------------------------------------------
+// Test: Radar real-beam sweep aging
+//
+// The radar's sweeps are aged lazily (see Radar::ageSweeps()).  This test
+// drives a radar's sweeps with random writes, clears and aging frames, and
+// checks that the sweeps read using getSweep() -- both the copying and the
+// aging versions -- match a reference copy of the sweeps that is
+// aged eagerly, every frame, like the original code:
+//
+//    if (p > 0) { p -= aging; if (p < 0) p = 0; }
+//
+// Exits with a non-zero status on a mismatch.
+//------------------------------------------------------------------------------
+
+#include "openeaagles/simulation/Radar.h"
+
+#include "openeaagles/basic/Rng.h"
+
+#include <cmath>
+#include <cstdio>
+
+namespace Eaagles {
+namespace Test {
+
+static const unsigned int NUM_FRAMES = 2000;  // Number of aging frames
+static const LCreal AGING = 0.002f;           // Aging per frame
+static const LCreal TOLERANCE = 1.0e-4f;      // Max difference (accumulated rounding)
+
+//------------------------------------------------------------------------------
+// Radar with access to the sweep functions
+//------------------------------------------------------------------------------
+class TestRadar : public Simulation::Radar
+{
+public:
+   void clear(const unsigned int n)   { clearSweep(n); }
+   void age()                         { ageSweeps(); }
+   void add(const unsigned int n, const unsigned int irng, const LCreal p, const LCreal v) {
+      addToSweep(n, irng, p, v);
+   }
+};
+
+static unsigned int nErrors = 0;
+
+// Compares the radar's sweep 'n' with the reference sweep 'ref'
+static void compare(TestRadar* const radar, const LCreal* const ref, const unsigned int n, const unsigned int np, const unsigned int frame)
+{
+   LCreal* copy = new LCreal[np];
+   const unsigned int cnt = static_cast<const TestRadar*>(radar)->getSweep(n, copy, np);
+   if (cnt != np) {
+      std::printf("radarSweepTest: frame %u, sweep %u: copied %u of %u points\n", frame, n, cnt, np);
+      nErrors++;
+   }
+   for (unsigned int i = 0; i < cnt; i++) {
+      if (std::fabs(copy[i] - ref[i]) > TOLERANCE) {
+         std::printf("radarSweepTest: frame %u, sweep %u, point %u: copy %f, eager %f\n", frame, n, i, copy[i], ref[i]);
+         nErrors++;
+      }
+   }
+
+   // Apply the aging to the sweep itself, which should give the same values
+   const LCreal* const p = static_cast<const TestRadar*>(radar)->getSweep(n);
+   for (unsigned int i = 0; i < np; i++) {
+      if (std::fabs(p[i] - ref[i]) > TOLERANCE || p[i] != copy[i]) {
+         std::printf("radarSweepTest: frame %u, sweep %u, point %u: lazy %f, copy %f, eager %f\n", frame, n, i, p[i], copy[i], ref[i]);
+         nErrors++;
+      }
+   }
+   delete[] copy;
+}
+
+static int run()
+{
+   TestRadar* radar = new TestRadar();
+   const unsigned int ns = radar->getNumSweeps();
+   const unsigned int np = radar->getPtrsPerSweep();
+
+   LCreal* ref = new LCreal[ns * np];
+   for (unsigned int i = 0; i < ns*np; i++) ref[i] = 0;
+
+   Basic::Rng rng(4357);
+   for (unsigned int frame = 0; frame < NUM_FRAMES; frame++) {
+
+      // A few writes, including a few negative powers (which aren't aged)
+      const unsigned int nw = static_cast<unsigned int>(rng.drawHalfOpen() * 20);
+      for (unsigned int k = 0; k < nw; k++) {
+         const unsigned int n = static_cast<unsigned int>(rng.drawHalfOpen() * ns);
+         const unsigned int i = static_cast<unsigned int>(rng.drawHalfOpen() * np);
+         const LCreal p = static_cast<LCreal>(rng.drawHalfOpen() * 0.6 - 0.1);
+         radar->add(n, i, p, 100.0f);
+         ref[n*np + i] += p;
+      }
+
+      // Sometimes clear a sweep
+      if (rng.drawHalfOpen() < 0.05) {
+         const unsigned int n = static_cast<unsigned int>(rng.drawHalfOpen() * ns);
+         radar->clear(n);
+         for (unsigned int i = 0; i < np; i++) ref[n*np + i] = 0;
+      }
+
+      // Sometimes read a sweep
+      if (rng.drawHalfOpen() < 0.1) {
+         const unsigned int n = static_cast<unsigned int>(rng.drawHalfOpen() * ns);
+         compare(radar, &ref[n*np], n, np, frame);
+      }
+
+      // Age the sweeps: lazy and eager
+      radar->age();
+      for (unsigned int i = 0; i < ns*np; i++) {
+         LCreal p = ref[i];
+         if (p > 0) {
+            p -= AGING;
+            if (p < 0) p = 0;
+            ref[i] = p;
+         }
+      }
+   }
+
+   // All sweeps at the end
+   for (unsigned int n = 0; n < ns; n++) {
+      compare(radar, &ref[n*np], n, np, NUM_FRAMES);
+   }
+
+   delete[] ref;
+   radar->unref();
+
+   if (nErrors > 0) {
+      std::printf("radarSweepTest: FAILED, %u errors\n", nErrors);
+      return 1;
+   }
+   std::printf("radarSweepTest: passed (%u frames, %u x %u sweeps)\n", NUM_FRAMES, ns, np);
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int, char**)
+{
+   return Eaagles::Test::run();
+}
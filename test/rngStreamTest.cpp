@@ -0,0 +1,509 @@
+//------------------------------------------------------------------------------
+// Test: Rng counter-based streams
+//
+//    1) Known answers: Rng::philox() is checked against the Philox4x32-10
+//       known-answer vectors of the Random123 library.
+//
+//    2) Copies: a copy (clone) of an Rng that's using a counter-based stream
+//       must draw a different sequence than the original and the other copies,
+//       without changing the original's sequence; copies made in the same order
+//       must draw the same sequences, and setStream() must give a copy the
+//       (seed, stream ID) sequence.
+//
+//    3) Statistical quality: 2^20 numbers of each of several streams -- stream
+//       IDs 0 to 7, copies of stream 0 and copies of a copy -- are checked with
+//       a 256 bin chi-square test, the frequency of each bit, the lag one serial
+//       correlation and the mean and variance of drawGauss().  Pairs of streams
+//       (adjacent stream IDs, the original and its copies, and the copies) are
+//       checked for independence with a 16 x 16 bin chi-square test.  The limits
+//       are about five standard deviations, and the streams are fixed, so the
+//       results are the same from run to run.
+//
+//    4) Thread count reproducibility: 64 players, half with their own stream ID
+//       and half with copies of a template Rng, draw numbers (uniform, Gauss,
+//       exponential, Poisson and fillHalfOpen()) for 20 frames from callbacks
+//       that are run by a single-threaded pool and by pools of 1, 2, 3, 5 and 8
+//       threads, in forward and in reverse order.  Each player's numbers must
+//       be bit-identical in all runs.
+//
+// Exits with a non-zero status if a check fails.
+//------------------------------------------------------------------------------
+
+#include "openeaagles/basic/Component.h"
+#include "openeaagles/basic/Rng.h"
+#include "openeaagles/basic/ThreadPool.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace Eaagles {
+namespace Test {
+
+static const unsigned int SEED = 20260418;         // Stream seed
+static const unsigned int NUM_DRAWS = 1 << 20;     // Numbers per stream (statistical tests)
+static const unsigned int NUM_PLAYERS = 64;        // Players (reproducibility test)
+static const unsigned int NUM_FRAMES = 20;         // Frames (reproducibility test)
+static const unsigned int MAX_QUEUED = 256;        // Pool backlog
+
+// Numbers of pool threads (zero is single-threaded)
+static const int threadCounts[] = { 0, 1, 2, 3, 5, 8 };
+
+static unsigned int nErrors = 0;
+
+static void fail(const char* const what)
+{
+   std::printf("rngStreamTest: %s\n", what);
+   nErrors++;
+}
+
+//------------------------------------------------------------------------------
+// 1) Philox4x32-10 known answers
+//------------------------------------------------------------------------------
+static void testKnownAnswers()
+{
+   static const unsigned int kat[3][10] = {
+      // counter [4], key [2], result [4]
+      { 0x00000000, 0x00000000, 0x00000000, 0x00000000,  0x00000000, 0x00000000,
+        0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 },
+      { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,  0xffffffff, 0xffffffff,
+        0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd },
+      { 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344,  0xa4093822, 0x299f31d0,
+        0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 },
+   };
+
+   for (unsigned int i = 0; i < 3; i++) {
+      unsigned int out[4];
+      Basic::Rng::philox(&kat[i][0], &kat[i][4], out);
+      if (std::memcmp(out, &kat[i][6], sizeof(out)) != 0) {
+         std::printf("rngStreamTest: philox() known answer %u: %08x %08x %08x %08x\n", i, out[0], out[1], out[2], out[3]);
+         nErrors++;
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// 2) Copies
+//------------------------------------------------------------------------------
+static const unsigned int SEQ_LEN = 64;
+
+static void drawSeq(Basic::Rng* const rng, unsigned int* const v)
+{
+   for (unsigned int i = 0; i < SEQ_LEN; i++) v[i] = rng->drawInt32();
+}
+
+static bool sameSeq(const unsigned int* const a, const unsigned int* const b)
+{
+   return std::memcmp(a, b, SEQ_LEN * sizeof(unsigned int)) == 0;
+}
+
+static void testCopies()
+{
+   unsigned int ref[SEQ_LEN];
+   unsigned int seq[SEQ_LEN];
+
+   // The original's sequence, without copies
+   Basic::Rng* a = new Basic::Rng();
+   a->setStream(SEED, 7);
+   drawSeq(a, ref);
+
+   // ... is the same when copies are made of it, part way into its sequence
+   Basic::Rng* b = new Basic::Rng();
+   b->setStream(SEED, 7);
+   for (unsigned int i = 0; i < SEQ_LEN / 2; i++) seq[i] = b->drawInt32();
+   Basic::Rng* c1 = b->clone();
+   Basic::Rng* c2 = b->clone();
+   for (unsigned int i = SEQ_LEN / 2; i < SEQ_LEN; i++) seq[i] = b->drawInt32();
+   if (!sameSeq(ref, seq)) fail("copies: making copies changed the original's sequence");
+
+   // The copies draw their own sequences
+   unsigned int s1[SEQ_LEN];
+   unsigned int s2[SEQ_LEN];
+   unsigned int s3[SEQ_LEN];
+   Basic::Rng* c3 = c1->clone();      // (copy of a copy)
+   drawSeq(c1, s1);
+   drawSeq(c2, s2);
+   drawSeq(c3, s3);
+   if (!c1->isStreamEnabled() || !c2->isStreamEnabled() || !c3->isStreamEnabled()) fail("copies: a copy isn't using a counter-based stream");
+   if (c1->getStreamSeed() != SEED || c1->getStreamId() != 7) fail("copies: a copy's stream seed or ID changed");
+   if (c1->getSubstream() == 0 || c1->getSubstream() == c2->getSubstream() || c3->getSubstream() == c1->getSubstream()) {
+      fail("copies: copies have the same substream");
+   }
+   if (sameSeq(s1, ref) || sameSeq(s2, ref) || sameSeq(s3, ref) || sameSeq(s1, s2) || sameSeq(s1, s3) || sameSeq(s2, s3)) {
+      fail("copies: a copy draws the same sequence as the original or another copy");
+   }
+   // (and not just the original's sequence shifted)
+   for (unsigned int i = 1; i < SEQ_LEN; i++) {
+      if (s1[0] == ref[i] || s2[0] == ref[i]) fail("copies: a copy's first number is in the original's sequence");
+   }
+
+   // Copies made in the same order draw the same sequences
+   {
+      Basic::Rng* d = new Basic::Rng();
+      d->setStream(SEED, 7);
+      d->drawInt32();
+      Basic::Rng* d1 = d->clone();
+      Basic::Rng* d2 = d->clone();
+      Basic::Rng* d3 = d1->clone();
+      drawSeq(d1, seq);
+      if (!sameSeq(seq, s1)) fail("copies: the first copies' sequences differ");
+      drawSeq(d2, seq);
+      if (!sameSeq(seq, s2)) fail("copies: the second copies' sequences differ");
+      drawSeq(d3, seq);
+      if (!sameSeq(seq, s3)) fail("copies: the copies of copies' sequences differ");
+
+      // setStreamPosition() jumps within a copy's substream
+      d1->setStreamPosition(5);
+      if (d1->drawInt32() != s1[5]) fail("copies: setStreamPosition() in a copy");
+
+      d1->unref();
+      d2->unref();
+      d3->unref();
+      d->unref();
+   }
+
+   // setStream() gives a copy the (seed, stream ID) sequence
+   c2->setStream(SEED, 7);
+   drawSeq(c2, seq);
+   if (!sameSeq(seq, ref) || c2->getSubstream() != 0) fail("copies: setStream() of a copy");
+
+   // A copy of a copy made after setStream() is the same as a first copy
+   Basic::Rng* c4 = c2->clone();
+   drawSeq(c4, seq);
+   if (!sameSeq(seq, s1)) fail("copies: first copy after setStream() differs");
+
+   // Assignment is a copy too
+   {
+      Basic::Rng* e = new Basic::Rng();
+      e->setStream(SEED, 7);
+      Basic::Rng* f = new Basic::Rng();
+      *f = *e;
+      drawSeq(f, seq);
+      if (!sameSeq(seq, s1)) fail("copies: an assigned Rng isn't the first copy");
+      f->unref();
+      e->unref();
+   }
+
+   // Copies of an Rng that's not using a counter-based stream aren't either
+   {
+      Basic::Rng* g = new Basic::Rng();
+      Basic::Rng* h = g->clone();
+      if (h->isStreamEnabled() || h->getSubstream() != 0) fail("copies: copy of a shared Mersenne Twister Rng is using a stream");
+      h->unref();
+      g->unref();
+   }
+
+   c1->unref();
+   c2->unref();
+   c3->unref();
+   c4->unref();
+   b->unref();
+   a->unref();
+}
+
+//------------------------------------------------------------------------------
+// 3) Statistical quality
+//------------------------------------------------------------------------------
+
+// Upper limit of a chi-square with 'df' degrees of freedom (about five
+// standard deviations)
+static double chiLimit(const unsigned int df)
+{
+   return df + 5.0 * std::sqrt(2.0 * df);
+}
+
+// Single stream tests
+static void testStream(const char* const name, Basic::Rng* const rng)
+{
+   unsigned int* v = new unsigned int[NUM_DRAWS];
+   rng->fillInt32(v, NUM_DRAWS);
+
+   // 256 bin chi-square (high bits)
+   unsigned int bins[256] = { 0 };
+   for (unsigned int i = 0; i < NUM_DRAWS; i++) bins[v[i] >> 24]++;
+   const double e = NUM_DRAWS / 256.0;
+   double chi = 0;
+   for (unsigned int i = 0; i < 256; i++) chi += (bins[i] - e) * (bins[i] - e) / e;
+
+   // Frequency of each bit
+   unsigned int nBadBits = 0;
+   const double sigma = std::sqrt(static_cast<double>(NUM_DRAWS)) / 2.0;
+   for (unsigned int b = 0; b < 32; b++) {
+      unsigned int ones = 0;
+      for (unsigned int i = 0; i < NUM_DRAWS; i++) ones += ((v[i] >> b) & 1);
+      if (std::fabs(ones - NUM_DRAWS / 2.0) > 5.0 * sigma) nBadBits++;
+   }
+
+   // Lag one serial correlation
+   double sx = 0, sxx = 0, sxy = 0;
+   for (unsigned int i = 0; i < NUM_DRAWS; i++) {
+      const double x = v[i] * (1.0 / 4294967296.0) - 0.5;
+      sx += x;
+      sxx += x * x;
+      if (i > 0) sxy += x * (v[i - 1] * (1.0 / 4294967296.0) - 0.5);
+   }
+   const double mean = sx / NUM_DRAWS;
+   const double corr = (sxy / (NUM_DRAWS - 1) - mean * mean) / (sxx / NUM_DRAWS - mean * mean);
+
+   // Gauss mean and variance
+   double gs = 0, gss = 0;
+   for (unsigned int i = 0; i < NUM_DRAWS; i++) {
+      const double g = rng->drawGauss();
+      gs += g;
+      gss += g * g;
+   }
+   const double gMean = gs / NUM_DRAWS;
+   const double gVar = gss / NUM_DRAWS - gMean * gMean;
+
+   const double lim = 5.0 / std::sqrt(static_cast<double>(NUM_DRAWS));
+   if (chi > chiLimit(255) || nBadBits > 0 || std::fabs(corr) > lim || std::fabs(gMean) > lim || std::fabs(gVar - 1.0) > lim * std::sqrt(2.0)) {
+      std::printf("rngStreamTest: stream %s: chi-square %.1f (limit %.1f), %u bad bits, serial corr %.5f, gauss mean %.5f var %.5f\n",
+         name, chi, chiLimit(255), nBadBits, corr, gMean, gVar);
+      nErrors++;
+   }
+   delete[] v;
+}
+
+// Independence of two streams: 16 x 16 bin chi-square of their pairs of numbers
+static void testPair(const char* const name, Basic::Rng* const a, Basic::Rng* const b)
+{
+   a->setStreamPosition(0);
+   b->setStreamPosition(0);
+   unsigned int bins[256] = { 0 };
+   for (unsigned int i = 0; i < NUM_DRAWS; i++) {
+      const unsigned int x = a->drawInt32() >> 28;
+      const unsigned int y = b->drawInt32() >> 28;
+      bins[x * 16 + y]++;
+   }
+   const double e = NUM_DRAWS / 256.0;
+   double chi = 0;
+   for (unsigned int i = 0; i < 256; i++) chi += (bins[i] - e) * (bins[i] - e) / e;
+   if (chi > chiLimit(255)) {
+      std::printf("rngStreamTest: streams %s: pair chi-square %.1f (limit %.1f)\n", name, chi, chiLimit(255));
+      nErrors++;
+   }
+}
+
+static void testStatistics()
+{
+   static const unsigned int N_IDS = 8;
+   static const unsigned int N_COPIES = 4;
+
+   Basic::Rng* ids[N_IDS];
+   for (unsigned int i = 0; i < N_IDS; i++) {
+      ids[i] = new Basic::Rng();
+      ids[i]->setStream(SEED, i);
+   }
+   Basic::Rng* copies[N_COPIES];
+   for (unsigned int i = 0; i < N_COPIES; i++) copies[i] = ids[0]->clone();
+   Basic::Rng* copy2 = copies[0]->clone();     // (copy of a copy)
+
+   char name[64];
+   for (unsigned int i = 0; i < N_IDS; i++) {
+      std::sprintf(name, "ID %u", i);
+      testStream(name, ids[i]);
+   }
+   for (unsigned int i = 0; i < N_COPIES; i++) {
+      std::sprintf(name, "copy %u", i);
+      testStream(name, copies[i]);
+   }
+   testStream("copy of copy", copy2);
+
+   for (unsigned int i = 0; i + 1 < N_IDS; i++) {
+      std::sprintf(name, "ID %u, ID %u", i, i + 1);
+      testPair(name, ids[i], ids[i + 1]);
+   }
+   for (unsigned int i = 0; i < N_COPIES; i++) {
+      std::sprintf(name, "ID 0, copy %u", i);
+      testPair(name, ids[0], copies[i]);
+      if (i > 0) {
+         std::sprintf(name, "copy %u, copy %u", i - 1, i);
+         testPair(name, copies[i - 1], copies[i]);
+      }
+   }
+   testPair("copy 0, copy of copy", copies[0], copy2);
+
+   for (unsigned int i = 0; i < N_IDS; i++) ids[i]->unref();
+   for (unsigned int i = 0; i < N_COPIES; i++) copies[i]->unref();
+   copy2->unref();
+}
+
+//------------------------------------------------------------------------------
+// 4) Thread count reproducibility
+//------------------------------------------------------------------------------
+
+// Player: draws numbers from its own Rng and hashes them
+class Player : public Basic::Object
+{
+   DECLARE_SUBCLASS(Player,Basic::Object)
+public:
+   Player()  { STANDARD_CONSTRUCTOR() rng = 0; hash = 0; }
+
+   void setRng(Basic::Rng* const r)  { rng = r; hash = 14695981039346656037ULL; }
+   LCuint64 getHash() const          { return hash; }
+
+   // One frame of draws (the number of draws varies with the numbers drawn)
+   void frame() {
+      const int n = rng->drawUniformDisc(1, 40);
+      for (int i = 0; i < n; i++) {
+         add(rng->drawHalfOpen());
+         add(rng->drawGauss(10.0, 3.0));
+         add(rng->drawExponential(0.5));
+         add(static_cast<double>(rng->drawPoisson(4.0)));
+      }
+      double v[17];
+      rng->fillHalfOpen(v, 17);
+      for (unsigned int i = 0; i < 17; i++) add(v[i]);
+   }
+
+private:
+   // FNV-1a hash of the bits of 'x'
+   void add(const double x) {
+      unsigned char b[sizeof(double)];
+      std::memcpy(b, &x, sizeof(double));
+      for (unsigned int i = 0; i < sizeof(double); i++) {
+         hash = (hash ^ b[i]) * 1099511628211ULL;
+      }
+   }
+
+   Basic::Rng* rng;     // (not ref()'d)
+   LCuint64 hash;
+};
+
+IMPLEMENT_SUBCLASS(Player,"Player")
+EMPTY_SLOTTABLE(Player)
+EMPTY_COPYDATA(Player)
+EMPTY_DELETEDATA(Player)
+EMPTY_SERIALIZER(Player)
+
+// Pool manager: runs a frame of the player
+class FrameManager : public Basic::ThreadPoolManager
+{
+   DECLARE_SUBCLASS(FrameManager,Basic::ThreadPoolManager)
+public:
+   FrameManager()  { STANDARD_CONSTRUCTOR() }
+protected:
+   virtual void execute(Basic::Object* const, Basic::Object* cur) {
+      Player* p = static_cast<Player*>(cur);
+      if (p != 0) p->frame();
+   }
+};
+
+IMPLEMENT_SUBCLASS(FrameManager,"FrameManager")
+EMPTY_SLOTTABLE(FrameManager)
+EMPTY_COPYDATA(FrameManager)
+EMPTY_DELETEDATA(FrameManager)
+EMPTY_SERIALIZER(FrameManager)
+
+// Runs the frames with a pool of 'numThreads' threads; returns the players' hashes
+static void runFrames(const int numThreads, const bool reverse, LCuint64* const hashes)
+{
+   // The players' Rngs: the even players use their own stream IDs, and the odd
+   // players use copies of a template Rng (made in player order)
+   Basic::Rng* tmpl = new Basic::Rng();
+   tmpl->setStream(SEED, 1000);
+   Basic::Rng* rngs[NUM_PLAYERS];
+   Player* players[NUM_PLAYERS];
+   for (unsigned int i = 0; i < NUM_PLAYERS; i++) {
+      if ((i % 2) == 0) {
+         rngs[i] = new Basic::Rng();
+         rngs[i]->setStream(SEED, i + 1);
+      }
+      else {
+         rngs[i] = tmpl->clone();
+      }
+      players[i] = new Player();
+      players[i]->setRng(rngs[i]);
+   }
+
+   Basic::Component* parent = new Basic::Component();
+   FrameManager* mgr = new FrameManager();
+   Basic::ThreadPool* pool = new Basic::ThreadPool(mgr, numThreads, 0.5f, MAX_QUEUED);
+   mgr->unref();
+   pool->initialize(parent);
+
+   Basic::ThreadPoolTask* tasks[NUM_PLAYERS];
+   for (unsigned int f = 0; f < NUM_FRAMES; f++) {
+      for (unsigned int k = 0; k < NUM_PLAYERS; k++) {
+         const unsigned int i = (reverse ? (NUM_PLAYERS - 1 - k) : k);
+         tasks[k] = pool->submit(players[i]);
+         if (tasks[k] == 0) {
+            fail("reproducibility: submit() failed");
+            players[i]->frame();
+         }
+      }
+      for (unsigned int k = 0; k < NUM_PLAYERS; k++) {
+         if (tasks[k] != 0) {
+            tasks[k]->waitForCompleted();
+            tasks[k]->unref();
+         }
+      }
+   }
+
+   parent->event(Basic::Component::SHUTDOWN_EVENT);
+   pool->unref();
+   parent->unref();
+
+   for (unsigned int i = 0; i < NUM_PLAYERS; i++) {
+      hashes[i] = players[i]->getHash();
+      players[i]->unref();
+      rngs[i]->unref();
+   }
+   tmpl->unref();
+}
+
+static void testReproducibility()
+{
+   LCuint64 ref[NUM_PLAYERS];
+   LCuint64 hashes[NUM_PLAYERS];
+   runFrames(0, false, ref);
+
+   // (all of the players' numbers differ)
+   for (unsigned int i = 0; i < NUM_PLAYERS; i++) {
+      for (unsigned int j = 0; j < i; j++) {
+         if (ref[i] == ref[j]) {
+            std::printf("rngStreamTest: reproducibility: players %u and %u drew the same numbers\n", j, i);
+            nErrors++;
+         }
+      }
+   }
+
+   const unsigned int nc = sizeof(threadCounts) / sizeof(threadCounts[0]);
+   for (unsigned int ic = 0; ic < nc; ic++) {
+      for (unsigned int r = 0; r < 2; r++) {
+         runFrames(threadCounts[ic], (r == 1), hashes);
+         unsigned int nBad = 0;
+         for (unsigned int i = 0; i < NUM_PLAYERS; i++) {
+            if (hashes[i] != ref[i]) nBad++;
+         }
+         if (nBad > 0) {
+            std::printf("rngStreamTest: reproducibility: %d threads%s: %u of %u players drew different numbers\n",
+               threadCounts[ic], (r == 1 ? ", reverse order" : ""), nBad, NUM_PLAYERS);
+            nErrors++;
+         }
+      }
+   }
+}
+
+static int run()
+{
+   testKnownAnswers();
+   testCopies();
+   testStatistics();
+   testReproducibility();
+
+   if (nErrors > 0) {
+      std::printf("rngStreamTest: FAILED, %u errors\n", nErrors);
+      return 1;
+   }
+   std::printf("rngStreamTest: passed\n");
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int, char**)
+{
+   return Eaagles::Test::run();
+}
@@ -0,0 +1,124 @@
+//------------------------------------------------------------------------------
+// Benchmark: CADRG tile decoding (Maps::Rpf::TileCache)
+//
+// Decodes the tiles (the frames' subframes) of the first map boundary of the
+// CADRG data in an RPF directory (the directory with the A.TOC file):
+//    1) one at a time, using TileCache::decodeTile(), and
+//    2) by the TileCache's worker threads (with prefetch requests),
+// and prints the decode throughput of each.  The tiles that were decoded by
+// the worker threads are then read from the cache and compared with the tiles
+// from (1).
+//
+// Usage: rpfDecodeBench rpfDirectory [ numThreads [ numTiles ] ]
+//
+// Needs CADRG data; build and run with 'make bench-rpf RPF_ARGS="rpfDirectory"'.
+// Exits with a non-zero status if the data can't be loaded or the tiles differ.
+//------------------------------------------------------------------------------
+
+#include "openeaagles/maps/rpfMap/CadrgFile.h"
+#include "openeaagles/maps/rpfMap/CadrgFrame.h"
+#include "openeaagles/maps/rpfMap/CadrgTocEntry.h"
+#include "openeaagles/maps/rpfMap/TileCache.h"
+
+#include "openeaagles/basic/Component.h"
+#include "openeaagles/basic/support.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace Eaagles {
+namespace Test {
+
+static int run(const char* const dir, const int numThreads, const int maxTiles)
+{
+   Maps::Rpf::CadrgFile* file = new Maps::Rpf::CadrgFile();
+   Maps::Rpf::CadrgTocEntry* toc = 0;
+   if (file->initialize(dir)) {
+      for (int i = 0; i < file->getNumBoundaries() && toc == 0; i++) {
+         Maps::Rpf::CadrgTocEntry* e = file->entry(i);
+         if (e != 0 && e->getVertFrames() > 0 && e->getHorizFrames() > 0) toc = e;
+      }
+   }
+   if (toc == 0) {
+      std::printf("rpfDecodeBench: no CADRG data in %s\n", dir);
+      file->unref();
+      return 1;
+   }
+
+   // Tiles, in row order
+   const int rows = toc->getVertFrames() * 6;
+   const int cols = toc->getHorizFrames() * 6;
+   int numTiles = rows * cols;
+   if (numTiles > maxTiles) numTiles = maxTiles;
+
+   // 1) One at a time
+   Maps::Rpf::CadrgMap::ColorArray* ref = new Maps::Rpf::CadrgMap::ColorArray[numTiles];
+   Maps::Rpf::CadrgFrame* frame = new Maps::Rpf::CadrgFrame();
+   double t0 = getComputerTime();
+   for (int i = 0; i < numTiles; i++) {
+      Maps::Rpf::TileCache::decodeTile(toc, i / cols, i % cols, frame, ref[i]);
+   }
+   const double serialTime = getComputerTime() - t0;
+   frame->unref();
+
+   // 2) Worker threads; keep at most 32 prefetch requests queued
+   Basic::Component* parent = new Basic::Component();
+   Maps::Rpf::TileCache* cache = new Maps::Rpf::TileCache();
+   cache->setCacheSize(numTiles);
+   cache->setNumThreads(numThreads);
+   bool ok = cache->start(parent);
+   t0 = getComputerTime();
+   int next = 0;
+   while (ok && static_cast<int>(cache->getNumDecoded()) < numTiles && (getComputerTime() - t0) < 600.0) {
+      while (next < numTiles && next < static_cast<int>(cache->getNumDecoded()) + 32) {
+         cache->prefetchTile(toc, next / cols, next % cols);
+         next++;
+      }
+      lcSleep(1);
+   }
+   const double threadTime = getComputerTime() - t0;
+
+   // Compare with (1)
+   unsigned int nDiffs = 0;
+   Maps::Rpf::CadrgMap::ColorArray* tile = new Maps::Rpf::CadrgMap::ColorArray;
+   for (int i = 0; ok && i < numTiles; i++) {
+      if (!cache->getTile(toc, i / cols, i % cols, *tile) || std::memcmp(tile, &ref[i], sizeof(*tile)) != 0) {
+         nDiffs++;
+      }
+   }
+   cache->stop();
+
+   std::printf("rpfDecodeBench: %s, %d tiles (%d x %d frames)\n", dir, numTiles, toc->getVertFrames(), toc->getHorizFrames());
+   std::printf("   decodeTile():         %10.3f tiles/sec\n", numTiles / serialTime);
+   std::printf("   %d worker threads:    %10.3f tiles/sec\n", numThreads, numTiles / threadTime);
+   std::printf("   differences:          %10u tiles\n", nDiffs);
+
+   delete tile;
+   delete[] ref;
+   cache->unref();
+   parent->unref();
+   file->unref();
+
+   if (!ok || nDiffs > 0) {
+      std::printf("rpfDecodeBench: FAILED\n");
+      return 1;
+   }
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int argc, char* argv[])
+{
+   if (argc < 2) {
+      std::printf("usage: rpfDecodeBench rpfDirectory [ numThreads [ numTiles ] ]\n");
+      return 1;
+   }
+   int numThreads = 2;
+   int numTiles = 720;
+   if (argc > 2) numThreads = std::atoi(argv[2]);
+   if (argc > 3) numTiles = std::atoi(argv[3]);
+   return Eaagles::Test::run(argv[1], numThreads, numTiles);
+}
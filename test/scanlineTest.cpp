@@ -0,0 +1,219 @@
+//------------------------------------------------------------------------------
+// Test: multi-threaded Scanline scan
+//
+// With a thread pool, Scanline::scan() scans bands of scanlines in parallel
+// (see Scanline.h, notes 2 and 3).  This test renders random scenes of
+// overlapping polygons, with vertex normals and layers, into images of
+// (PolyData, norm) pixels -- single-threaded, and with pools of 1, 2, 3 and 5
+// threads -- and checks that each threaded image is pixel-identical to the
+// single-threaded image:
+//    -- the same PolyData object (the polygon table's, not a copy),
+//    -- the same norm (PolyData::getNorm(norm, x, y)), and
+//    -- callback() called exactly once for each pixel.
+// The scenes are scanned at several image sizes (including images with fewer
+// scanlines than bands) and area rotations.
+//
+// Exits with a non-zero status if an image differs.
+//------------------------------------------------------------------------------
+
+#include "openeaagles/basicGL/Polygon.h"
+#include "openeaagles/basicGL/Scanline.h"
+
+#include "openeaagles/basic/Component.h"
+#include "openeaagles/basic/Rng.h"
+#include "openeaagles/basic/ThreadPool.h"
+
+#include <cmath>
+#include <cstdio>
+
+namespace Eaagles {
+namespace Test {
+
+static const unsigned int NUM_POLYS = 200;       // Polygons per scene
+static const LCreal AREA = 100.0f;               // Scene area (+/- units)
+
+// Image sizes and area rotations
+struct View {
+   unsigned int width;
+   unsigned int height;
+   LCreal rotation;     // degrees
+};
+static const View views[] = {
+   { 640, 480, 0.0f },
+   { 333, 211, 30.0f },
+   { 97, 3, -15.0f },      // (fewer scanlines than bands)
+};
+
+// Numbers of pool threads
+static const unsigned int threadCounts[] = { 1, 2, 3, 5 };
+
+static unsigned int nErrors = 0;
+
+//------------------------------------------------------------------------------
+// Pixel of the test images
+//------------------------------------------------------------------------------
+struct Pixel {
+   const void* poly;       // PolyData passed to callback()
+   osg::Vec3 norm;         // Norm at the pixel
+   unsigned int count;     // Number of callback() calls
+};
+
+//------------------------------------------------------------------------------
+// Scanner that renders into an image
+//------------------------------------------------------------------------------
+class TestScanner : public BasicGL::Scanline
+{
+public:
+   TestScanner() : image(0) {}
+
+   void render(Pixel* const img) {
+      image = img;
+      const unsigned int n = getWidth() * getHeight();
+      for (unsigned int i = 0; i < n; i++) {
+         image[i].poly = 0;
+         image[i].norm.set(0, 0, 0);
+         image[i].count = 0;
+      }
+      scan();
+      image = 0;
+   }
+
+protected:
+   virtual void callback(const PolyData* const p, const unsigned int x, const unsigned int y) {
+      Pixel& px = image[y * getWidth() + x];
+      px.poly = p;
+      if (p != 0) p->getNorm(px.norm, static_cast<LCreal>(x), y);
+      px.count++;
+   }
+
+private:
+   Pixel* image;
+};
+
+// Random number [ lo .. hi )
+static LCreal draw(Basic::Rng& rng, const LCreal lo, const LCreal hi)
+{
+   return lo + (hi - lo) * static_cast<LCreal>(rng.drawHalfOpen());
+}
+
+// Random convex polygon (counterclockwise, on a random plane), with vertex normals
+static BasicGL::Polygon* makePolygon(Basic::Rng& rng)
+{
+   const unsigned int n = 3 + static_cast<unsigned int>(rng.drawHalfOpen() * 4);
+   const LCreal x0 = draw(rng, -AREA, AREA);
+   const LCreal y0 = draw(rng, -AREA, AREA);
+   const LCreal r = draw(rng, 5.0f, 40.0f);
+   const LCreal a = draw(rng, -0.3f, 0.3f);
+   const LCreal b = draw(rng, -0.3f, 0.3f);
+   const LCreal c = draw(rng, -50.0f, 50.0f);
+
+   osg::Vec3 v[6];
+   osg::Vec3 nv[6];
+   LCreal ang = draw(rng, 0.0f, 1.0f);
+   for (unsigned int i = 0; i < n; i++) {
+      ang += static_cast<LCreal>(6.2831853 / n) * draw(rng, 0.6f, 1.0f);
+      const LCreal x = x0 + r * std::cos(ang);
+      const LCreal y = y0 + r * std::sin(ang);
+      v[i].set(x, y, a * x + b * y + c);
+      nv[i].set(draw(rng, -0.5f, 0.5f), draw(rng, -0.5f, 0.5f), 1.0f);
+   }
+
+   BasicGL::Polygon* p = new BasicGL::Polygon();
+   p->setVertices(v, n);
+   p->setNormals(nv, n);
+   p->setLayer(static_cast<unsigned int>(rng.drawHalfOpen() * 3));
+   return p;
+}
+
+// Compares image 'img' with the single-threaded image 'ref'
+static void compare(const Pixel* const ref, const Pixel* const img, const unsigned int w, const unsigned int h, const unsigned int nt, const char* const scene)
+{
+   unsigned int nBad = 0;
+   for (unsigned int i = 0; i < w*h; i++) {
+      if (img[i].count != 1 || img[i].poly != ref[i].poly || img[i].norm != ref[i].norm) {
+         if (nBad++ < 5) {
+            std::printf("scanlineTest: %s, %ux%u, %u threads: pixel (%u, %u): poly %p, count %u; single-threaded poly %p\n",
+               scene, w, h, nt, (i % w), (i / w), img[i].poly, img[i].count, ref[i].poly);
+         }
+      }
+   }
+   nErrors += nBad;
+}
+
+static void testScene(Basic::Rng& rng, const char* const scene, const unsigned int nPolys)
+{
+   BasicGL::Polygon* polys[NUM_POLYS];
+   for (unsigned int i = 0; i < nPolys; i++) polys[i] = makePolygon(rng);
+
+   const unsigned int nv = sizeof(views) / sizeof(views[0]);
+   const unsigned int nc = sizeof(threadCounts) / sizeof(threadCounts[0]);
+   for (unsigned int iv = 0; iv < nv; iv++) {
+      const unsigned int w = views[iv].width;
+      const unsigned int h = views[iv].height;
+
+      TestScanner* scanner = new TestScanner();
+      scanner->setSize(w, h);
+      scanner->setArea(0.0f, 0.0f, 2.0f * AREA, 2.0f * AREA * h / w, views[iv].rotation);
+      for (unsigned int i = 0; i < nPolys; i++) scanner->addPolygon(polys[i]);
+
+      // Single-threaded reference image
+      Pixel* ref = new Pixel[w*h];
+      scanner->render(ref);
+      unsigned int covered = 0;
+      for (unsigned int i = 0; i < w*h; i++) {
+         if (ref[i].poly != 0) covered++;
+         if (ref[i].count != 1) nErrors++;
+      }
+
+      // Threaded images
+      Pixel* img = new Pixel[w*h];
+      for (unsigned int ic = 0; ic < nc; ic++) {
+         Basic::Component* parent = new Basic::Component();
+         Basic::ThreadPool* pool = new Basic::ThreadPool(0, threadCounts[ic]);
+         scanner->setThreadPool(pool, parent);
+         pool->unref();
+
+         scanner->render(img);
+         compare(ref, img, w, h, threadCounts[ic], scene);
+
+         // (shutdown the pool's parent, so its threads end normally)
+         parent->event(Basic::Component::SHUTDOWN_EVENT);
+         scanner->setThreadPool(0, 0);
+         parent->unref();
+      }
+
+      // And single-threaded again, after the threaded scans
+      scanner->render(img);
+      compare(ref, img, w, h, 0, scene);
+
+      std::printf("scanlineTest: %s, %ux%u: %u of %u pixels covered\n", scene, w, h, covered, w*h);
+
+      delete[] ref;
+      delete[] img;
+      scanner->unref();
+   }
+
+   for (unsigned int i = 0; i < nPolys; i++) polys[i]->unref();
+}
+
+static int run()
+{
+   Basic::Rng rng(20260418);
+   testScene(rng, "sparse", 20);
+   testScene(rng, "dense", NUM_POLYS);
+
+   if (nErrors > 0) {
+      std::printf("scanlineTest: FAILED, %u errors\n", nErrors);
+      return 1;
+   }
+   std::printf("scanlineTest: passed\n");
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int, char**)
+{
+   return Eaagles::Test::run();
+}
@@ -0,0 +1,327 @@
+//------------------------------------------------------------------------------
+// Test: SigAzEl RCS lookup grid
+//
+// A SigAzEl with a "gridTolerance" resamples its table into a fixed resolution
+// az/el grid (see SigAzEl::buildGrid()).  This test builds signatures from
+// random tables -- uniform and non-uniform breakpoints, radians and degrees,
+// az/el and el/az order, square meters and decibels -- and checks that the
+// grid's RCS is within the tolerance of the table's RCS at random angles,
+// including angles beyond the table (clamped), as note 5 of SigAzEl says:
+// the error is relative to the table's RCS, or to 0.1% of the max RCS for
+// small values.  The table's RCS is itself checked against the table's lfi().
+//
+// It also checks that getRCS() and getRCSN() use the grid, that a clone has
+// the same grid, and that the table is used (TABLE_COST) when the table
+// extrapolates or when the tolerance can't be met with MAX_GRID_POINTS.
+//
+// Exits with a non-zero status on a mismatch.
+//------------------------------------------------------------------------------
+
+#include "openeaagles/simulation/Signatures.h"
+#include "openeaagles/simulation/Emission.h"
+
+#include "openeaagles/basic/Rng.h"
+#include "openeaagles/basic/Tables.h"
+#include "openeaagles/basic/units/Angles.h"
+
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+
+namespace Eaagles {
+namespace Test {
+
+static const unsigned int NUM_SAMPLES = 20000;   // Random angles per signature
+static const unsigned int BATCH = 64;            // getRCSN() batch size
+
+//------------------------------------------------------------------------------
+// Signature with access to the grid and table lookups
+//------------------------------------------------------------------------------
+class TestSig : public Simulation::SigAzEl
+{
+public:
+   TestSig(const Basic::Table2* const t) : Simulation::SigAzEl(t) {}
+
+   LCreal table(const LCreal az, const LCreal el) const  { return computeTableRCS(az, el); }
+   LCreal grid(const LCreal az, const LCreal el) const   { return computeGridRCS(az, el); }
+};
+
+// Signature table description
+struct TableDef {
+   const char* name;
+   unsigned int nAz;       // Number of az breakpoints
+   unsigned int nEl;       // Number of el breakpoints
+   bool uniform;           // Uniform breakpoints
+   bool degrees;           // Breakpoints in degrees
+   bool swapped;           // El is the table's first independent variable
+   bool decibel;           // Data in dB
+   bool rough;             // Random data with deep nulls (else smooth lobes)
+   LCreal tol;             // Grid tolerance
+   bool gridded;           // Expect a grid (else the table is used)
+};
+
+static const TableDef tables[] = {
+   { "uniform, degrees, m^2, rough",       37, 19, true,  true,  false, false, true,  0.01f, true  },
+   { "uniform, radians, dB, rough",        25, 13, true,  false, false, true,  true,  0.01f, true  },
+   { "non-uniform, degrees, m^2",          30, 12, false, true,  false, false, false, 0.05f, true  },
+   { "non-uniform, radians, swapped",      20, 10, false, false, true,  false, false, 0.05f, true  },
+   { "non-uniform, degrees, swap, dB",     16, 9,  false, true,  true,  true,  false, 0.1f,  true  },
+   { "non-uniform, degrees, m^2, rough",   30, 12, false, true,  false, false, true,  0.05f, false },
+};
+
+static unsigned int nErrors = 0;
+
+// Random number [ lo .. hi )
+static LCreal draw(Basic::Rng& rng, const LCreal lo, const LCreal hi)
+{
+   return lo + (hi - lo) * static_cast<LCreal>(rng.drawHalfOpen());
+}
+
+// Breakpoints from 'lo' to 'hi': uniform, or with random spacing
+static void breakpoints(Basic::Rng& rng, LCreal* const bp, const unsigned int n, const LCreal lo, const LCreal hi, const bool uniform)
+{
+   LCreal sum = 0;
+   bp[0] = 0;
+   for (unsigned int i = 1; i < n; i++) {
+      sum += (uniform ? 1.0f : draw(rng, 0.2f, 2.0f));
+      bp[i] = sum;
+   }
+   for (unsigned int i = 0; i < n; i++) {
+      bp[i] = lo + (hi - lo) * bp[i] / sum;
+   }
+   bp[n-1] = hi;
+}
+
+// Builds a random table
+static Basic::Table2* makeTable(Basic::Rng& rng, const TableDef& def)
+{
+   const LCreal cc = (def.degrees ? 1.0f : static_cast<LCreal>(Basic::Angle::D2RCC));
+   LCreal* az = new LCreal[def.nAz];
+   LCreal* el = new LCreal[def.nEl];
+   breakpoints(rng, az, def.nAz, -180.0f * cc, 180.0f * cc, def.uniform);
+   breakpoints(rng, el, def.nEl, -90.0f * cc, 90.0f * cc, def.uniform);
+
+   // Data (the az/el table's data is by el, then by az): random RCS values
+   // with a few deep nulls if 'rough', else smooth lobes with a little noise
+   const unsigned int n = def.nAz * def.nEl;
+   LCreal* data = new LCreal[n];
+   const LCreal d2r = (def.degrees ? static_cast<LCreal>(Basic::Angle::D2RCC) : 1.0f);
+   for (unsigned int ie = 0; ie < def.nEl; ie++) {
+      for (unsigned int ia = 0; ia < def.nAz; ia++) {
+         LCreal r = 0;
+         if (def.rough) {
+            r = draw(rng, 0.5f, 50.0f);
+            if (rng.drawHalfOpen() < 0.05) r = 0.001f;
+         }
+         else {
+            const LCreal a = az[ia] * d2r;
+            const LCreal e = el[ie] * d2r;
+            r = (10.0f + 8.0f * std::cos(3.0f * a) * std::cos(2.0f * e)) * draw(rng, 0.99f, 1.01f);
+         }
+         const LCreal v = (def.decibel ? 10.0f * std::log10(r) : r);
+         if (def.swapped) data[ia * def.nEl + ie] = v;
+         else data[ie * def.nAz + ia] = v;
+      }
+   }
+
+   Basic::Table2* t = 0;
+   if (def.swapped) t = new Basic::Table2(data, n, el, def.nEl, az, def.nAz);
+   else t = new Basic::Table2(data, n, az, def.nAz, el, def.nEl);
+
+   delete[] az;
+   delete[] el;
+   delete[] data;
+   return t;
+}
+
+// Reference RCS: the table's lfi() by the angles (radians)
+static LCreal reference(const Basic::Table2* const t, const TableDef& def, const LCreal az, const LCreal el)
+{
+   LCreal iv1 = (def.swapped ? el : az);
+   LCreal iv2 = (def.swapped ? az : el);
+   if (def.degrees) {
+      iv1 *= static_cast<LCreal>(Basic::Angle::R2DCC);
+      iv2 *= static_cast<LCreal>(Basic::Angle::R2DCC);
+   }
+   LCreal r = t->lfi(iv1, iv2);
+   if (def.decibel) r = std::pow(10.0f, r / 10.0f);
+   return r;
+}
+
+// Max RCS of the table (at its breakpoints)
+static LCreal maxRcs(const Basic::Table2* const t, const TableDef& def)
+{
+   LCreal mx = 0;
+   const unsigned int n = t->getNumXPoints() * t->getNumYPoints();
+   for (unsigned int i = 0; i < n; i++) {
+      LCreal r = t->getDataTable()[i];
+      if (def.decibel) r = std::pow(10.0f, r / 10.0f);
+      if (std::fabs(r) > mx) mx = std::fabs(r);
+   }
+   return mx;
+}
+
+static void testTable(Basic::Rng& rng, const TableDef& def)
+{
+   Basic::Table2* t = makeTable(rng, def);
+   TestSig* sig = new TestSig(t);
+   sig->setInDegrees(def.degrees);
+   sig->setSwapOrder(def.swapped);
+   sig->setDecibel(def.decibel);
+
+   // Without a tolerance, the table is used
+   if (sig->isGridValid() || sig->getCostClass() != Simulation::RfSignature::TABLE_COST) {
+      std::printf("sigGridTest: %s: grid without a tolerance\n", def.name);
+      nErrors++;
+   }
+
+   // With the tolerance (a rough non-uniform table can't meet it, and warns)
+   std::streambuf* errBuf = std::cerr.rdbuf(0);
+   sig->setGridTolerance(def.tol);
+   std::cerr.rdbuf(errBuf);
+   std::cerr.clear();
+
+   const Simulation::RfSignature::CostClass cost = (def.gridded ? Simulation::RfSignature::GRID_COST : Simulation::RfSignature::TABLE_COST);
+   if (sig->isGridValid() != def.gridded || sig->getCostClass() != cost) {
+      std::printf("sigGridTest: %s: grid %d with a tolerance of %g; expected %d\n", def.name, sig->isGridValid(), def.tol, def.gridded);
+      nErrors++;
+      sig->unref();
+      t->unref();
+      return;
+   }
+   Simulation::SigAzEl* copy = sig->clone();
+
+   const LCreal floor = 0.001f * maxRcs(t, def);
+   const LCreal margin = 1.1f;     // Angles up to 10% beyond the table
+   Simulation::Emission* ems[BATCH];
+   for (unsigned int i = 0; i < BATCH; i++) ems[i] = new Simulation::Emission();
+   LCreal rcs[BATCH];
+
+   unsigned int nBad = 0;
+   LCreal maxErr = 0;
+   for (unsigned int k = 0; k < NUM_SAMPLES; k += BATCH) {
+      for (unsigned int i = 0; i < BATCH; i++) {
+         ems[i]->setAzimuthAoi(draw(rng, -margin, margin) * static_cast<LCreal>(PI));
+         ems[i]->setElevationAoi(draw(rng, -margin, margin) * static_cast<LCreal>(PI/2.0));
+      }
+      sig->getRCSN(const_cast<const Simulation::Emission**>(ems), rcs, BATCH);
+
+      for (unsigned int i = 0; i < BATCH; i++) {
+         const LCreal az = ems[i]->getAzimuthAoi();
+         const LCreal el = ems[i]->getElevationAoi();
+
+         // Table lookup against the table's lfi()
+         const LCreal ref = reference(t, def, az, el);
+         const LCreal tr = sig->table(az, el);
+         if (std::fabs(tr - ref) > 1.0e-5f * (std::fabs(ref) > floor ? std::fabs(ref) : floor)) {
+            if (nBad++ < 10) std::printf("sigGridTest: %s: az %f, el %f: table %g, lfi %g\n", def.name, az, el, tr, ref);
+         }
+
+         // Grid lookup within the tolerance of the table
+         LCreal expected = tr;
+         if (def.gridded) {
+            expected = sig->grid(az, el);
+            const LCreal err = std::fabs(expected - tr) / (std::fabs(tr) > floor ? std::fabs(tr) : floor);
+            if (err > maxErr) maxErr = err;
+            if (err > def.tol) {
+               if (nBad++ < 10) std::printf("sigGridTest: %s: az %f, el %f: grid %g, table %g (error %g)\n", def.name, az, el, expected, tr, err);
+            }
+         }
+
+         // getRCS(), getRCSN() and the clone use the same grid (or the table)
+         const LCreal r1 = sig->getRCS(ems[i]);
+         const LCreal r2 = copy->getRCS(ems[i]);
+         if (r1 != expected || rcs[i] != expected || r2 != expected) {
+            if (nBad++ < 10) std::printf("sigGridTest: %s: az %f, el %f: expected %g, getRCS %g, getRCSN %g, clone %g\n", def.name, az, el, expected, r1, rcs[i], r2);
+         }
+      }
+   }
+   if (nBad > 0) {
+      std::printf("sigGridTest: %s: %u mismatches\n", def.name, nBad);
+      nErrors += nBad;
+   }
+   else if (def.gridded) {
+      std::printf("sigGridTest: %s: max relative error %g (tolerance %g)\n", def.name, maxErr, def.tol);
+   }
+   else {
+      std::printf("sigGridTest: %s: table used (tolerance %g)\n", def.name, def.tol);
+   }
+
+   for (unsigned int i = 0; i < BATCH; i++) ems[i]->unref();
+   copy->unref();
+   sig->unref();
+   t->unref();
+}
+
+// The table is used when the grid can't be built
+static void testFallback(Basic::Rng& rng)
+{
+   // Extrapolating table
+   {
+      const TableDef def = { "extrapolating", 13, 7, true, false, false, false, true, 0.01f, false };
+      Basic::Table2* t = makeTable(rng, def);
+      t->setExtrapolationEnabled(true);
+      TestSig* sig = new TestSig(t);
+      sig->setGridTolerance(def.tol);
+      if (sig->isGridValid() || sig->getCostClass() != Simulation::RfSignature::TABLE_COST) {
+         std::printf("sigGridTest: grid of an extrapolating table\n");
+         nErrors++;
+      }
+      sig->unref();
+      t->unref();
+   }
+
+   // Breakpoint spacing too fine for MAX_GRID_POINTS
+   {
+      const LCreal az[] = { 0.0f, 0.00001f, 3.0f };
+      const LCreal el[] = { -1.0f, 0.0f, 1.0f };
+      const LCreal data[] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f };
+      Basic::Table2* t = new Basic::Table2(data, 9, az, 3, el, 3);
+      TestSig* sig = new TestSig(t);
+
+      std::streambuf* errBuf = std::cerr.rdbuf(0);
+      sig->setGridTolerance(0.01f);
+      std::cerr.rdbuf(errBuf);
+      std::cerr.clear();
+
+      if (sig->isGridValid() || sig->getCostClass() != Simulation::RfSignature::TABLE_COST) {
+         std::printf("sigGridTest: grid with more than MAX_GRID_POINTS points\n");
+         nErrors++;
+      }
+      Simulation::Emission* em = new Simulation::Emission();
+      em->setAzimuthAoi(0.5f);
+      em->setElevationAoi(0.25f);
+      if (sig->getRCS(em) != sig->table(0.5f, 0.25f)) {
+         std::printf("sigGridTest: getRCS() without a grid doesn't use the table\n");
+         nErrors++;
+      }
+      em->unref();
+      sig->unref();
+      t->unref();
+   }
+}
+
+static int run()
+{
+   Basic::Rng rng(8675309);
+   const unsigned int n = sizeof(tables) / sizeof(tables[0]);
+   for (unsigned int i = 0; i < n; i++) {
+      testTable(rng, tables[i]);
+   }
+   testFallback(rng);
+
+   if (nErrors > 0) {
+      std::printf("sigGridTest: FAILED, %u errors\n", nErrors);
+      return 1;
+   }
+   std::printf("sigGridTest: passed (%u tables, %u angles each)\n", n, NUM_SAMPLES);
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int, char**)
+{
+   return Eaagles::Test::run();
+}
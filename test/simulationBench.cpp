@@ -0,0 +1,73 @@
+//------------------------------------------------------------------------------
+// Benchmark: headless simulation core (Simulation::Benchmark)
+//
+// Builds a station and its simulation programmatically, with a template air
+// vehicle that has a navigation system, a radar and an RWR, and runs the
+// Benchmark component with 200 clones for 500 unpaced T/C frames.  The JSON
+// results, including the per-phase and per-subsystem breakdowns, are written
+// to the standard output.
+//
+// Usage: simulationBench [ numPlayers [ numFrames [ numTcThreads ] ] ]
+//
+// Exits with a non-zero status if the benchmark can't be run.
+//------------------------------------------------------------------------------
+
+#include "benchScenario.h"
+
+#include "openeaagles/simulation/AirVehicle.h"
+#include "openeaagles/simulation/Navigation.h"
+#include "openeaagles/simulation/Radar.h"
+#include "openeaagles/simulation/Rwr.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace Eaagles {
+namespace Test {
+
+static int run(const int numPlayers, const int numFrames, const int numTcThreads)
+{
+   // Template player
+   Simulation::AirVehicle* av = new Simulation::AirVehicle();
+   {
+      Basic::PairStream* systems = new Basic::PairStream();
+      add(systems, "nav", new Simulation::Navigation());
+      add(systems, "radar", new Simulation::Radar());
+      add(systems, "rwr", new Simulation::Rwr());
+      av->setSlotComponent(systems);
+      systems->unref();
+   }
+   Basic::PairStream* templates = new Basic::PairStream();
+   add(templates, "fighter", av);
+
+   // Station, simulation and the benchmark
+   Simulation::Station* station = newStation(numTcThreads);
+   Simulation::Benchmark* bm = newBenchmark(station, templates, numPlayers, numFrames);
+   station->unref();
+   templates->unref();
+
+   const bool ok = bm->run();
+
+   bm->getStation()->event(Basic::Component::SHUTDOWN_EVENT);
+   bm->unref();
+
+   if (!ok) {
+      std::printf("simulationBench: FAILED\n");
+      return 1;
+   }
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int argc, char* argv[])
+{
+   int numPlayers = 200;
+   int numFrames = 500;
+   int numTcThreads = 1;
+   if (argc > 1) numPlayers = std::atoi(argv[1]);
+   if (argc > 2) numFrames = std::atoi(argv[2]);
+   if (argc > 3) numTcThreads = std::atoi(argv[3]);
+   return Eaagles::Test::run(numPlayers, numFrames, numTcThreads);
+}
@@ -0,0 +1,195 @@
+//------------------------------------------------------------------------------
+// Benchmark: SymbolLoader symbol updates (BasicGL::SymbolLoader::draw())
+//
+// Headless: the loader's display has no window and there's no current GL
+// context, so the GL calls do nothing and only the loader's own work is timed.
+// A loader with 10000 lat/lon symbols (well past the default MAX_SYMBOLS, so
+// the symbol storage grows) gets 10000 position updates per frame over 100
+// frames, while a few symbols are hidden and shown again each frame (only the
+// visible symbols' positions are updated).
+// The frames are run twice:
+//    1) with the map still, except for a pan every 10 frames, so only the
+//       updated symbols' screen positions are recomputed, and
+//    2) with the map panning every frame, so all of them are (this was the
+//       cost of every frame before the screen positions were cached).
+// The mean draw() time per frame of each is printed.
+//
+// After each frame, the screen position of each visible symbol is checked
+// against the map's latLon2Earth(), earth2Aircraft() and aircraft2Screen()
+// transforms, which catches symbols that were hidden while the map moved and
+// were shown with a stale position.
+//
+// Exits with a non-zero status if a symbol's screen position is stale.
+//------------------------------------------------------------------------------
+
+#include "openeaagles/basicGL/Display.h"
+#include "openeaagles/basicGL/SymbolLoader.h"
+
+#include "openeaagles/basic/Pair.h"
+#include "openeaagles/basic/PairStream.h"
+#include "openeaagles/basic/Rng.h"
+#include "openeaagles/basic/support.h"
+
+#include <cmath>
+#include <cstdio>
+
+namespace Eaagles {
+namespace Test {
+
+static const int NUM_SYMBOLS = 10000;                // Number of symbols
+static const unsigned int NUM_FRAMES = 100;          // Number of frames
+static const unsigned int UPDATES_PER_FRAME = 10000; // Position updates per frame
+static const unsigned int HIDES_PER_FRAME = 50;      // Symbols hidden or shown per frame
+static const double REF_LAT = 35.0;               // Map reference point (degs)
+static const double REF_LON = -117.0;
+static const double AREA = 1.0;                   // Symbols' lat/lon area (+/- degs)
+
+static unsigned int nErrors = 0;
+
+// Random number [ lo .. hi )
+static double draw(Basic::Rng& rng, const double lo, const double hi)
+{
+   return lo + (hi - lo) * rng.drawHalfOpen();
+}
+
+// Checks the screen positions of the visible symbols
+static void check(BasicGL::SymbolLoader* const sl, const double* const lat, const double* const lon, const unsigned int frame)
+{
+   for (int i = 0; i < NUM_SYMBOLS; i++) {
+      const BasicGL::SlSymbol* sym = sl->getSymbol(i + 1);
+      if (sym == 0 || !sym->isVisible()) continue;
+
+      LCreal north = 0, east = 0;
+      LCreal acX = 0, acY = 0;
+      LCreal xScn = 0, yScn = 0;
+      sl->latLon2Earth(lat[i], lon[i], &north, &east);
+      sl->earth2Aircraft(north, east, &acX, &acY);
+      sl->aircraft2Screen(acX, acY, &xScn, &yScn);
+
+      if (std::fabs(sym->getScreenXPos() - xScn) > 1.0e-6 || std::fabs(sym->getScreenYPos() - yScn) > 1.0e-6) {
+         if (nErrors < 10) {
+            std::printf("symbolLoaderBench: frame %u, symbol %d: screen (%f, %f), expected (%f, %f)\n",
+               frame, (i + 1), sym->getScreenXPos(), sym->getScreenYPos(), xScn, yScn);
+         }
+         nErrors++;
+      }
+   }
+}
+
+// Runs the frames, panning the map every 'panFrames' frames; returns the
+// mean draw() time per frame (usec)
+static double runFrames(BasicGL::SymbolLoader* const sl, const unsigned int panFrames)
+{
+   Basic::Rng rng(1234);
+   double* lat = new double[NUM_SYMBOLS];
+   double* lon = new double[NUM_SYMBOLS];
+   for (int i = 0; i < NUM_SYMBOLS; i++) {
+      lat[i] = REF_LAT + draw(rng, -AREA, AREA);
+      lon[i] = REF_LON + draw(rng, -AREA, AREA);
+      sl->updateSymbolPositionLL(i + 1, lat[i], lon[i]);
+      sl->setSymbolVisible(i + 1, 0, true);
+   }
+   sl->setReferenceLatDeg(REF_LAT);
+   sl->setReferenceLonDeg(REF_LON);
+   sl->draw();
+
+   double drawTime = 0;
+   for (unsigned int frame = 0; frame < NUM_FRAMES; frame++) {
+
+      // Position updates (of visible symbols)
+      for (unsigned int k = 0; k < UPDATES_PER_FRAME; k++) {
+         int i = static_cast<int>(rng.drawHalfOpen() * NUM_SYMBOLS);
+         while (!sl->getSymbol(i + 1)->isVisible()) i = (i + 1) % NUM_SYMBOLS;
+         lat[i] += draw(rng, -0.01, 0.01);
+         lon[i] += draw(rng, -0.01, 0.01);
+         sl->updateSymbolPositionLL(i + 1, lat[i], lon[i]);
+      }
+
+      // Hide or show a few symbols
+      for (unsigned int k = 0; k < HIDES_PER_FRAME; k++) {
+         const int i = static_cast<int>(rng.drawHalfOpen() * NUM_SYMBOLS);
+         sl->setSymbolVisible(i + 1, 0, !sl->getSymbol(i + 1)->isVisible());
+      }
+
+      // Pan the map
+      if ((frame % panFrames) == 0) {
+         sl->setReferenceLatDeg(sl->getReferenceLatDeg() + 0.001);
+         sl->setReferenceLonDeg(sl->getReferenceLonDeg() - 0.001);
+         sl->setHeadingDeg(sl->getHeadingDeg() + 1.0f);
+      }
+
+      const double t0 = getComputerTime();
+      sl->draw();
+      drawTime += getComputerTime() - t0;
+
+      check(sl, lat, lon, frame);
+   }
+   delete[] lat;
+   delete[] lon;
+   return (drawTime * 1.0e6) / NUM_FRAMES;
+}
+
+static int run()
+{
+   // Loader with one symbol template
+   BasicGL::SymbolLoader* sl = new BasicGL::SymbolLoader();
+   {
+      Basic::PairStream* templates = new Basic::PairStream();
+      BasicGL::Graphic* g = new BasicGL::Graphic();
+      Basic::Pair* pair = new Basic::Pair("1", g);
+      templates->put(pair);
+      pair->unref();
+      g->unref();
+      sl->setSlotByName("templates", templates);
+      templates->unref();
+   }
+   sl->setMaxSymbols(NUM_SYMBOLS);
+   sl->setShowInRangeOnly(false);
+   sl->setRange(80.0f);
+   sl->setNorthUp(false);
+
+   // The loader's display (there's no window)
+   BasicGL::Display* display = new BasicGL::Display();
+   {
+      Basic::PairStream* comps = new Basic::PairStream();
+      Basic::Pair* pair = new Basic::Pair("loader", sl);
+      comps->put(pair);
+      pair->unref();
+      display->setSlotComponent(comps);
+      comps->unref();
+   }
+   sl->updateData(0);
+
+   for (int i = 0; i < NUM_SYMBOLS; i++) {
+      if (sl->addSymbol(1, "sym") == 0) {
+         std::printf("symbolLoaderBench: FAILED, unable to add symbol %d\n", (i + 1));
+         sl->unref();
+         display->unref();
+         return 1;
+      }
+   }
+
+   const double stillTime = runFrames(sl, 10);
+   const double panTime = runFrames(sl, 1);
+
+   std::printf("symbolLoaderBench: %d symbols, %u frames, %u updates\n", NUM_SYMBOLS, NUM_FRAMES, (NUM_FRAMES * UPDATES_PER_FRAME));
+   std::printf("   draw(), map still:   %10.3f usec/frame\n", stillTime);
+   std::printf("   draw(), map panning: %10.3f usec/frame\n", panTime);
+
+   sl->unref();
+   display->unref();
+
+   if (nErrors > 0) {
+      std::printf("symbolLoaderBench: FAILED, %u stale screen positions\n", nErrors);
+      return 1;
+   }
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int, char**)
+{
+   return Eaagles::Test::run();
+}
@@ -0,0 +1,274 @@
+//------------------------------------------------------------------------------
+// Benchmark: ThreadPool task throughput and completion latency
+//
+// Throughput: 100000 small callbacks (about a microsecond of work each) are
+// submit()'d to a pool with a backlog; when the backlog is full, the oldest
+// callback's completion handle is waited on before the next submit().  The
+// same callbacks are also run by a single-threaded pool.
+//
+// Latency: single callbacks (no work) are submit()'d and waited on, one at a
+// time, using ThreadPoolTask::waitForCompleted(), which blocks on the handle's
+// completed signal, and by polling isCompleted() with a one millisecond sleep,
+// which is how waitForCompleted() used to wait.
+//
+// Shutdown: a pool is destroyed, after its parent is shutdown, while one
+// callback is being executed and others are queued.
+//
+// Usage: threadPoolBench [ numThreads [ numTasks ] ]
+//
+// Exits with a non-zero status if a callback isn't executed once, or if a
+// completion handle isn't completed (including when the pool is destroyed).
+//------------------------------------------------------------------------------
+
+#include "openeaagles/basic/Component.h"
+#include "openeaagles/basic/ThreadPool.h"
+#include "openeaagles/basic/support.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace Eaagles {
+namespace Test {
+
+static const unsigned int MAX_QUEUED = 256;         // Backlog size
+static const unsigned int WORK = 200;               // Work per throughput callback (loops)
+static const unsigned int NUM_LATENCY = 2000;       // Latency round trips (blocking)
+static const unsigned int NUM_POLLED = 200;         // Latency round trips (polling)
+
+static unsigned int nErrors = 0;
+
+//------------------------------------------------------------------------------
+// Callback object: does 'work' loops and counts its executions
+//------------------------------------------------------------------------------
+class Work : public Basic::Object
+{
+   DECLARE_SUBCLASS(Work,Basic::Object)
+public:
+   Work()  { STANDARD_CONSTRUCTOR() work = 0; count = 0; result = 0; }
+
+   void setWork(const unsigned int n)  { work = n; }
+   unsigned int getCount() const       { return count; }
+
+   void run() {
+      double x = 1.0;
+      for (unsigned int i = 0; i < work; i++) x = x * 1.0000001 + 0.5;
+      result = x;
+      count++;
+   }
+
+private:
+   unsigned int work;
+   unsigned int count;
+   volatile double result;
+};
+
+IMPLEMENT_SUBCLASS(Work,"Work")
+EMPTY_SLOTTABLE(Work)
+EMPTY_COPYDATA(Work)
+EMPTY_DELETEDATA(Work)
+EMPTY_SERIALIZER(Work)
+
+//------------------------------------------------------------------------------
+// Pool manager: runs the callback objects
+//------------------------------------------------------------------------------
+class BenchManager : public Basic::ThreadPoolManager
+{
+   DECLARE_SUBCLASS(BenchManager,Basic::ThreadPoolManager)
+public:
+   BenchManager()  { STANDARD_CONSTRUCTOR() }
+protected:
+   virtual void execute(Basic::Object* const, Basic::Object* cur) {
+      Work* w = static_cast<Work*>(cur);
+      if (w != 0) w->run();
+   }
+};
+
+IMPLEMENT_SUBCLASS(BenchManager,"BenchManager")
+EMPTY_SLOTTABLE(BenchManager)
+EMPTY_COPYDATA(BenchManager)
+EMPTY_DELETEDATA(BenchManager)
+EMPTY_SERIALIZER(BenchManager)
+
+// New pool of 'numThreads' threads (zero for single-threaded)
+static Basic::ThreadPool* newPool(Basic::Component* const parent, const int numThreads)
+{
+   BenchManager* mgr = new BenchManager();
+   Basic::ThreadPool* pool = new Basic::ThreadPool(mgr, numThreads, 0.5f, MAX_QUEUED);
+   mgr->unref();
+   pool->initialize(parent);
+   return pool;
+}
+
+// Checks that each callback was executed once
+static void checkCounts(const char* const what, Work** const work, const unsigned int n)
+{
+   unsigned int nBad = 0;
+   for (unsigned int i = 0; i < n; i++) {
+      if (work[i]->getCount() != 1) nBad++;
+   }
+   if (nBad > 0) {
+      std::printf("threadPoolBench: %s: %u of %u callbacks weren't executed once\n", what, nBad, n);
+      nErrors++;
+   }
+}
+
+//------------------------------------------------------------------------------
+// Throughput: returns the callbacks per second
+//------------------------------------------------------------------------------
+static double throughput(const char* const what, Basic::ThreadPool* const pool, const unsigned int numTasks)
+{
+   Work** work = new Work*[numTasks];
+   for (unsigned int i = 0; i < numTasks; i++) {
+      work[i] = new Work();
+      work[i]->setWork(WORK);
+   }
+
+   // Outstanding completion handles (oldest first)
+   Basic::ThreadPoolTask** tasks = new Basic::ThreadPoolTask*[numTasks];
+   unsigned int first = 0;
+
+   const double t0 = getComputerTime();
+   for (unsigned int i = 0; i < numTasks; i++) {
+      Basic::ThreadPoolTask* task = pool->submit(work[i]);
+      while (task == 0) {
+         // Backlog is full: wait for the oldest callback
+         tasks[first]->waitForCompleted();
+         tasks[first]->unref();
+         first++;
+         task = pool->submit(work[i]);
+      }
+      tasks[i] = task;
+   }
+   for (unsigned int i = first; i < numTasks; i++) {
+      tasks[i]->waitForCompleted();
+      tasks[i]->unref();
+   }
+   const double dt = getComputerTime() - t0;
+
+   checkCounts(what, work, numTasks);
+   for (unsigned int i = 0; i < numTasks; i++) work[i]->unref();
+   delete[] work;
+   delete[] tasks;
+
+   const double rate = (dt > 0 ? numTasks / dt : 0);
+   std::printf("   %-40s %10.0f callbacks/sec (%8.3f usec/callback)\n", what, rate, (dt * 1.0e6) / numTasks);
+   return rate;
+}
+
+//------------------------------------------------------------------------------
+// Latency: submit() to completion of single callbacks
+//------------------------------------------------------------------------------
+static void latency(const char* const what, Basic::ThreadPool* const pool, const unsigned int n, const bool polling)
+{
+   Work** work = new Work*[n];
+   std::vector<double> times(n);
+   for (unsigned int i = 0; i < n; i++) {
+      work[i] = new Work();
+   }
+
+   for (unsigned int i = 0; i < n; i++) {
+      const double t0 = getComputerTime();
+      Basic::ThreadPoolTask* task = pool->submit(work[i]);
+      if (task == 0) {
+         std::printf("threadPoolBench: %s: submit() failed\n", what);
+         nErrors++;
+         break;
+      }
+      if (polling) {
+         while (!task->isCompleted()) lcSleep(1);
+      }
+      else {
+         task->waitForCompleted();
+      }
+      times[i] = getComputerTime() - t0;
+      task->unref();
+   }
+
+   checkCounts(what, work, n);
+   for (unsigned int i = 0; i < n; i++) work[i]->unref();
+   delete[] work;
+
+   double sum = 0;
+   for (unsigned int i = 0; i < n; i++) sum += times[i];
+   std::sort(times.begin(), times.end());
+   std::printf("   %-40s mean %9.1f, median %9.1f, 99%% %9.1f usec\n", what,
+      (sum * 1.0e6) / n, times[n / 2] * 1.0e6, times[(n * 99) / 100] * 1.0e6);
+}
+
+//------------------------------------------------------------------------------
+// Shutdown: the pool's callbacks are completed when it's destroyed
+//------------------------------------------------------------------------------
+static void shutdown()
+{
+   static const unsigned int N = 8;
+   Basic::Component* parent = new Basic::Component();
+   Basic::ThreadPool* pool = newPool(parent, 1);
+
+   Work* work[N];
+   Basic::ThreadPoolTask* tasks[N];
+   for (unsigned int i = 0; i < N; i++) {
+      work[i] = new Work();
+      work[i]->setWork(i == 0 ? 20000000 : WORK);    // (the first takes a while)
+      tasks[i] = pool->submit(work[i]);
+   }
+
+   parent->event(Basic::Component::SHUTDOWN_EVENT);
+   pool->unref();       // (destroys the pool)
+
+   for (unsigned int i = 0; i < N; i++) {
+      if (tasks[i] == 0 || !tasks[i]->isCompleted()) {
+         std::printf("threadPoolBench: shutdown: callback %u wasn't completed\n", i);
+         nErrors++;
+      }
+      if (tasks[i] != 0) {
+         tasks[i]->waitForCompleted();     // (returns at once)
+         tasks[i]->unref();
+      }
+      work[i]->unref();
+   }
+   parent->unref();
+}
+
+static int run(const int numThreads, const unsigned int numTasks)
+{
+   Basic::Component* parent = new Basic::Component();
+   Basic::ThreadPool* pool = newPool(parent, numThreads);
+   Basic::ThreadPool* single = newPool(parent, 0);
+
+   std::printf("threadPoolBench: %u threads, backlog %u\n", pool->getNumThreads(), MAX_QUEUED);
+   std::printf("Throughput (%u callbacks):\n", numTasks);
+   const double r1 = throughput("single-threaded:", single, numTasks);
+   const double rn = throughput("thread pool:", pool, numTasks);
+   if (r1 > 0) std::printf("   %-40s %10.2f\n", "speedup:", rn / r1);
+
+   std::printf("Latency (submit() to completion):\n");
+   latency("waitForCompleted() (signal):", pool, NUM_LATENCY, false);
+   latency("isCompleted() and lcSleep(1) (polled):", pool, NUM_POLLED, true);
+
+   parent->event(Basic::Component::SHUTDOWN_EVENT);
+   pool->unref();
+   single->unref();
+   parent->unref();
+
+   shutdown();
+
+   if (nErrors > 0) {
+      std::printf("threadPoolBench: FAILED, %u errors\n", nErrors);
+      return 1;
+   }
+   return 0;
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int argc, char* argv[])
+{
+   int numThreads = 2;
+   unsigned int numTasks = 100000;
+   if (argc > 1) numThreads = std::atoi(argv[1]);
+   if (argc > 2) numTasks = static_cast<unsigned int>(std::atoi(argv[2]));
+   return Eaagles::Test::run(numThreads, numTasks);
+}
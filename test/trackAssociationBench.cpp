@@ -0,0 +1,226 @@
+//------------------------------------------------------------------------------
+// Benchmark: TrackManager report-to-track association
+//
+// Times the gated association (TrackManager::associateReports()) and the
+// batched alpha-beta update (smoothAndPredictTracks()) of an AirTrkMgr with
+// 500 tracks and 1000 reports per scan.  One report per scan is the noisy
+// position of each track's target, and the rest are random clutter reports.
+// The targets have closure rates up to 1200 m/s, so the range gate is
+// checked against the predicted track positions at speed.
+//
+// The track and report limits are the EAAGLES_CONFIG_MAX_TRACKS and
+// EAAGLES_CONFIG_MAX_REPORTS options (see openeaagles/config.h); with the
+// default limits, the benchmark is run at those limits instead.  Build the
+// libraries and this benchmark with, for example,
+//    CPPFLAGS += -DEAAGLES_CONFIG_MAX_TRACKS=500 -DEAAGLES_CONFIG_MAX_REPORTS=1000
+// to run the full size benchmark.
+//
+// Exits with a non-zero status if less than 99% of the target reports are
+// associated with their own tracks.
+//------------------------------------------------------------------------------
+
+#include "openeaagles/simulation/TrackManager.h"
+#include "openeaagles/simulation/Track.h"
+
+#include "openeaagles/basic/Float.h"
+#include "openeaagles/basic/Rng.h"
+#include "openeaagles/basic/support.h"
+
+#include <cmath>
+#include <cstdio>
+
+namespace Eaagles {
+namespace Test {
+
+static const unsigned int NUM_TRACKS = 500;     // Requested number of tracks
+static const unsigned int NUM_REPORTS = 1000;   // Requested number of reports per scan
+static const unsigned int NUM_SCANS = 50;       // Number of measured scans
+static const LCreal SCAN_TIME = 2.0f;           // Time between scans (sec)
+static const LCreal NOISE = 30.0f;              // Report position noise (meters)
+
+//------------------------------------------------------------------------------
+// Track manager with access to the association stage
+//------------------------------------------------------------------------------
+class BenchTrkMgr : public Simulation::AirTrkMgr
+{
+public:
+   BenchTrkMgr() {
+      Basic::Float vg(50.0f);
+      setVelocityGate(&vg);
+      alpha = 0.5f;
+      beta = 0.2f;
+   }
+
+   static unsigned int maxTracks()   { return MAX_TRKS; }
+   static unsigned int maxReports()  { return MAX_REPORTS; }
+
+   Simulation::Track* track(const unsigned int i)  { return tracks[i]; }
+   int trackOf(const unsigned int ir) const        { return report2Track[ir]; }
+   int reportOf(const unsigned int it) const       { return track2Report[it]; }
+
+   void predict(const LCreal dt)  { makeMatrixA(dt); }
+
+   unsigned int associate(const osg::Vec3 pos[], const LCreal rdot[], const unsigned int n) {
+      return associateReports(pos, rdot, n, posGate, rngGate, velGate);
+   }
+
+   void smooth(const osg::Vec3 u[], const LCreal age[], const bool haveU[]) {
+      smoothAndPredictTracks(u, age, haveU, posGate);
+   }
+};
+
+// Random number [ lo .. hi )
+static LCreal draw(Basic::Rng& rng, const LCreal lo, const LCreal hi)
+{
+   return lo + (hi - lo) * static_cast<LCreal>(rng.drawHalfOpen());
+}
+
+// Range rate of position 'p' with velocity 'v'
+static LCreal rangeRate(const osg::Vec3& p, const osg::Vec3& v)
+{
+   return (p * v) / p.length();
+}
+
+static int run()
+{
+   // Sizes (limited by the config options, with at least as many clutter reports as tracks)
+   unsigned int nr = NUM_REPORTS;
+   if (nr > BenchTrkMgr::maxReports()) nr = BenchTrkMgr::maxReports();
+   unsigned int nt = NUM_TRACKS;
+   if (nt > BenchTrkMgr::maxTracks()) nt = BenchTrkMgr::maxTracks();
+   if (nt > nr/2) nt = nr/2;
+
+   Basic::Rng rng(12345);
+
+   // Targets: 80 to 150 km from ownship, 150 to 600 m/s radial velocity
+   osg::Vec3* tgtPos = new osg::Vec3[nt];
+   osg::Vec3* tgtVel = new osg::Vec3[nt];
+   for (unsigned int i = 0; i < nt; i++) {
+      const LCreal az = draw(rng, 0.0f, static_cast<LCreal>(TWO_PI));
+      const LCreal rng0 = draw(rng, 80000.0f, 150000.0f);
+      const osg::Vec3 los( std::cos(az), std::sin(az), 0.0f );
+      tgtPos[i] = los * rng0 + osg::Vec3(0, 0, draw(rng, -9000.0f, -1000.0f));
+      const LCreal sign = (i % 2 == 0 ? -1.0f : 1.0f);
+      tgtVel[i] = los * (sign * draw(rng, 150.0f, 600.0f)) + osg::Vec3(-los.y(), los.x(), 0.0f) * draw(rng, -50.0f, 50.0f);
+   }
+
+   // Tracks, initialized at their targets
+   BenchTrkMgr* mgr = new BenchTrkMgr();
+   mgr->predict(SCAN_TIME);
+   for (unsigned int i = 0; i < nt; i++) {
+      Simulation::RfTrack* trk = new Simulation::RfTrack();
+      trk->setTrackID(i + 1);
+      trk->setPosition(tgtPos[i]);
+      trk->setVelocity(tgtVel[i]);
+      trk->setRangeRate(rangeRate(tgtPos[i], tgtVel[i]));
+      mgr->addTrack(trk);
+      trk->unref();
+   }
+
+   osg::Vec3* rptPos = new osg::Vec3[nr];
+   LCreal* rptRdot = new LCreal[nr];
+   int* rptTgt = new int[nr];
+   osg::Vec3* u = new osg::Vec3[nt];
+   LCreal* age = new LCreal[nt];
+   bool* haveU = new bool[nt];
+
+   double assocTime = 0;
+   double smoothTime = 0;
+   unsigned int nCorrect = 0;
+   unsigned int nTotal = 0;
+
+   // Predict the tracks to the time of the first scan
+   for (unsigned int it = 0; it < nt; it++) {
+      haveU[it] = false;
+      age[it] = 0;
+   }
+   mgr->smooth(u, age, haveU);
+
+   for (unsigned int scan = 0; scan < NUM_SCANS; scan++) {
+
+      // Age the tracks (they've been predicted to the time of this scan)
+      for (unsigned int it = 0; it < nt; it++) {
+         haveU[it] = false;
+         u[it].set(0,0,0);
+         age[it] = 0;
+         mgr->track(it)->updateTrackAge(SCAN_TIME);
+      }
+
+      // Move the targets and build the scan's reports (in a random order)
+      for (unsigned int i = 0; i < nt; i++) tgtPos[i] += tgtVel[i] * SCAN_TIME;
+      for (unsigned int ir = 0; ir < nr; ir++) rptTgt[ir] = (ir < nt ? static_cast<int>(ir) : -1);
+      for (unsigned int ir = nr - 1; ir > 0; ir--) {
+         const unsigned int k = static_cast<unsigned int>(rng.drawHalfOpen() * (ir + 1));
+         const int tmp = rptTgt[ir];
+         rptTgt[ir] = rptTgt[k];
+         rptTgt[k] = tmp;
+      }
+      for (unsigned int ir = 0; ir < nr; ir++) {
+         const int t = rptTgt[ir];
+         if (t >= 0) {
+            const osg::Vec3 noise( draw(rng, -NOISE, NOISE), draw(rng, -NOISE, NOISE), draw(rng, -NOISE, NOISE) );
+            rptPos[ir] = tgtPos[t] + noise;
+            rptRdot[ir] = rangeRate(tgtPos[t], tgtVel[t]);
+         }
+         else {
+            rptPos[ir].set( draw(rng, -150000.0f, 150000.0f), draw(rng, -150000.0f, 150000.0f), draw(rng, -9000.0f, -1000.0f) );
+            rptRdot[ir] = draw(rng, -600.0f, 600.0f);
+         }
+      }
+
+      // Associate
+      double t0 = getComputerTime();
+      mgr->associate(rptPos, rptRdot, nr);
+      assocTime += getComputerTime() - t0;
+
+      // Score: target reports that were associated with their own track
+      for (unsigned int ir = 0; ir < nr; ir++) {
+         if (rptTgt[ir] >= 0) {
+            if (mgr->trackOf(ir) == rptTgt[ir]) nCorrect++;
+            nTotal++;
+         }
+      }
+
+      // Update the tracks with their associated reports
+      for (unsigned int it = 0; it < nt; it++) {
+         const int ir = mgr->reportOf(it);
+         if (ir >= 0) {
+            Simulation::Track* trk = mgr->track(it);
+            trk->setRangeRate(rptRdot[ir]);
+            u[it] = rptPos[ir] - trk->getPosition();
+            age[it] = trk->getTrackAge();
+            trk->resetTrackAge();
+            haveU[it] = true;
+         }
+      }
+      t0 = getComputerTime();
+      mgr->smooth(u, age, haveU);
+      smoothTime += getComputerTime() - t0;
+   }
+
+   const double pct = (nTotal > 0 ? (100.0 * nCorrect) / nTotal : 0.0);
+   std::printf("trackAssociationBench: %u tracks, %u reports per scan, %u scans\n", nt, nr, NUM_SCANS);
+   std::printf("   associateReports():       %10.3f usec/scan\n", (assocTime * 1.0e6) / NUM_SCANS);
+   std::printf("   smoothAndPredictTracks(): %10.3f usec/scan\n", (smoothTime * 1.0e6) / NUM_SCANS);
+   std::printf("   correct associations:     %10.3f %%\n", pct);
+
+   mgr->unref();
+   delete[] tgtPos;
+   delete[] tgtVel;
+   delete[] rptPos;
+   delete[] rptRdot;
+   delete[] rptTgt;
+   delete[] u;
+   delete[] age;
+   delete[] haveU;
+
+   return (pct >= 99.0 ? 0 : 1);
+}
+
+} // End Test namespace
+} // End Eaagles namespace
+
+int main(int, char**)
+{
+   return Eaagles::Test::run();
+}